@@ -26,6 +26,10 @@
 
 #define READDIRBUF_SIZE (sizeof(struct dirent) + GF_NAME_MAX + 1)
 
+/* caller buffers sent without a copy, per write (rpc messages carry up to
+   MAX_IOVEC vectors including the headers) */
+#define GLFS_IO_ZC_MAX_IOVCNT 8
+
 int
 glfs_loc_link (loc_t *loc, struct iatt *iatt)
 {
@@ -473,6 +477,86 @@ pub_glfs_lseek (struct glfs_fd *glfd, off_t offset, int whence)
 GFAPI_SYMVER_PUBLIC_DEFAULT(glfs_lseek, 3.4.0);
 
 
+/* Registers a single caller buffer as the destination of a read, so that
+ * the protocol client has the reply payload received straight into it.
+ * Returns the xdata to wind the read with, or NULL to read into iobufs.
+ */
+static dict_t *
+glfs_read_dest_xdata (struct glfs *fs, struct iobuf_read_dest *dest,
+		      const struct iovec *iovec, int iovcnt, off_t offset)
+{
+	dict_t        *xdata = NULL;
+	struct iobuf  *iobuf = NULL;
+
+	if (iovcnt != 1 || !iovec[0].iov_len)
+		return NULL;
+
+	iobuf = iobuf_get_external (fs->ctx->iobuf_pool, iovec[0].iov_base);
+	if (!iobuf)
+		goto err;
+
+	dest->iobref = iobref_new ();
+	if (!dest->iobref)
+		goto err;
+
+	if (iobref_add (dest->iobref, iobuf))
+		goto err;
+	iobuf_unref (iobuf);
+	iobuf = NULL;
+
+	dest->vector = iovec[0];
+	dest->offset = offset;
+	dest->claimed = 0;
+
+	xdata = dict_new ();
+	if (!xdata)
+		goto err;
+
+	if (dict_set_static_ptr (xdata, GF_READ_DEST_KEY, dest))
+		goto err;
+
+	return xdata;
+err:
+	if (xdata)
+		dict_unref (xdata);
+	if (iobuf)
+		iobuf_unref (iobuf);
+	if (dest->iobref) {
+		iobref_unref (dest->iobref);
+		dest->iobref = NULL;
+	}
+
+	return NULL;
+}
+
+
+static void
+glfs_read_dest_release (struct iobuf_read_dest *dest, dict_t *xdata)
+{
+	if (xdata)
+		dict_unref (xdata);
+	if (dest->iobref) {
+		iobref_unref (dest->iobref);
+		dest->iobref = NULL;
+	}
+}
+
+
+/* Copies the reply into the caller's vector, unless it was already
+ * received in place. */
+static ssize_t
+glfs_read_dest_copy (struct iobuf_read_dest *dest, const struct iovec *iovec,
+		     int iovcnt, struct iovec *iov, int cnt)
+{
+	if (dest->claimed && cnt == 1 &&
+	    iov[0].iov_base == iovec[0].iov_base &&
+	    iov[0].iov_len <= iovec[0].iov_len)
+		return iov[0].iov_len;
+
+	return iov_copy (iovec, iovcnt, iov, cnt);
+}
+
+
 ssize_t
 pub_glfs_preadv (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
                  off_t offset, int flags)
@@ -484,6 +568,8 @@ pub_glfs_preadv (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
 	int             cnt = 0;
 	struct iobref  *iobref = NULL;
 	fd_t           *fd = NULL;
+	dict_t         *xdata = NULL;
+	struct iobuf_read_dest dest = {0, };
 
 	__glfs_entry_fd (glfd);
 
@@ -503,13 +589,15 @@ pub_glfs_preadv (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
 
 	size = iov_length (iovec, iovcnt);
 
+	xdata = glfs_read_dest_xdata (glfd->fs, &dest, iovec, iovcnt, offset);
+
 	ret = syncop_readv (subvol, fd, size, offset, 0, &iov, &cnt, &iobref,
-                            NULL, NULL);
+                            xdata, NULL);
         DECODE_SYNCOP_ERR (ret);
 	if (ret <= 0)
 		goto out;
 
-	size = iov_copy (iovec, iovcnt, iov, cnt); /* FIXME!!! */
+	size = glfs_read_dest_copy (&dest, iovec, iovcnt, iov, cnt);
 
 	glfd->offset = (offset + size);
 
@@ -520,6 +608,8 @@ out:
         if (iobref)
                 iobref_unref (iobref);
 
+	glfs_read_dest_release (&dest, xdata);
+
 	if (fd)
 		fd_unref (fd);
 
@@ -589,6 +679,8 @@ struct glfs_io {
 	int                  flags;
 	glfs_io_cbk          fn;
 	void                *data;
+	dict_t              *xdata;
+	struct iobuf_read_dest dest;
 };
 
 
@@ -676,13 +768,15 @@ glfs_preadv_async_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 	if (op_ret <= 0)
 		goto out;
 
-	op_ret = iov_copy (gio->iov, gio->count, iovec, count);
+	op_ret = glfs_read_dest_copy (&gio->dest, gio->iov, gio->count,
+				      iovec, count);
 
 	glfd->offset = gio->offset + op_ret;
 out:
 	errno = op_errno;
 	gio->fn (gio->glfd, op_ret, gio->data);
 
+	glfs_read_dest_release (&gio->dest, gio->xdata);
 	GF_FREE (gio->iov);
 	GF_FREE (gio);
 	STACK_DESTROY (frame->root);
@@ -751,11 +845,16 @@ pub_glfs_preadv_async (struct glfs_fd *glfd, const struct iovec *iovec,
 	gio->fn     = fn;
 	gio->data   = data;
 
+	/* the vector is the caller's own, the buffers it points to stay
+	   valid until the callback */
+	gio->xdata = glfs_read_dest_xdata (fs, &gio->dest, gio->iov, count,
+					   offset);
+
 	frame->local = gio;
 
 	STACK_WIND_COOKIE (frame, glfs_preadv_async_cbk, subvol, subvol,
 			   subvol->fops->readv, fd, iov_length (iovec, count),
-			   offset, flags, NULL);
+			   offset, flags, gio->xdata);
 
 out:
         if (ret) {
@@ -828,6 +927,44 @@ pub_glfs_readv_async (struct glfs_fd *glfd, const struct iovec *iov, int count,
 GFAPI_SYMVER_PUBLIC_DEFAULT(glfs_readv_async, 3.4.0);
 
 
+/* Wraps the caller's buffers in external iobufs, so that a write is sent
+ * from them directly. Translators that keep the data after unwinding the
+ * write (write-behind) copy external buffers themselves.
+ */
+static struct iobref *
+glfs_iobref_from_user (struct glfs *fs, const struct iovec *iovec, int iovcnt)
+{
+	struct iobref  *iobref = NULL;
+	struct iobuf   *iobuf = NULL;
+	int             i = 0;
+
+	/* the whole vector has to fit in a single rpc message */
+	if (iovcnt > GLFS_IO_ZC_MAX_IOVCNT)
+		return NULL;
+
+	iobref = iobref_new ();
+	if (!iobref)
+		return NULL;
+
+	for (i = 0; i < iovcnt; i++) {
+		if (!iovec[i].iov_len)
+			continue;
+
+		iobuf = iobuf_get_external (fs->ctx->iobuf_pool,
+					    iovec[i].iov_base);
+		if (!iobuf || iobref_add (iobref, iobuf)) {
+			if (iobuf)
+				iobuf_unref (iobuf);
+			iobref_unref (iobref);
+			return NULL;
+		}
+		iobuf_unref (iobuf);
+	}
+
+	return iobref;
+}
+
+
 ssize_t
 pub_glfs_pwritev (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
                   off_t offset, int flags)
@@ -858,6 +995,16 @@ pub_glfs_pwritev (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
 
 	size = iov_length (iovec, iovcnt);
 
+	iobref = glfs_iobref_from_user (glfd->fs, iovec, iovcnt);
+	if (iobref) {
+		ret = syncop_writev (subvol, fd, iovec, iovcnt, offset, iobref,
+				     flags, NULL, NULL);
+		DECODE_SYNCOP_ERR (ret);
+
+		iobref_unref (iobref);
+		goto done;
+	}
+
 	iobuf = iobuf_get2 (subvol->ctx->iobuf_pool, size);
 	if (!iobuf) {
 		ret = -1;
@@ -882,7 +1029,7 @@ pub_glfs_pwritev (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
 		goto out;
 	}
 
-	iov_unload (iobuf_ptr (iobuf), iovec, iovcnt);  /* FIXME!!! */
+	iov_unload (iobuf_ptr (iobuf), iovec, iovcnt);
 
 	iov.iov_base = iobuf_ptr (iobuf);
 	iov.iov_len = size;
@@ -894,6 +1041,7 @@ pub_glfs_pwritev (struct glfs_fd *glfd, const struct iovec *iovec, int iovcnt,
 	iobuf_unref (iobuf);
 	iobref_unref (iobref);
 
+done:
 	if (ret <= 0)
 		goto out;
 
@@ -1328,6 +1328,7 @@ gf_cli_print_rebalance_status (dict_t *dict, enum gf_task_types task_type)
         double             elapsed      = 0;
         char               *status_str  = NULL;
         char               *size_str    = NULL;
+        char               *workers     = NULL;
 
         ret = dict_get_int32 (dict, "count", &count);
         if (ret) {
@@ -1435,6 +1436,28 @@ gf_cli_print_rebalance_status (dict_t *dict, enum gf_task_types task_type)
                 }
                 GF_FREE(size_str);
         }
+
+        /* throughput of the migration workers of each node */
+        for (i = 1; i <= count; i++) {
+                node_name = NULL;
+                workers = NULL;
+
+                memset (key, 0, 256);
+                snprintf (key, 256, "workers-%d", i);
+                ret = dict_get_str (dict, key, &workers);
+                if (ret)
+                        continue;
+
+                memset (key, 0, 256);
+                snprintf (key, 256, "node-name-%d", i);
+                ret = dict_get_str (dict, key, &node_name);
+                if (ret)
+                        gf_log ("cli", GF_LOG_TRACE, "failed to get node-name");
+
+                cli_out ("\nMigration workers on %s:\n%s",
+                         node_name ? node_name : "-", workers);
+        }
+        ret = 0;
 out:
         return ret;
 }
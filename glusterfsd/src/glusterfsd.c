@@ -226,6 +226,12 @@ static struct argp_option gf_options[] = {
          " [default: \"off\"]"},
         {"secure-mgmt", ARGP_SECURE_MGMT_KEY, "BOOL", OPTION_ARG_OPTIONAL,
          "Override default for secure (SSL) management connections"},
+        {"event-sharding", ARGP_EVENT_SHARDING_KEY, "BOOL",
+         OPTION_ARG_OPTIONAL, "Give every event thread its own epoll "
+         "instance and set of connections [default: \"off\"]"},
+        {"event-cpu-affinity", ARGP_EVENT_CPU_AFFINITY_KEY, "BOOL",
+         OPTION_ARG_OPTIONAL, "Pin each event thread to a CPU, requires "
+         "--event-sharding [default: \"off\"]"},
         {0, 0, 0, 0, "Miscellaneous Options:"},
         {0, }
 };
@@ -1175,6 +1181,33 @@ parse_opts (int key, char *arg, struct argp_state *state)
                 argp_failure (state, -1, 0,
                               "unknown secure-mgmt setting \"%s\"", arg);
                 break;
+
+        case ARGP_EVENT_SHARDING_KEY:
+                if (!arg)
+                        arg = "yes";
+
+                if (gf_string2boolean (arg, &b) == 0) {
+                        cmd_args->event_sharding = b ? 1 : 0;
+                        break;
+                }
+
+                argp_failure (state, -1, 0,
+                              "unknown event-sharding setting \"%s\"", arg);
+                break;
+
+        case ARGP_EVENT_CPU_AFFINITY_KEY:
+                if (!arg)
+                        arg = "yes";
+
+                if (gf_string2boolean (arg, &b) == 0) {
+                        cmd_args->event_cpu_affinity = b ? 1 : 0;
+                        break;
+                }
+
+                argp_failure (state, -1, 0,
+                              "unknown event-cpu-affinity setting \"%s\"",
+                              arg);
+                break;
 	}
 
         return 0;
@@ -2292,6 +2325,12 @@ main (int argc, char *argv[])
 
         gf_proc_dump_init();
 
+        /* must happen before any fd is registered; on failure the shared
+         * epoll instance is kept */
+        if (cmd->event_sharding)
+                event_pool_set_sharding (ctx->event_pool,
+                                         cmd->event_cpu_affinity);
+
         ret = create_fuse_mount (ctx);
         if (ret)
                 goto out;
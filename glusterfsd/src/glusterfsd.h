@@ -94,6 +94,8 @@ enum argp_option_keys {
         ARGP_LOG_BUF_SIZE                 = 170,
         ARGP_LOG_FLUSH_TIMEOUT            = 171,
         ARGP_SECURE_MGMT_KEY              = 172,
+        ARGP_EVENT_SHARDING_KEY           = 173,
+        ARGP_EVENT_CPU_AFFINITY_KEY       = 174,
 };
 
 struct _gfd_vol_top_priv_t {
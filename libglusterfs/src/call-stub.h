@@ -26,6 +26,7 @@ typedef struct {
 	call_frame_t *frame;
 	glusterfs_fop_t fop;
         struct mem_pool *stub_mem_pool; /* pointer to stub mempool in ctx_t */
+        struct timeval queued; /* set by translators queueing stubs */
 
 	union {
 		fop_lookup_t lookup;
@@ -73,6 +74,7 @@ typedef struct {
 		fop_discard_t discard;
                 fop_zerofill_t zerofill;
                 fop_ipc_t ipc;
+                fop_seek_t seek;
 	} fn;
 
 	union {
@@ -121,6 +123,7 @@ typedef struct {
 		fop_discard_cbk_t discard;
                 fop_zerofill_cbk_t zerofill;
                 fop_ipc_cbk_t ipc;
+                fop_seek_cbk_t seek;
 	} fn_cbk;
 
 	struct {
@@ -150,6 +153,7 @@ typedef struct {
 		gf_xattrop_flags_t optype;
 		int valid;
 		struct iatt stat;
+		gf_seek_what_t what;
 		dict_t *xdata;
 	} args;
 
@@ -176,6 +180,7 @@ typedef struct {
 		uint8_t *strong_checksum;
 		dict_t *xdata;
                 gf_dirent_t entries;
+                off_t offset;
 	} args_cbk;
 } call_stub_t;
 
@@ -770,6 +775,15 @@ call_stub_t *
 fop_ipc_cbk_stub (call_frame_t *frame, fop_ipc_cbk_t fn,
                   int32_t op_ret, int32_t op_errno, dict_t *xdata);
 
+call_stub_t *
+fop_seek_stub (call_frame_t *frame, fop_seek_t fn, fd_t *fd, off_t offset,
+               gf_seek_what_t what, dict_t *xdata);
+
+call_stub_t *
+fop_seek_cbk_stub (call_frame_t *frame, fop_seek_cbk_t fn,
+                   int32_t op_ret, int32_t op_errno, off_t offset,
+                   dict_t *xdata);
+
 
 void call_resume (call_stub_t *stub);
 void call_stub_destroy (call_stub_t *stub);
@@ -321,6 +321,43 @@ gf_client_put (client_t *client, gf_boolean_t *detached)
         }
 }
 
+/*
+ * Drops the bind of one of several transports bound to the same client (a
+ * client xlator with transport-count > 1), leaving the last bind alone so
+ * that its disconnect still goes through the grace timer. Returns
+ * _gf_true if a bind was dropped.
+ */
+gf_boolean_t
+gf_client_put_shared (client_t *client)
+{
+        gf_boolean_t put      = _gf_false;
+        int          bind_ref = 0;
+
+#if (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 1)) && !defined(__i386__)
+        do {
+                bind_ref = client->ref.bind;
+                if (bind_ref <= 1)
+                        return _gf_false;
+        } while (!__sync_bool_compare_and_swap (&client->ref.bind, bind_ref,
+                                                bind_ref - 1));
+        put = _gf_true;
+#else
+        LOCK (&client->ref.lock);
+        {
+                bind_ref = client->ref.bind;
+                if (bind_ref > 1) {
+                        --client->ref.bind;
+                        put = _gf_true;
+                }
+        }
+        UNLOCK (&client->ref.lock);
+#endif
+
+        gf_log_callingfn ("client_t", GF_LOG_DEBUG, "%s: bind_ref: %d, put: %d",
+                          client->client_uid, bind_ref, put);
+        return put;
+}
+
 client_t *
 gf_client_ref (client_t *client)
 {
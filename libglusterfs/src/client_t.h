@@ -84,6 +84,9 @@ gf_client_get (xlator_t *this, struct rpcsvc_auth_data *cred, char *client_uid);
 void
 gf_client_put (client_t *client, gf_boolean_t *detached);
 
+gf_boolean_t
+gf_client_put_shared (client_t *client);
+
 clienttable_t *
 gf_clienttable_alloc (void);
 
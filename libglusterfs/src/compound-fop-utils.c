@@ -0,0 +1,153 @@
+/*
+  Copyright (c) 2015, Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "compound-fop-utils.h"
+#include "mem-types.h"
+
+compound_args_t *
+compound_args_new (int count)
+{
+        compound_args_t *args = NULL;
+
+        if (count <= 0)
+                return NULL;
+
+        args = GF_CALLOC (1, sizeof (*args), gf_common_mt_compound_args_t);
+        if (!args)
+                return NULL;
+
+        args->req = GF_CALLOC (count, sizeof (*args->req),
+                               gf_common_mt_compound_args_t);
+        args->rsp = GF_CALLOC (count, sizeof (*args->rsp),
+                               gf_common_mt_compound_args_t);
+        if (!args->req || !args->rsp) {
+                GF_FREE (args->req);
+                GF_FREE (args->rsp);
+                GF_FREE (args);
+                return NULL;
+        }
+
+        args->count = count;
+
+        return args;
+}
+
+
+void
+compound_args_destroy (compound_args_t *args)
+{
+        compound_req_t *req = NULL;
+        compound_rsp_t *rsp = NULL;
+        int             i   = 0;
+
+        if (!args)
+                return;
+
+        for (i = 0; i < args->count; i++) {
+                req = &args->req[i];
+                if (req->fd)
+                        fd_unref (req->fd);
+                GF_FREE (req->vector);
+                if (req->iobref)
+                        iobref_unref (req->iobref);
+                if (req->xattr)
+                        dict_unref (req->xattr);
+                if (req->xdata)
+                        dict_unref (req->xdata);
+
+                rsp = &args->rsp[i];
+                if (rsp->xattr)
+                        dict_unref (rsp->xattr);
+                if (rsp->xdata)
+                        dict_unref (rsp->xdata);
+        }
+
+        GF_FREE (args->req);
+        GF_FREE (args->rsp);
+        GF_FREE (args);
+}
+
+
+int
+compound_args_writev (compound_args_t *args, int index, fd_t *fd,
+                      struct iovec *vector, int32_t count, off_t offset,
+                      uint32_t flags, struct iobref *iobref, dict_t *xdata)
+{
+        compound_req_t *req = NULL;
+
+        GF_VALIDATE_OR_GOTO ("compound", args, out);
+        GF_VALIDATE_OR_GOTO ("compound", fd, out);
+        GF_VALIDATE_OR_GOTO ("compound", (index < args->count), out);
+
+        req = &args->req[index];
+
+        req->vector = iov_dup (vector, count);
+        if (!req->vector)
+                return -ENOMEM;
+
+        req->fop = GF_FOP_WRITE;
+        req->fd = fd_ref (fd);
+        req->count = count;
+        req->offset = offset;
+        req->flags = flags;
+        if (iobref)
+                req->iobref = iobref_ref (iobref);
+        if (xdata)
+                req->xdata = dict_ref (xdata);
+
+        return 0;
+out:
+        return -EINVAL;
+}
+
+
+int
+compound_args_fxattrop (compound_args_t *args, int index, fd_t *fd,
+                        gf_xattrop_flags_t optype, dict_t *xattr,
+                        dict_t *xdata)
+{
+        compound_req_t *req = NULL;
+
+        GF_VALIDATE_OR_GOTO ("compound", args, out);
+        GF_VALIDATE_OR_GOTO ("compound", fd, out);
+        GF_VALIDATE_OR_GOTO ("compound", (index < args->count), out);
+
+        req = &args->req[index];
+
+        req->fop = GF_FOP_FXATTROP;
+        req->fd = fd_ref (fd);
+        req->optype = optype;
+        if (xattr)
+                req->xattr = dict_ref (xattr);
+        if (xdata)
+                req->xdata = dict_ref (xdata);
+
+        return 0;
+out:
+        return -EINVAL;
+}
+
+
+/* The fops that were not run fail with @op_errno. */
+void
+compound_args_cancel (compound_args_t *args, int32_t op_errno)
+{
+        int i = 0;
+
+        for (i = args->done; i < args->count; i++) {
+                args->rsp[i].op_ret = -1;
+                args->rsp[i].op_errno = op_errno;
+        }
+}
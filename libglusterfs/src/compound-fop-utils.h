@@ -0,0 +1,82 @@
+/*
+  Copyright (c) 2015, Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef _COMPOUND_FOP_UTILS_H
+#define _COMPOUND_FOP_UTILS_H
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "xlator.h"
+
+/* A compound fop is an ordered list of fops on one fd. They are run one
+ * after the other and the list stops at the first one that fails. Only
+ * GF_FOP_WRITE and GF_FOP_FXATTROP can be part of a compound, and there is
+ * at most one write in it (its data is the payload of the rpc).
+ *
+ * The args hold a ref on everything they point to, including what the
+ * replies carry back; compound_args_destroy() drops them. */
+
+typedef struct {
+        glusterfs_fop_t       fop;
+        fd_t                 *fd;
+        /* GF_FOP_WRITE */
+        struct iovec         *vector;
+        int32_t               count;
+        off_t                 offset;
+        uint32_t              flags;
+        struct iobref        *iobref;
+        /* GF_FOP_FXATTROP */
+        gf_xattrop_flags_t    optype;
+        dict_t               *xattr;
+        dict_t               *xdata;
+} compound_req_t;
+
+typedef struct {
+        int32_t               op_ret;
+        int32_t               op_errno;
+        /* GF_FOP_WRITE */
+        struct iatt           prestat;
+        struct iatt           poststat;
+        /* GF_FOP_FXATTROP */
+        dict_t               *xattr;
+        dict_t               *xdata;
+} compound_rsp_t;
+
+struct _compound_args {
+        int32_t               count;
+        /* number of fops run so far, the last one may have failed */
+        int32_t               done;
+        compound_req_t       *req;
+        compound_rsp_t       *rsp;
+};
+
+compound_args_t *
+compound_args_new (int count);
+
+void
+compound_args_destroy (compound_args_t *args);
+
+int
+compound_args_writev (compound_args_t *args, int index, fd_t *fd,
+                      struct iovec *vector, int32_t count, off_t offset,
+                      uint32_t flags, struct iobref *iobref, dict_t *xdata);
+
+int
+compound_args_fxattrop (compound_args_t *args, int index, fd_t *fd,
+                        gf_xattrop_flags_t optype, dict_t *xattr,
+                        dict_t *xdata);
+
+void
+compound_args_cancel (compound_args_t *args, int32_t op_errno);
+
+#endif /* _COMPOUND_FOP_UTILS_H */
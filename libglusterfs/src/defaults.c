@@ -26,6 +26,7 @@
 #endif
 
 #include "xlator.h"
+#include "compound-fop-utils.h"
 
 /* FAILURE_CBK function section */
 
@@ -365,6 +366,20 @@ default_zerofill_failure_cbk (call_frame_t *frame, int32_t op_errno)
         return 0;
 }
 
+int32_t
+default_seek_failure_cbk (call_frame_t *frame, int32_t op_errno)
+{
+        STACK_UNWIND_STRICT (seek, frame, -1, op_errno, 0, NULL);
+        return 0;
+}
+
+int32_t
+default_compound_failure_cbk (call_frame_t *frame, int32_t op_errno)
+{
+        STACK_UNWIND_STRICT (compound, frame, -1, op_errno, NULL, NULL);
+        return 0;
+}
+
 
 int32_t
 default_getspec_failure_cbk (call_frame_t *frame, int32_t op_errno)
@@ -822,6 +837,15 @@ default_zerofill_cbk_resume(call_frame_t *frame, void *cookie, xlator_t *this,
         return 0;
 }
 
+int32_t
+default_seek_cbk_resume (call_frame_t *frame, void *cookie, xlator_t *this,
+                         int32_t op_ret, int32_t op_errno, off_t offset,
+                         dict_t *xdata)
+{
+        STACK_UNWIND_STRICT (seek, frame, op_ret, op_errno, offset, xdata);
+        return 0;
+}
+
 
 int32_t
 default_getspec_cbk_resume (call_frame_t *frame, void *cookie, xlator_t *this,
@@ -1286,6 +1310,24 @@ default_zerofill_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
         return 0;
 }
 
+int32_t
+default_seek_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                  int32_t op_ret, int32_t op_errno, off_t offset,
+                  dict_t *xdata)
+{
+        STACK_UNWIND_STRICT (seek, frame, op_ret, op_errno, offset, xdata);
+        return 0;
+}
+
+int32_t
+default_compound_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                      int32_t op_ret, int32_t op_errno,
+                      compound_args_t *args, dict_t *xdata)
+{
+        STACK_UNWIND_STRICT (compound, frame, op_ret, op_errno, args, xdata);
+        return 0;
+}
+
 
 int32_t
 default_getspec_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
@@ -1746,6 +1788,16 @@ default_ipc_resume (call_frame_t *frame, xlator_t *this, int32_t op,
         return 0;
 }
 
+int32_t
+default_seek_resume (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                     off_t offset, gf_seek_what_t what, dict_t *xdata)
+{
+        STACK_WIND (frame, default_seek_cbk,
+                    FIRST_CHILD(this), FIRST_CHILD(this)->fops->seek,
+                    fd, offset, what, xdata);
+        return 0;
+}
+
 
 /* FOPS */
 
@@ -2191,6 +2243,121 @@ default_ipc (call_frame_t *frame, xlator_t *this, int32_t op, dict_t *xdata)
         return 0;
 }
 
+int32_t
+default_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+              gf_seek_what_t what, dict_t *xdata)
+{
+        STACK_WIND_TAIL (frame,
+                         FIRST_CHILD(this), FIRST_CHILD(this)->fops->seek,
+                         fd, offset, what, xdata);
+        return 0;
+}
+
+/* An xlator that does not know about compound fops runs them as separate
+ * fops through its own fop table, so that it sees every one of them. */
+static int32_t
+default_compound_next (call_frame_t *frame, xlator_t *this,
+                       compound_args_t *args);
+
+static int32_t
+default_compound_writev_cbk (call_frame_t *frame, void *cookie,
+                             xlator_t *this, int32_t op_ret, int32_t op_errno,
+                             struct iatt *prebuf, struct iatt *postbuf,
+                             dict_t *xdata)
+{
+        compound_args_t *args = cookie;
+        compound_rsp_t  *rsp  = NULL;
+
+        rsp = &args->rsp[args->done - 1];
+        rsp->op_ret = op_ret;
+        rsp->op_errno = op_errno;
+        if (prebuf)
+                rsp->prestat = *prebuf;
+        if (postbuf)
+                rsp->poststat = *postbuf;
+        if (xdata)
+                rsp->xdata = dict_ref (xdata);
+
+        return default_compound_next (frame, this, args);
+}
+
+static int32_t
+default_compound_fxattrop_cbk (call_frame_t *frame, void *cookie,
+                               xlator_t *this, int32_t op_ret,
+                               int32_t op_errno, dict_t *dict, dict_t *xdata)
+{
+        compound_args_t *args = cookie;
+        compound_rsp_t  *rsp  = NULL;
+
+        rsp = &args->rsp[args->done - 1];
+        rsp->op_ret = op_ret;
+        rsp->op_errno = op_errno;
+        if (dict)
+                rsp->xattr = dict_ref (dict);
+        if (xdata)
+                rsp->xdata = dict_ref (xdata);
+
+        return default_compound_next (frame, this, args);
+}
+
+static int32_t
+default_compound_next (call_frame_t *frame, xlator_t *this,
+                       compound_args_t *args)
+{
+        compound_req_t *req      = NULL;
+        compound_rsp_t *rsp      = NULL;
+        int32_t         op_errno = 0;
+
+        if (args->done) {
+                rsp = &args->rsp[args->done - 1];
+                if (rsp->op_ret < 0) {
+                        op_errno = rsp->op_errno;
+                        goto fail;
+                }
+        }
+
+        if (args->done == args->count) {
+                STACK_UNWIND_STRICT (compound, frame, 0, 0, args, NULL);
+                return 0;
+        }
+
+        req = &args->req[args->done++];
+
+        switch (req->fop) {
+        case GF_FOP_WRITE:
+                STACK_WIND_COOKIE (frame, default_compound_writev_cbk, args,
+                                   this, this->fops->writev, req->fd,
+                                   req->vector, req->count, req->offset,
+                                   req->flags, req->iobref, req->xdata);
+                break;
+        case GF_FOP_FXATTROP:
+                STACK_WIND_COOKIE (frame, default_compound_fxattrop_cbk, args,
+                                   this, this->fops->fxattrop, req->fd,
+                                   req->optype, req->xattr, req->xdata);
+                break;
+        default:
+                op_errno = ENOTSUP;
+                args->rsp[args->done - 1].op_ret = -1;
+                args->rsp[args->done - 1].op_errno = op_errno;
+                goto fail;
+        }
+
+        return 0;
+fail:
+        compound_args_cancel (args, op_errno);
+        STACK_UNWIND_STRICT (compound, frame, -1, op_errno, args, NULL);
+        return 0;
+}
+
+int32_t
+default_compound (call_frame_t *frame, xlator_t *this, compound_args_t *args,
+                  dict_t *xdata)
+{
+        args->done = 0;
+
+        return default_compound_next (frame, this, args);
+}
+
 
 int32_t
 default_forget (xlator_t *this, inode_t *inode)
@@ -2277,6 +2444,8 @@ struct xlator_fops _default_fops = {
 	.fallocate = default_fallocate,
 	.discard = default_discard,
         .zerofill = default_zerofill,
+        .seek = default_seek,
+        .compound = default_compound,
 
         .getspec = default_getspec,
 };
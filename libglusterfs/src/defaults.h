@@ -266,6 +266,12 @@ int32_t default_zerofill(call_frame_t *frame,
 int32_t default_ipc (call_frame_t *frame, xlator_t *this, int32_t op,
                      dict_t *xdata);
 
+int32_t default_seek (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                      off_t offset, gf_seek_what_t what, dict_t *xdata);
+
+int32_t default_compound (call_frame_t *frame, xlator_t *this,
+                          compound_args_t *args, dict_t *xdata);
+
 
 /* Resume */
 int32_t default_getspec_resume (call_frame_t *frame,
@@ -498,6 +504,10 @@ int32_t default_zerofill_resume(call_frame_t *frame,
 int32_t default_ipc_resume (call_frame_t *frame, xlator_t *this,
                             int32_t op, dict_t *xdata);
 
+int32_t default_seek_resume (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                             off_t offset, gf_seek_what_t what,
+                             dict_t *xdata);
+
 
 /* _cbk_resume */
 
@@ -765,6 +775,11 @@ int32_t default_zerofill_cbk_resume (call_frame_t * frame, void *cookie,
                                      int32_t op_errno, struct iatt *pre,
                                      struct iatt *post, dict_t * xdata);
 
+int32_t default_seek_cbk_resume (call_frame_t *frame, void *cookie,
+                                 xlator_t *this, int32_t op_ret,
+                                 int32_t op_errno, off_t offset,
+                                 dict_t *xdata);
+
 int32_t
 default_getspec_cbk_resume (call_frame_t * frame, void *cookie,
                             xlator_t * this, int32_t op_ret, int32_t op_errno,
@@ -994,6 +1009,15 @@ int32_t default_zerofill_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
 int32_t default_ipc_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                          int32_t op_ret, int32_t op_errno, dict_t *xdata);
 
+int32_t default_seek_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                          int32_t op_ret, int32_t op_errno, off_t offset,
+                          dict_t *xdata);
+
+int32_t default_compound_cbk (call_frame_t *frame, void *cookie,
+                              xlator_t *this, int32_t op_ret,
+                              int32_t op_errno, compound_args_t *args,
+                              dict_t *xdata);
+
 int32_t
 default_getspec_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                      int32_t op_ret, int32_t op_errno, char *spec_data);
@@ -1132,6 +1156,12 @@ default_discard_failure_cbk (call_frame_t *frame, int32_t op_errno);
 int32_t
 default_zerofill_failure_cbk (call_frame_t *frame, int32_t op_errno);
 
+int32_t
+default_seek_failure_cbk (call_frame_t *frame, int32_t op_errno);
+
+int32_t
+default_compound_failure_cbk (call_frame_t *frame, int32_t op_errno);
+
 int32_t
 default_getspec_failure_cbk (call_frame_t *frame, int32_t op_errno);
 
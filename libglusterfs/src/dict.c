@@ -24,7 +24,6 @@
 #include "glusterfs.h"
 #include "common-utils.h"
 #include "dict.h"
-#include "hashfn.h"
 #include "logging.h"
 #include "compat.h"
 #include "byte-order.h"
@@ -45,6 +44,13 @@ get_new_data ()
         return data;
 }
 
+/* dicts up to this many keys are searched by walking members_list */
+#define DICT_LINEAR_MAX         8
+#define DICT_INDEX_MIN_SIZE     32
+
+static int
+dict_index_build (dict_t *this, int32_t size);
+
 dict_t *
 get_new_dict_full (int size_hint)
 {
@@ -54,37 +60,12 @@ get_new_dict_full (int size_hint)
                 return NULL;
         }
 
-        dict->hash_size = size_hint;
-        if (size_hint == 1) {
-                /*
-                 * This is the only case we ever see currently.  If we ever
-                 * need to support resizing the hash table, the resize function
-                 * will have to take into account the possibility that
-                 * "members" is not separately allocated (i.e. don't just call
-                 * realloc() blindly.
-                 */
-                dict->members = &dict->members_internal;
-        }
-        else {
-                /*
-                 * We actually need to allocate space for size_hint *pointers*
-                 * but we actually allocate space for one *structure*.  Since
-                 * a data_pair_t consists of five pointers, we're wasting four
-                 * pointers' worth for N=1, and will overrun what we allocated
-                 * for N>5.  If anybody ever starts using size_hint, we'll need
-                 * to fix this.
-                 */
-                GF_ASSERT (size_hint <=
-                           (sizeof(data_pair_t) / sizeof(data_pair_t *)));
-                dict->members = mem_get0 (THIS->ctx->dict_pair_pool);
-                if (!dict->members) {
-                        mem_put (dict);
-                        return NULL;
-                }
-        }
-
         LOCK_INIT (&dict->lock);
 
+        /* an index is only worth building upfront for a known large dict */
+        if (size_hint > DICT_LINEAR_MAX)
+                dict_index_build (dict, size_hint * 2);
+
         return dict;
 }
 
@@ -140,7 +121,9 @@ data_destroy (data_t *data)
         if (data) {
                 LOCK_DESTROY (&data->lock);
 
-                if (!data->is_static) {
+                if (data->owner) {
+                        data_unref (data->owner);
+                } else if (!data->is_static) {
                         if (data->data) {
                                 if (data->is_stdalloc)
                                         free (data->data);
@@ -189,32 +172,343 @@ err_out:
         return NULL;
 }
 
-static data_pair_t *
-_dict_lookup (dict_t *this, char *key)
+/* FNV-1a, computing the length of @key on the way. */
+static uint32_t
+dict_key_hash (const char *key, uint32_t *len)
 {
-        int hashval = 0;
-        if (!this || !key) {
-                gf_log_callingfn ("dict", GF_LOG_WARNING,
-                                  "!this || !key (%s)", key);
+        const unsigned char *trav = (const unsigned char *)key;
+        uint32_t             hash = 2166136261U;
+
+        for (; *trav; trav++) {
+                hash ^= *trav;
+                hash *= 16777619U;
+        }
+
+        *len = trav - (const unsigned char *)key;
+
+        return hash;
+}
+
+/*
+ * Keys that go with most fops are interned: a pair holding one points to the
+ * shared copy instead of storing its own. The well known keys below are
+ * hashed once; the per-brick "trusted.afr." and "trusted.ec." keys are
+ * interned on first use. Entries are published with a compare and swap into
+ * an empty slot and never removed, so lookups need no lock.
+ */
+#define DICT_INTERN_SLOTS       1024    /* power of two */
+#define DICT_INTERN_MAX         (DICT_INTERN_SLOTS / 2)
+
+struct dict_intern {
+        uint32_t hash;
+        uint32_t len;
+        char     key[];
+};
+
+static struct dict_intern *dict_interned[DICT_INTERN_SLOTS];
+static int                 dict_interned_count;
+static pthread_once_t      dict_intern_once = PTHREAD_ONCE_INIT;
+
+static char *dict_well_known_keys[] = {
+        GF_CONTENT_KEY,
+        GFID_XATTR_KEY,
+        VIRTUAL_GFID_XATTR_KEY,
+        GF_XATTR_PATHINFO_KEY,
+        GF_XATTR_NODE_UUID_KEY,
+        GF_XATTR_LOCKINFO_KEY,
+        GF_XATTR_LINKINFO_KEY,
+        GF_XATTROP_INDEX_GFID,
+        GF_XATTROP_INDEX_COUNT,
+        GLUSTERFS_INTERNAL_FOP_KEY,
+        GLUSTERFS_WRITE_IS_APPEND,
+        GLUSTERFS_OPEN_FD_COUNT,
+        GLUSTERFS_INODELK_COUNT,
+        GLUSTERFS_ENTRYLK_COUNT,
+        GLUSTERFS_POSIXLK_COUNT,
+        GLUSTERFS_PARENT_ENTRYLK,
+        GLUSTERFS_INODELK_DOM_COUNT,
+        GLUSTERFS_DURABLE_OP,
+        QUOTA_SIZE_KEY,
+        QUOTA_LIMIT_KEY,
+        QUOTA_LIMIT_OBJECTS_KEY,
+        BITROT_CURRENT_VERSION_KEY,
+        BITROT_SIGNING_VERSION_KEY,
+        "trusted.glusterfs.dht",
+        "trusted.glusterfs.dht.linkto",
+        "trusted.afr.dirty",
+        "trusted.ec.version",
+        "trusted.ec.size",
+        "trusted.ec.config",
+        "trusted.ec.dirty",
+        "link-count",
+        "gfid-req",
+        "security.selinux",
+        "system.posix_acl_access",
+        "system.posix_acl_default",
+        NULL
+};
+
+static char *dict_intern_prefixes[] = {
+        "trusted.afr.",
+        "trusted.ec.",
+        NULL
+};
+
+static char *
+dict_intern_insert (const char *key, uint32_t hash, uint32_t len)
+{
+        struct dict_intern *entry = NULL;
+        struct dict_intern *slot = NULL;
+        uint32_t            i = 0;
+        uint32_t            idx = 0;
+
+        if (dict_interned_count >= DICT_INTERN_MAX)
+                return NULL;
+
+        /* lives as long as the process, so not accounted to any xlator */
+        entry = CALLOC (1, sizeof (*entry) + len + 1);
+        if (!entry)
                 return NULL;
+
+        entry->hash = hash;
+        entry->len = len;
+        memcpy (entry->key, key, len + 1);
+
+        for (i = 0; i < DICT_INTERN_SLOTS; i++) {
+                idx = (hash + i) & (DICT_INTERN_SLOTS - 1);
+
+                slot = __sync_val_compare_and_swap (&dict_interned[idx],
+                                                    NULL, entry);
+                if (!slot) {
+                        __sync_fetch_and_add (&dict_interned_count, 1);
+                        return entry->key;
+                }
+
+                /* interned by someone else meanwhile */
+                if ((slot->hash == hash) && (slot->len == len) &&
+                    !memcmp (slot->key, key, len)) {
+                        FREE (entry);
+                        return slot->key;
+                }
         }
 
-        /* If the divisor is 1, the modulo is always 0,
-         * in such case avoid hash calculation.
-         */
-        if (this->hash_size != 1)
-                hashval = SuperFastHash (key, strlen (key)) % this->hash_size;
+        FREE (entry);
 
-        data_pair_t *pair;
+        return NULL;
+}
+
+static void
+dict_intern_init (void)
+{
+        uint32_t len = 0;
+        uint32_t hash = 0;
+        int      i = 0;
+
+        for (i = 0; dict_well_known_keys[i]; i++) {
+                hash = dict_key_hash (dict_well_known_keys[i], &len);
+                dict_intern_insert (dict_well_known_keys[i], hash, len);
+        }
+}
+
+/* Returns the shared copy of @key, interning it if it is worth it. */
+static char *
+dict_intern (const char *key, uint32_t hash, uint32_t len)
+{
+        struct dict_intern *slot = NULL;
+        uint32_t            i = 0;
+        int                 p = 0;
+
+        pthread_once (&dict_intern_once, dict_intern_init);
+
+        for (i = 0; i < DICT_INTERN_SLOTS; i++) {
+                slot = dict_interned[(hash + i) & (DICT_INTERN_SLOTS - 1)];
+                if (!slot)
+                        break;
+
+                if ((slot->hash == hash) && (slot->len == len) &&
+                    !memcmp (slot->key, key, len))
+                        return slot->key;
+        }
+
+        for (p = 0; dict_intern_prefixes[p]; p++) {
+                if (!strncmp (key, dict_intern_prefixes[p],
+                              strlen (dict_intern_prefixes[p])))
+                        return dict_intern_insert (key, hash, len);
+        }
+
+        return NULL;
+}
+
+static int
+dict_pair_set_key (data_pair_t *pair, char *key)
+{
+        pair->key_hash = dict_key_hash (key, &pair->key_len);
+        pair->key_interned = 0;
+
+        pair->key = dict_intern (key, pair->key_hash, pair->key_len);
+        if (pair->key) {
+                pair->key_interned = 1;
+                return 0;
+        }
 
-        for (pair = this->members[hashval]; pair != NULL; pair = pair->hash_next) {
-                if (pair->key && !strcmp (pair->key, key))
+        if (pair->key_len < DICT_KEY_INLINE_LEN) {
+                pair->key = pair->key_inline;
+        } else {
+                pair->key = GF_MALLOC (pair->key_len + 1, gf_common_mt_char);
+                if (!pair->key)
+                        return -1;
+        }
+
+        memcpy (pair->key, key, pair->key_len + 1);
+
+        return 0;
+}
+
+static void
+dict_pair_free_key (data_pair_t *pair)
+{
+        if (!pair->key_interned && (pair->key != pair->key_inline))
+                GF_FREE (pair->key);
+
+        pair->key = NULL;
+}
+
+#define DICT_PAIR_MATCH(p, k, h, l)                                     \
+        (((p)->key_hash == (h)) && ((p)->key_len == (l)) &&             \
+         (((p)->key == (k)) || !memcmp ((p)->key, (k), (l))))
+
+/* Index of the pair for @key in this->members, or of the free slot where it
+ * would go. The index is kept at most half full. */
+static uint32_t
+dict_index_slot (dict_t *this, const char *key, uint32_t hash, uint32_t len)
+{
+        data_pair_t *pair = NULL;
+        uint32_t     mask = this->hash_size - 1;
+        uint32_t     idx = hash & mask;
+
+        while ((pair = this->members[idx]) != NULL) {
+                if (DICT_PAIR_MATCH (pair, key, hash, len))
+                        break;
+                idx = (idx + 1) & mask;
+        }
+
+        return idx;
+}
+
+/* With duplicate keys (dict_add) the index points to the newest pair. */
+static void
+dict_index_insert (dict_t *this, data_pair_t *pair)
+{
+        uint32_t idx = 0;
+
+        idx = dict_index_slot (this, pair->key, pair->key_hash, pair->key_len);
+        this->members[idx] = pair;
+}
+
+static void
+dict_index_remove (dict_t *this, data_pair_t *pair)
+{
+        data_pair_t *trav = NULL;
+        uint32_t     mask = this->hash_size - 1;
+        uint32_t     hole = 0;
+        uint32_t     idx = 0;
+        uint32_t     home = 0;
+
+        hole = dict_index_slot (this, pair->key, pair->key_hash,
+                                pair->key_len);
+        if (this->members[hole] != pair)
+                return;
+
+        /* backward shift deletion, keeps every probe sequence intact */
+        idx = hole;
+        for (;;) {
+                idx = (idx + 1) & mask;
+                trav = this->members[idx];
+                if (!trav)
+                        break;
+
+                home = trav->key_hash & mask;
+                if (((idx > hole) && ((home <= hole) || (home > idx))) ||
+                    ((idx < hole) && ((home <= hole) && (home > idx)))) {
+                        this->members[hole] = trav;
+                        hole = idx;
+                }
+        }
+        this->members[hole] = NULL;
+
+        /* an older pair with the same key becomes visible again */
+        for (trav = this->members_list; trav; trav = trav->next) {
+                if ((trav != pair) &&
+                    DICT_PAIR_MATCH (trav, pair->key, pair->key_hash,
+                                     pair->key_len)) {
+                        dict_index_insert (this, trav);
+                        break;
+                }
+        }
+}
+
+static int
+dict_index_build (dict_t *this, int32_t size)
+{
+        data_pair_t  **members = NULL;
+        data_pair_t   *pair = NULL;
+        data_pair_t   *last = NULL;
+        int32_t        hash_size = DICT_INDEX_MIN_SIZE;
+
+        while (hash_size < size)
+                hash_size <<= 1;
+
+        members = GF_CALLOC (hash_size, sizeof (*members),
+                             gf_common_mt_dict_index_t);
+        if (!members)
+                return -1;
+
+        GF_FREE (this->members);
+        this->members = members;
+        this->hash_size = hash_size;
+
+        /* oldest first, so that the newest of duplicate keys wins */
+        for (pair = this->members_list; pair; pair = pair->next)
+                last = pair;
+        for (pair = last; pair; pair = pair->prev)
+                dict_index_insert (this, pair);
+
+        return 0;
+}
+
+static data_pair_t *
+__dict_lookup (dict_t *this, const char *key, uint32_t hash, uint32_t len)
+{
+        data_pair_t *pair = NULL;
+
+        if (this->members)
+                return this->members[dict_index_slot (this, key, hash, len)];
+
+        for (pair = this->members_list; pair; pair = pair->next) {
+                if (DICT_PAIR_MATCH (pair, key, hash, len))
                         return pair;
         }
 
         return NULL;
 }
 
+static data_pair_t *
+_dict_lookup (dict_t *this, char *key)
+{
+        uint32_t hash = 0;
+        uint32_t len = 0;
+
+        if (!this || !key) {
+                gf_log_callingfn ("dict", GF_LOG_WARNING,
+                                  "!this || !key (%s)", key);
+                return NULL;
+        }
+
+        hash = dict_key_hash (key, &len);
+
+        return __dict_lookup (this, key, hash, len);
+}
+
 int32_t
 dict_lookup (dict_t *this, char *key, data_t **data)
 {
@@ -241,10 +535,8 @@ dict_lookup (dict_t *this, char *key, data_t **data)
 static int32_t
 _dict_set (dict_t *this, char *key, data_t *value, gf_boolean_t replace)
 {
-        int hashval = 0;
         data_pair_t *pair;
         char key_free = 0;
-        int tmp = 0;
         int ret = 0;
 
         if (!key) {
@@ -256,14 +548,6 @@ _dict_set (dict_t *this, char *key, data_t *value, gf_boolean_t replace)
                 key_free = 1;
         }
 
-        /* If the divisor is 1, the modulo is always 0,
-         * in such case avoid hash calculation.
-         */
-        if (this->hash_size != 1) {
-                tmp = SuperFastHash (key, strlen (key));
-                hashval = (tmp % this->hash_size);
-        }
-
         /* Search for a existing key if 'replace' is asked for */
         if (replace) {
                 pair = _dict_lookup (this, key);
@@ -292,30 +576,20 @@ _dict_set (dict_t *this, char *key, data_t *value, gf_boolean_t replace)
                 this->free_pair_in_use = _gf_true;
         }
 
-        if (key_free) {
-                /* It's ours.  Use it. */
-                pair->key = key;
-                key_free = 0;
-        }
-        else {
-                pair->key = (char *) GF_CALLOC (1, strlen (key) + 1,
-                                                gf_common_mt_char);
-                if (!pair->key) {
-                        if (pair == &this->free_pair) {
-                                this->free_pair_in_use = _gf_false;
-                        }
-                        else {
-                                mem_put (pair);
-                        }
-                        return -1;
+        ret = dict_pair_set_key (pair, key);
+        if (key_free)
+                GF_FREE (key);
+        if (ret) {
+                if (pair == &this->free_pair) {
+                        this->free_pair_in_use = _gf_false;
                 }
-                strcpy (pair->key, key);
+                else {
+                        mem_put (pair);
+                }
+                return -1;
         }
         pair->value = data_ref (value);
 
-        pair->hash_next = this->members[hashval];
-        this->members[hashval] = pair;
-
         pair->next = this->members_list;
         pair->prev = NULL;
         if (this->members_list)
@@ -323,8 +597,19 @@ _dict_set (dict_t *this, char *key, data_t *value, gf_boolean_t replace)
         this->members_list = pair;
         this->count++;
 
-        if (key_free)
-                GF_FREE (key);
+        if (this->members && (this->count * 2 > this->hash_size)) {
+                /* lookups fall back to the list if the index can't grow */
+                if (dict_index_build (this, this->count * 2)) {
+                        GF_FREE (this->members);
+                        this->members = NULL;
+                        this->hash_size = 0;
+                }
+        } else if (this->members) {
+                dict_index_insert (this, pair);
+        } else if (this->count > DICT_LINEAR_MAX) {
+                dict_index_build (this, this->count * 2);
+        }
+
         return 0;
 }
 
@@ -398,7 +683,7 @@ dict_get (dict_t *this, char *key)
 void
 dict_del (dict_t *this, char *key)
 {
-        int hashval = 0;
+        data_pair_t *pair = NULL;
 
         if (!this || !key) {
                 gf_log_callingfn ("dict", GF_LOG_WARNING,
@@ -408,45 +693,29 @@ dict_del (dict_t *this, char *key)
 
         LOCK (&this->lock);
 
-        /* If the divisor is 1, the modulo is always 0,
-         * in such case avoid hash calculation.
-         */
-        if (this->hash_size != 1)
-                hashval = SuperFastHash (key, strlen (key)) % this->hash_size;
-
-        data_pair_t *pair = this->members[hashval];
-        data_pair_t *prev = NULL;
-
-        while (pair) {
-                if (strcmp (pair->key, key) == 0) {
-                        if (prev)
-                                prev->hash_next = pair->hash_next;
-                        else
-                                this->members[hashval] = pair->hash_next;
+        pair = _dict_lookup (this, key);
+        if (pair) {
+                if (pair->prev)
+                        pair->prev->next = pair->next;
+                else
+                        this->members_list = pair->next;
 
-                        data_unref (pair->value);
+                if (pair->next)
+                        pair->next->prev = pair->prev;
 
-                        if (pair->prev)
-                                pair->prev->next = pair->next;
-                        else
-                                this->members_list = pair->next;
+                if (this->members)
+                        dict_index_remove (this, pair);
 
-                        if (pair->next)
-                                pair->next->prev = pair->prev;
+                data_unref (pair->value);
 
-                        GF_FREE (pair->key);
-                        if (pair == &this->free_pair) {
-                                this->free_pair_in_use = _gf_false;
-                        }
-                        else {
-                                mem_put (pair);
-                        }
-                        this->count--;
-                        break;
+                dict_pair_free_key (pair);
+                if (pair == &this->free_pair) {
+                        this->free_pair_in_use = _gf_false;
                 }
-
-                prev = pair;
-                pair = pair->hash_next;
+                else {
+                        mem_put (pair);
+                }
+                this->count--;
         }
 
         UNLOCK (&this->lock);
@@ -470,16 +739,14 @@ dict_destroy (dict_t *this)
         while (prev) {
                 pair = pair->next;
                 data_unref (prev->value);
-                GF_FREE (prev->key);
+                dict_pair_free_key (prev);
                 if (prev != &this->free_pair) {
                         mem_put (prev);
                 }
                 prev = pair;
         }
 
-        if (this->members != &this->members_internal) {
-                mem_put (this->members);
-        }
+        GF_FREE (this->members);
 
         GF_FREE (this->extra_free);
         free (this->extra_stdfree);
@@ -1273,7 +1540,7 @@ dict_copy (dict_t *dict,
         }
 
         if (!new)
-                new = get_new_dict_full (dict->hash_size);
+                new = get_new_dict_full (dict->count);
 
         dict_foreach (dict, _copy, new);
 
@@ -2407,7 +2674,7 @@ _dict_serialized_length (dict_t *this)
                         goto out;
                 }
 
-                len += strlen (pair->key) + 1  /* for '\0' */;
+                len += pair->key_len + 1  /* for '\0' */;
 
                 if (!pair->value) {
                         gf_log ("dict", GF_LOG_ERROR,
@@ -2487,7 +2754,7 @@ _dict_serialize (dict_t *this, char *buf)
                         goto out;
                 }
 
-                keylen  = strlen (pair->key);
+                keylen  = pair->key_len;
                 netword = hton32 (keylen);
                 memcpy (buf, &netword, sizeof(netword));
                 buf += DICT_DATA_HDR_KEY_LEN;
@@ -2581,19 +2848,9 @@ out:
 }
 
 
-/**
- * dict_unserialize - unserialize a buffer into a dict
- *
- * @buf:  buf containing serialized dict
- * @size: size of the @buf
- * @fill: dict to fill in
- *
- * @return: success: 0
- *          failure: -errno
- */
-
-int32_t
-dict_unserialize (char *orig_buf, int32_t size, dict_t **fill)
+/* The values point into @backing, which holds the serialized dict. */
+static int32_t
+_dict_unserialize (data_t *backing, dict_t **fill)
 {
         char   *buf = NULL;
         int     ret   = -1;
@@ -2605,8 +2862,11 @@ dict_unserialize (char *orig_buf, int32_t size, dict_t **fill)
         int32_t  keylen  = 0;
         int32_t  vallen  = 0;
         int32_t  hostord = 0;
+        char   * orig_buf = NULL;
+        int32_t  size    = 0;
 
-        buf = orig_buf;
+        buf = orig_buf = backing->data;
+        size = backing->len;
 
         if (!buf) {
                 gf_log_callingfn ("dict", GF_LOG_WARNING, "buf is null!");
@@ -2698,9 +2958,12 @@ dict_unserialize (char *orig_buf, int32_t size, dict_t **fill)
                         goto out;
                 }
                 value = get_new_data ();
+                if (!value)
+                        goto out;
                 value->len  = vallen;
-                value->data = memdup (buf, vallen);
-                value->is_static = 0;
+                value->data = buf;
+                value->is_static = 1;
+                value->owner = data_ref (backing);
                 buf += vallen;
 
                 dict_add (*fill, key, value);
@@ -2712,6 +2975,96 @@ out:
 }
 
 
+
+/**
+ * dict_unserialize - unserialize a buffer into a dict
+ *
+ * @buf:  buf containing serialized dict
+ * @size: size of the @buf
+ * @fill: dict to fill in
+ *
+ * The buffer is copied once, and the values point into that copy.
+ *
+ * @return: success: 0
+ *          failure: -errno
+ */
+
+int32_t
+dict_unserialize (char *buf, int32_t size, dict_t **fill)
+{
+        data_t  *backing = NULL;
+        int32_t  ret     = -1;
+
+        if (!buf || (size <= 0)) {
+                gf_log_callingfn ("dict", GF_LOG_WARNING,
+                                  "buf is null or empty!");
+                goto out;
+        }
+
+        backing = get_new_data ();
+        if (!backing)
+                goto out;
+        data_ref (backing);
+
+        backing->data = memdup (buf, size);
+        if (!backing->data)
+                goto unref;
+        backing->len = size;
+
+        ret = _dict_unserialize (backing, fill);
+unref:
+        data_unref (backing);
+out:
+        return ret;
+}
+
+
+/**
+ * dict_unserialize_steal - unserialize a buffer into a dict without copying
+ *
+ * @buf:  buf containing serialized dict, allocated with malloc()
+ * @size: size of the @buf
+ * @fill: dict to fill in
+ *
+ * The values point into @buf, which is owned by them from now on and freed
+ * with free() once the last of them is gone, whatever the result.
+ *
+ * @return: success: 0
+ *          failure: -errno
+ */
+
+int32_t
+dict_unserialize_steal (char *buf, int32_t size, dict_t **fill)
+{
+        data_t  *backing = NULL;
+        int32_t  ret     = -1;
+
+        if (!buf || (size <= 0)) {
+                gf_log_callingfn ("dict", GF_LOG_WARNING,
+                                  "buf is null or empty!");
+                free (buf);
+                goto out;
+        }
+
+        backing = get_new_data ();
+        if (!backing) {
+                free (buf);
+                goto out;
+        }
+        data_ref (backing);
+
+        backing->data = buf;
+        backing->len = size;
+        backing->is_stdalloc = 1;
+
+        ret = _dict_unserialize (backing, fill);
+
+        data_unref (backing);
+out:
+        return ret;
+}
+
+
 /**
  * dict_allocate_and_serialize - serialize a dictionary into an allocated buffer
  *
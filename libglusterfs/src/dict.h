@@ -62,6 +62,32 @@ typedef struct _data_pair data_pair_t;
                                                                         \
         } while (0)
 
+
+/* Same as GF_PROTOCOL_DICT_UNSERIALIZE, for a buffer allocated by the xdr
+ * decoder: the dict takes it over instead of copying the values out of it,
+ * and @buff is cleared so that the caller's free() becomes a no-op. */
+#define GF_PROTOCOL_DICT_UNSERIALIZE_STEAL(xl,to,buff,len,ret,ope,labl) do { \
+                if (!len)                                               \
+                        break;                                          \
+                to = dict_new();                                        \
+                GF_VALIDATE_OR_GOTO (xl->name, to, labl);               \
+                                                                        \
+                ret = dict_unserialize_steal (buff, len, &to);          \
+                buff = NULL;                                            \
+                if (ret < 0) {                                          \
+                        gf_log (xl->name, GF_LOG_WARNING,               \
+                                "failed to unserialize dictionary (%s)", \
+                                (#to));                                 \
+                                                                        \
+                        ope = EINVAL;                                   \
+                        goto labl;                                      \
+                }                                                       \
+                                                                        \
+        } while (0)
+
+/* keys shorter than this are stored in the pair itself */
+#define DICT_KEY_INLINE_LEN     32
+
 struct _data {
         unsigned char  is_static:1;
         unsigned char  is_const:1;
@@ -70,27 +96,31 @@ struct _data {
         char          *data;
         int32_t        refcount;
         gf_lock_t      lock;
+        data_t        *owner;   /* ref'ed buffer @data points into */
 };
 
 struct _data_pair {
-        struct _data_pair *hash_next;
         struct _data_pair *prev;
         struct _data_pair *next;
         data_t            *value;
         char              *key;
+        uint32_t           key_hash;
+        uint32_t           key_len;
+        unsigned char      key_interned:1;
+        char               key_inline[DICT_KEY_INLINE_LEN];
 };
 
 struct _dict {
         unsigned char   is_static:1;
-        int32_t         hash_size;
+        int32_t         hash_size;      /* slots in members, 0 if no index */
         int32_t         count;
         int32_t         refcount;
-        data_pair_t   **members;
+        data_pair_t   **members;        /* open addressed index by key hash,
+                                           built for larger dicts only */
         data_pair_t    *members_list;
         char           *extra_free;
         char           *extra_stdfree;
         gf_lock_t       lock;
-        data_pair_t    *members_internal;
         data_pair_t     free_pair;
         gf_boolean_t    free_pair_in_use;
 };
@@ -113,6 +143,7 @@ int dict_reset (dict_t *dict);
 int32_t dict_serialized_length (dict_t *dict);
 int32_t dict_serialize (dict_t *dict, char *buf);
 int32_t dict_unserialize (char *buf, int32_t size, dict_t **fill);
+int32_t dict_unserialize_steal (char *buf, int32_t size, dict_t **fill);
 
 int32_t dict_allocate_and_serialize (dict_t *this, char **buf, u_int *length);
 
@@ -29,6 +29,11 @@
 
 #ifdef HAVE_SYS_EPOLL_H
 #include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sched.h>
+
+/* ev_data->idx of the eventfd used to wake up the poller of a shard */
+#define EVENT_SHARD_WAKEUP_IDX -1
 
 
 struct event_slot_epoll {
@@ -41,6 +46,9 @@ struct event_slot_epoll {
 	void *data;
 	event_handler_t handler;
 	gf_lock_t lock;
+	int shard;      /* sharded mode: epoll instance owning the fd */
+	int armed;      /* sharded mode: events currently set in epoll */
+	int registered; /* fd is present in an epoll instance */
 };
 
 struct event_thread_data {
@@ -48,6 +56,101 @@ struct event_thread_data {
         int    event_index;
 };
 
+
+static int
+__event_slot_epfd (struct event_pool *event_pool,
+                   struct event_slot_epoll *slot)
+{
+        if (event_pool->sharded)
+                return event_pool->shard_fd[slot->shard];
+
+        return event_pool->fd;
+}
+
+
+static int
+__event_shard_init (struct event_pool *event_pool, int shard)
+{
+        struct epoll_event  epoll_event = {0, };
+        struct event_data  *ev_data = (void *)&epoll_event.data;
+        int                 epfd = -1;
+        int                 wakeup = -1;
+
+        if (event_pool->shard_fd[shard] != -1)
+                return 0;
+
+        epfd = epoll_create (event_pool->count);
+        if (epfd == -1) {
+                gf_log ("epoll", GF_LOG_ERROR, "epoll fd creation failed "
+                        "for shard %d (%s)", shard, strerror (errno));
+                goto err;
+        }
+
+        wakeup = eventfd (0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (wakeup == -1) {
+                gf_log ("epoll", GF_LOG_ERROR, "eventfd creation failed "
+                        "for shard %d (%s)", shard, strerror (errno));
+                goto err;
+        }
+
+        epoll_event.events = EPOLLIN;
+        ev_data->idx = EVENT_SHARD_WAKEUP_IDX;
+        ev_data->gen = 0;
+        if (epoll_ctl (epfd, EPOLL_CTL_ADD, wakeup, &epoll_event) == -1) {
+                gf_log ("epoll", GF_LOG_ERROR, "failed to add eventfd to "
+                        "epoll fd of shard %d (%s)", shard, strerror (errno));
+                goto err;
+        }
+
+        event_pool->shard_fd[shard] = epfd;
+        event_pool->shard_wakeup[shard] = wakeup;
+        event_pool->shard_load[shard] = 0;
+
+        return 0;
+err:
+        if (wakeup != -1)
+                close (wakeup);
+        if (epfd != -1)
+                close (epfd);
+
+        return -1;
+}
+
+
+static void
+__event_shard_wakeup (struct event_pool *event_pool, int shard)
+{
+        uint64_t one = 1;
+
+        if (event_pool->shard_wakeup[shard] == -1)
+                return;
+
+        if (write (event_pool->shard_wakeup[shard], &one, sizeof (one)) == -1)
+                gf_log ("epoll", GF_LOG_DEBUG, "failed to wake up poller of "
+                        "shard %d (%s)", shard, strerror (errno));
+}
+
+
+/* least loaded shard among the first 'count' ones */
+static int
+__event_shard_pick (struct event_pool *event_pool, int count)
+{
+        int i = 0;
+        int best = 0;
+
+        if (count > EVENT_MAX_THREADS)
+                count = EVENT_MAX_THREADS;
+
+        for (i = 1; i < count; i++) {
+                if (event_pool->shard_fd[i] == -1)
+                        continue;
+                if (event_pool->shard_load[i] < event_pool->shard_load[best])
+                        best = i;
+        }
+
+        return best;
+}
+
 static struct event_slot_epoll *
 __event_newtable (struct event_pool *event_pool, int table_idx)
 {
@@ -119,6 +222,12 @@ __event_slot_alloc (struct event_pool *event_pool, int fd)
 			table[i].fd = fd;
 			event_pool->slots_used[table_idx]++;
 
+			if (event_pool->sharded) {
+				table[i].shard = __event_shard_pick (event_pool,
+					event_pool->eventthreadcount);
+				event_pool->shard_load[table[i].shard]++;
+			}
+
 			break;
 		}
 	}
@@ -164,6 +273,9 @@ __event_slot_dealloc (struct event_pool *event_pool, int idx)
 	slot->fd = -1;
 	event_pool->slots_used[table_idx]--;
 
+	if (event_pool->sharded)
+		event_pool->shard_load[slot->shard]--;
+
 	return;
 }
 
@@ -242,6 +354,7 @@ event_pool_new_epoll (int count, int eventthreadcount)
 {
         struct event_pool *event_pool = NULL;
         int                epfd = -1;
+        int                i = 0;
 
         event_pool = GF_CALLOC (1, sizeof (*event_pool),
                                 gf_common_mt_event_pool);
@@ -266,6 +379,11 @@ event_pool_new_epoll (int count, int eventthreadcount)
 
         event_pool->eventthreadcount = eventthreadcount;
 
+        for (i = 0; i < EVENT_MAX_THREADS; i++) {
+                event_pool->shard_fd[i] = -1;
+                event_pool->shard_wakeup[i] = -1;
+        }
+
         pthread_mutex_init (&event_pool->mutex, NULL);
 
 out:
@@ -310,6 +428,56 @@ __slot_update_events (struct event_slot_epoll *slot, int poll_in, int poll_out)
 }
 
 
+/* Adds the fd of a freshly allocated slot to its epoll instance */
+static int
+event_slot_add (struct event_pool *event_pool, struct event_slot_epoll *slot,
+		int idx, event_handler_t handler, void *data, int poll_in,
+		int poll_out)
+{
+        int                 ret = -1;
+        struct epoll_event  epoll_event = {0, };
+        struct event_data  *ev_data = (void *)&epoll_event.data;
+
+	LOCK (&slot->lock);
+	{
+		/* make epoll 'singleshot', which
+		   means we need to re-add the fd with
+		   epoll_ctl(EPOLL_CTL_MOD) after delivery of every
+		   single event. This assures us that while a poller
+		   thread has picked up and is processing an event,
+		   another poller will not try to pick this at the same
+		   time as well.
+		*/
+
+		/* In sharded mode, only the owner of the shard waits on
+		   its epoll fd, so the same fd can never be picked up by
+		   two pollers and 'singleshot' is not needed.
+		*/
+		slot->events = EPOLLPRI;
+		if (!event_pool->sharded)
+			slot->events |= EPOLLONESHOT;
+		slot->handler = handler;
+		slot->data = data;
+
+		__slot_update_events (slot, poll_in, poll_out);
+
+		epoll_event.events = slot->events;
+		ev_data->idx = idx;
+		ev_data->gen = slot->gen;
+
+		ret = epoll_ctl (__event_slot_epfd (event_pool, slot),
+				 EPOLL_CTL_ADD, slot->fd, &epoll_event);
+		if (ret == 0) {
+			slot->armed = slot->events;
+			slot->registered = 1;
+		}
+	}
+	UNLOCK (&slot->lock);
+
+	return ret;
+}
+
+
 int
 event_register_epoll (struct event_pool *event_pool, int fd,
                       event_handler_t handler,
@@ -318,8 +486,6 @@ event_register_epoll (struct event_pool *event_pool, int fd,
         int                 idx = -1;
         int                 ret = -1;
         int             destroy = 0;
-        struct epoll_event  epoll_event = {0, };
-        struct event_data  *ev_data = (void *)&epoll_event.data;
 	struct event_slot_epoll *slot = NULL;
 
 
@@ -337,56 +503,47 @@ event_register_epoll (struct event_pool *event_pool, int fd,
         pthread_mutex_lock (&event_pool->mutex);
         {
                 destroy = event_pool->destroy;
+                if (destroy == 1)
+                        goto unlock;
+
+                idx = __event_slot_alloc (event_pool, fd);
+
+                /* In sharded mode, a rebalance skips the slots that are not
+                 * registered yet. Add the fd to the shard it was given
+                 * before a rebalance can move the others around it. */
+                if (idx != -1 && event_pool->sharded) {
+                        slot = event_slot_get (event_pool, idx);
+                        ret = event_slot_add (event_pool, slot, idx, handler,
+                                              data, poll_in, poll_out);
+                }
         }
+unlock:
         pthread_mutex_unlock (&event_pool->mutex);
 
         if (destroy == 1)
                goto out;
 
-	idx = event_slot_alloc (event_pool, fd);
 	if (idx == -1) {
 		gf_log ("epoll", GF_LOG_ERROR,
 			"could not find slot for fd=%d", fd);
 		return -1;
 	}
 
-	slot = event_slot_get (event_pool, idx);
+	if (!slot) {
+		slot = event_slot_get (event_pool, idx);
+		ret = event_slot_add (event_pool, slot, idx, handler, data,
+				      poll_in, poll_out);
+	}
 
 	assert (slot->fd == fd);
 
-	LOCK (&slot->lock);
-	{
-		/* make epoll 'singleshot', which
-		   means we need to re-add the fd with
-		   epoll_ctl(EPOLL_CTL_MOD) after delivery of every
-		   single event. This assures us that while a poller
-		   thread has picked up and is processing an event,
-		   another poller will not try to pick this at the same
-		   time as well.
-		*/
-
-		slot->events = EPOLLPRI | EPOLLONESHOT;
-		slot->handler = handler;
-		slot->data = data;
-
-		__slot_update_events (slot, poll_in, poll_out);
-
-		epoll_event.events = slot->events;
-		ev_data->idx = idx;
-		ev_data->gen = slot->gen;
-
-		ret = epoll_ctl (event_pool->fd, EPOLL_CTL_ADD, fd,
-				 &epoll_event);
-		/* check ret after UNLOCK() to avoid deadlock in
-		   event_slot_unref()
-		*/
-	}
-	UNLOCK (&slot->lock);
-
+	/* check ret after UNLOCK() to avoid deadlock in
+	   event_slot_unref()
+	*/
 	if (ret == -1) {
 		gf_log ("epoll", GF_LOG_ERROR,
-			"failed to add fd(=%d) to epoll fd(=%d) (%s)",
-			fd, event_pool->fd, strerror (errno));
+			"failed to add fd(=%d) to epoll fd (%s)",
+			fd, strerror (errno));
 
 		event_slot_unref (event_pool, slot, idx);
 		idx = -1;
@@ -413,15 +570,18 @@ event_unregister_epoll_common (struct event_pool *event_pool, int fd,
 
 	LOCK (&slot->lock);
 	{
-                ret = epoll_ctl (event_pool->fd, EPOLL_CTL_DEL, fd, NULL);
+                ret = epoll_ctl (__event_slot_epfd (event_pool, slot),
+                                 EPOLL_CTL_DEL, fd, NULL);
 
                 if (ret == -1) {
                         gf_log ("epoll", GF_LOG_ERROR,
-                                "fail to del fd(=%d) from epoll fd(=%d) (%s)",
-                                fd, event_pool->fd, strerror (errno));
+                                "fail to del fd(=%d) from epoll fd (%s)",
+                                fd, strerror (errno));
                         goto unlock;
                 }
 
+		slot->registered = 0;
+
 		slot->do_close = do_close;
 		slot->gen++; /* detect unregister in dispatch_handler() */
         }
@@ -497,12 +657,18 @@ event_select_on_epoll (struct event_pool *event_pool, int fd, int idx,
 			*/
 			goto unlock;
 
-		ret = epoll_ctl (event_pool->fd, EPOLL_CTL_MOD, fd,
-				 &epoll_event);
+		if (event_pool->sharded && (slot->armed == slot->events))
+			/* level triggered, nothing to change */
+			goto unlock;
+
+		ret = epoll_ctl (__event_slot_epfd (event_pool, slot),
+				 EPOLL_CTL_MOD, fd, &epoll_event);
 		if (ret == -1) {
 			gf_log ("epoll", GF_LOG_ERROR,
 				"failed to modify fd(=%d) events to %d",
 				fd, epoll_event.events);
+		} else {
+			slot->armed = slot->events;
 		}
 	}
 unlock:
@@ -517,7 +683,7 @@ out:
 
 static int
 event_dispatch_epoll_handler (struct event_pool *event_pool,
-                              struct epoll_event *event)
+                              struct epoll_event *event, int shard)
 {
         struct event_data  *ev_data = NULL;
 	struct event_slot_epoll *slot = NULL;
@@ -558,6 +724,16 @@ event_dispatch_epoll_handler (struct event_pool *event_pool,
 			goto pre_unlock;
 		}
 
+		if (event_pool->sharded &&
+		    ((slot->shard != shard) || slot->in_handler)) {
+			/* The fd was moved to another shard after this
+			   event was fetched, or an event fetched before the
+			   move is still being handled by the previous owner,
+			   which will re-arm the fd when done.
+			*/
+			goto pre_unlock;
+		}
+
 		handler = slot->handler;
 		data = slot->data;
 
@@ -594,10 +770,13 @@ pre_unlock:
 		   thread calling event_select_on_epoll() while this
 		   thread was busy in handler()
 		*/
-                if (slot->in_handler == 0) {
+                if ((slot->in_handler == 0) &&
+                    (!event_pool->sharded || (slot->armed != slot->events))) {
                         event->events = slot->events;
-                        ret = epoll_ctl (event_pool->fd, EPOLL_CTL_MOD,
-                                         fd, event);
+                        ret = epoll_ctl (__event_slot_epfd (event_pool, slot),
+                                         EPOLL_CTL_MOD, fd, event);
+                        if (ret == 0)
+                                slot->armed = slot->events;
                 }
 	}
 post_unlock:
@@ -609,15 +788,65 @@ out:
 }
 
 
+static void
+event_shard_set_affinity (int myindex)
+{
+        cpu_set_t allowed;
+        cpu_set_t mine;
+        int       ncpus = 0;
+        int       n = 0;
+        int       cpu = 0;
+        int       ret = 0;
+
+        CPU_ZERO (&allowed);
+        ret = sched_getaffinity (0, sizeof (allowed), &allowed);
+        if (ret == -1) {
+                gf_log ("epoll", GF_LOG_WARNING, "failed to get CPU affinity "
+                        "(%s)", strerror (errno));
+                return;
+        }
+
+        ncpus = CPU_COUNT (&allowed);
+        if (ncpus <= 0)
+                return;
+
+        /* n-th CPU the process is allowed to run on */
+        n = (myindex - 1) % ncpus;
+        for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                if (CPU_ISSET (cpu, &allowed) && (n-- == 0))
+                        break;
+        }
+
+        CPU_ZERO (&mine);
+        CPU_SET (cpu, &mine);
+        ret = pthread_setaffinity_np (pthread_self (), sizeof (mine), &mine);
+        if (ret != 0) {
+                gf_log ("epoll", GF_LOG_WARNING, "failed to pin thread with "
+                        "index %d to CPU %d (%s)", myindex, cpu,
+                        strerror (ret));
+                return;
+        }
+
+        gf_log ("epoll", GF_LOG_INFO, "Pinned thread with index %d to CPU %d",
+                myindex, cpu);
+}
+
+
 static void *
 event_dispatch_epoll_worker (void *data)
 {
-        struct epoll_event  event;
+        struct epoll_event  events[EVENT_EPOLL_BATCH];
+        struct event_data  *event_data = NULL;
         int                 ret = -1;
         struct event_thread_data *ev_data = data;
 	struct event_pool  *event_pool;
         int                 myindex = -1;
         int                 timetodie = 0;
+        int                 shard = -1;
+        int                 epfd = -1;
+        int                 maxevents = 1;
+        int                 i = 0;
+        uint64_t            value = 0;
 
         GF_VALIDATE_OR_GOTO ("event", ev_data, out);
 
@@ -631,9 +860,21 @@ event_dispatch_epoll_worker (void *data)
         pthread_mutex_lock (&event_pool->mutex);
         {
                 event_pool->activethreadcount++;
+
+                epfd = event_pool->fd;
+                if (event_pool->sharded) {
+                        /* one poller per shard: fetching several events at
+                         * once cannot starve other pollers */
+                        shard = myindex - 1;
+                        epfd = event_pool->shard_fd[shard];
+                        maxevents = EVENT_EPOLL_BATCH;
+                }
         }
         pthread_mutex_unlock (&event_pool->mutex);
 
+        if (event_pool->sharded && event_pool->cpu_affinity)
+                event_shard_set_affinity (myindex);
+
 	for (;;) {
                 if (event_pool->eventthreadcount < myindex) {
                         /* ...time to die, thread count was decreased below
@@ -661,7 +902,7 @@ event_dispatch_epoll_worker (void *data)
                         }
                 }
 
-                ret = epoll_wait (event_pool->fd, &event, 1, -1);
+                ret = epoll_wait (epfd, events, maxevents, -1);
 
                 if (ret == 0)
                         /* timeout */
@@ -671,7 +912,21 @@ event_dispatch_epoll_worker (void *data)
                         /* sys call */
                         continue;
 
-		ret = event_dispatch_epoll_handler (event_pool, &event);
+                for (i = 0; i < ret; i++) {
+                        event_data = (void *)&events[i].data;
+                        if (event_data->idx == EVENT_SHARD_WAKEUP_IDX) {
+                                /* kicked by a reconfiguration */
+                                if (read (event_pool->shard_wakeup[shard],
+                                          &value, sizeof (value)) == -1)
+                                        gf_log ("epoll", GF_LOG_DEBUG,
+                                                "failed to read eventfd (%s)",
+                                                strerror (errno));
+                                continue;
+                        }
+
+                        event_dispatch_epoll_handler (event_pool, &events[i],
+                                                      shard);
+                }
         }
 out:
         if (ev_data)
@@ -767,6 +1022,118 @@ event_dispatch_epoll (struct event_pool *event_pool)
 	return ret;
 }
 
+static int
+__event_slot_migrate (struct event_pool *event_pool,
+                      struct event_slot_epoll *slot, int idx, int dst)
+{
+        struct epoll_event  epoll_event = {0, };
+        struct event_data  *ev_data = (void *)&epoll_event.data;
+        int                 src = -1;
+        int                 ret = 0;
+
+	LOCK (&slot->lock);
+	{
+		src = slot->shard;
+		if ((slot->fd == -1) || !slot->registered || (src == dst))
+			goto unlock;
+
+		ev_data->idx = idx;
+		ev_data->gen = slot->gen;
+
+		/* A poller may be running the handler for this fd right
+		   now. Add it disarmed to the new shard in that case, the
+		   handler re-arms it on its way out. */
+		if (slot->in_handler)
+			epoll_event.events = EPOLLONESHOT;
+		else
+			epoll_event.events = slot->events;
+
+		ret = epoll_ctl (event_pool->shard_fd[dst], EPOLL_CTL_ADD,
+				 slot->fd, &epoll_event);
+		if (ret == -1) {
+			gf_log ("epoll", GF_LOG_ERROR, "failed to move fd(=%d) "
+				"from shard %d to %d (%s)", slot->fd, src, dst,
+				strerror (errno));
+			goto unlock;
+		}
+
+		ret = epoll_ctl (event_pool->shard_fd[src], EPOLL_CTL_DEL,
+				 slot->fd, NULL);
+		if (ret == -1) {
+			/* roll back, the fd stays where it was */
+			gf_log ("epoll", GF_LOG_ERROR, "failed to remove fd(=%d) "
+				"from shard %d (%s)", slot->fd, src,
+				strerror (errno));
+			epoll_ctl (event_pool->shard_fd[dst], EPOLL_CTL_DEL,
+				   slot->fd, NULL);
+			goto unlock;
+		}
+
+		slot->armed = slot->in_handler ? 0 : slot->events;
+		slot->shard = dst;
+
+		event_pool->shard_load[src]--;
+		event_pool->shard_load[dst]++;
+	}
+unlock:
+	UNLOCK (&slot->lock);
+
+	return ret;
+}
+
+
+/* Spreads the registered fds over the first 'count' shards, whose pollers
+ * must be running. This is the only place where fds change hands between
+ * pollers. An fd that cannot be moved stays on its shard. Returns the
+ * number of shards that still own fds, at least 'count'. */
+static int
+__event_shards_rebalance (struct event_pool *event_pool, int count)
+{
+        struct event_slot_epoll *table = NULL;
+        int                      total = 0;
+        int                      target = 0;
+        int                      src = 0;
+        int                      dst = 0;
+        int                      needed = count;
+        int                      i = 0;
+        int                      j = 0;
+
+        for (i = 0; i < EVENT_MAX_THREADS; i++)
+                total += event_pool->shard_load[i];
+
+        target = (total + count - 1) / count;
+
+        for (i = 0; i < EVENT_EPOLL_TABLES; i++) {
+                table = event_pool->ereg[i];
+                if (!table || !event_pool->slots_used[i])
+                        continue;
+
+                for (j = 0; j < EVENT_EPOLL_SLOTS; j++) {
+                        if (table[j].fd == -1)
+                                continue;
+
+                        /* only read under event_pool->mutex */
+                        src = table[j].shard;
+                        if ((src < count) &&
+                            (event_pool->shard_load[src] <= target))
+                                continue;
+
+                        dst = __event_shard_pick (event_pool, count);
+                        if (dst == src)
+                                continue;
+
+                        if (__event_slot_migrate (event_pool, &table[j],
+                                                  i * EVENT_EPOLL_SLOTS + j,
+                                                  dst) == -1 &&
+                            src >= needed)
+                                needed = src + 1;
+                }
+        }
+
+        return needed;
+}
+
+
 int
 event_reconfigure_threads_epoll (struct event_pool *event_pool, int value)
 {
@@ -793,44 +1160,77 @@ event_reconfigure_threads_epoll (struct event_pool *event_pool, int value)
 
                 oldthreadcount = event_pool->eventthreadcount;
 
+                if (event_pool->sharded) {
+                        for (i = oldthreadcount; i < value; i++) {
+                                if (__event_shard_init (event_pool, i) != 0)
+                                        break;
+                        }
+                        /* run with the shards we could set up */
+                        if (i < value)
+                                value = (i > 0) ? i : 1;
+                }
+
                 if (oldthreadcount < value) {
                         /* create more poll threads */
                         for (i = oldthreadcount; i < value; i++) {
                                 /* Start a thread if the index at this location
                                  * is a 0, so that the older thread is confirmed
                                  * as dead */
-                                if (event_pool->pollers[i] == 0) {
-                                        ev_data = GF_CALLOC (1,
-                                                      sizeof (*ev_data),
-                                                      gf_common_mt_event_pool);
-                                        if (!ev_data) {
-                                                gf_log ("epoll", GF_LOG_WARNING,
-                                                  "Allocation failure for"
-                                                  " index %d", i);
-                                                continue;
-                                        }
-
-                                        ev_data->event_pool = event_pool;
-                                        ev_data->event_index = i + 1;
-
-                                        ret = pthread_create (&t_id, NULL,
-                                                event_dispatch_epoll_worker,
-                                                ev_data);
-                                        if (ret) {
-                                                gf_log ("epoll", GF_LOG_WARNING,
-                                                  "Failed to start thread for"
-                                                  " index %d", i);
-                                                GF_FREE (ev_data);
-                                        } else {
-                                                pthread_detach (t_id);
-                                                event_pool->pollers[i] = t_id;
-                                        }
+                                if (event_pool->pollers[i] != 0)
+                                        continue;
+
+                                ev_data = GF_CALLOC (1, sizeof (*ev_data),
+                                                     gf_common_mt_event_pool);
+                                if (!ev_data) {
+                                        gf_log ("epoll", GF_LOG_WARNING,
+                                                "Allocation failure for"
+                                                " index %d", i);
+                                        goto nothread;
+                                }
+
+                                ev_data->event_pool = event_pool;
+                                ev_data->event_index = i + 1;
+
+                                ret = pthread_create (&t_id, NULL,
+                                                      event_dispatch_epoll_worker,
+                                                      ev_data);
+                                if (ret) {
+                                        gf_log ("epoll", GF_LOG_WARNING,
+                                                "Failed to start thread for"
+                                                " index %d", i);
+                                        GF_FREE (ev_data);
+                                        goto nothread;
+                                }
+
+                                pthread_detach (t_id);
+                                event_pool->pollers[i] = t_id;
+                                continue;
+nothread:
+                                /* nobody would wait on this shard, stop
+                                 * short of it */
+                                if (event_pool->sharded) {
+                                        value = i;
+                                        break;
                                 }
                         }
                 }
 
+                /* only now that the pollers run, move fds to their shards;
+                 * the pollers of the shards that keep fds which could not be
+                 * moved stay */
+                if (event_pool->sharded && value > 0 &&
+                    value != oldthreadcount)
+                        value = __event_shards_rebalance (event_pool, value);
+
                 /* if value decreases, threads will terminate, themselves */
                 event_pool->eventthreadcount = value;
+
+                /* pollers of the shards being retired have nothing left to
+                 * wait for, kick them so that they notice */
+                if (event_pool->sharded) {
+                        for (i = value; i < oldthreadcount; i++)
+                                __event_shard_wakeup (event_pool, i);
+                }
         }
         pthread_mutex_unlock (&event_pool->mutex);
 
@@ -849,6 +1249,13 @@ event_pool_destroy_epoll (struct event_pool *event_pool)
 
         ret = close (event_pool->fd);
 
+        for (i = 0; i < EVENT_MAX_THREADS; i++) {
+                if (event_pool->shard_fd[i] != -1)
+                        close (event_pool->shard_fd[i]);
+                if (event_pool->shard_wakeup[i] != -1)
+                        close (event_pool->shard_wakeup[i]);
+        }
+
         for (i = 0; i < EVENT_EPOLL_TABLES; i++) {
                 if (event_pool->ereg[i]) {
                         table = event_pool->ereg[i];
@@ -870,6 +1277,48 @@ event_pool_destroy_epoll (struct event_pool *event_pool)
         return ret;
 }
 
+static int
+event_pool_set_sharding_epoll (struct event_pool *event_pool, int cpu_affinity)
+{
+        int ret = -1;
+        int i = 0;
+        int count = 0;
+
+        pthread_mutex_lock (&event_pool->mutex);
+        {
+                for (i = 0; i < EVENT_EPOLL_TABLES; i++) {
+                        if (event_pool->slots_used[i]) {
+                                gf_log ("epoll", GF_LOG_ERROR, "cannot shard "
+                                        "an event pool with registered fds");
+                                goto unlock;
+                        }
+                }
+
+                count = event_pool->eventthreadcount;
+                if (count > EVENT_MAX_THREADS)
+                        count = EVENT_MAX_THREADS;
+                if (count <= 0)
+                        count = 1;
+
+                for (i = 0; i < count; i++) {
+                        if (__event_shard_init (event_pool, i) != 0)
+                                goto unlock;
+                }
+
+                event_pool->sharded = 1;
+                event_pool->cpu_affinity = cpu_affinity;
+                ret = 0;
+        }
+unlock:
+        pthread_mutex_unlock (&event_pool->mutex);
+
+        if (ret == 0)
+                gf_log ("epoll", GF_LOG_INFO, "Using sharded event dispatch%s",
+                        cpu_affinity ? " with CPU affinity" : "");
+
+        return ret;
+}
+
 struct event_ops event_ops_epoll = {
         .new                       = event_pool_new_epoll,
         .event_register            = event_register_epoll,
@@ -878,7 +1327,8 @@ struct event_ops event_ops_epoll = {
         .event_unregister_close    = event_unregister_close_epoll,
         .event_dispatch            = event_dispatch_epoll,
         .event_reconfigure_threads = event_reconfigure_threads_epoll,
-        .event_pool_destroy        = event_pool_destroy_epoll
+        .event_pool_destroy        = event_pool_destroy_epoll,
+        .event_pool_set_sharding   = event_pool_set_sharding_epoll
 };
 
 #endif
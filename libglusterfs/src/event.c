@@ -145,6 +145,27 @@ out:
         return ret;
 }
 
+/* Has to be called before the first fd is registered. Fails if the event
+ * mechanism in use does not support sharding. */
+int
+event_pool_set_sharding (struct event_pool *event_pool, int cpu_affinity)
+{
+        int ret = -1;
+
+        GF_VALIDATE_OR_GOTO ("event", event_pool, out);
+
+        if (!event_pool->ops->event_pool_set_sharding) {
+                gf_log ("event", GF_LOG_WARNING, "sharded event dispatch "
+                        "is not supported by this event mechanism");
+                goto out;
+        }
+
+        ret = event_pool->ops->event_pool_set_sharding (event_pool,
+                                                        cpu_affinity);
+out:
+        return ret;
+}
+
 int
 event_pool_destroy (struct event_pool *event_pool)
 {
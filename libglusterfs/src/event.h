@@ -34,6 +34,7 @@ typedef int (*event_handler_t) (int fd, int idx, void *data,
 #define EVENT_EPOLL_TABLES 1024
 #define EVENT_EPOLL_SLOTS 1024
 #define EVENT_MAX_THREADS  32
+#define EVENT_EPOLL_BATCH  16
 
 struct event_pool {
 	struct event_ops *ops;
@@ -62,6 +63,16 @@ struct event_pool {
                                                      * and live status */
         int destroy;
         int activethreadcount;
+
+        /* Sharded mode (epoll only): every poller thread waits on its own
+         * epoll instance, and each registered fd belongs to exactly one of
+         * them. fds are only moved between shards when the number of
+         * threads is reconfigured. */
+        int sharded;
+        int cpu_affinity; /* pin poller N to the Nth allowed CPU */
+        int shard_fd[EVENT_MAX_THREADS];
+        int shard_wakeup[EVENT_MAX_THREADS]; /* eventfd to kick a poller */
+        int shard_load[EVENT_MAX_THREADS]; /* fds owned by each shard */
 };
 
 struct event_ops {
@@ -84,6 +95,9 @@ struct event_ops {
         int (*event_reconfigure_threads) (struct event_pool *event_pool,
                                           int newcount);
         int (*event_pool_destroy) (struct event_pool *event_pool);
+
+        int (*event_pool_set_sharding) (struct event_pool *event_pool,
+                                        int cpu_affinity);
 };
 
 struct event_pool *event_pool_new (int count, int eventthreadcount);
@@ -98,4 +112,5 @@ int event_dispatch (struct event_pool *event_pool);
 int event_reconfigure_threads (struct event_pool *event_pool, int value);
 int event_pool_destroy (struct event_pool *event_pool);
 int event_dispatch_destroy (struct event_pool *event_pool);
+int event_pool_set_sharding (struct event_pool *event_pool, int cpu_affinity);
 #endif /* _EVENT_H_ */
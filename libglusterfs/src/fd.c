@@ -495,6 +495,10 @@ fd_destroy (fd_t *fd)
                                 if (xl->cbks->releasedir)
                                         xl->cbks->releasedir (xl, fd);
                                 THIS = old_THIS;
+
+                                if (fd->_ctx[i].key &&
+                                    (fd->_ctx[i].xl_key != xl))
+                                        i--;
                         }
                 }
         } else {
@@ -506,6 +510,10 @@ fd_destroy (fd_t *fd)
                                 if (xl->cbks->release)
                                         xl->cbks->release (xl, fd);
                                 THIS = old_THIS;
+
+                                if (fd->_ctx[i].key &&
+                                    (fd->_ctx[i].xl_key != xl))
+                                        i--;
                         }
                 }
         }
@@ -820,11 +828,73 @@ fd_list_empty (inode_t *inode)
 }
 
 
+/* Same slot layout as the inode ctx: the xlators of the graph owning the
+ * inode table find their ctx at their xl_id, the others (and natives whose
+ * home is taken) in the first free slot. The slots are not read without
+ * fd->lock since the array is reallocated when a foreign xlator finds it
+ * full.
+ */
+static inline int
+__fd_ctx_home (fd_t *fd, xlator_t *xlator)
+{
+        if (xlator->xl_id && xlator->graph && fd->inode &&
+            (xlator->graph == fd->inode->table->xl->graph) &&
+            (xlator->xl_id < fd->xl_count))
+                return xlator->xl_id;
+
+        return -1;
+}
+
+static int
+__fd_ctx_index (fd_t *fd, xlator_t *xlator)
+{
+        int index = 0;
+        int home  = -1;
+
+        home = __fd_ctx_home (fd, xlator);
+        if (home >= 0) {
+                if (fd->_ctx[home].xl_key == xlator)
+                        return home;
+                if (!fd->_ctx[home].key)
+                        return -1;
+        }
+
+        for (index = 0; index < fd->xl_count; index++) {
+                if (fd->_ctx[index].xl_key == xlator)
+                        return index;
+        }
+
+        return -1;
+}
+
+/* Slot @index was just freed, move its owner back in if it had spilled. */
+static void
+__fd_ctx_rehome (fd_t *fd, int index)
+{
+        int       i     = 0;
+        xlator_t *owner = NULL;
+
+        for (i = 0; i < fd->xl_count; i++) {
+                owner = fd->_ctx[i].xl_key;
+                if (owner && (i != index) &&
+                    (__fd_ctx_home (fd, owner) == index))
+                        break;
+        }
+
+        if (i == fd->xl_count)
+                return;
+
+        fd->_ctx[index] = fd->_ctx[i];
+        fd->_ctx[i].key = 0;
+        fd->_ctx[i].value1 = 0;
+}
+
 int
 __fd_ctx_set (fd_t *fd, xlator_t *xlator, uint64_t value)
 {
         int             index   = 0, new_xl_count = 0;
         int             ret     = 0;
+        int             home    = -1;
         int             set_idx = -1;
         void           *begin   = NULL;
         size_t          diff    = 0;
@@ -833,16 +903,19 @@ __fd_ctx_set (fd_t *fd, xlator_t *xlator, uint64_t value)
 	if (!fd || !xlator)
 		return -1;
 
-        for (index = 0; index < fd->xl_count; index++) {
-                if (!fd->_ctx[index].key) {
-                        if (set_idx == -1)
+        set_idx = __fd_ctx_index (fd, xlator);
+        if (set_idx >= 0)
+                goto set;
+
+        home = __fd_ctx_home (fd, xlator);
+        if ((home >= 0) && !fd->_ctx[home].key) {
+                set_idx = home;
+        } else {
+                for (index = 0; index < fd->xl_count; index++) {
+                        if (!fd->_ctx[index].key) {
                                 set_idx = index;
-                        /* dont break, to check if key already exists
-                           further on */
-                }
-                if (fd->_ctx[index].xl_key == xlator) {
-                        set_idx = index;
-                        break;
+                                break;
+                        }
                 }
         }
 
@@ -876,6 +949,7 @@ __fd_ctx_set (fd_t *fd, xlator_t *xlator, uint64_t value)
                 fd->xl_count = new_xl_count;
         }
 
+set:
         fd->_ctx[set_idx].xl_key = xlator;
         fd->_ctx[set_idx].value1  = value;
 
@@ -913,12 +987,8 @@ __fd_ctx_get (fd_t *fd, xlator_t *xlator, uint64_t *value)
         if (!fd || !xlator)
                 return -1;
 
-        for (index = 0; index < fd->xl_count; index++) {
-                if (fd->_ctx[index].xl_key == xlator)
-                        break;
-        }
-
-        if (index == fd->xl_count) {
+        index = __fd_ctx_index (fd, xlator);
+        if (index < 0) {
                 ret = -1;
                 goto out;
         }
@@ -958,12 +1028,8 @@ __fd_ctx_del (fd_t *fd, xlator_t *xlator, uint64_t *value)
         if (!fd || !xlator)
                 return -1;
 
-        for (index = 0; index < fd->xl_count; index++) {
-                if (fd->_ctx[index].xl_key == xlator)
-                        break;
-        }
-
-        if (index == fd->xl_count) {
+        index = __fd_ctx_index (fd, xlator);
+        if (index < 0) {
                 ret = -1;
                 goto out;
         }
@@ -974,6 +1040,9 @@ __fd_ctx_del (fd_t *fd, xlator_t *xlator, uint64_t *value)
         fd->_ctx[index].key   = 0;
         fd->_ctx[index].value1 = 0;
 
+        if (index != __fd_ctx_home (fd, xlator))
+                __fd_ctx_rehome (fd, index);
+
 out:
         return ret;
 }
@@ -72,6 +72,8 @@ const char *gf_fop_list[GF_FOP_MAXVALUE] = {
 	[GF_FOP_DISCARD]     = "DISCARD",
         [GF_FOP_ZEROFILL]    = "ZEROFILL",
         [GF_FOP_IPC]         = "IPC",
+        [GF_FOP_SEEK]        = "SEEK",
+        [GF_FOP_COMPOUND]    = "COMPOUND",
 };
 /* THIS */
 
@@ -35,7 +35,7 @@
  */
 #define GD_OP_VERSION_MIN  1 /* MIN is the fresh start op-version, mostly
                                 should not change */
-#define GD_OP_VERSION_MAX  30700 /* MAX VERSION is the maximum count in VME
+#define GD_OP_VERSION_MAX  30701 /* MAX VERSION is the maximum count in VME
                                     table, should keep changing with
                                     introduction of newer versions */
 
@@ -43,6 +43,8 @@
 
 #define GD_OP_VERSION_3_7_0    30700 /* Op-version for GlusterFS 3.7.0 */
 
+#define GD_OP_VERSION_3_7_1    30701 /* Op-version for GlusterFS 3.7.1 */
+
 #define GD_OP_VER_PERSISTENT_AFR_XATTRS GD_OP_VERSION_3_6_0
 
 #include "xlator.h"
@@ -300,6 +300,8 @@ typedef enum {
 	GF_FOP_DISCARD,
         GF_FOP_ZEROFILL,
         GF_FOP_IPC,
+        GF_FOP_SEEK,
+        GF_FOP_COMPOUND,
         GF_FOP_MAXVALUE,
 } glusterfs_fop_t;
 
@@ -368,6 +370,12 @@ typedef enum {
         GF_XATTROP_AND_ARRAY
 } gf_xattrop_flags_t;
 
+/* values are sent over the wire */
+typedef enum {
+        GF_SEEK_DATA,
+        GF_SEEK_HOLE
+} gf_seek_what_t;
+
 
 #define GF_SET_IF_NOT_PRESENT 0x1 /* default behaviour */
 #define GF_SET_OVERWRITE      0x2 /* Overwrite with the buf given */
@@ -377,6 +385,9 @@ typedef enum {
 /* key value which quick read uses to get small files in lookup cbk */
 #define GF_CONTENT_KEY "glusterfs.content"
 
+/* xdata key carrying a struct iobuf_read_dest for zero-copy reads */
+#define GF_READ_DEST_KEY "glusterfs.read-dest"
+
 struct _xlator_cmdline_option {
         struct list_head    cmd_args;
         char               *volume;
@@ -467,6 +478,10 @@ struct _cmd_args {
 
         /* Should management connections use SSL? */
         int             secure_mgmt;
+
+        /* per-thread epoll instances, optionally pinned to CPUs */
+        int             event_sharding;
+        int             event_cpu_affinity;
 };
 typedef struct _cmd_args cmd_args_t;
 
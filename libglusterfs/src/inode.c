@@ -28,6 +28,9 @@
    move latest accessed dentry to list_head of inode
 */
 
+/* inode->ref of an inode being retired, see __inode_put() */
+#define INODE_REF_DEAD  UINT32_MAX
+
 #define INODE_DUMP_LIST(head, key_buf, key_prefix, list_type)           \
         {                                                               \
                 int i = 1;                                              \
@@ -43,6 +46,9 @@
 static inode_t *
 __inode_unref (inode_t *inode);
 
+static void
+__dentry_unhash (dentry_t *dentry);
+
 static int
 inode_table_prune (inode_table_t *table);
 
@@ -78,6 +84,79 @@ hash_gfid (uuid_t uuid, int mod)
 }
 
 
+static pthread_mutex_t *
+__hash_lock (inode_table_t *table, int hash)
+{
+        return &table->hash_locks[hash & (INODE_TABLE_HASH_LOCKS - 1)];
+}
+
+
+/* Takes a ref on @inode without table->lock, if it is referenced already
+ * and hence on the active list. Fails for an unreferenced inode, which has
+ * to be moved off the lru list, for an inode being retired, and for the
+ * root before its first ref; the caller then retries under table->lock.
+ *
+ * Without table->lock, @inode must either be referenced by the caller or be
+ * reachable through a hash bucket whose lock is held.
+ */
+static gf_boolean_t
+__inode_ref_fast (inode_t *inode)
+{
+        uint32_t ref = 0;
+        uint32_t old = 0;
+
+        ref = inode->ref;
+        while (ref && (ref != INODE_REF_DEAD)) {
+                /* refs on the root are pinned at 1, see __inode_ref() */
+                if (inode == inode->table->root)
+                        return _gf_true;
+
+                old = __sync_val_compare_and_swap (&inode->ref, ref, ref + 1);
+                if (old == ref)
+                        return _gf_true;
+                ref = old;
+        }
+
+        return _gf_false;
+}
+
+
+/* Drops a ref on @inode only if it is not the last one. */
+static gf_boolean_t
+__inode_unref_fast (inode_t *inode)
+{
+        uint32_t ref = 0;
+        uint32_t old = 0;
+
+        ref = inode->ref;
+        while ((ref > 1) && (ref != INODE_REF_DEAD)) {
+                old = __sync_val_compare_and_swap (&inode->ref, ref, ref - 1);
+                if (old == ref)
+                        return _gf_true;
+                ref = old;
+        }
+
+        return _gf_false;
+}
+
+
+/* Pruning takes table->lock once more, so only bother when there is
+ * something to do. The counters are read without the lock: a thread always
+ * sees the inodes it retired itself, and anything missed here is picked up
+ * by the next caller. */
+static gf_boolean_t
+inode_table_prune_needed (inode_table_t *table)
+{
+        if (table->purge_size)
+                return _gf_true;
+
+        if (table->lru_limit && (table->lru_size > table->lru_limit))
+                return _gf_true;
+
+        return _gf_false;
+}
+
+
 static void
 __dentry_hash (dentry_t *dentry)
 {
@@ -93,8 +172,13 @@ __dentry_hash (dentry_t *dentry)
         hash = hash_dentry (dentry->parent, dentry->name,
                             table->hashsize);
 
-        list_del_init (&dentry->hash);
-        list_add (&dentry->hash, &table->name_hash[hash]);
+        __dentry_unhash (dentry);
+
+        pthread_mutex_lock (__hash_lock (table, hash));
+        {
+                list_add (&dentry->hash, &table->name_hash[hash]);
+        }
+        pthread_mutex_unlock (__hash_lock (table, hash));
 }
 
 
@@ -113,12 +197,26 @@ __is_dentry_hashed (dentry_t *dentry)
 static void
 __dentry_unhash (dentry_t *dentry)
 {
+        inode_table_t   *table = NULL;
+        int              hash = 0;
+
         if (!dentry) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "dentry not found");
                 return;
         }
 
-        list_del_init (&dentry->hash);
+        if (list_empty (&dentry->hash))
+                return;
+
+        table = dentry->inode->table;
+        hash = hash_dentry (dentry->parent, dentry->name,
+                            table->hashsize);
+
+        pthread_mutex_lock (__hash_lock (table, hash));
+        {
+                list_del_init (&dentry->hash);
+        }
+        pthread_mutex_unlock (__hash_lock (table, hash));
 }
 
 
@@ -225,12 +323,25 @@ __is_dentry_cyclic (dentry_t *dentry)
 static void
 __inode_unhash (inode_t *inode)
 {
+        inode_table_t *table = NULL;
+        int            hash = 0;
+
         if (!inode) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "inode not found");
                 return;
         }
 
-        list_del_init (&inode->hash);
+        if (list_empty (&inode->hash))
+                return;
+
+        table = inode->table;
+        hash = hash_gfid (inode->gfid, 65536);
+
+        pthread_mutex_lock (__hash_lock (table, hash));
+        {
+                list_del_init (&inode->hash);
+        }
+        pthread_mutex_unlock (__hash_lock (table, hash));
 }
 
 
@@ -260,8 +371,13 @@ __inode_hash (inode_t *inode)
         table = inode->table;
         hash = hash_gfid (inode->gfid, 65536);
 
-        list_del_init (&inode->hash);
-        list_add (&inode->hash, &table->inode_hash[hash]);
+        __inode_unhash (inode);
+
+        pthread_mutex_lock (__hash_lock (table, hash));
+        {
+                list_add (&inode->hash, &table->inode_hash[hash]);
+        }
+        pthread_mutex_unlock (__hash_lock (table, hash));
 }
 
 
@@ -311,7 +427,7 @@ __inode_ctx_free (inode_t *inode)
                 goto noctx;
         }
 
-        for (index = 0; index < inode->table->xl->graph->xl_count; index++) {
+        for (index = 0; index < inode->table->ctxcount; index++) {
                 if (inode->_ctx[index].xl_key) {
                         xl = (xlator_t *)(long)inode->_ctx[index].xl_key;
                         old_THIS = THIS;
@@ -319,6 +435,11 @@ __inode_ctx_free (inode_t *inode)
                         if (xl->cbks->forget)
                                 xl->cbks->forget (xl, inode);
                         THIS = old_THIS;
+
+                        /* deleting a spilled ctx moves another one in */
+                        if (inode->_ctx[index].xl_key &&
+                            (inode->_ctx[index].xl_key != xl))
+                                index--;
                 }
         }
 
@@ -384,6 +505,7 @@ __inode_activate (inode_t *inode)
 
         list_move (&inode->list, &inode->table->active);
         inode->table->active_size++;
+        inode->in_lru = _gf_false;
 }
 
 
@@ -399,7 +521,10 @@ __inode_passivate (inode_t *inode)
         }
 
         list_move_tail (&inode->list, &inode->table->lru);
-        inode->table->lru_size++;
+        if (!inode->in_lru) {
+                inode->table->lru_size++;
+                inode->in_lru = _gf_true;
+        }
 
         list_for_each_entry_safe (dentry, t, &inode->dentry_list, inode_list) {
                 if (!__is_dentry_hashed (dentry))
@@ -421,12 +546,56 @@ __inode_retire (inode_t *inode)
 
         list_move_tail (&inode->list, &inode->table->purge);
         inode->table->purge_size++;
+        if (inode->in_lru) {
+                inode->table->lru_size--;
+                inode->in_lru = _gf_false;
+        }
 
         __inode_unhash (inode);
 
         list_for_each_entry_safe (dentry, t, &inode->dentry_list, inode_list) {
                 __dentry_unset (dentry);
         }
+
+        /* unreachable from the hashes now */
+        inode->ref = 0;
+}
+
+
+/* Drops @nref refs (all of them if @nref is 0) under table->lock. Dropping
+ * the last one passivates the inode, or retires it if it is not looked up
+ * any more. The ref goes straight to INODE_REF_DEAD in the latter case so
+ * that __inode_ref_fast() cannot pick the inode up again while it is being
+ * unhashed. */
+static void
+__inode_put (inode_t *inode, uint64_t nref)
+{
+        uint32_t ref = 0;
+        uint32_t old = 0;
+        uint32_t new = 0;
+
+        ref = inode->ref;
+        for (;;) {
+                new = (nref && (ref > nref)) ? (ref - nref) : 0;
+                if (!new && !inode->nlookup)
+                        new = INODE_REF_DEAD;
+
+                old = __sync_val_compare_and_swap (&inode->ref, ref, new);
+                if (old == ref)
+                        break;
+                ref = old;
+        }
+
+        if (new && (new != INODE_REF_DEAD))
+                return;
+
+        if (!inode->in_lru)
+                inode->table->active_size--;
+
+        if (new == INODE_REF_DEAD)
+                __inode_retire (inode);
+        else
+                __inode_passivate (inode);
 }
 
 
@@ -445,16 +614,7 @@ __inode_unref (inode_t *inode)
 
         GF_ASSERT (inode->ref);
 
-        --inode->ref;
-
-        if (!inode->ref) {
-                inode->table->active_size--;
-
-                if (inode->nlookup)
-                        __inode_passivate (inode);
-                else
-                        __inode_retire (inode);
-        }
+        __inode_put (inode, 1);
 
         return inode;
 }
@@ -466,7 +626,7 @@ __inode_ref (inode_t *inode)
         if (!inode)
                 return NULL;
 
-        if (!inode->ref) {
+        if (inode->in_lru) {
                 inode->table->lru_size--;
                 __inode_activate (inode);
         }
@@ -482,7 +642,7 @@ __inode_ref (inode_t *inode)
         if (__is_root_gfid(inode->gfid) && inode->ref)
                 return inode;
 
-        inode->ref++;
+        __sync_fetch_and_add (&inode->ref, 1);
 
         return inode;
 }
@@ -498,13 +658,17 @@ inode_unref (inode_t *inode)
 
         table = inode->table;
 
+        if (__inode_unref_fast (inode))
+                return inode;
+
         pthread_mutex_lock (&table->lock);
         {
                 inode = __inode_unref (inode);
         }
         pthread_mutex_unlock (&table->lock);
 
-        inode_table_prune (table);
+        if (inode_table_prune_needed (table))
+                inode_table_prune (table);
 
         return inode;
 }
@@ -520,6 +684,9 @@ inode_ref (inode_t *inode)
 
         table = inode->table;
 
+        if (__inode_ref_fast (inode))
+                return inode;
+
         pthread_mutex_lock (&table->lock);
         {
                 inode = __inode_ref (inode);
@@ -603,6 +770,7 @@ __inode_create (inode_table_t *table)
 
         list_add (&newi->list, &table->lru);
         table->lru_size++;
+        newi->in_lru = _gf_true;
 
 out:
 
@@ -650,19 +818,7 @@ __inode_ref_reduce_by_n (inode_t *inode, uint64_t nref)
 
         GF_ASSERT (inode->ref >= nref);
 
-        inode->ref -= nref;
-
-        if (!nref)
-                inode->ref = 0;
-
-        if (!inode->ref) {
-                inode->table->active_size--;
-
-                if (inode->nlookup)
-                        __inode_passivate (inode);
-                else
-                        __inode_retire (inode);
-        }
+        __inode_put (inode, nref);
 
         return inode;
 }
@@ -725,6 +881,7 @@ inode_grep (inode_table_t *table, inode_t *parent, const char *name)
 {
         inode_t   *inode = NULL;
         dentry_t  *dentry = NULL;
+        int        hash = 0;
 
         if (!table || !parent || !name) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING,
@@ -732,6 +889,21 @@ inode_grep (inode_table_t *table, inode_t *parent, const char *name)
                 return NULL;
         }
 
+        hash = hash_dentry (parent, name, table->hashsize);
+
+        pthread_mutex_lock (__hash_lock (table, hash));
+        {
+                dentry = __dentry_grep (table, parent, name);
+
+                if (dentry && __inode_ref_fast (dentry->inode))
+                        inode = dentry->inode;
+        }
+        pthread_mutex_unlock (__hash_lock (table, hash));
+
+        if (inode || !dentry)
+                return inode;
+
+        /* the inode is on the lru list, activating it needs table->lock */
         pthread_mutex_lock (&table->lock);
         {
                 dentry = __dentry_grep (table, parent, name);
@@ -798,6 +970,7 @@ inode_grep_for_gfid (inode_table_t *table, inode_t *parent, const char *name,
         inode_t   *inode = NULL;
         dentry_t  *dentry = NULL;
         int        ret = -1;
+        int        hash = 0;
 
         if (!table || !parent || !name) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING,
@@ -805,7 +978,9 @@ inode_grep_for_gfid (inode_table_t *table, inode_t *parent, const char *name,
                 return ret;
         }
 
-        pthread_mutex_lock (&table->lock);
+        hash = hash_dentry (parent, name, table->hashsize);
+
+        pthread_mutex_lock (__hash_lock (table, hash));
         {
                 dentry = __dentry_grep (table, parent, name);
 
@@ -818,7 +993,7 @@ inode_grep_for_gfid (inode_table_t *table, inode_t *parent, const char *name,
                         ret = 0;
                 }
         }
-        pthread_mutex_unlock (&table->lock);
+        pthread_mutex_unlock (__hash_lock (table, hash));
 
         return ret;
 }
@@ -873,12 +1048,29 @@ inode_t *
 inode_find (inode_table_t *table, uuid_t gfid)
 {
         inode_t   *inode = NULL;
+        int        hash = 0;
+        int        ret = 0;
 
         if (!table) {
                 gf_log_callingfn (THIS->name, GF_LOG_WARNING, "table not found");
                 return NULL;
         }
 
+        hash = hash_gfid (gfid, 65536);
+
+        pthread_mutex_lock (__hash_lock (table, hash));
+        {
+                inode = __inode_find (table, gfid);
+
+                if (inode)
+                        ret = __inode_ref_fast (inode);
+        }
+        pthread_mutex_unlock (__hash_lock (table, hash));
+
+        if (!inode || ret)
+                return inode;
+
+        /* the inode is on the lru list, activating it needs table->lock */
         pthread_mutex_lock (&table->lock);
         {
                 inode = __inode_find (table, gfid);
@@ -998,6 +1190,61 @@ __inode_link (inode_t *inode, inode_t *parent, const char *name,
 }
 
 
+/* Every lookup reply is linked, so linking an inode under the dentry it is
+ * already linked with (or a fresh inode whose gfid is) is the common case,
+ * and only needs a ref. Check for it under the bucket lock and leave
+ * everything else to __inode_link().
+ */
+static inode_t *
+inode_link_existing (inode_t *inode, inode_t *parent, const char *name,
+                     struct iatt *iatt)
+{
+        inode_table_t *table = NULL;
+        inode_t       *link_inode = NULL;
+        dentry_t      *dentry = NULL;
+        int            hash = 0;
+
+        table = inode->table;
+
+        if (parent) {
+                if (!name || parent->table != table)
+                        return NULL;
+
+                hash = hash_dentry (parent, name, table->hashsize);
+
+                pthread_mutex_lock (__hash_lock (table, hash));
+                {
+                        dentry = __dentry_grep (table, parent, name);
+
+                        /* a fresh inode resolves to the linked one */
+                        if (dentry && (dentry->inode != inode) &&
+                            !__is_inode_hashed (inode) && iatt &&
+                            gf_uuid_compare (dentry->inode->gfid,
+                                             iatt->ia_gfid) == 0)
+                                inode = dentry->inode;
+
+                        if (dentry && (dentry->inode == inode) &&
+                            __inode_ref_fast (inode))
+                                link_inode = inode;
+                }
+                pthread_mutex_unlock (__hash_lock (table, hash));
+        } else if (iatt && !gf_uuid_is_null (iatt->ia_gfid) &&
+                   gf_uuid_compare (inode->gfid, iatt->ia_gfid) == 0) {
+                hash = hash_gfid (iatt->ia_gfid, 65536);
+
+                pthread_mutex_lock (__hash_lock (table, hash));
+                {
+                        if (__is_inode_hashed (inode) &&
+                            __inode_ref_fast (inode))
+                                link_inode = inode;
+                }
+                pthread_mutex_unlock (__hash_lock (table, hash));
+        }
+
+        return link_inode;
+}
+
+
 inode_t *
 inode_link (inode_t *inode, inode_t *parent, const char *name,
             struct iatt *iatt)
@@ -1012,6 +1259,10 @@ inode_link (inode_t *inode, inode_t *parent, const char *name,
 
         table = inode->table;
 
+        linked_inode = inode_link_existing (inode, parent, name, iatt);
+        if (linked_inode)
+                return linked_inode;
+
         pthread_mutex_lock (&table->lock);
         {
                 linked_inode = __inode_link (inode, parent, name, iatt);
@@ -1021,7 +1272,8 @@ inode_link (inode_t *inode, inode_t *parent, const char *name,
         }
         pthread_mutex_unlock (&table->lock);
 
-        inode_table_prune (table);
+        if (inode_table_prune_needed (table))
+                inode_table_prune (table);
 
         return linked_inode;
 }
@@ -1067,7 +1319,8 @@ inode_ref_reduce_by_n (inode_t *inode, uint64_t nref)
         }
         pthread_mutex_unlock (&table->lock);
 
-        inode_table_prune (table);
+        if (inode_table_prune_needed (table))
+                inode_table_prune (table);
 
         return 0;
 }
@@ -1091,7 +1344,8 @@ inode_forget (inode_t *inode, uint64_t nlookup)
         }
         pthread_mutex_unlock (&table->lock);
 
-        inode_table_prune (table);
+        if (inode_table_prune_needed (table))
+                inode_table_prune (table);
 
         return 0;
 }
@@ -1187,7 +1441,8 @@ inode_unlink (inode_t *inode, inode_t *parent, const char *name)
         }
         pthread_mutex_unlock (&table->lock);
 
-        inode_table_prune (table);
+        if (inode_table_prune_needed (table))
+                inode_table_prune (table);
 }
 
 
@@ -1210,7 +1465,8 @@ inode_rename (inode_table_t *table, inode_t *srcdir, const char *srcname,
         }
         pthread_mutex_unlock (&table->lock);
 
-        inode_table_prune (table);
+        if (inode_table_prune_needed (table))
+                inode_table_prune (table);
 
         return 0;
 }
@@ -1412,7 +1668,8 @@ inode_table_set_lru_limit (inode_table_t *table, uint32_t lru_limit)
         }
         pthread_mutex_unlock (&table->lock);
 
-        inode_table_prune (table);
+        if (inode_table_prune_needed (table))
+                inode_table_prune (table);
 
         return;
 }
@@ -1438,7 +1695,16 @@ inode_table_prune (inode_table_t *table)
 
                         entry = list_entry (table->lru.next, inode_t, list);
 
-                        table->lru_size--;
+                        if (!__sync_bool_compare_and_swap (&entry->ref, 0,
+                                                           INODE_REF_DEAD)) {
+                                /* cannot happen, an inode is moved off
+                                 * the lru list when it gets its first
+                                 * ref */
+                                table->lru_size--;
+                                __inode_activate (entry);
+                                continue;
+                        }
+
                         __inode_retire (entry);
 
                         ret++;
@@ -1541,6 +1807,10 @@ inode_table_new (size_t lru_limit, xlator_t *xl)
                 INIT_LIST_HEAD (&new->name_hash[i]);
         }
 
+        for (i = 0; i < INODE_TABLE_HASH_LOCKS; i++) {
+                pthread_mutex_init (&new->hash_locks[i], NULL);
+        }
+
         INIT_LIST_HEAD (&new->active);
         INIT_LIST_HEAD (&new->lru);
         INIT_LIST_HEAD (&new->purge);
@@ -1660,6 +1930,7 @@ void
 inode_table_destroy (inode_table_t *inode_table) {
 
         inode_t  *tmp = NULL, *trav = NULL;
+        int       i = 0;
 
         if (inode_table == NULL)
                 return;
@@ -1688,6 +1959,13 @@ inode_table_destroy (inode_table_t *inode_table) {
          */
         pthread_mutex_lock (&inode_table->lock);
         {
+                list_for_each_entry_safe (trav, tmp, &inode_table->lru, list) {
+                        if (trav->ref) {
+                                inode_table->lru_size--;
+                                __inode_activate (trav);
+                        }
+                }
+
                 list_for_each_entry_safe (trav, tmp, &inode_table->active, list) {
                         __inode_ref_reduce_by_n (trav, 0);
                 }
@@ -1711,6 +1989,9 @@ inode_table_destroy (inode_table_t *inode_table) {
 
         pthread_mutex_destroy (&inode_table->lock);
 
+        for (i = 0; i < INODE_TABLE_HASH_LOCKS; i++)
+                pthread_mutex_destroy (&inode_table->hash_locks[i]);
+
         GF_FREE (inode_table->name);
         GF_FREE (inode_table);
 
@@ -1776,40 +2057,156 @@ out:
 }
 
 
+/* Every xlator of the graph owning the inode table has a home slot in
+ * inode->_ctx: its xl_id (slot 0 is left to xlators outside of that graph,
+ * like fuse). Foreign xlators take the first free slot, which can be the
+ * home of a native xlator that has no ctx yet; that one then spills to a
+ * free slot of its own. A home slot is handed back to its owner as soon as
+ * the squatter leaves (__inode_ctx_rehome), so an empty home slot always
+ * means that its owner has no ctx on this inode.
+ */
+static inline int
+__inode_ctx_home (inode_t *inode, xlator_t *xlator)
+{
+        if (xlator->xl_id && xlator->graph &&
+            (xlator->graph == inode->table->xl->graph) &&
+            (xlator->xl_id < inode->table->ctxcount))
+                return xlator->xl_id;
+
+        return -1;
+}
+
+static int
+__inode_ctx_index (inode_t *inode, xlator_t *xlator)
+{
+        int index = 0;
+        int home  = -1;
+
+        home = __inode_ctx_home (inode, xlator);
+        if (home >= 0) {
+                if (inode->_ctx[home].xl_key == xlator)
+                        return home;
+                if (!inode->_ctx[home].xl_key)
+                        return -1;
+        }
+
+        for (index = 0; index < inode->table->ctxcount; index++) {
+                if (inode->_ctx[index].xl_key == xlator)
+                        return index;
+        }
+
+        return -1;
+}
+
+/* Slot @index was just freed, move its owner back in if it had spilled. */
+static void
+__inode_ctx_rehome (inode_t *inode, int index)
+{
+        int                i     = 0;
+        xlator_t          *owner = NULL;
+        struct _inode_ctx *from  = NULL;
+        struct _inode_ctx *to    = NULL;
+
+        to = &inode->_ctx[index];
+
+        for (i = 0; i < inode->table->ctxcount; i++) {
+                owner = inode->_ctx[i].xl_key;
+                if (owner && (i != index) &&
+                    (__inode_ctx_home (inode, owner) == index))
+                        break;
+        }
+
+        if (i == inode->table->ctxcount)
+                return;
+
+        from = &inode->_ctx[i];
+
+        to->value1 = from->value1;
+        to->value2 = from->value2;
+        __atomic_store_n (&to->xl_key, owner, __ATOMIC_RELEASE);
+
+        __atomic_store_n (&from->xl_key, NULL, __ATOMIC_RELEASE);
+        from->value1 = 0;
+        from->value2 = 0;
+}
+
+/* Lock-free read of one of the values in the home slot of @xlator. The
+ * owner is checked again after the value is read, so that a slot being
+ * freed or handed over in between is noticed. Only a hit is reported, the
+ * caller takes the lock for everything else.
+ */
+static int
+inode_ctx_get_home (inode_t *inode, xlator_t *xlator, int second,
+                    uint64_t *value)
+{
+        int                home = -1;
+        uint64_t           tmp  = 0;
+        struct _inode_ctx *slot = NULL;
+
+        if (!inode->_ctx)
+                return -1;
+
+        home = __inode_ctx_home (inode, xlator);
+        if (home < 0)
+                return -1;
+
+        slot = &inode->_ctx[home];
+        if (__atomic_load_n (&slot->xl_key, __ATOMIC_ACQUIRE) != xlator)
+                return -1;
+
+        tmp = __atomic_load_n (second ? &slot->value2 : &slot->value1,
+                               __ATOMIC_ACQUIRE);
+        if (!tmp ||
+            (__atomic_load_n (&slot->xl_key, __ATOMIC_ACQUIRE) != xlator))
+                return -1;
+
+        *value = tmp;
+        return 0;
+}
+
 int
 __inode_ctx_set2 (inode_t *inode, xlator_t *xlator, uint64_t *value1_p,
                   uint64_t *value2_p)
 {
         int ret = 0;
         int index = 0;
+        int home = -1;
         int set_idx = -1;
 
         if (!inode || !xlator || !inode->_ctx)
                 return -1;
 
-        for (index = 0; index < inode->table->ctxcount; index++) {
-                if (!inode->_ctx[index].xl_key) {
-                        if (set_idx == -1)
+        set_idx = __inode_ctx_index (inode, xlator);
+        if (set_idx >= 0) {
+                if (value1_p)
+                        inode->_ctx[set_idx].value1 = *value1_p;
+                if (value2_p)
+                        inode->_ctx[set_idx].value2 = *value2_p;
+                goto out;
+        }
+
+        home = __inode_ctx_home (inode, xlator);
+        if ((home >= 0) && !inode->_ctx[home].xl_key) {
+                set_idx = home;
+        } else {
+                for (index = 0; index < inode->table->ctxcount; index++) {
+                        if (!inode->_ctx[index].xl_key) {
                                 set_idx = index;
-                        /* dont break, to check if key already exists
-                           further on */
-                }
-                if (inode->_ctx[index].xl_key == xlator) {
-                        set_idx = index;
-                        break;
+                                break;
+                        }
                 }
         }
 
         if (set_idx == -1) {
                 ret = -1;
-                goto out;;
+                goto out;
         }
 
-        inode->_ctx[set_idx].xl_key = xlator;
-        if (value1_p)
-                inode->_ctx[set_idx].value1 = *value1_p;
-        if (value2_p)
-                inode->_ctx[set_idx].value2 = *value2_p;
+        /* values first, lock-free readers trust them once the key shows */
+        inode->_ctx[set_idx].value1 = (value1_p) ? *value1_p : 0;
+        inode->_ctx[set_idx].value2 = (value2_p) ? *value2_p : 0;
+        __atomic_store_n (&inode->_ctx[set_idx].xl_key, xlator,
+                          __ATOMIC_RELEASE);
 out:
         return ret;
 }
@@ -1889,12 +2286,8 @@ __inode_ctx_get2 (inode_t *inode, xlator_t *xlator, uint64_t *value1,
         if (!inode || !xlator || !inode->_ctx)
                 goto out;
 
-        for (index = 0; index < inode->table->ctxcount; index++) {
-                if (inode->_ctx[index].xl_key == xlator)
-                        break;
-        }
-
-        if (index == inode->table->ctxcount)
+        index = __inode_ctx_index (inode, xlator);
+        if (index < 0)
                 goto out;
 
         if (inode->_ctx[index].value1) {
@@ -1962,10 +2355,17 @@ int
 inode_ctx_get1 (inode_t *inode, xlator_t *xlator, uint64_t *value2)
 {
         int ret = 0;
+        uint64_t tmp_value = 0;
 
         if (!inode || !xlator)
                 return -1;
 
+        if (!inode_ctx_get_home (inode, xlator, 1, &tmp_value)) {
+                if (value2)
+                        *value2 = tmp_value;
+                return 0;
+        }
+
         LOCK (&inode->lock);
         {
                 ret = __inode_ctx_get1 (inode, xlator, value2);
@@ -1979,10 +2379,17 @@ int
 inode_ctx_get0 (inode_t *inode, xlator_t *xlator, uint64_t *value1)
 {
         int ret = 0;
+        uint64_t tmp_value = 0;
 
         if (!inode || !xlator)
                 return -1;
 
+        if (!inode_ctx_get_home (inode, xlator, 0, &tmp_value)) {
+                if (value1)
+                        *value1 = tmp_value;
+                return 0;
+        }
+
         LOCK (&inode->lock);
         {
                 ret = __inode_ctx_get0 (inode, xlator, value1);
@@ -2008,13 +2415,8 @@ inode_ctx_del2 (inode_t *inode, xlator_t *xlator, uint64_t *value1,
                 if (!inode->_ctx)
                         goto unlock;
 
-                for (index = 0; index < inode->table->ctxcount;
-                     index++) {
-                        if (inode->_ctx[index].xl_key == xlator)
-                                break;
-                }
-
-                if (index == inode->table->ctxcount) {
+                index = __inode_ctx_index (inode, xlator);
+                if (index < 0) {
                         ret = -1;
                         goto unlock;
                 }
@@ -2024,10 +2426,13 @@ inode_ctx_del2 (inode_t *inode, xlator_t *xlator, uint64_t *value1,
                 if (inode->_ctx[index].value2 && value2)
                         *value2 = inode->_ctx[index].value2;
 
-                inode->_ctx[index].key    = 0;
-                inode->_ctx[index].xl_key = NULL;
+                __atomic_store_n (&inode->_ctx[index].xl_key, NULL,
+                                  __ATOMIC_RELEASE);
                 inode->_ctx[index].value1 = 0;
                 inode->_ctx[index].value2 = 0;
+
+                if (index != __inode_ctx_home (inode, xlator))
+                        __inode_ctx_rehome (inode, index);
         }
 unlock:
         UNLOCK (&inode->lock);
@@ -2054,13 +2459,8 @@ __inode_ctx_reset2 (inode_t *inode, xlator_t *xlator, uint64_t *value1,
 
         LOCK (&inode->lock);
         {
-                for (index = 0; index < inode->table->ctxcount;
-                     index++) {
-                        if (inode->_ctx[index].xl_key == xlator)
-                                break;
-                }
-
-                if (index == inode->table->ctxcount) {
+                index = __inode_ctx_index (inode, xlator);
+                if (index < 0) {
                         ret = -1;
                         goto unlock;
                 }
@@ -21,6 +21,9 @@
 
 #define DEFAULT_INODE_MEMPOOL_ENTRIES   32 * 1024
 #define INODE_PATH_FMT "<gfid:%s>"
+
+/* number of locks striping the inode and dentry hash buckets, power of two */
+#define INODE_TABLE_HASH_LOCKS          64
 struct _inode_table;
 typedef struct _inode_table inode_table_t;
 
@@ -36,8 +39,21 @@ typedef struct _dentry dentry_t;
 #include "compat-uuid.h"
 #include "fd.h"
 
+/*
+ * Locking:
+ *  - table->lock serializes every change to the hashes, the dentry lists and
+ *    the active/lru/purge lists, and every drop of the last inode->ref.
+ *  - a bucket of inode_hash or name_hash is additionally guarded by
+ *    hash_locks[bucket % INODE_TABLE_HASH_LOCKS], so inode_find, inode_grep
+ *    and inode_link of an already linked dentry only take that lock.
+ *  - inode->ref is updated atomically. An inode referenced without
+ *    table->lock stays on the lru list (in_lru) until inode_table_prune or
+ *    the next locked ref moves it to the active list.
+ * Lock order is table->lock -> hash_locks[].
+ */
 struct _inode_table {
         pthread_mutex_t    lock;
+        pthread_mutex_t    hash_locks[INODE_TABLE_HASH_LOCKS];
         size_t             hashsize;    /* bucket size of inode hash and dentry hash */
         char              *name;        /* name of the inode table, just for gf_log() */
         inode_t           *root;        /* root directory inode, with number 1 */
@@ -97,6 +113,8 @@ struct _inode {
         struct list_head     dentry_list;   /* list of directory entries for this inode */
         struct list_head     hash;          /* hash table pointers */
         struct list_head     list;          /* active/lru/purge */
+        gf_boolean_t         in_lru;        /* on the lru list, possibly
+                                               with refs taken lazily */
 
 	struct _inode_ctx   *_ctx;    /* replacement for dict_t *(inode->ctx) */
 };
@@ -149,6 +149,11 @@ __iobuf_arena_destroy (struct iobuf_pool *iobuf_pool,
                 iobuf_pool->rdma_deregistration (iobuf_pool->mr_list,
                                                  iobuf_arena);
 
+        if (iobuf_pool->arena_removed && iobuf_arena->mem_base
+            && iobuf_arena->mem_base != MAP_FAILED)
+                iobuf_pool->arena_removed (iobuf_pool->arena_hook_data,
+                                           iobuf_arena);
+
         __iobuf_arena_destroy_iobufs (iobuf_arena);
 
         if (iobuf_arena->mem_base
@@ -201,6 +206,10 @@ __iobuf_arena_alloc (struct iobuf_pool *iobuf_pool, size_t page_size,
                                                iobuf_arena);
         }
 
+        if (iobuf_pool->arena_added)
+                iobuf_pool->arena_added (iobuf_pool->arena_hook_data,
+                                         iobuf_arena);
+
         list_add_tail (&iobuf_arena->all_list, &iobuf_pool->all_arenas);
 
         __iobuf_arena_init_iobufs (iobuf_arena);
@@ -433,6 +442,62 @@ out:
 }
 
 
+/* Only one user at a time. @added is called for the arenas that exist
+ * already, and later for each new one; @removed before an arena is
+ * unmapped. Both run under the pool mutex. */
+int
+iobuf_pool_set_arena_hooks (struct iobuf_pool *iobuf_pool, void *data,
+                            void (*added) (void *, struct iobuf_arena *),
+                            void (*removed) (void *, struct iobuf_arena *))
+{
+        struct iobuf_arena *iobuf_arena = NULL;
+        int                 ret         = -1;
+
+        GF_VALIDATE_OR_GOTO ("iobuf", iobuf_pool, out);
+
+        pthread_mutex_lock (&iobuf_pool->mutex);
+        {
+                if (iobuf_pool->arena_hook_data) {
+                        ret = -EBUSY;
+                        goto unlock;
+                }
+
+                iobuf_pool->arena_hook_data = data;
+                iobuf_pool->arena_added = added;
+                iobuf_pool->arena_removed = removed;
+
+                list_for_each_entry (iobuf_arena, &iobuf_pool->all_arenas,
+                                     all_list)
+                        added (data, iobuf_arena);
+
+                ret = 0;
+        }
+unlock:
+        pthread_mutex_unlock (&iobuf_pool->mutex);
+out:
+        return ret;
+}
+
+
+void
+iobuf_pool_clear_arena_hooks (struct iobuf_pool *iobuf_pool, void *data)
+{
+        GF_VALIDATE_OR_GOTO ("iobuf", iobuf_pool, out);
+
+        pthread_mutex_lock (&iobuf_pool->mutex);
+        {
+                if (iobuf_pool->arena_hook_data == data) {
+                        iobuf_pool->arena_hook_data = NULL;
+                        iobuf_pool->arena_added = NULL;
+                        iobuf_pool->arena_removed = NULL;
+                }
+        }
+        pthread_mutex_unlock (&iobuf_pool->mutex);
+out:
+        return;
+}
+
+
 void
 __iobuf_arena_prune (struct iobuf_pool *iobuf_pool,
                      struct iobuf_arena *iobuf_arena, int index)
@@ -673,6 +738,53 @@ unlock:
         return iobuf;
 }
 
+/* Wraps memory owned by the caller (an application buffer handed to gfapi)
+ * in an iobuf, so that it can travel down the stack in an iobref like any
+ * other payload. Only the iobuf itself is freed on the last unref.
+ */
+struct iobuf *
+iobuf_get_external (struct iobuf_pool *iobuf_pool, void *ptr)
+{
+        struct iobuf       *iobuf       = NULL;
+        struct iobuf_arena *iobuf_arena = NULL;
+        struct iobuf_arena *trav        = NULL;
+
+        GF_VALIDATE_OR_GOTO ("iobuf", iobuf_pool, out);
+        GF_VALIDATE_OR_GOTO ("iobuf", ptr, out);
+
+        /* accounted along with the stdalloc iobufs */
+        list_for_each_entry (trav, &iobuf_pool->arenas[IOBUF_ARENA_MAX_INDEX],
+                             list) {
+                iobuf_arena = trav;
+                break;
+        }
+
+        iobuf = GF_CALLOC (1, sizeof (*iobuf), gf_common_mt_iobuf);
+        if (!iobuf)
+                goto out;
+
+        iobuf->ptr = ptr;
+        iobuf->free_ptr = NULL;
+        iobuf->iobuf_arena = iobuf_arena;
+        LOCK_INIT (&iobuf->lock);
+
+        iobuf->ref = 1;
+out:
+        return iobuf;
+}
+
+
+static gf_boolean_t
+iobuf_is_external (struct iobuf *iobuf)
+{
+        if (iobuf->free_ptr || !iobuf->iobuf_arena)
+                return _gf_false;
+
+        return (gf_iobuf_get_arena_index (iobuf->iobuf_arena->page_size)
+                == -1);
+}
+
+
 struct iobuf *
 iobuf_get (struct iobuf_pool *iobuf_pool)
 {
@@ -1076,6 +1188,102 @@ out:
         return size;
 }
 
+/* true when any of the iobufs in @iobref points to caller-owned memory,
+ * which must not be kept beyond the fop that brought it in */
+gf_boolean_t
+iobref_has_external (struct iobref *iobref)
+{
+        gf_boolean_t external = _gf_false;
+        int          i = 0;
+
+        GF_VALIDATE_OR_GOTO ("iobuf", iobref, out);
+
+        LOCK (&iobref->lock);
+        {
+                for (i = 0; i < iobref->alloced; i++) {
+                        if (!iobref->iobrefs[i])
+                                break;
+                        if (iobuf_is_external (iobref->iobrefs[i])) {
+                                external = _gf_true;
+                                break;
+                        }
+                }
+        }
+        UNLOCK (&iobref->lock);
+
+out:
+        return external;
+}
+
+
+/* Copies @vector into a private iobuf, for translators that need to keep
+ * or modify data that may live in caller-owned memory. On success @copy
+ * describes the data and @iobref holds the new iobuf.
+ */
+int
+iobuf_copy_iovec (struct iobuf_pool *iobuf_pool, const struct iovec *vector,
+                  int count, struct iovec *copy, struct iobref **iobref)
+{
+        struct iobuf  *iobuf = NULL;
+        size_t         size  = 0;
+        int            ret   = -1;
+
+        GF_VALIDATE_OR_GOTO ("iobuf", iobuf_pool, out);
+        GF_VALIDATE_OR_GOTO ("iobuf", copy, out);
+        GF_VALIDATE_OR_GOTO ("iobuf", iobref, out);
+
+        size = iov_length (vector, count);
+
+        iobuf = iobuf_get2 (iobuf_pool, size);
+        if (!iobuf)
+                goto out;
+
+        *iobref = iobref_new ();
+        if (!*iobref)
+                goto out;
+
+        ret = iobref_add (*iobref, iobuf);
+        if (ret) {
+                iobref_unref (*iobref);
+                *iobref = NULL;
+                goto out;
+        }
+
+        iov_unload (iobuf_ptr (iobuf), vector, count);
+
+        copy->iov_base = iobuf_ptr (iobuf);
+        copy->iov_len = size;
+out:
+        if (iobuf)
+                iobuf_unref (iobuf);
+
+        return ret;
+}
+
+
+/* Claims @dest as the destination of a read of @size bytes at @offset.
+ * Only a read that matches the one the destination was registered for is
+ * accepted, and only once, so that translators fanning a read out to
+ * several subvolumes (or retrying it) never have two transports writing
+ * into the same memory.
+ */
+int
+iobuf_read_dest_claim (struct iobuf_read_dest *dest, off_t offset,
+                       size_t size)
+{
+        if (!dest || !dest->iobref)
+                return -1;
+
+        if ((dest->offset != offset) || (dest->vector.iov_len != size))
+                return -1;
+
+        if (!__sync_bool_compare_and_swap (&dest->claimed, 0, 1))
+                return -1;
+
+        return 0;
+}
+
+
 void
 iobuf_info_dump (struct iobuf *iobuf, const char *key_prefix)
 {
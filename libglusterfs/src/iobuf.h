@@ -132,6 +132,12 @@ struct iobuf_pool {
         int (*rdma_registration)(void **, void*);
         int (*rdma_deregistration)(struct list_head**, struct iobuf_arena *);
 
+        /* another user of the arena memory, told about each arena while it
+           is mapped (the posix io_uring engine registers them with the
+           kernel as fixed buffers) */
+        void                *arena_hook_data;
+        void (*arena_added) (void *, struct iobuf_arena *);
+        void (*arena_removed) (void *, struct iobuf_arena *);
 };
 
 
@@ -142,6 +148,11 @@ void iobuf_unref (struct iobuf *iobuf);
 struct iobuf *iobuf_ref (struct iobuf *iobuf);
 void iobuf_pool_destroy (struct iobuf_pool *iobuf_pool);
 void iobuf_to_iovec(struct iobuf *iob, struct iovec *iov);
+int iobuf_pool_set_arena_hooks (struct iobuf_pool *iobuf_pool, void *data,
+                                void (*added) (void *, struct iobuf_arena *),
+                                void (*removed) (void *,
+                                                 struct iobuf_arena *));
+void iobuf_pool_clear_arena_hooks (struct iobuf_pool *iobuf_pool, void *data);
 
 #define iobuf_ptr(iob) ((iob)->ptr)
 #define iobpool_default_pagesize(iobpool) ((iobpool)->default_page_size)
@@ -163,6 +174,25 @@ int iobref_add (struct iobref *iobref, struct iobuf *iobuf);
 int iobref_merge (struct iobref *to, struct iobref *from);
 void iobref_clear (struct iobref *iobref);
 
+/* Caller-supplied destination for the payload of a read. It is passed
+ * down in xdata under GF_READ_DEST_KEY, and the protocol client that
+ * claims it has the transport read the reply payload straight into
+ * @vector instead of into a fresh iobuf.
+ */
+struct iobuf_read_dest {
+        struct iobref     *iobref;   /* holds the external iobuf */
+        struct iovec       vector;
+        off_t              offset;
+        int                claimed;
+};
+
+struct iobuf *iobuf_get_external (struct iobuf_pool *iobuf_pool, void *ptr);
+gf_boolean_t iobref_has_external (struct iobref *iobref);
+int iobuf_copy_iovec (struct iobuf_pool *iobuf_pool, const struct iovec *vector,
+                      int count, struct iovec *copy, struct iobref **iobref);
+int iobuf_read_dest_claim (struct iobuf_read_dest *dest, off_t offset,
+                           size_t size);
+
 size_t iobuf_size (struct iobuf *iobuf);
 size_t iobref_size (struct iobref *iobref);
 void   iobuf_stats_dump (struct iobuf_pool *iobuf_pool);
@@ -14,13 +14,10 @@
 #include <stdlib.h>
 #include <stdarg.h>
 
-#define GF_MEM_POOL_LIST_BOUNDARY        (sizeof(struct list_head))
-#define GF_MEM_POOL_PTR                  (sizeof(struct mem_pool*))
-#define GF_MEM_POOL_PAD_BOUNDARY         (GF_MEM_POOL_LIST_BOUNDARY  + GF_MEM_POOL_PTR + sizeof(int))
+#define GF_MEM_POOL_PAD_BOUNDARY         (sizeof (struct mem_pool_chunk))
 #define mem_pool_chunkhead2ptr(head)     ((head) + GF_MEM_POOL_PAD_BOUNDARY)
 #define mem_pool_ptr2chunkhead(ptr)      ((ptr) - GF_MEM_POOL_PAD_BOUNDARY)
 #define is_mem_chunk_in_use(ptr)         (*ptr == 1)
-#define mem_pool_from_ptr(ptr)           ((ptr) + GF_MEM_POOL_LIST_BOUNDARY)
 
 #define GLUSTERFS_ENV_MEM_ACCT_STR  "GLUSTERFS_DISABLE_MEM_ACCT"
 
@@ -320,23 +317,404 @@ free:
 
 
 
+/*
+ * Every chunk handed out by a pool is preceded by this header. The pool and
+ * slab back-pointers are set once when the slab is carved and never change.
+ * Chunks which did not come from a slab (DEBUG builds) have a NULL slab.
+ */
+struct mem_pool_chunk {
+        struct list_head       list;
+        struct mem_pool       *pool;
+        struct mem_pool_slab  *slab;
+        int                    in_use;
+} __attribute__ ((aligned (8)));
+
+struct mem_pool_slab {
+        struct list_head  slabs;        /* pool->partial/full_slabs */
+        struct list_head  free;         /* cold chunks of this slab */
+        unsigned long     count;
+        unsigned long     cold;
+        void             *base;
+};
+
+struct mem_pool_magazine {
+        struct list_head  list;         /* pool->depot_full/empty */
+        int               count;
+        void             *chunks[GF_MEM_POOL_MAGAZINE_SIZE];
+};
+
+/*
+ * Per-thread cache of one pool. Each thread owns a table of these indexed
+ * by pool->cache_id. A slot is only valid while (pool, gen) match the pool
+ * that currently owns the id; slots of destroyed pools are recycled without
+ * touching the chunks they still reference.
+ */
+struct mem_pool_cache {
+        struct mem_pool          *pool;
+        uint64_t                  gen;
+        uint64_t                  hits;
+        struct mem_pool_magazine *loaded;
+        struct mem_pool_magazine *prev;
+};
+
+static pthread_once_t   mem_pool_cache_once = PTHREAD_ONCE_INIT;
+static pthread_key_t    mem_pool_cache_key;
+static pthread_mutex_t  mem_pool_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct mem_pool *mem_pool_registry[GF_MEM_POOL_MAX_CACHED];
+static uint64_t         mem_pool_registry_gen;
+
+static void __mem_pool_put_chunk (struct mem_pool *pool,
+                                  struct mem_pool_chunk *chunk);
+
+static void
+mem_pool_cache_destroy (void *data)
+{
+        struct mem_pool_cache *caches = data;
+        struct mem_pool_cache *cache = NULL;
+        struct mem_pool       *pool = NULL;
+        int                    i = 0;
+
+        if (!caches)
+                return;
+
+        pthread_mutex_lock (&mem_pool_registry_lock);
+        for (i = 0; i < GF_MEM_POOL_MAX_CACHED; i++) {
+                cache = &caches[i];
+                pool = cache->pool;
+
+                if (pool && (mem_pool_registry[i] == pool) &&
+                    (pool->cache_gen == cache->gen)) {
+                        /* hand whatever this thread still holds back to
+                         * the slabs so that exiting threads do not pin
+                         * chunks forever */
+                        LOCK (&pool->lock);
+                        {
+                                pool->cache_hits += cache->hits;
+                                pool->alloc_count += cache->hits;
+                                while (cache->loaded->count)
+                                        __mem_pool_put_chunk (pool,
+                                        cache->loaded->chunks
+                                        [--cache->loaded->count]);
+                                while (cache->prev->count)
+                                        __mem_pool_put_chunk (pool,
+                                        cache->prev->chunks
+                                        [--cache->prev->count]);
+                        }
+                        UNLOCK (&pool->lock);
+                }
+
+                FREE (cache->loaded);
+                FREE (cache->prev);
+        }
+        pthread_mutex_unlock (&mem_pool_registry_lock);
+
+        FREE (caches);
+}
+
+static void
+mem_pool_cache_key_init (void)
+{
+        if (pthread_key_create (&mem_pool_cache_key, mem_pool_cache_destroy))
+                gf_log ("mem-pool", GF_LOG_WARNING, "per-thread mem-pool "
+                        "caches disabled: unable to create thread key");
+        else
+                mem_pool_registry_gen = 1;
+}
+
+static struct mem_pool_cache *
+mem_pool_thread_cache (struct mem_pool *pool)
+{
+        struct mem_pool_cache *caches = NULL;
+        struct mem_pool_cache *cache = NULL;
+
+        if (pool->cache_id < 0)
+                return NULL;
+
+        caches = pthread_getspecific (mem_pool_cache_key);
+        if (!caches) {
+                caches = CALLOC (GF_MEM_POOL_MAX_CACHED, sizeof (*caches));
+                if (!caches)
+                        return NULL;
+                if (pthread_setspecific (mem_pool_cache_key, caches)) {
+                        FREE (caches);
+                        return NULL;
+                }
+        }
+
+        cache = &caches[pool->cache_id];
+        if ((cache->pool == pool) && (cache->gen == pool->cache_gen))
+                return cache;
+
+        /* first use of this slot, or the pool which owned it was
+         * destroyed: whatever the magazines point to is gone */
+        if (!cache->loaded)
+                cache->loaded = CALLOC (1, sizeof (*cache->loaded));
+        if (!cache->prev)
+                cache->prev = CALLOC (1, sizeof (*cache->prev));
+        if (!cache->loaded || !cache->prev) {
+                cache->pool = NULL;
+                return NULL;
+        }
+
+        cache->loaded->count = 0;
+        cache->prev->count = 0;
+        cache->hits = 0;
+        cache->gen = pool->cache_gen;
+        cache->pool = pool;
+
+        return cache;
+}
+
+static inline void
+mem_pool_cache_swap (struct mem_pool_cache *cache)
+{
+        struct mem_pool_magazine *mag = cache->loaded;
+
+        cache->loaded = cache->prev;
+        cache->prev = mag;
+}
+
+static void
+mem_pool_lock (struct mem_pool *pool)
+{
+        if (TRY_LOCK (&pool->lock) == 0)
+                return;
+
+        LOCK (&pool->lock);
+        pool->lock_contention++;
+}
+
+static struct mem_pool_slab *
+__mem_pool_slab_new (struct mem_pool *pool)
+{
+        struct mem_pool_slab  *slab = NULL;
+        struct mem_pool_chunk *chunk = NULL;
+        unsigned long          i = 0;
+
+        slab = GF_CALLOC (1, sizeof (*slab) +
+                          (pool->slab_size * pool->padded_sizeof_type),
+                          gf_common_mt_mem_pool);
+        if (!slab)
+                return NULL;
+
+        INIT_LIST_HEAD (&slab->slabs);
+        INIT_LIST_HEAD (&slab->free);
+        slab->count = pool->slab_size;
+        slab->cold = pool->slab_size;
+        slab->base = (void *)(slab + 1);
+
+        for (i = 0; i < slab->count; i++) {
+                chunk = slab->base + (i * pool->padded_sizeof_type);
+                chunk->pool = pool;
+                chunk->slab = slab;
+                list_add_tail (&chunk->list, &slab->free);
+        }
+
+        list_add (&slab->slabs, &pool->partial_slabs);
+        pool->cold_count += slab->count;
+        pool->slab_count++;
+        if (pool->max_slab_count < pool->slab_count)
+                pool->max_slab_count = pool->slab_count;
+
+        return slab;
+}
+
+static void
+__mem_pool_slab_destroy (struct mem_pool *pool, struct mem_pool_slab *slab)
+{
+        list_del (&slab->slabs);
+        pool->cold_count -= slab->count;
+        pool->slab_count--;
+
+        GF_FREE (slab);
+}
+
+static struct mem_pool_chunk *
+__mem_pool_get_chunk (struct mem_pool *pool, gf_boolean_t grow)
+{
+        struct mem_pool_slab  *slab = NULL;
+        struct mem_pool_chunk *chunk = NULL;
+
+#ifdef DEBUG
+        /* keep every object a separate heap allocation so that valgrind
+         * and friends can track it */
+        if (!grow)
+                return NULL;
+
+        chunk = GF_CALLOC (1, pool->padded_sizeof_type,
+                           gf_common_mt_mem_pool);
+        if (!chunk)
+                return NULL;
+
+        chunk->pool = pool;
+        pool->curr_stdalloc++;
+        if (pool->max_stdalloc < pool->curr_stdalloc)
+                pool->max_stdalloc = pool->curr_stdalloc;
+
+        return chunk;
+#endif
+
+        if (list_empty (&pool->partial_slabs)) {
+                if (!grow)
+                        return NULL;
+
+                pool->pool_misses++;
+                if (!__mem_pool_slab_new (pool))
+                        return NULL;
+        }
+
+        slab = list_entry (pool->partial_slabs.next, struct mem_pool_slab,
+                           slabs);
+        chunk = list_entry (slab->free.next, struct mem_pool_chunk, list);
+        list_del_init (&chunk->list);
+
+        if (--slab->cold == 0)
+                list_move (&slab->slabs, &pool->full_slabs);
+
+        pool->hot_count++;
+        pool->cold_count--;
+        if (pool->max_alloc < pool->hot_count)
+                pool->max_alloc = pool->hot_count;
+
+        return chunk;
+}
+
+static void
+__mem_pool_put_chunk (struct mem_pool *pool, struct mem_pool_chunk *chunk)
+{
+        struct mem_pool_slab *slab = chunk->slab;
+
+        if (!slab) {
+                pool->curr_stdalloc--;
+                GF_FREE (chunk);
+                return;
+        }
+
+        list_add (&chunk->list, &slab->free);
+        if (slab->cold++ == 0)
+                list_move (&slab->slabs, &pool->partial_slabs);
+
+        pool->hot_count--;
+        pool->cold_count++;
+
+        /* give an idle slab back as long as another slab worth of chunks
+         * stays cold, so that a pool oscillating around a slab boundary
+         * does not keep allocating and freeing it */
+        if ((slab->cold == slab->count) && (pool->slab_count > 1) &&
+            ((pool->cold_count - slab->count) >= pool->slab_size))
+                __mem_pool_slab_destroy (pool, slab);
+}
+
+static void
+__mem_pool_depot_drain (struct mem_pool *pool)
+{
+        struct mem_pool_magazine *mag = NULL;
+        struct mem_pool_magazine *tmp = NULL;
+
+        list_for_each_entry_safe (mag, tmp, &pool->depot_full, list) {
+                pool->depot_count -= mag->count;
+                while (mag->count)
+                        __mem_pool_put_chunk (pool,
+                                              mag->chunks[--mag->count]);
+                list_move (&mag->list, &pool->depot_empty);
+        }
+
+        list_for_each_entry_safe (mag, tmp, &pool->depot_empty, list) {
+                list_del (&mag->list);
+                FREE (mag);
+        }
+}
+
+/* Called with the pool locked when both magazines of @cache are empty. */
+static struct mem_pool_chunk *
+__mem_pool_cache_refill (struct mem_pool *pool, struct mem_pool_cache *cache)
+{
+        struct mem_pool_magazine *mag = NULL;
+        struct mem_pool_chunk    *chunk = NULL;
+
+        if (!list_empty (&pool->depot_full)) {
+                mag = list_entry (pool->depot_full.next,
+                                  struct mem_pool_magazine, list);
+                list_del_init (&mag->list);
+                pool->depot_count -= mag->count;
+
+                list_add (&cache->prev->list, &pool->depot_empty);
+                cache->prev = cache->loaded;
+                cache->loaded = mag;
+
+                return cache->loaded->chunks[--cache->loaded->count];
+        }
+
+        chunk = __mem_pool_get_chunk (pool, _gf_true);
+        if (!chunk)
+                return NULL;
+
+        /* prefetch half a magazine from slabs which already have cold
+         * chunks, without growing the pool for it */
+        while (cache->loaded->count < (GF_MEM_POOL_MAGAZINE_SIZE / 2)) {
+                cache->loaded->chunks[cache->loaded->count] =
+                        __mem_pool_get_chunk (pool, _gf_false);
+                if (!cache->loaded->chunks[cache->loaded->count])
+                        break;
+                cache->loaded->count++;
+        }
+
+        return chunk;
+}
+
+/* Called with the pool locked when both magazines of @cache are full. */
+static int
+__mem_pool_cache_flush (struct mem_pool *pool, struct mem_pool_cache *cache,
+                        struct mem_pool_chunk *chunk)
+{
+        struct mem_pool_magazine *mag = NULL;
+
+        if (!list_empty (&pool->depot_empty)) {
+                mag = list_entry (pool->depot_empty.next,
+                                  struct mem_pool_magazine, list);
+                list_del_init (&mag->list);
+        } else {
+                mag = CALLOC (1, sizeof (*mag));
+                if (!mag)
+                        return -1;
+        }
+
+        /* the depot holds at most a slab worth of chunks, anything beyond
+         * that goes back to the slabs where it can be reclaimed */
+        if ((pool->depot_count + GF_MEM_POOL_MAGAZINE_SIZE) >
+            pool->slab_size) {
+                while (cache->prev->count)
+                        __mem_pool_put_chunk (pool,
+                                cache->prev->chunks[--cache->prev->count]);
+                list_add (&cache->prev->list, &pool->depot_empty);
+        } else {
+                list_add_tail (&cache->prev->list, &pool->depot_full);
+                pool->depot_count += cache->prev->count;
+        }
+
+        cache->prev = cache->loaded;
+        cache->loaded = mag;
+        cache->loaded->chunks[cache->loaded->count++] = chunk;
+
+        return 0;
+}
+
 struct mem_pool *
 mem_pool_new_fn (unsigned long sizeof_type,
                  unsigned long count, char *name)
 {
         struct mem_pool  *mem_pool = NULL;
         unsigned long     padded_sizeof_type = 0;
-        GF_UNUSED void             *pool = NULL;
-        GF_UNUSED int               i = 0;
         int               ret = 0;
-        GF_UNUSED struct list_head *list = NULL;
+        int               i = 0;
         glusterfs_ctx_t  *ctx = NULL;
 
         if (!sizeof_type || !count) {
                 gf_log_callingfn ("mem-pool", GF_LOG_ERROR, "invalid argument");
                 return NULL;
         }
-        padded_sizeof_type = sizeof_type + GF_MEM_POOL_PAD_BOUNDARY;
+        padded_sizeof_type = GF_MEM_POOL_PAD_BOUNDARY +
+                             ((sizeof_type + 7) & ~7UL);
 
         mem_pool = GF_CALLOC (sizeof (*mem_pool), 1, gf_common_mt_mem_pool);
         if (!mem_pool)
@@ -352,29 +730,39 @@ mem_pool_new_fn (unsigned long sizeof_type,
         }
 
         LOCK_INIT (&mem_pool->lock);
-        INIT_LIST_HEAD (&mem_pool->list);
+        INIT_LIST_HEAD (&mem_pool->partial_slabs);
+        INIT_LIST_HEAD (&mem_pool->full_slabs);
+        INIT_LIST_HEAD (&mem_pool->depot_full);
+        INIT_LIST_HEAD (&mem_pool->depot_empty);
         INIT_LIST_HEAD (&mem_pool->global_list);
 
         mem_pool->padded_sizeof_type = padded_sizeof_type;
         mem_pool->real_sizeof_type = sizeof_type;
+        mem_pool->slab_size = count;
+        mem_pool->cache_id = -1;
 
 #ifndef DEBUG
-        mem_pool->cold_count = count;
-        pool = GF_CALLOC (count, padded_sizeof_type, gf_common_mt_long);
-        if (!pool) {
+        if (!__mem_pool_slab_new (mem_pool)) {
                 GF_FREE (mem_pool->name);
                 GF_FREE (mem_pool);
                 return NULL;
         }
 
-        for (i = 0; i < count; i++) {
-                list = pool + (i * (padded_sizeof_type));
-                INIT_LIST_HEAD (list);
-                list_add_tail (list, &mem_pool->list);
-        }
+        pthread_once (&mem_pool_cache_once, mem_pool_cache_key_init);
 
-        mem_pool->pool = pool;
-        mem_pool->pool_end = pool + (count * (padded_sizeof_type));
+        pthread_mutex_lock (&mem_pool_registry_lock);
+        {
+                for (i = 0; mem_pool_registry_gen &&
+                     (i < GF_MEM_POOL_MAX_CACHED); i++) {
+                        if (mem_pool_registry[i])
+                                continue;
+                        mem_pool_registry[i] = mem_pool;
+                        mem_pool->cache_id = i;
+                        mem_pool->cache_gen = mem_pool_registry_gen++;
+                        break;
+                }
+        }
+        pthread_mutex_unlock (&mem_pool_registry_lock);
 #endif
 
         /* add this pool to the global list */
@@ -409,177 +797,114 @@ mem_get0 (struct mem_pool *mem_pool)
 void *
 mem_get (struct mem_pool *mem_pool)
 {
-        struct list_head *list = NULL;
-        void             *ptr = NULL;
-        int             *in_use = NULL;
-        struct mem_pool **pool_ptr = NULL;
+        struct mem_pool_cache *cache = NULL;
+        struct mem_pool_chunk *chunk = NULL;
 
         if (!mem_pool) {
                 gf_log_callingfn ("mem-pool", GF_LOG_ERROR, "invalid argument");
                 return NULL;
         }
 
-        LOCK (&mem_pool->lock);
+        cache = mem_pool_thread_cache (mem_pool);
+        if (cache) {
+                if (!cache->loaded->count && cache->prev->count)
+                        mem_pool_cache_swap (cache);
+                if (cache->loaded->count) {
+                        chunk = cache->loaded->chunks[--cache->loaded->count];
+                        cache->hits++;
+                        goto out;
+                }
+        }
+
+        mem_pool_lock (mem_pool);
         {
                 mem_pool->alloc_count++;
-                if (mem_pool->cold_count) {
-                        list = mem_pool->list.next;
-                        list_del (list);
+                mem_pool->cache_misses++;
 
-                        mem_pool->hot_count++;
-                        mem_pool->cold_count--;
+                if (cache) {
+                        mem_pool->alloc_count += cache->hits;
+                        mem_pool->cache_hits += cache->hits;
+                        cache->hits = 0;
 
-                        if (mem_pool->max_alloc < mem_pool->hot_count)
-                                mem_pool->max_alloc = mem_pool->hot_count;
-
-                        ptr = list;
-                        in_use = (ptr + GF_MEM_POOL_LIST_BOUNDARY +
-                                  GF_MEM_POOL_PTR);
-                        *in_use = 1;
-
-                        goto fwd_addr_out;
+                        chunk = __mem_pool_cache_refill (mem_pool, cache);
+                } else {
+                        chunk = __mem_pool_get_chunk (mem_pool, _gf_true);
                 }
-
-                /* This is a problem area. If we've run out of
-                 * chunks in our slab above, we need to allocate
-                 * enough memory to service this request.
-                 * The problem is, these individual chunks will fail
-                 * the first address range check in __is_member. Now, since
-                 * we're not allocating a full second slab, we wont have
-                 * enough info perform the range check in __is_member.
-                 *
-                 * I am working around this by performing a regular allocation
-                 * , just the way the caller would've done when not using the
-                 * mem-pool. That also means, we're not padding the size with
-                 * the list_head structure because, this will not be added to
-                 * the list of chunks that belong to the mem-pool allocated
-                 * initially.
-                 *
-                 * This is the best we can do without adding functionality for
-                 * managing multiple slabs. That does not interest us at present
-                 * because it is too much work knowing that a better slab
-                 * allocator is coming RSN.
-                 */
-                mem_pool->pool_misses++;
-                mem_pool->curr_stdalloc++;
-                if (mem_pool->max_stdalloc < mem_pool->curr_stdalloc)
-                        mem_pool->max_stdalloc = mem_pool->curr_stdalloc;
-                ptr = GF_CALLOC (1, mem_pool->padded_sizeof_type,
-                                 gf_common_mt_mem_pool);
-
-                /* Memory coming from the heap need not be transformed from a
-                 * chunkhead to a usable pointer since it is not coming from
-                 * the pool.
-                 */
         }
-fwd_addr_out:
-        pool_ptr = mem_pool_from_ptr (ptr);
-        *pool_ptr = (struct mem_pool *)mem_pool;
-        ptr = mem_pool_chunkhead2ptr (ptr);
         UNLOCK (&mem_pool->lock);
 
-        return ptr;
-}
-
-
-static int
-__is_member (struct mem_pool *pool, void *ptr)
-{
-        if (!pool || !ptr) {
-                gf_log_callingfn ("mem-pool", GF_LOG_ERROR, "invalid argument");
-                return -1;
-        }
-
-        if (ptr < pool->pool || ptr >= pool->pool_end)
-                return 0;
+out:
+        if (!chunk)
+                return NULL;
 
-        if ((mem_pool_ptr2chunkhead (ptr) - pool->pool)
-            % pool->padded_sizeof_type)
-                return -1;
+        chunk->in_use = 1;
 
-        return 1;
+        return mem_pool_chunkhead2ptr ((void *)chunk);
 }
 
-
 void
 mem_put (void *ptr)
 {
-        struct list_head *list = NULL;
-        int    *in_use = NULL;
-        void   *head = NULL;
-        struct mem_pool **tmp = NULL;
-        struct mem_pool *pool = NULL;
+        struct mem_pool_chunk *chunk = NULL;
+        struct mem_pool_cache *cache = NULL;
+        struct mem_pool       *pool = NULL;
 
         if (!ptr) {
                 gf_log_callingfn ("mem-pool", GF_LOG_ERROR, "invalid argument");
                 return;
         }
 
-        list = head = mem_pool_ptr2chunkhead (ptr);
-        tmp = mem_pool_from_ptr (head);
-        if (!tmp) {
-                gf_log_callingfn ("mem-pool", GF_LOG_ERROR,
-                                  "ptr header is corrupted");
-                return;
-        }
-
-        pool = *tmp;
+        chunk = mem_pool_ptr2chunkhead (ptr);
+        pool = chunk->pool;
         if (!pool) {
                 gf_log_callingfn ("mem-pool", GF_LOG_ERROR,
                                   "mem-pool ptr is NULL");
                 return;
         }
-        LOCK (&pool->lock);
-        {
 
-                switch (__is_member (pool, ptr))
-                {
-                case 1:
-                        in_use = (head + GF_MEM_POOL_LIST_BOUNDARY +
-                                  GF_MEM_POOL_PTR);
-                        if (!is_mem_chunk_in_use(in_use)) {
-                                gf_log_callingfn ("mem-pool", GF_LOG_CRITICAL,
-                                                  "mem_put called on freed ptr %p of mem "
-                                                  "pool %p", ptr, pool);
-                                break;
-                        }
-                        pool->hot_count--;
-                        pool->cold_count++;
-                        *in_use = 0;
-                        list_add (list, &pool->list);
-                        break;
-                case -1:
-                        /* For some reason, the address given is within
-                         * the address range of the mem-pool but does not align
-                         * with the expected start of a chunk that includes
-                         * the list headers also. Sounds like a problem in
-                         * layers of clouds up above us. ;)
-                         */
-                        abort ();
-                        break;
-                case 0:
-                        /* The address is outside the range of the mem-pool. We
-                         * assume here that this address was allocated at a
-                         * point when the mem-pool was out of chunks in mem_get
-                         * or the programmer has made a mistake by calling the
-                         * wrong de-allocation interface. We do
-                         * not have enough info to distinguish between the two
-                         * situations.
-                         */
-                        pool->curr_stdalloc--;
-                        GF_FREE (list);
-                        break;
-                default:
-                        /* log error */
-                        break;
+        if (chunk->slab &&
+            ((void *)chunk < chunk->slab->base ||
+             ((void *)chunk - chunk->slab->base) % pool->padded_sizeof_type)) {
+                /* For some reason, the address given does not align with
+                 * the expected start of a chunk that includes the headers.
+                 * Sounds like a problem in layers of clouds up above us. ;)
+                 */
+                abort ();
+        }
+
+        if (!is_mem_chunk_in_use (&chunk->in_use)) {
+                gf_log_callingfn ("mem-pool", GF_LOG_CRITICAL,
+                                  "mem_put called on freed ptr %p of mem "
+                                  "pool %p", ptr, pool);
+                return;
+        }
+        chunk->in_use = 0;
+
+        cache = mem_pool_thread_cache (pool);
+        if (cache) {
+                if ((cache->loaded->count == GF_MEM_POOL_MAGAZINE_SIZE) &&
+                    (cache->prev->count < GF_MEM_POOL_MAGAZINE_SIZE))
+                        mem_pool_cache_swap (cache);
+                if (cache->loaded->count < GF_MEM_POOL_MAGAZINE_SIZE) {
+                        cache->loaded->chunks[cache->loaded->count++] = chunk;
+                        return;
                 }
         }
+
+        mem_pool_lock (pool);
+        {
+                if (!cache || __mem_pool_cache_flush (pool, cache, chunk))
+                        __mem_pool_put_chunk (pool, chunk);
+        }
         UNLOCK (&pool->lock);
 }
 
 void
 mem_pool_destroy (struct mem_pool *pool)
 {
+        struct mem_pool_slab *slab = NULL;
+        struct mem_pool_slab *tmp = NULL;
+
         if (!pool)
                 return;
 
@@ -588,9 +913,23 @@ mem_pool_destroy (struct mem_pool *pool)
 
         list_del (&pool->global_list);
 
+        if (pool->cache_id >= 0) {
+                pthread_mutex_lock (&mem_pool_registry_lock);
+                {
+                        mem_pool_registry[pool->cache_id] = NULL;
+                }
+                pthread_mutex_unlock (&mem_pool_registry_lock);
+        }
+
+        __mem_pool_depot_drain (pool);
+
+        list_for_each_entry_safe (slab, tmp, &pool->partial_slabs, slabs)
+                __mem_pool_slab_destroy (pool, slab);
+        list_for_each_entry_safe (slab, tmp, &pool->full_slabs, slabs)
+                __mem_pool_slab_destroy (pool, slab);
+
         LOCK_DESTROY (&pool->lock);
         GF_FREE (pool->name);
-        GF_FREE (pool->pool);
         GF_FREE (pool);
 
         return;
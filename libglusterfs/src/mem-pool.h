@@ -199,20 +199,37 @@ out:
         return dup_mem;
 }
 
+/* Number of chunks held by one magazine of a per-thread pool cache. */
+#define GF_MEM_POOL_MAGAZINE_SIZE        32
+
+/* Pools beyond this many do not get per-thread caches and always go
+ * through the pool lock. */
+#define GF_MEM_POOL_MAX_CACHED           256
+
 struct mem_pool {
-        struct list_head  list;
+        struct list_head  partial_slabs; /* slabs with cold chunks */
+        struct list_head  full_slabs;    /* slabs with every chunk hot */
+        struct list_head  depot_full;    /* magazines holding chunks */
+        struct list_head  depot_empty;   /* magazines with no chunks */
         int               hot_count;
         int               cold_count;
         gf_lock_t         lock;
         unsigned long     padded_sizeof_type;
-        void             *pool;
-        void             *pool_end;
+        unsigned long     slab_size;     /* chunks per slab */
         int               real_sizeof_type;
+        int               slab_count;
+        int               max_slab_count;
+        int               depot_count;   /* chunks parked in the depot */
         uint64_t          alloc_count;
-        uint64_t          pool_misses;
+        uint64_t          pool_misses;   /* times a new slab was needed */
+        uint64_t          cache_hits;
+        uint64_t          cache_misses;
+        uint64_t          lock_contention;
         int               max_alloc;
         int               curr_stdalloc;
         int               max_stdalloc;
+        int               cache_id;
+        uint64_t          cache_gen;
         char             *name;
         struct list_head  global_list;
 };
@@ -392,6 +392,15 @@ gf_proc_dump_mempool_info (glusterfs_ctx_t *ctx)
                 gf_proc_dump_write ("pool-misses", "%"PRIu64, pool->pool_misses);
                 gf_proc_dump_write ("cur-stdalloc", "%d", pool->curr_stdalloc);
                 gf_proc_dump_write ("max-stdalloc", "%d", pool->max_stdalloc);
+                gf_proc_dump_write ("slab-count", "%d", pool->slab_count);
+                gf_proc_dump_write ("max-slab-count", "%d",
+                                    pool->max_slab_count);
+                gf_proc_dump_write ("depot-count", "%d", pool->depot_count);
+                gf_proc_dump_write ("cache-hits", "%"PRIu64, pool->cache_hits);
+                gf_proc_dump_write ("cache-misses", "%"PRIu64,
+                                    pool->cache_misses);
+                gf_proc_dump_write ("lock-contention", "%"PRIu64,
+                                    pool->lock_contention);
         }
 }
 
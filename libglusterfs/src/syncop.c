@@ -2693,6 +2693,48 @@ syncop_zerofill(xlator_t *subvol, fd_t *fd, off_t offset, off_t len,
 }
 
 
+int
+syncop_seek_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int op_ret, int op_errno, off_t offset, dict_t *xdata)
+{
+        struct syncargs *args = NULL;
+
+        args = cookie;
+
+        args->op_ret   = op_ret;
+        args->op_errno = op_errno;
+        args->offset   = offset;
+        if (xdata)
+                args->xdata  = dict_ref (xdata);
+
+        __wake (args);
+
+        return 0;
+}
+
+/* Finds the next data or hole at or after @offset, as lseek() does with
+ * SEEK_DATA and SEEK_HOLE. Returns -ENXIO if there is no data left. */
+int
+syncop_seek (xlator_t *subvol, fd_t *fd, off_t offset, gf_seek_what_t what,
+             dict_t *xdata_in, off_t *off)
+{
+        struct syncargs args = {0, };
+
+        SYNCOP (subvol, (&args), syncop_seek_cbk, subvol->fops->seek,
+                fd, offset, what, xdata_in);
+
+        if (args.xdata)
+                dict_unref (args.xdata);
+
+        if (args.op_ret < 0)
+                return -args.op_errno;
+
+        if (off)
+                *off = args.offset;
+
+        return args.op_ret;
+}
+
 int
 syncop_ipc_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                 int op_ret, int op_errno, dict_t *xdata)
@@ -154,6 +154,7 @@ struct syncargs {
         pthread_mutex_t     lock_dict;
 
 	syncbarrier_t       barrier;
+        off_t               offset;
 
         /* do not touch */
         struct synctask    *task;
@@ -480,6 +481,9 @@ int syncop_discard(xlator_t *subvol, fd_t *fd, off_t offset, size_t len,
 int syncop_zerofill(xlator_t *subvol, fd_t *fd, off_t offset, off_t len,
 		    dict_t *xdata_in, dict_t **xdata_out);
 
+int syncop_seek (xlator_t *subvol, fd_t *fd, off_t offset, gf_seek_what_t what,
+                 dict_t *xdata_in, off_t *off);
+
 int syncop_rename (xlator_t *subvol, loc_t *oldloc, loc_t *newloc,
 		   dict_t *xdata_in, dict_t **xdata_out);
 
@@ -0,0 +1,241 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Cost of the inode and fd ctx lookups done on the way down a graph. For
+ * graphs of increasing depth, every xlator sets a ctx on a shared inode
+ * and fd, then each thread repeatedly simulates a fop: every xlator of the
+ * graph reads its inode ctx and its fd ctx. Xlators that belong to the
+ * graph of the inode table use their home slot; the same run with xlators
+ * from another graph measures the fallback scan.
+ *
+ *   ./ctx_bench [max-depth] [fops-per-thread] [threads]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "inode.h"
+#include "fd.h"
+#include "mem-types.h"
+
+struct ctx_bench {
+        inode_t         *inode;
+        fd_t            *fd;
+        xlator_t        *xls;
+        int              depth;
+        int              fops;
+        int              errors;
+};
+
+static void *
+ctx_bench_worker (void *data)
+{
+        struct ctx_bench *bench = data;
+        uint64_t          value = 0;
+        int               i = 0;
+        int               x = 0;
+
+        for (i = 0; i < bench->fops; i++) {
+                for (x = 0; x < bench->depth; x++) {
+                        value = 0;
+                        if (inode_ctx_get (bench->inode, &bench->xls[x],
+                                           &value) ||
+                            (value != (uint64_t)(x + 1)))
+                                __sync_fetch_and_add (&bench->errors, 1);
+
+                        value = 0;
+                        if (fd_ctx_get (bench->fd, &bench->xls[x], &value) ||
+                            (value != (uint64_t)(x + 1)))
+                                __sync_fetch_and_add (&bench->errors, 1);
+                }
+        }
+
+        return NULL;
+}
+
+/* nanoseconds per simulated fop */
+static double
+ctx_bench_run (struct ctx_bench *bench, int threads)
+{
+        pthread_t       tids[threads];
+        struct timespec start = {0, };
+        struct timespec end = {0, };
+        double          nsecs = 0;
+        int             i = 0;
+
+        clock_gettime (CLOCK_MONOTONIC, &start);
+        for (i = 0; i < threads; i++)
+                pthread_create (&tids[i], NULL, ctx_bench_worker, bench);
+        for (i = 0; i < threads; i++)
+                pthread_join (tids[i], NULL);
+        clock_gettime (CLOCK_MONOTONIC, &end);
+
+        nsecs = (end.tv_sec - start.tv_sec) * 1e9 +
+                (end.tv_nsec - start.tv_nsec);
+
+        return nsecs / ((double)bench->fops * threads);
+}
+
+/* Builds a graph of @depth xlators owning an inode table, and a second set
+ * of @depth xlators from another graph. The ids are handed out as the
+ * volfile parser does. */
+static int
+ctx_bench_setup (glusterfs_ctx_t *ctx, int depth, glusterfs_graph_t *graph,
+                 glusterfs_graph_t *other, xlator_t *native,
+                 xlator_t *foreign, struct ctx_bench *bench)
+{
+        inode_table_t *table = NULL;
+        int            x = 0;
+
+        memset (graph, 0, sizeof (*graph));
+        memset (other, 0, sizeof (*other));
+        memset (native, 0, depth * sizeof (*native));
+        memset (foreign, 0, depth * sizeof (*foreign));
+
+        for (x = 0; x < depth; x++) {
+                native[x].name = "ctx-bench";
+                native[x].ctx = ctx;
+                native[x].graph = graph;
+                native[x].xl_id = ++graph->xl_count;
+
+                foreign[x].name = "ctx-bench-other";
+                foreign[x].ctx = ctx;
+                foreign[x].graph = other;
+                foreign[x].xl_id = ++other->xl_count;
+        }
+
+        table = inode_table_new (0, &native[0]);
+        if (!table)
+                return -1;
+
+        bench->inode = inode_new (table);
+        if (!bench->inode)
+                return -1;
+
+        bench->fd = fd_create (bench->inode, 0);
+        if (!bench->fd)
+                return -1;
+
+        for (x = 0; x < depth; x++) {
+                if (inode_ctx_put (bench->inode, &native[x], x + 1) ||
+                    fd_ctx_set (bench->fd, &native[x], x + 1))
+                        return -1;
+        }
+
+        bench->depth = depth;
+        return 0;
+}
+
+/* The foreign xlators share the slots left by the native ones. */
+static int
+ctx_bench_swap (struct ctx_bench *bench, xlator_t *from, xlator_t *to)
+{
+        uint64_t value = 0;
+        int      x = 0;
+
+        for (x = 0; x < bench->depth; x++) {
+                if (inode_ctx_del (bench->inode, &from[x], &value) ||
+                    fd_ctx_del (bench->fd, &from[x], &value))
+                        return -1;
+        }
+
+        for (x = 0; x < bench->depth; x++) {
+                if (inode_ctx_put (bench->inode, &to[x], x + 1) ||
+                    fd_ctx_set (bench->fd, &to[x], x + 1))
+                        return -1;
+        }
+
+        bench->xls = to;
+        return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t     *ctx = NULL;
+        glusterfs_graph_t    graph;
+        glusterfs_graph_t    other;
+        xlator_t            *native = NULL;
+        xlator_t            *foreign = NULL;
+        struct ctx_bench     bench;
+        double               home = 0;
+        double               scan = 0;
+        int                  max_depth = 32;
+        int                  threads = 4;
+        int                  depth = 0;
+        int                  fops = 1000000;
+
+        if (argc > 1)
+                max_depth = atoi (argv[1]);
+        if (argc > 2)
+                fops = atoi (argv[2]);
+        if (argc > 3)
+                threads = atoi (argv[3]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx)) {
+                fprintf (stderr, "failed to initialize glusterfs context\n");
+                return 1;
+        }
+        THIS->ctx = ctx;
+        if (xlator_mem_acct_init (THIS, gf_common_mt_end + 1)) {
+                fprintf (stderr, "failed to initialize memory accounting\n");
+                return 1;
+        }
+
+        native = calloc (max_depth, sizeof (*native));
+        foreign = calloc (max_depth, sizeof (*foreign));
+        if (!native || !foreign)
+                return 1;
+
+        printf ("%d fops per thread, %d threads\n", fops, threads);
+        printf ("%-8s %16s %16s\n", "depth", "home ns/fop", "scan ns/fop");
+        for (depth = 2; depth <= max_depth; depth *= 2) {
+                memset (&bench, 0, sizeof (bench));
+                bench.fops = fops;
+
+                if (ctx_bench_setup (ctx, depth, &graph, &other, native,
+                                     foreign, &bench)) {
+                        fprintf (stderr, "failed to set up a graph of %d\n",
+                                 depth);
+                        return 1;
+                }
+
+                bench.xls = native;
+                home = ctx_bench_run (&bench, threads);
+
+                if (ctx_bench_swap (&bench, native, foreign)) {
+                        fprintf (stderr, "failed to move the ctx to the "
+                                 "foreign xlators\n");
+                        return 1;
+                }
+                scan = ctx_bench_run (&bench, threads);
+
+                printf ("%-8d %16.1f %16.1f\n", depth, home, scan);
+
+                if (bench.errors) {
+                        fprintf (stderr, "%d ctx lookups returned the wrong "
+                                 "value\n", bench.errors);
+                        return 1;
+                }
+
+                /* the inode and fd of each depth are left behind, the
+                 * xlators have no cbks for their release or forget */
+        }
+
+        return 0;
+}
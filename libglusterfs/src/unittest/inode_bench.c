@@ -0,0 +1,274 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Inode table throughput with concurrent lookups. A tree of 'dirs'
+ * directories holding 'files' entries each is linked and looked up, then
+ * every thread resolves random entries through a mix of inode_grep (40%),
+ * inode_find (40%) and inode_link of a fresh inode with the gfid of an
+ * existing entry (20%, as done for every lookup reply). Refs are checked
+ * to be balanced afterwards.
+ *
+ *   ./inode_bench [max-threads] [ops-per-thread] [lru-limit]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "inode.h"
+#include "mem-types.h"
+
+#define INODE_BENCH_DIRS        64
+#define INODE_BENCH_FILES       1024
+
+struct inode_bench {
+        inode_table_t *table;
+        inode_t       *dirs[INODE_BENCH_DIRS];
+        uuid_t         gfids[INODE_BENCH_DIRS][INODE_BENCH_FILES];
+        int            ops;
+        int            errors;
+};
+
+static void
+inode_bench_name (char *name, size_t size, int file)
+{
+        snprintf (name, size, "file-%05d", file);
+}
+
+static void
+inode_bench_iatt (struct iatt *iatt, uuid_t gfid, ia_type_t type)
+{
+        memset (iatt, 0, sizeof (*iatt));
+        gf_uuid_copy (iatt->ia_gfid, gfid);
+        iatt->ia_type = type;
+}
+
+static int
+inode_bench_setup (struct inode_bench *bench)
+{
+        inode_table_t *table = bench->table;
+        inode_t       *inode = NULL;
+        inode_t       *linked = NULL;
+        struct iatt    iatt;
+        uuid_t         gfid;
+        char           name[32];
+        int            d = 0;
+        int            f = 0;
+
+        for (d = 0; d < INODE_BENCH_DIRS; d++) {
+                gf_uuid_generate (gfid);
+                inode_bench_iatt (&iatt, gfid, IA_IFDIR);
+                snprintf (name, sizeof (name), "dir-%03d", d);
+
+                inode = inode_new (table);
+                linked = inode_link (inode, table->root, name, &iatt);
+                if (linked != inode)
+                        return -1;
+                inode_lookup (linked);
+                inode_unref (inode);
+
+                /* kept referenced for the whole run */
+                bench->dirs[d] = linked;
+
+                for (f = 0; f < INODE_BENCH_FILES; f++) {
+                        gf_uuid_generate (bench->gfids[d][f]);
+                        inode_bench_iatt (&iatt, bench->gfids[d][f],
+                                          IA_IFREG);
+                        inode_bench_name (name, sizeof (name), f);
+
+                        inode = inode_new (table);
+                        linked = inode_link (inode, bench->dirs[d], name,
+                                             &iatt);
+                        if (linked != inode)
+                                return -1;
+                        inode_lookup (linked);
+                        inode_unref (linked);
+                        inode_unref (inode);
+                }
+        }
+
+        return 0;
+}
+
+static void *
+inode_bench_worker (void *data)
+{
+        struct inode_bench *bench = data;
+        inode_table_t      *table = bench->table;
+        inode_t            *inode = NULL;
+        inode_t            *linked = NULL;
+        struct iatt         iatt;
+        char                name[32];
+        unsigned int        seed = 0;
+        int                 op = 0;
+        int                 d = 0;
+        int                 f = 0;
+        int                 i = 0;
+
+        seed = (unsigned int)(unsigned long)pthread_self ();
+
+        for (i = 0; i < bench->ops; i++) {
+                op = rand_r (&seed) % 10;
+                d = rand_r (&seed) % INODE_BENCH_DIRS;
+                f = rand_r (&seed) % INODE_BENCH_FILES;
+
+                if (op < 4) {
+                        inode_bench_name (name, sizeof (name), f);
+                        inode = inode_grep (table, bench->dirs[d], name);
+                } else if (op < 8) {
+                        inode = inode_find (table, bench->gfids[d][f]);
+                } else {
+                        inode_bench_name (name, sizeof (name), f);
+                        inode_bench_iatt (&iatt, bench->gfids[d][f],
+                                          IA_IFREG);
+                        linked = inode_new (table);
+                        inode = inode_link (linked, bench->dirs[d], name,
+                                            &iatt);
+                        inode_unref (linked);
+                }
+
+                /* entries can be pruned when the lru limit is small */
+                if (!inode)
+                        continue;
+
+                if (gf_uuid_compare (inode->gfid, bench->gfids[d][f]) != 0)
+                        __sync_fetch_and_add (&bench->errors, 1);
+
+                inode_unref (inode);
+        }
+
+        return NULL;
+}
+
+static double
+inode_bench_run (struct inode_bench *bench, int threads)
+{
+        pthread_t       tids[threads];
+        struct timespec start = {0, };
+        struct timespec end = {0, };
+        double          secs = 0;
+        int             i = 0;
+
+        clock_gettime (CLOCK_MONOTONIC, &start);
+        for (i = 0; i < threads; i++)
+                pthread_create (&tids[i], NULL, inode_bench_worker, bench);
+        for (i = 0; i < threads; i++)
+                pthread_join (tids[i], NULL);
+        clock_gettime (CLOCK_MONOTONIC, &end);
+
+        secs = (end.tv_sec - start.tv_sec) +
+               (end.tv_nsec - start.tv_nsec) / 1e9;
+
+        return ((double)bench->ops * threads) / secs / 1e6;
+}
+
+/* Only the root and the directories should still be referenced. */
+static int
+inode_bench_check_refs (struct inode_bench *bench)
+{
+        inode_table_t *table = bench->table;
+        inode_t       *inode = NULL;
+        int            referenced = 0;
+        uint32_t       lru = 0;
+
+        pthread_mutex_lock (&table->lock);
+        {
+                list_for_each_entry (inode, &table->active, list) {
+                        if (inode->ref)
+                                referenced++;
+                }
+                list_for_each_entry (inode, &table->lru, list) {
+                        if (inode->ref)
+                                referenced++;
+                        lru++;
+                }
+        }
+        pthread_mutex_unlock (&table->lock);
+
+        if ((referenced != INODE_BENCH_DIRS + 1) || (lru != table->lru_size)) {
+                fprintf (stderr, "unbalanced refs: %d referenced inodes, "
+                         "%u on lru list (lru_size %u)\n", referenced, lru,
+                         table->lru_size);
+                return -1;
+        }
+
+        return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t     *ctx = NULL;
+        glusterfs_graph_t    graph;
+        xlator_t             xl;
+        struct inode_bench   bench;
+        int                  max_threads = 16;
+        int                  lru_limit = 0;
+        int                  threads = 0;
+
+        memset (&bench, 0, sizeof (bench));
+        bench.ops = 1000000;
+
+        if (argc > 1)
+                max_threads = atoi (argv[1]);
+        if (argc > 2)
+                bench.ops = atoi (argv[2]);
+        if (argc > 3)
+                lru_limit = atoi (argv[3]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx)) {
+                fprintf (stderr, "failed to initialize glusterfs context\n");
+                return 1;
+        }
+        THIS->ctx = ctx;
+        if (xlator_mem_acct_init (THIS, gf_common_mt_end + 1)) {
+                fprintf (stderr, "failed to initialize memory accounting\n");
+                return 1;
+        }
+
+        memset (&graph, 0, sizeof (graph));
+        memset (&xl, 0, sizeof (xl));
+        graph.xl_count = 1;
+        xl.name = "inode-bench";
+        xl.graph = &graph;
+        xl.ctx = ctx;
+
+        bench.table = inode_table_new (lru_limit, &xl);
+        if (!bench.table || inode_bench_setup (&bench)) {
+                fprintf (stderr, "failed to set up the inode table\n");
+                return 1;
+        }
+
+        printf ("%d inodes, lru limit %d, %d ops per thread\n",
+                INODE_BENCH_DIRS * (INODE_BENCH_FILES + 1), lru_limit,
+                bench.ops);
+        printf ("%-8s %14s\n", "threads", "Mops/s");
+        for (threads = 1; threads <= max_threads; threads *= 2) {
+                printf ("%-8d %14.2f\n", threads,
+                        inode_bench_run (&bench, threads));
+
+                if (bench.errors) {
+                        fprintf (stderr, "%d lookups returned the wrong "
+                                 "inode\n", bench.errors);
+                        return 1;
+                }
+                if (inode_bench_check_refs (&bench))
+                        return 1;
+        }
+
+        return 0;
+}
@@ -0,0 +1,198 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * active_size and lru_size of the inode table, checked against the lists
+ * after refs taken through every lookup path, with and without an lru
+ * limit.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "inode.h"
+#include "mem-types.h"
+
+#define INODE_TEST_FILES 8
+
+static int failures;
+
+#define CHECK(cond) do {                                                \
+                if (!(cond)) {                                          \
+                        fprintf (stderr, "%s:%d: check failed: %s\n",   \
+                                 __FILE__, __LINE__, #cond);            \
+                        failures++;                                     \
+                }                                                       \
+        } while (0)
+
+static void
+inode_test_counts (inode_table_t *table, uint32_t active, uint32_t lru)
+{
+        inode_t  *inode = NULL;
+        uint32_t  on_active = 0;
+        uint32_t  on_lru = 0;
+
+        pthread_mutex_lock (&table->lock);
+        {
+                list_for_each_entry (inode, &table->active, list) {
+                        if (!inode->ref)
+                                failures++;
+                        on_active++;
+                }
+                list_for_each_entry (inode, &table->lru, list) {
+                        if (inode->ref)
+                                failures++;
+                        on_lru++;
+                }
+        }
+        pthread_mutex_unlock (&table->lock);
+
+        CHECK (table->active_size == on_active);
+        CHECK (table->lru_size == on_lru);
+        CHECK (table->active_size == active);
+        CHECK (table->lru_size == lru);
+}
+
+static void
+inode_test_name (char *name, size_t size, int file)
+{
+        snprintf (name, size, "file-%d", file);
+}
+
+static void
+inode_test_populate (inode_table_t *table, uuid_t *gfids)
+{
+        inode_t     *inode = NULL;
+        inode_t     *linked = NULL;
+        struct iatt  iatt;
+        char         name[32];
+        int          i = 0;
+
+        for (i = 0; i < INODE_TEST_FILES; i++) {
+                memset (&iatt, 0, sizeof (iatt));
+                gf_uuid_generate (gfids[i]);
+                gf_uuid_copy (iatt.ia_gfid, gfids[i]);
+                iatt.ia_type = IA_IFREG;
+                inode_test_name (name, sizeof (name), i);
+
+                inode = inode_new (table);
+                linked = inode_link (inode, table->root, name, &iatt);
+                CHECK (linked == inode);
+                inode_lookup (linked);
+                inode_unref (linked);
+                inode_unref (inode);
+        }
+}
+
+static void
+inode_test_lru_unlimited (xlator_t *xl)
+{
+        inode_table_t *table = NULL;
+        inode_t       *inodes[3] = {NULL, };
+        inode_t       *inode = NULL;
+        uuid_t         gfids[INODE_TEST_FILES];
+        char           name[32];
+        int            i = 0;
+
+        table = inode_table_new (0, xl);
+        CHECK (table != NULL);
+        if (!table)
+                return;
+
+        inode_test_populate (table, gfids);
+        inode_test_counts (table, 1, INODE_TEST_FILES);
+
+        /* the first ref, through any path, takes the inode off the lru */
+        inodes[0] = inode_find (table, gfids[0]);
+        inode_test_name (name, sizeof (name), 1);
+        inodes[1] = inode_grep (table, table->root, name);
+        inodes[2] = inode_ref (inodes[0]);
+        CHECK (inodes[0] && inodes[1] && (inodes[2] == inodes[0]));
+        inode_test_counts (table, 3, INODE_TEST_FILES - 2);
+
+        /* later refs do not move anything */
+        for (i = 0; i < 100; i++) {
+                inode = inode_find (table, gfids[1]);
+                inode_unref (inode);
+        }
+        inode_test_counts (table, 3, INODE_TEST_FILES - 2);
+
+        inode_unref (inodes[2]);
+        inode_test_counts (table, 3, INODE_TEST_FILES - 2);
+
+        inode_unref (inodes[0]);
+        inode_unref (inodes[1]);
+        inode_test_counts (table, 1, INODE_TEST_FILES);
+}
+
+static void
+inode_test_lru_limit (xlator_t *xl)
+{
+        inode_table_t *table = NULL;
+        inode_t       *inode = NULL;
+        uuid_t         gfids[INODE_TEST_FILES];
+
+        table = inode_table_new (2, xl);
+        CHECK (table != NULL);
+        if (!table)
+                return;
+
+        inode_test_populate (table, gfids);
+        inode_test_counts (table, 1, 2);
+
+        /* only the two most recently used ones are left */
+        CHECK (inode_find (table, gfids[0]) == NULL);
+        inode = inode_find (table, gfids[INODE_TEST_FILES - 1]);
+        CHECK (inode != NULL);
+        inode_test_counts (table, 2, 1);
+
+        inode_unref (inode);
+        inode_test_counts (table, 1, 2);
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t   *ctx = NULL;
+        glusterfs_graph_t  graph;
+        xlator_t           xl;
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx)) {
+                fprintf (stderr, "failed to initialize glusterfs context\n");
+                return 1;
+        }
+        THIS->ctx = ctx;
+        if (xlator_mem_acct_init (THIS, gf_common_mt_end + 1)) {
+                fprintf (stderr, "failed to initialize memory accounting\n");
+                return 1;
+        }
+
+        memset (&graph, 0, sizeof (graph));
+        memset (&xl, 0, sizeof (xl));
+        graph.xl_count = 1;
+        xl.name = "inode-table-unittest";
+        xl.graph = &graph;
+        xl.ctx = ctx;
+
+        inode_test_lru_unlimited (&xl);
+        inode_test_lru_limit (&xl);
+
+        if (failures) {
+                fprintf (stderr, "%d checks failed\n", failures);
+                return 1;
+        }
+
+        return 0;
+}
@@ -0,0 +1,282 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * mem_get and mem_put through the per-thread magazines: slab growth,
+ * chunks freed by another thread, chunks handed back by exiting threads
+ * and cache slots taken over by a new pool.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "mem-pool.h"
+
+#define MEM_TEST_SLAB   64
+#define MEM_TEST_OBJS   (5 * MEM_TEST_SLAB)
+
+struct mem_test_obj {
+        uint64_t  tag;
+        char      pad[40];
+};
+
+static int failures;
+
+#define CHECK(cond) do {                                                \
+                if (!(cond)) {                                          \
+                        fprintf (stderr, "%s:%d: check failed: %s\n",   \
+                                 __FILE__, __LINE__, #cond);            \
+                        failures++;                                     \
+                }                                                       \
+        } while (0)
+
+/* with no thread caching chunks, every chunk the slabs consider in use is
+   either held by a caller or parked in the depot */
+static void
+mem_test_counts (struct mem_pool *pool, int held)
+{
+        LOCK (&pool->lock);
+        {
+                CHECK (pool->hot_count + pool->cold_count ==
+                       pool->slab_count * (int)pool->slab_size);
+                CHECK (pool->hot_count == held + pool->depot_count);
+                CHECK (pool->depot_count <= (int)pool->slab_size);
+        }
+        UNLOCK (&pool->lock);
+}
+
+static struct mem_test_obj **
+mem_test_get (struct mem_pool *pool, int nr)
+{
+        struct mem_test_obj **objs = NULL;
+        int                   i = 0;
+        int                   j = 0;
+
+        objs = calloc (nr, sizeof (*objs));
+        if (!objs)
+                return NULL;
+
+        for (i = 0; i < nr; i++) {
+                objs[i] = mem_get0 (pool);
+                CHECK (objs[i] != NULL);
+                if (!objs[i])
+                        continue;
+                CHECK (objs[i]->tag == 0);
+                objs[i]->tag = i + 1;
+        }
+
+        for (i = 0; i < nr; i++)
+                for (j = 0; objs[i] && j < i; j++)
+                        CHECK (objs[i] != objs[j]);
+
+        return objs;
+}
+
+static void
+mem_test_put (struct mem_test_obj **objs, int nr)
+{
+        int i = 0;
+
+        for (i = 0; i < nr; i++) {
+                if (!objs[i])
+                        continue;
+                CHECK (objs[i]->tag == (uint64_t)(i + 1));
+                mem_put (objs[i]);
+        }
+        free (objs);
+}
+
+static void *
+mem_test_worker (void *data)
+{
+        struct mem_pool *pool = data;
+
+        mem_test_put (mem_test_get (pool, MEM_TEST_OBJS), MEM_TEST_OBJS);
+
+        return NULL;
+}
+
+static void *
+mem_test_getter (void *data)
+{
+        return mem_test_get (data, MEM_TEST_OBJS);
+}
+
+static void *
+mem_test_putter (void *data)
+{
+        mem_test_put (data, MEM_TEST_OBJS);
+
+        return NULL;
+}
+
+/* runs @fn in a thread of its own, whose cache is gone once it returns */
+static void *
+mem_test_run (void *(*fn) (void *), void *data)
+{
+        pthread_t  thread;
+        void      *ret = NULL;
+
+        if (pthread_create (&thread, NULL, fn, data) != 0) {
+                CHECK (!"pthread_create");
+                return NULL;
+        }
+        pthread_join (thread, &ret);
+
+        return ret;
+}
+
+static void *
+mem_test_reuse (void *data)
+{
+        struct mem_pool      *pool = data;
+        struct mem_test_obj **objs = NULL;
+        void                 *last = NULL;
+
+        /* running out of slabs adds new ones instead of using the heap */
+        objs = mem_test_get (pool, MEM_TEST_OBJS);
+        CHECK (pool->slab_count >= MEM_TEST_OBJS / MEM_TEST_SLAB);
+        CHECK (pool->curr_stdalloc == 0);
+        last = objs[MEM_TEST_OBJS - 1];
+        mem_test_put (objs, MEM_TEST_OBJS);
+
+        /* idle slabs went back */
+        CHECK (pool->slab_count < MEM_TEST_OBJS / MEM_TEST_SLAB);
+
+        /* the last chunk put is the first one we get back */
+        objs = mem_test_get (pool, 1);
+        CHECK (objs[0] == last);
+        mem_test_put (objs, 1);
+
+        return NULL;
+}
+
+static void
+mem_test_grow_and_reuse (void)
+{
+        struct mem_pool *pool = NULL;
+
+        pool = mem_pool_new (struct mem_test_obj, MEM_TEST_SLAB);
+        CHECK (pool != NULL);
+        if (!pool)
+                return;
+        CHECK (pool->cache_id >= 0);
+
+        mem_test_run (mem_test_reuse, pool);
+        mem_test_counts (pool, 0);
+
+        mem_pool_destroy (pool);
+}
+
+static void
+mem_test_threads (void)
+{
+        struct mem_pool      *pool = NULL;
+        struct mem_test_obj **objs = NULL;
+        pthread_t             threads[4];
+        int                   i = 0;
+
+        pool = mem_pool_new (struct mem_test_obj, MEM_TEST_SLAB);
+        CHECK (pool != NULL);
+        if (!pool)
+                return;
+
+        /* exiting threads give their magazines back */
+        for (i = 0; i < 4; i++)
+                CHECK (pthread_create (&threads[i], NULL, mem_test_worker,
+                                       pool) == 0);
+        for (i = 0; i < 4; i++)
+                pthread_join (threads[i], NULL);
+        mem_test_counts (pool, 0);
+
+        /* chunks put by another thread than the one that got them */
+        objs = mem_test_run (mem_test_getter, pool);
+        CHECK (objs != NULL);
+        mem_test_counts (pool, MEM_TEST_OBJS);
+        if (objs)
+                mem_test_run (mem_test_putter, objs);
+        mem_test_counts (pool, 0);
+
+        mem_pool_destroy (pool);
+}
+
+static void *
+mem_test_slot_reuse (void *data)
+{
+        struct mem_pool      *pool = NULL;
+        struct mem_pool      *next = NULL;
+        struct mem_test_obj **objs = NULL;
+        int                   cache_id = 0;
+
+        /* leave chunks of a pool in our cache and destroy the pool */
+        pool = mem_pool_new (struct mem_test_obj, MEM_TEST_SLAB);
+        CHECK (pool != NULL);
+        if (!pool)
+                return NULL;
+        cache_id = pool->cache_id;
+        mem_test_put (mem_test_get (pool, 8), 8);
+        mem_pool_destroy (pool);
+
+        /* the new owner of the slot must not get any of them */
+        next = mem_pool_new (struct mem_test_obj, MEM_TEST_SLAB);
+        CHECK (next != NULL);
+        if (!next)
+                return NULL;
+        CHECK (next->cache_id == cache_id);
+
+        objs = mem_test_get (next, 8);
+        CHECK (next->hot_count >= 8);
+        mem_test_put (objs, 8);
+
+        return next;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t *ctx = NULL;
+        struct mem_pool *pool = NULL;
+
+#ifdef DEBUG
+        /* debug builds allocate every object from the heap */
+        return 77;
+#endif
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx)) {
+                fprintf (stderr, "failed to initialize glusterfs context\n");
+                return 1;
+        }
+        THIS->ctx = ctx;
+        if (xlator_mem_acct_init (THIS, gf_common_mt_end + 1)) {
+                fprintf (stderr, "failed to initialize memory accounting\n");
+                return 1;
+        }
+
+        mem_test_grow_and_reuse ();
+        mem_test_threads ();
+        pool = mem_test_run (mem_test_slot_reuse, NULL);
+        if (pool) {
+                mem_test_counts (pool, 0);
+                mem_pool_destroy (pool);
+        }
+
+        if (failures) {
+                fprintf (stderr, "%d checks failed\n", failures);
+                return 1;
+        }
+
+        return 0;
+}
@@ -83,6 +83,8 @@ fill_defaults (xlator_t *xl)
 	SET_DEFAULT_FOP (discard);
         SET_DEFAULT_FOP (zerofill);
         SET_DEFAULT_FOP (ipc);
+        SET_DEFAULT_FOP (seek);
+        SET_DEFAULT_FOP (compound);
 
         SET_DEFAULT_FOP (getspec);
 
@@ -54,6 +54,8 @@ struct _gf_dirent_t;
 typedef struct _gf_dirent_t gf_dirent_t;
 struct _loc;
 typedef struct _loc loc_t;
+struct _compound_args;
+typedef struct _compound_args compound_args_t;
 
 
 typedef int32_t (*event_notify_fn_t) (xlator_t *this, int32_t event, void *data,
@@ -448,6 +450,16 @@ typedef int32_t (*fop_ipc_cbk_t) (call_frame_t *frame, void *cookie,
                                  xlator_t *this, int32_t op_ret,
                                  int32_t op_errno, dict_t *xdata);
 
+typedef int32_t (*fop_seek_cbk_t) (call_frame_t *frame, void *cookie,
+                                   xlator_t *this, int32_t op_ret,
+                                   int32_t op_errno, off_t offset,
+                                   dict_t *xdata);
+
+typedef int32_t (*fop_compound_cbk_t) (call_frame_t *frame, void *cookie,
+                                       xlator_t *this, int32_t op_ret,
+                                       int32_t op_errno,
+                                       compound_args_t *args, dict_t *xdata);
+
 typedef int32_t (*fop_lookup_t) (call_frame_t *frame,
                                  xlator_t *this,
                                  loc_t *loc,
@@ -690,6 +702,13 @@ typedef int32_t (*fop_zerofill_t) (call_frame_t *frame,
 typedef int32_t (*fop_ipc_t) (call_frame_t *frame, xlator_t *this, int32_t op,
                               dict_t *xdata);
 
+typedef int32_t (*fop_seek_t) (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                               off_t offset, gf_seek_what_t what,
+                               dict_t *xdata);
+
+typedef int32_t (*fop_compound_t) (call_frame_t *frame, xlator_t *this,
+                                   compound_args_t *args, dict_t *xdata);
+
 struct xlator_fops {
         fop_lookup_t         lookup;
         fop_stat_t           stat;
@@ -737,6 +756,8 @@ struct xlator_fops {
 	fop_discard_t	     discard;
         fop_zerofill_t       zerofill;
         fop_ipc_t            ipc;
+        fop_seek_t           seek;
+        fop_compound_t       compound;
 
         /* these entries are used for a typechecking hack in STACK_WIND _only_ */
         fop_lookup_cbk_t         lookup_cbk;
@@ -785,6 +806,8 @@ struct xlator_fops {
 	fop_discard_cbk_t	 discard_cbk;
         fop_zerofill_cbk_t       zerofill_cbk;
         fop_ipc_cbk_t            ipc_cbk;
+        fop_seek_cbk_t           seek_cbk;
+        fop_compound_cbk_t       compound_cbk;
 };
 
 typedef int32_t (*cbk_forget_t) (xlator_t *this,
@@ -886,6 +909,8 @@ struct _xlator {
         eh_t               *history; /* event history context */
         glusterfs_ctx_t    *ctx;
         glusterfs_graph_t  *graph; /* not set for fuse */
+        int                 xl_id; /* 1..graph->xl_count, indexes the
+                                      inode and fd ctx slots */
         inode_table_t      *itable;
         char                init_succeeded;
         void               *private;
@@ -44,6 +44,63 @@ rpc_clnt_new_callid (struct rpc_clnt *clnt)
 }
 
 
+static inline struct list_head *
+__saved_frames_bucket (struct saved_frames *frames, uint32_t xid)
+{
+        return &frames->buckets[xid & (frames->bucket_count - 1)];
+}
+
+static void
+__saved_frames_rehash (struct saved_frames *frames)
+{
+        struct list_head   *buckets = NULL;
+        struct list_head   *old = NULL;
+        struct saved_frame *trav = NULL;
+        struct saved_frame *tmp = NULL;
+        uint32_t            old_count = 0;
+        uint32_t            i = 0;
+
+        buckets = GF_CALLOC (frames->bucket_count * 2, sizeof (*buckets),
+                             gf_common_mt_rpcclnt_savedframe_t);
+        if (!buckets) {
+                /* lookups stay correct, chains just get longer */
+                return;
+        }
+
+        for (i = 0; i < frames->bucket_count * 2; i++)
+                INIT_LIST_HEAD (&buckets[i]);
+
+        old = frames->buckets;
+        old_count = frames->bucket_count;
+
+        frames->buckets = buckets;
+        frames->bucket_count *= 2;
+
+        for (i = 0; i < old_count; i++) {
+                list_for_each_entry_safe (trav, tmp, &old[i], hash) {
+                        list_move_tail (&trav->hash,
+                                        __saved_frames_bucket (frames,
+                                                        trav->rpcreq->xid));
+                }
+        }
+
+        GF_FREE (old);
+}
+
+static struct saved_frame *
+__saved_frame_lookup (struct saved_frames *frames, int64_t callid)
+{
+        struct saved_frame *tmp = NULL;
+
+        list_for_each_entry (tmp, __saved_frames_bucket (frames, callid),
+                             hash) {
+                if (tmp->rpcreq->xid == callid)
+                        return tmp;
+        }
+
+        return NULL;
+}
+
 struct saved_frame *
 __saved_frames_get_timedout (struct saved_frames *frames, uint32_t timeout,
                              struct timeval *current)
@@ -55,6 +112,7 @@ __saved_frames_get_timedout (struct saved_frames *frames, uint32_t timeout,
 		if ((tmp->saved_at.tv_sec + timeout) < current->tv_sec) {
 			bailout_frame = tmp;
 			list_del_init (&bailout_frame->list);
+			list_del_init (&bailout_frame->hash);
 			frames->count--;
 		}
 	}
@@ -92,6 +150,7 @@ __saved_frames_put (struct saved_frames *frames, void *frame,
 
         memset (saved_frame, 0, sizeof (*saved_frame));
 	INIT_LIST_HEAD (&saved_frame->list);
+	INIT_LIST_HEAD (&saved_frame->hash);
 
 	saved_frame->capital_this = THIS;
 	saved_frame->frame        = frame;
@@ -103,8 +162,15 @@ __saved_frames_put (struct saved_frames *frames, void *frame,
         else
                 list_add_tail (&saved_frame->list, &frames->sf.list);
 
+        list_add_tail (&saved_frame->hash,
+                       __saved_frames_bucket (frames, rpcreq->xid));
+
 	frames->count++;
 
+        if ((frames->count > (frames->bucket_count * 2)) &&
+            (frames->bucket_count < RPC_CLNT_SAVED_FRAMES_MAX_BUCKETS))
+                __saved_frames_rehash (frames);
+
 out:
 	return saved_frame;
 }
@@ -250,6 +316,7 @@ struct saved_frames *
 saved_frames_new (void)
 {
 	struct saved_frames *saved_frames = NULL;
+        uint32_t             i            = 0;
 
 	saved_frames = GF_CALLOC (1, sizeof (*saved_frames),
                                   gf_common_mt_rpcclnt_savedframe_t);
@@ -260,6 +327,18 @@ saved_frames_new (void)
 	INIT_LIST_HEAD (&saved_frames->sf.list);
 	INIT_LIST_HEAD (&saved_frames->lk_sf.list);
 
+        saved_frames->bucket_count = RPC_CLNT_SAVED_FRAMES_MIN_BUCKETS;
+        saved_frames->buckets = GF_CALLOC (saved_frames->bucket_count,
+                                           sizeof (*saved_frames->buckets),
+                                           gf_common_mt_rpcclnt_savedframe_t);
+        if (!saved_frames->buckets) {
+                GF_FREE (saved_frames);
+                return NULL;
+        }
+
+        for (i = 0; i < saved_frames->bucket_count; i++)
+                INIT_LIST_HEAD (&saved_frames->buckets[i]);
+
 	return saved_frames;
 }
 
@@ -276,21 +355,11 @@ __saved_frame_copy (struct saved_frames *frames, int64_t callid,
                 goto out;
         }
 
-	list_for_each_entry (tmp, &frames->sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			*saved_frame = *tmp;
-                        ret = 0;
-			goto out;
-		}
-	}
-
-	list_for_each_entry (tmp, &frames->lk_sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			*saved_frame = *tmp;
-                        ret = 0;
-			goto out;
-		}
-	}
+        tmp = __saved_frame_lookup (frames, callid);
+        if (tmp) {
+                *saved_frame = *tmp;
+                ret = 0;
+        }
 
 out:
 	return ret;
@@ -301,28 +370,12 @@ struct saved_frame *
 __saved_frame_get (struct saved_frames *frames, int64_t callid)
 {
 	struct saved_frame *saved_frame = NULL;
-	struct saved_frame *tmp = NULL;
-
-	list_for_each_entry (tmp, &frames->sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			list_del_init (&tmp->list);
-			frames->count--;
-			saved_frame = tmp;
-			goto out;
-		}
-	}
 
-	list_for_each_entry (tmp, &frames->lk_sf.list, list) {
-		if (tmp->rpcreq->xid == callid) {
-			list_del_init (&tmp->list);
-			frames->count--;
-			saved_frame = tmp;
-			goto out;
-		}
-	}
-
-out:
+        saved_frame = __saved_frame_lookup (frames, callid);
 	if (saved_frame) {
+                list_del_init (&saved_frame->list);
+                list_del_init (&saved_frame->hash);
+                frames->count--;
                 THIS  = saved_frame->capital_this;
         }
 
@@ -369,6 +422,7 @@ saved_frames_unwind (struct saved_frames *saved_frames)
                                        trav->rpcreq->conn->rpc_clnt->reqpool);
 
 		list_del_init (&trav->list);
+		list_del_init (&trav->hash);
                 mem_put (trav);
 	}
 }
@@ -382,6 +436,7 @@ saved_frames_destroy (struct saved_frames *frames)
 
 	saved_frames_unwind (frames);
 
+	GF_FREE (frames->buckets);
 	GF_FREE (frames);
 }
 
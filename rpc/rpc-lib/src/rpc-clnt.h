@@ -50,6 +50,7 @@ struct saved_frame {
 			struct saved_frame *frame_prev;
 		};
 	};
+        struct list_head         hash; /* xid bucket in saved_frames */
         void                    *capital_this;
 	void                    *frame;
 	struct timeval           saved_at;
@@ -57,10 +58,18 @@ struct saved_frame {
         rpc_transport_rsp_t      rsp;
 };
 
+#define RPC_CLNT_SAVED_FRAMES_MIN_BUCKETS 64
+#define RPC_CLNT_SAVED_FRAMES_MAX_BUCKETS 65536
+
+/* sf and lk_sf keep the frames in the order they were sent, which is what
+ * the call_bail timeout scan relies on. buckets index the same frames by
+ * xid so that replies are matched without walking those lists. */
 struct saved_frames {
 	int64_t            count;
 	struct saved_frame sf;
 	struct saved_frame lk_sf;
+        struct list_head  *buckets;
+        uint32_t           bucket_count; /* always a power of two */
 };
 
 
@@ -210,6 +210,8 @@ struct rpc_transport {
 
         uint64_t                   total_bytes_read;
         uint64_t                   total_bytes_write;
+        uint64_t                   total_msgs_write;
+        uint64_t                   total_write_calls;
 
         struct list_head           list;
         int                        bind_insecure;
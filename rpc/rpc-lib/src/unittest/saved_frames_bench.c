@@ -0,0 +1,147 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Measures the cost of matching a reply to its saved frame as the number
+ * of outstanding requests on a connection grows. Replies are consumed in
+ * random order and every consumed request is replaced by a new one, so
+ * the queue depth stays constant during a run.
+ *
+ *   ./saved_frames_bench [replies-per-depth]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+#include "rpc-clnt.h"
+
+/*
+ * Prototypes to private functions
+ */
+struct saved_frame *
+__saved_frames_put (struct saved_frames *frames, void *frame,
+                    struct rpc_req *rpcreq);
+struct saved_frame *
+__saved_frame_get (struct saved_frames *frames, int64_t callid);
+struct saved_frames *
+saved_frames_new (void);
+
+static const int depths[] = { 1, 16, 128, 1024, 4096, 16384, 65536 };
+
+static rpc_clnt_prog_t bench_prog = {
+        .progname = "BENCH",
+        .prognum  = 1,
+        .progver  = 1,
+};
+
+static double
+bench_depth (struct rpc_clnt *clnt, int depth, int replies)
+{
+        struct saved_frames *frames = NULL;
+        struct saved_frame  *sframe = NULL;
+        struct rpc_req      *reqs = NULL;
+        struct timespec      start = {0, };
+        struct timespec      end = {0, };
+        uint32_t             xid = 0;
+        int                  i = 0;
+        int                  slot = 0;
+
+        frames = saved_frames_new ();
+        reqs = calloc (depth, sizeof (*reqs));
+        if (!frames || !reqs) {
+                fprintf (stderr, "out of memory\n");
+                exit (1);
+        }
+
+        for (i = 0; i < depth; i++) {
+                reqs[i].conn = &clnt->conn;
+                reqs[i].prog = &bench_prog;
+                reqs[i].xid = ++xid;
+                __saved_frames_put (frames, NULL, &reqs[i]);
+        }
+
+        clock_gettime (CLOCK_MONOTONIC, &start);
+        for (i = 0; i < replies; i++) {
+                slot = random () % depth;
+                sframe = __saved_frame_get (frames, reqs[slot].xid);
+                if (!sframe) {
+                        fprintf (stderr, "xid %u not found\n",
+                                 reqs[slot].xid);
+                        exit (1);
+                }
+                mem_put (sframe);
+
+                reqs[slot].xid = ++xid;
+                __saved_frames_put (frames, NULL, &reqs[slot]);
+        }
+        clock_gettime (CLOCK_MONOTONIC, &end);
+
+        for (i = 0; i < depth; i++) {
+                sframe = __saved_frame_get (frames, reqs[i].xid);
+                if (sframe)
+                        mem_put (sframe);
+        }
+
+        GF_FREE (frames->buckets);
+        GF_FREE (frames);
+        free (reqs);
+
+        return ((end.tv_sec - start.tv_sec) * 1e9 +
+                (end.tv_nsec - start.tv_nsec)) / replies;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t  *ctx = NULL;
+        struct rpc_clnt  *clnt = NULL;
+        int               replies = 1000000;
+        int               i = 0;
+
+        if (argc > 1)
+                replies = atoi (argv[1]);
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx)) {
+                fprintf (stderr, "failed to initialize glusterfs context\n");
+                return 1;
+        }
+        THIS->ctx = ctx;
+        if (xlator_mem_acct_init (THIS, gf_common_mt_end + 1)) {
+                fprintf (stderr, "failed to initialize memory accounting\n");
+                return 1;
+        }
+
+        clnt = calloc (1, sizeof (*clnt));
+        if (!clnt) {
+                fprintf (stderr, "out of memory\n");
+                return 1;
+        }
+        clnt->conn.rpc_clnt = clnt;
+        clnt->saved_frames_pool = mem_pool_new (struct saved_frame, 512);
+        if (!clnt->saved_frames_pool) {
+                fprintf (stderr, "failed to create saved frames pool\n");
+                return 1;
+        }
+
+        printf ("%10s %16s\n", "depth", "ns/reply");
+        for (i = 0; i < sizeof (depths) / sizeof (depths[0]); i++)
+                printf ("%10d %16.1f\n", depths[i],
+                        bench_depth (clnt, depths[i], replies));
+
+        mem_pool_destroy (clnt->saved_frames_pool);
+        free (clnt);
+
+        return 0;
+}
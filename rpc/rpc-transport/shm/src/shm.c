@@ -0,0 +1,1648 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "shm.h"
+#include "dict.h"
+#include "rpc-transport.h"
+#include "logging.h"
+#include "xlator.h"
+#include "common-utils.h"
+#include "compat-errno.h"
+#include "shm-mem-types.h"
+
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <rpc/rpc_msg.h>
+
+#ifndef MFD_CLOEXEC
+#define MFD_CLOEXEC       0x0001U
+#endif
+#ifndef MFD_ALLOW_SEALING
+#define MFD_ALLOW_SEALING 0x0002U
+#endif
+
+#define SA(ptr) ((struct sockaddr *)ptr)
+
+typedef struct {
+        xlator_t        *this;
+        rpc_transport_t *trans;
+} shm_connect_error_state_t;
+
+static int
+shm_init (rpc_transport_t *this);
+
+
+static int
+shm_memfd_create (const char *name, unsigned int flags)
+{
+#ifdef HAVE_MEMFD_CREATE
+        return memfd_create (name, flags);
+#elif defined(SYS_memfd_create)
+        return syscall (SYS_memfd_create, name, flags);
+#else
+        errno = ENOSYS;
+        return -1;
+#endif
+}
+
+
+static uint32_t
+shm_ring_size_round (uint64_t size)
+{
+        uint32_t rounded = GF_SHM_MIN_RING_SIZE;
+
+        while (rounded < size && rounded < GF_SHM_MAX_RING_SIZE)
+                rounded <<= 1;
+
+        return rounded;
+}
+
+
+/* The ring we produce into. The memfd is sealed against resizing, so that
+ * the peer can map it without fearing a SIGBUS. */
+static struct shm_ring *
+shm_ring_create (rpc_transport_t *this, uint32_t size, size_t *len, int *fdp)
+{
+        struct shm_ring *ring = NULL;
+        int              fd   = -1;
+
+        *len = sizeof (*ring) + size;
+
+        fd = shm_memfd_create ("glusterfs-shm", MFD_CLOEXEC|MFD_ALLOW_SEALING);
+        if (fd == -1) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "memfd_create failed (%s)", strerror (errno));
+                goto err;
+        }
+
+        if (ftruncate (fd, *len) == -1) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "sizing the ring to %zu bytes failed (%s)", *len,
+                        strerror (errno));
+                goto err;
+        }
+
+#ifdef F_ADD_SEALS
+        if (fcntl (fd, F_ADD_SEALS,
+                   F_SEAL_SHRINK|F_SEAL_GROW|F_SEAL_SEAL) == -1) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "sealing the ring failed (%s)", strerror (errno));
+                goto err;
+        }
+#endif
+
+        ring = mmap (NULL, *len, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ring == MAP_FAILED) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "mapping the ring failed (%s)", strerror (errno));
+                ring = NULL;
+                goto err;
+        }
+
+        ring->magic = SHM_RING_MAGIC;
+        ring->size = size;
+        ring->reader_waiting = 1;
+
+        *fdp = fd;
+        return ring;
+err:
+        if (fd != -1)
+                close (fd);
+        return NULL;
+}
+
+
+/* Maps the peer's ring. Nothing in it is trusted: the size is checked once
+ * here and kept in priv, positions are checked on every read. */
+static struct shm_ring *
+shm_ring_map (rpc_transport_t *this, int fd, size_t *len, uint32_t *size)
+{
+        struct shm_ring *ring  = NULL;
+        struct stat      stbuf = {0, };
+
+#ifdef F_GET_SEALS
+        int              seals = 0;
+
+        seals = fcntl (fd, F_GET_SEALS);
+        if (seals == -1 || !(seals & F_SEAL_SHRINK)) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "peer's ring can be truncated, not mapping it");
+                return NULL;
+        }
+#endif
+
+        if (fstat (fd, &stbuf) == -1) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "stat of the peer's ring failed (%s)",
+                        strerror (errno));
+                return NULL;
+        }
+
+        if (stbuf.st_size < sizeof (*ring) ||
+            stbuf.st_size > sizeof (*ring) + GF_SHM_MAX_RING_SIZE) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "peer's ring has a bad size (%"PRId64")",
+                        (int64_t) stbuf.st_size);
+                return NULL;
+        }
+
+        *len = stbuf.st_size;
+        ring = mmap (NULL, *len, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+        if (ring == MAP_FAILED) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "mapping the peer's ring failed (%s)",
+                        strerror (errno));
+                return NULL;
+        }
+
+        *size = ring->size;
+        if (ring->magic != SHM_RING_MAGIC || *size == 0 ||
+            (*size & (*size - 1)) || sizeof (*ring) + *size > *len) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "peer's ring is not valid (magic 0x%x, size %u)",
+                        ring->magic, *size);
+                munmap (ring, *len);
+                return NULL;
+        }
+
+        return ring;
+}
+
+
+static void
+shm_ring_copy_in (struct shm_ring *ring, uint32_t size, uint64_t pos,
+                  const char *buf, size_t len)
+{
+        uint32_t off   = pos & (size - 1);
+        size_t   first = min (len, size - off);
+
+        memcpy (ring->data + off, buf, first);
+        if (len > first)
+                memcpy (ring->data, buf + first, len - first);
+}
+
+
+static void
+shm_ring_copy_out (struct shm_ring *ring, uint32_t size, uint64_t pos,
+                   char *buf, size_t len)
+{
+        uint32_t off   = pos & (size - 1);
+        size_t   first = min (len, size - off);
+
+        memcpy (buf, ring->data + off, first);
+        if (len > first)
+                memcpy (buf + first, ring->data, len - first);
+}
+
+
+/* Only sent when the peer asked for it; if the socket is full the peer has
+ * doorbells left to read anyway. */
+static int
+shm_ring_doorbell (rpc_transport_t *this)
+{
+        shm_private_t *priv = NULL;
+        char           byte = 'd';
+
+        priv = this->private;
+
+        if (send (priv->sock, &byte, 1, MSG_DONTWAIT|MSG_NOSIGNAL) == 1)
+                return 0;
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return 0;
+
+        gf_log (this->name, GF_LOG_DEBUG, "doorbell on %d failed (%s)",
+                priv->sock, strerror (errno));
+        return -1;
+}
+
+
+static int
+shm_send_ring (rpc_transport_t *this, int fd)
+{
+        shm_private_t  *priv = NULL;
+        char            byte = 'r';
+        struct iovec    iov  = {&byte, 1};
+        struct msghdr   msg  = {0, };
+        struct cmsghdr *cmsg = NULL;
+        union {
+                struct cmsghdr cm;
+                char           buf[CMSG_SPACE (sizeof (int))];
+        } control;
+
+        priv = this->private;
+
+        memset (&control, 0, sizeof (control));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.buf;
+        msg.msg_controllen = sizeof (control.buf);
+
+        cmsg = CMSG_FIRSTHDR (&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN (sizeof (int));
+        memcpy (CMSG_DATA (cmsg), &fd, sizeof (int));
+
+        if (sendmsg (priv->sock, &msg, MSG_NOSIGNAL) != 1) {
+                /* clients probing for the brick connect and go away */
+                gf_log (this->name, ((errno == EPIPE) ||
+                                     (errno == ECONNRESET)) ? GF_LOG_DEBUG
+                                                            : GF_LOG_ERROR,
+                        "sending the ring to the peer failed (%s)",
+                        strerror (errno));
+                return -1;
+        }
+
+        return 0;
+}
+
+
+/* returns the fd of the peer's ring, -2 if it has not arrived yet */
+static int
+shm_recv_ring (rpc_transport_t *this)
+{
+        shm_private_t  *priv = NULL;
+        char            byte = 0;
+        struct iovec    iov  = {&byte, 1};
+        struct msghdr   msg  = {0, };
+        struct cmsghdr *cmsg = NULL;
+        int             fd   = -1;
+        ssize_t         ret  = -1;
+        union {
+                struct cmsghdr cm;
+                char           buf[CMSG_SPACE (sizeof (int))];
+        } control;
+
+        priv = this->private;
+
+        memset (&control, 0, sizeof (control));
+        msg.msg_iov = &iov;
+        msg.msg_iovlen = 1;
+        msg.msg_control = control.buf;
+        msg.msg_controllen = sizeof (control.buf);
+
+        ret = recvmsg (priv->sock, &msg, MSG_DONTWAIT|MSG_CMSG_CLOEXEC);
+        if (ret == -1 && (errno == EAGAIN || errno == EINTR))
+                return -2;
+
+        if (ret <= 0) {
+                gf_log (this->name, GF_LOG_DEBUG,
+                        "peer went away before sending its ring (%s)",
+                        ret ? strerror (errno) : "EOF");
+                return -1;
+        }
+
+        cmsg = CMSG_FIRSTHDR (&msg);
+        if (!cmsg || cmsg->cmsg_level != SOL_SOCKET ||
+            cmsg->cmsg_type != SCM_RIGHTS ||
+            cmsg->cmsg_len != CMSG_LEN (sizeof (int))) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "peer did not send its ring");
+                return -1;
+        }
+
+        memcpy (&fd, CMSG_DATA (cmsg), sizeof (int));
+        return fd;
+}
+
+
+static int
+__shm_ring_setup (rpc_transport_t *this)
+{
+        shm_private_t *priv = NULL;
+        int            fd   = -1;
+        int            ret  = -1;
+
+        priv = this->private;
+
+        priv->tx = shm_ring_create (this, priv->ring_size, &priv->tx_len,
+                                    &fd);
+        if (!priv->tx)
+                goto out;
+
+        ret = shm_send_ring (this, fd);
+        close (fd);
+out:
+        return ret;
+}
+
+
+static void
+shm_incoming_reset (struct shm_incoming *in)
+{
+        if (in->iobuf)
+                iobuf_unref (in->iobuf);
+        if (in->payload)
+                iobuf_unref (in->payload);
+
+        memset (in, 0, sizeof (*in));
+}
+
+
+static void
+__shm_ioq_entry_free (struct shm_ioq *entry)
+{
+        list_del_init (&entry->list);
+        if (entry->iobref)
+                iobref_unref (entry->iobref);
+
+        GF_FREE (entry);
+}
+
+
+static void
+__shm_ioq_flush (rpc_transport_t *this)
+{
+        shm_private_t  *priv  = NULL;
+        struct shm_ioq *entry = NULL;
+
+        priv = this->private;
+
+        while (!list_empty (&priv->ioq)) {
+                entry = list_entry (priv->ioq.next, struct shm_ioq, list);
+                __shm_ioq_entry_free (entry);
+        }
+}
+
+
+static void
+__shm_reset (rpc_transport_t *this)
+{
+        shm_private_t *priv = NULL;
+
+        priv = this->private;
+
+        shm_incoming_reset (&priv->incoming);
+
+        if (priv->tx) {
+                munmap (priv->tx, priv->tx_len);
+                priv->tx = NULL;
+        }
+
+        if (priv->rx) {
+                munmap (priv->rx, priv->rx_len);
+                priv->rx = NULL;
+        }
+
+        if (priv->idx != -1)
+                event_unregister_close (this->ctx->event_pool, priv->sock,
+                                        priv->idx);
+        else if (priv->sock != -1)
+                close (priv->sock);
+
+        priv->sock = -1;
+        priv->idx = -1;
+        priv->connected = -1;
+}
+
+
+static struct shm_ioq *
+__shm_ioq_new (rpc_transport_t *this, rpc_transport_msg_t *msg)
+{
+        struct shm_ioq *entry      = NULL;
+        int             count      = 0;
+        uint64_t        hdrlen     = 0;
+        uint64_t        payloadlen = 0;
+
+        count = msg->rpchdrcount + msg->proghdrcount + msg->progpayloadcount;
+
+        GF_ASSERT (count <= (MAX_IOVEC - 1));
+
+        hdrlen = iov_length (msg->rpchdr, msg->rpchdrcount)
+                + iov_length (msg->proghdr, msg->proghdrcount);
+        payloadlen = iov_length (msg->progpayload, msg->progpayloadcount);
+
+        if (!hdrlen || hdrlen + payloadlen > SHM_MAX_MSG_SIZE) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "msg size (%"PRIu64") not allowed on shm",
+                        hdrlen + payloadlen);
+                return NULL;
+        }
+
+        entry = GF_CALLOC (1, sizeof (*entry), gf_shm_mt_ioq_t);
+        if (!entry)
+                return NULL;
+
+        entry->msghdr.hdrlen = hdrlen;
+        entry->msghdr.payloadlen = payloadlen;
+
+        entry->vector[0].iov_base = &entry->msghdr;
+        entry->vector[0].iov_len = sizeof (entry->msghdr);
+        entry->count = 1;
+
+        if (msg->rpchdr != NULL) {
+                memcpy (&entry->vector[entry->count], msg->rpchdr,
+                        sizeof (struct iovec) * msg->rpchdrcount);
+                entry->count += msg->rpchdrcount;
+        }
+
+        if (msg->proghdr != NULL) {
+                memcpy (&entry->vector[entry->count], msg->proghdr,
+                        sizeof (struct iovec) * msg->proghdrcount);
+                entry->count += msg->proghdrcount;
+        }
+
+        if (msg->progpayload != NULL) {
+                memcpy (&entry->vector[entry->count], msg->progpayload,
+                        sizeof (struct iovec) * msg->progpayloadcount);
+                entry->count += msg->progpayloadcount;
+        }
+
+        entry->pending_vector = entry->vector;
+        entry->pending_count = entry->count;
+
+        if (msg->iobref != NULL)
+                entry->iobref = iobref_ref (msg->iobref);
+
+        INIT_LIST_HEAD (&entry->list);
+
+        return entry;
+}
+
+
+/* Copies as much of the entry as fits at *head. Returns 0 when all of it
+ * is in the ring, 1 when the ring is full. */
+static int
+__shm_ioq_churn_entry (rpc_transport_t *this, struct shm_ioq *entry,
+                       uint64_t *head)
+{
+        shm_private_t *priv  = NULL;
+        uint64_t       tail  = 0;
+        uint64_t       space = 0;
+        size_t         len   = 0;
+
+        priv = this->private;
+
+        tail = __atomic_load_n (&priv->tx->tail, __ATOMIC_ACQUIRE);
+        if (*head - tail > priv->ring_size) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "peer moved the ring tail to %"PRIu64" (head "
+                        "%"PRIu64")", tail, *head);
+                return -1;
+        }
+
+        space = priv->ring_size - (*head - tail);
+
+        while (entry->pending_count && space) {
+                len = min (space, entry->pending_vector->iov_len);
+
+                shm_ring_copy_in (priv->tx, priv->ring_size, *head,
+                                  entry->pending_vector->iov_base, len);
+                *head += len;
+                space -= len;
+
+                if (len == entry->pending_vector->iov_len) {
+                        entry->pending_vector++;
+                        entry->pending_count--;
+                } else {
+                        entry->pending_vector->iov_base =
+                                (char *)entry->pending_vector->iov_base + len;
+                        entry->pending_vector->iov_len -= len;
+                }
+        }
+
+        return entry->pending_count ? 1 : 0;
+}
+
+
+static int
+__shm_ioq_churn (rpc_transport_t *this)
+{
+        shm_private_t  *priv  = NULL;
+        struct shm_ioq *entry = NULL;
+        struct shm_ioq *tmp   = NULL;
+        uint64_t        start = 0;
+        uint64_t        head  = 0;
+        int             ret   = 0;
+
+        priv = this->private;
+
+        start = head = priv->tx->head;
+
+        list_for_each_entry_safe (entry, tmp, &priv->ioq, list) {
+                ret = __shm_ioq_churn_entry (this, entry, &head);
+                if (ret)
+                        break;
+
+                __shm_ioq_entry_free (entry);
+                this->total_msgs_write++;
+        }
+
+        if (ret == -1)
+                return -1;
+
+        if (head != start) {
+                __atomic_store_n (&priv->tx->head, head, __ATOMIC_RELEASE);
+                this->total_bytes_write += head - start;
+
+                __sync_synchronize ();
+                if (priv->tx->reader_waiting &&
+                    __sync_bool_compare_and_swap (&priv->tx->reader_waiting,
+                                                  1, 0)) {
+                        this->total_write_calls++;
+                        if (shm_ring_doorbell (this))
+                                return -1;
+                }
+        }
+
+        return list_empty (&priv->ioq) ? 0 : 1;
+}
+
+
+/* Writes the ioq into the ring. When the ring is full the peer is asked for
+ * a doorbell once it made room, and the rest stays queued until then. */
+static int
+__shm_ioq_push (rpc_transport_t *this)
+{
+        shm_private_t *priv = NULL;
+        uint64_t       tail = 0;
+        int            ret  = 0;
+
+        priv = this->private;
+
+        for (;;) {
+                ret = __shm_ioq_churn (this);
+                if (ret <= 0)
+                        break;
+
+                __atomic_store_n (&priv->tx->writer_waiting, 1,
+                                  __ATOMIC_SEQ_CST);
+                __sync_synchronize ();
+
+                tail = __atomic_load_n (&priv->tx->tail, __ATOMIC_ACQUIRE);
+                if (priv->tx->head - tail >= priv->ring_size) {
+                        ret = 0;
+                        break;
+                }
+        }
+
+        return ret;
+}
+
+
+static int
+shm_incoming_alloc (rpc_transport_t *this)
+{
+        shm_private_t       *priv = NULL;
+        struct shm_incoming *in   = NULL;
+        struct iobuf_pool   *pool = NULL;
+
+        priv = this->private;
+        in = &priv->incoming;
+        pool = this->ctx->iobuf_pool;
+
+        if (!in->msghdr.hdrlen ||
+            (uint64_t)in->msghdr.hdrlen + in->msghdr.payloadlen
+            > SHM_MAX_MSG_SIZE) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "bad message from peer (header %u, payload %u)",
+                        in->msghdr.hdrlen, in->msghdr.payloadlen);
+                return -1;
+        }
+
+        in->iobuf = iobuf_get2 (pool, in->msghdr.hdrlen);
+        if (!in->iobuf)
+                return -1;
+
+        if (in->msghdr.payloadlen) {
+                in->payload = iobuf_get2 (pool, in->msghdr.payloadlen);
+                if (!in->payload)
+                        return -1;
+        }
+
+        return 0;
+}
+
+
+static rpc_transport_pollin_t *
+shm_incoming_complete (rpc_transport_t *this)
+{
+        shm_private_t          *priv      = NULL;
+        struct shm_incoming    *in        = NULL;
+        rpc_transport_pollin_t *pollin    = NULL;
+        struct iobref          *iobref    = NULL;
+        struct iovec            vector[2] = {{0, }, };
+        int                     count     = 0;
+        uint32_t                msg_type  = 0;
+
+        priv = this->private;
+        in = &priv->incoming;
+
+        iobref = iobref_new ();
+        if (!iobref)
+                goto out;
+
+        iobref_add (iobref, in->iobuf);
+        vector[count].iov_base = iobuf_ptr (in->iobuf);
+        vector[count].iov_len = in->msghdr.hdrlen;
+        count++;
+
+        if (in->payload) {
+                iobref_add (iobref, in->payload);
+                vector[count].iov_base = iobuf_ptr (in->payload);
+                vector[count].iov_len = in->msghdr.payloadlen;
+                count++;
+        }
+
+        pollin = rpc_transport_pollin_alloc (this, vector, count, in->iobuf,
+                                             iobref, NULL);
+        if (!pollin) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "transport pollin allocation failed");
+                goto out;
+        }
+
+        /* xid, then the message type */
+        if (in->msghdr.hdrlen >= 2 * sizeof (uint32_t)) {
+                memcpy (&msg_type, iobuf_ptr (in->iobuf) + sizeof (uint32_t),
+                        sizeof (msg_type));
+                if (ntohl (msg_type) == REPLY)
+                        pollin->is_reply = 1;
+        }
+out:
+        if (iobref)
+                iobref_unref (iobref);
+        shm_incoming_reset (in);
+
+        return pollin;
+}
+
+
+/* Takes up to avail bytes of the message being received from tail on.
+ * Returns how many were taken; *pollin is set once the message is whole. */
+static int
+shm_incoming_read (rpc_transport_t *this, uint64_t tail, uint64_t avail,
+                   rpc_transport_pollin_t **pollin)
+{
+        shm_private_t       *priv  = NULL;
+        struct shm_incoming *in    = NULL;
+        uint64_t             total = 0;
+        size_t               len   = 0;
+        size_t               done  = 0;
+
+        priv = this->private;
+        in = &priv->incoming;
+
+        if (in->msghdr_read < sizeof (in->msghdr)) {
+                len = min (avail, sizeof (in->msghdr) - in->msghdr_read);
+                shm_ring_copy_out (priv->rx, priv->rx_size, tail,
+                                   (char *)&in->msghdr + in->msghdr_read,
+                                   len);
+                in->msghdr_read += len;
+
+                if (in->msghdr_read == sizeof (in->msghdr) &&
+                    shm_incoming_alloc (this))
+                        return -1;
+
+                return len;
+        }
+
+        total = (uint64_t)in->msghdr.hdrlen + in->msghdr.payloadlen;
+        len = min (avail, total - in->body_read);
+
+        if (in->body_read < in->msghdr.hdrlen) {
+                done = min (len, in->msghdr.hdrlen - in->body_read);
+                shm_ring_copy_out (priv->rx, priv->rx_size, tail,
+                                   iobuf_ptr (in->iobuf) + in->body_read,
+                                   done);
+        }
+
+        if (done < len) {
+                shm_ring_copy_out (priv->rx, priv->rx_size, tail + done,
+                                   iobuf_ptr (in->payload) + in->body_read
+                                   + done - in->msghdr.hdrlen,
+                                   len - done);
+        }
+
+        in->body_read += len;
+
+        if (in->body_read == total) {
+                *pollin = shm_incoming_complete (this);
+                if (!*pollin)
+                        return -1;
+        }
+
+        return len;
+}
+
+
+/* Runs until the ring is empty and the peer knows we are going to sleep.
+ * Only the poller thread handling this transport gets here, so the
+ * incoming state needs no lock. */
+static int
+shm_ring_consume (rpc_transport_t *this)
+{
+        shm_private_t          *priv   = NULL;
+        struct shm_ring        *rx     = NULL;
+        rpc_transport_pollin_t *pollin = NULL;
+        uint64_t                head   = 0;
+        uint64_t                tail   = 0;
+        int                     ret    = 0;
+
+        priv = this->private;
+        rx = priv->rx;
+
+        for (;;) {
+                head = __atomic_load_n (&rx->head, __ATOMIC_ACQUIRE);
+                tail = rx->tail;
+
+                if (head - tail > priv->rx_size) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "peer moved the ring head to %"PRIu64" "
+                                "(tail %"PRIu64")", head, tail);
+                        return -1;
+                }
+
+                if (head == tail) {
+                        __atomic_store_n (&rx->reader_waiting, 1,
+                                          __ATOMIC_SEQ_CST);
+                        __sync_synchronize ();
+                        if (__atomic_load_n (&rx->head, __ATOMIC_ACQUIRE)
+                            == tail)
+                                break;
+                        __atomic_store_n (&rx->reader_waiting, 0,
+                                          __ATOMIC_SEQ_CST);
+                        continue;
+                }
+
+                ret = shm_incoming_read (this, tail, head - tail, &pollin);
+                if (ret < 0)
+                        return -1;
+
+                __atomic_store_n (&rx->tail, tail + ret, __ATOMIC_RELEASE);
+                this->total_bytes_read += ret;
+
+                __sync_synchronize ();
+                if (rx->writer_waiting &&
+                    __sync_bool_compare_and_swap (&rx->writer_waiting, 1, 0)) {
+                        if (shm_ring_doorbell (this))
+                                return -1;
+                }
+
+                if (pollin) {
+                        rpc_transport_notify (this, RPC_TRANSPORT_MSG_RECEIVED,
+                                              pollin);
+                        rpc_transport_pollin_destroy (pollin);
+                        pollin = NULL;
+                }
+        }
+
+        return 0;
+}
+
+
+static int
+shm_event_poll_in (rpc_transport_t *this)
+{
+        shm_private_t *priv    = NULL;
+        char           buf[64] = {0, };
+        ssize_t        ret     = 0;
+        int            flushed = 0;
+
+        priv = this->private;
+
+        /* the doorbells only say "look at the rings" */
+        for (;;) {
+                ret = recv (priv->sock, buf, sizeof (buf), MSG_DONTWAIT);
+                if (ret == sizeof (buf))
+                        continue;
+                if (ret > 0)
+                        break;
+                if (ret == -1 && errno == EINTR)
+                        continue;
+                if (ret == -1 && (errno == EAGAIN || errno == EWOULDBLOCK))
+                        break;
+
+                gf_log (this->name, GF_LOG_DEBUG, "peer %s (%s)",
+                        ret ? "read failed" : "closed the connection",
+                        ret ? strerror (errno) : "EOF");
+                return -1;
+        }
+
+        ret = shm_ring_consume (this);
+        if (ret)
+                return -1;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                if (priv->connected == 1 && !list_empty (&priv->ioq)) {
+                        ret = __shm_ioq_push (this);
+                        flushed = (ret == 0);
+                }
+        }
+        pthread_mutex_unlock (&priv->lock);
+
+        if (flushed)
+                rpc_transport_notify (this, RPC_TRANSPORT_MSG_SENT, NULL);
+
+        return ret;
+}
+
+
+static int
+shm_connect_finish (rpc_transport_t *this)
+{
+        shm_private_t *priv       = NULL;
+        int            fd         = -1;
+        int            ret        = 0;
+        int            notify_rpc = 0;
+
+        priv = this->private;
+
+        fd = shm_recv_ring (this);
+        if (fd == -2)
+                return 0;
+        if (fd < 0)
+                return -1;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                priv->rx = shm_ring_map (this, fd, &priv->rx_len,
+                                         &priv->rx_size);
+                if (!priv->rx) {
+                        ret = -1;
+                        goto unlock;
+                }
+
+                priv->connected = 1;
+                /* the server side has notified ACCEPT already */
+                notify_rpc = !priv->is_server;
+        }
+unlock:
+        pthread_mutex_unlock (&priv->lock);
+
+        close (fd);
+
+        if (notify_rpc)
+                rpc_transport_notify (this, RPC_TRANSPORT_CONNECT, this);
+
+        return ret;
+}
+
+
+static int
+shm_event_poll_err (rpc_transport_t *this)
+{
+        shm_private_t *priv = NULL;
+
+        priv = this->private;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                __shm_ioq_flush (this);
+                __shm_reset (this);
+        }
+        pthread_mutex_unlock (&priv->lock);
+
+        rpc_transport_notify (this, RPC_TRANSPORT_DISCONNECT, this);
+
+        return -1;
+}
+
+
+static int
+shm_event_handler (int fd, int idx, void *data,
+                   int poll_in, int poll_out, int poll_err)
+{
+        rpc_transport_t *this = NULL;
+        shm_private_t   *priv = NULL;
+        int              ret  = 0;
+
+        this = data;
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", this->private, out);
+        GF_VALIDATE_OR_GOTO ("shm", this->xl, out);
+
+        THIS = this->xl;
+        priv = this->private;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                priv->idx = idx;
+        }
+        pthread_mutex_unlock (&priv->lock);
+
+        if (poll_in && priv->connected == 0)
+                ret = shm_connect_finish (this);
+
+        if (!ret && poll_in && priv->connected == 1)
+                ret = shm_event_poll_in (this);
+
+        if ((ret < 0) || poll_err) {
+                gf_log ("transport", ((ret >= 0) ? GF_LOG_INFO : GF_LOG_DEBUG),
+                        "disconnecting now");
+                shm_event_poll_err (this);
+                rpc_transport_unref (this);
+        }
+
+out:
+        return ret;
+}
+
+
+static int
+shm_fill_sockaddr (rpc_transport_t *this, peer_info_t *info)
+{
+        shm_private_t      *priv  = NULL;
+        struct sockaddr_un *sunaddr = NULL;
+
+        priv = this->private;
+
+        if (!priv->path) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "transport.shm.%s-path not set",
+                        (info == &this->myinfo) ? "listen" : "connect");
+                return -1;
+        }
+
+        sunaddr = (struct sockaddr_un *)&info->sockaddr;
+        if (strlen (priv->path) >= sizeof (sunaddr->sun_path)) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "path %s is too long for a unix socket", priv->path);
+                return -1;
+        }
+
+        memset (&info->sockaddr, 0, sizeof (info->sockaddr));
+        sunaddr->sun_family = AF_UNIX;
+        strcpy (sunaddr->sun_path, priv->path);
+        info->sockaddr_len = sizeof (*sunaddr);
+        strcpy (info->identifier, priv->path);
+
+        return 0;
+}
+
+
+static void
+shm_set_nonblock (int fd)
+{
+        int flags = 0;
+
+        flags = fcntl (fd, F_GETFL);
+        if (flags != -1)
+                fcntl (fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+
+static void *
+shm_connect_error_cbk (void *opaque)
+{
+        shm_connect_error_state_t *arg = NULL;
+
+        arg = opaque;
+        THIS = arg->this;
+
+        rpc_transport_notify (arg->trans, RPC_TRANSPORT_DISCONNECT, arg->trans);
+
+        GF_FREE (opaque);
+        return NULL;
+}
+
+
+static int
+shm_connect (rpc_transport_t *this, int port)
+{
+        shm_private_t             *priv  = NULL;
+        glusterfs_ctx_t           *ctx   = NULL;
+        shm_connect_error_state_t *arg   = NULL;
+        pthread_t                  th_id = {0, };
+        int                        ret   = -1;
+        int                        sock  = -1;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, err);
+        GF_VALIDATE_OR_GOTO ("shm", this->private, err);
+
+        priv = this->private;
+        ctx = this->ctx;
+
+        /* port is for the network transports, the path is all we need */
+        pthread_mutex_lock (&priv->lock);
+        {
+                if (priv->sock != -1) {
+                        gf_log_callingfn (this->name, GF_LOG_TRACE,
+                                          "connect () called on transport "
+                                          "already connected");
+                        errno = EINPROGRESS;
+                        ret = -1;
+                        goto unlock;
+                }
+
+                ret = shm_fill_sockaddr (this, &this->peerinfo);
+                if (ret)
+                        goto unlock;
+
+                priv->sock = socket (AF_UNIX, SOCK_STREAM, 0);
+                if (priv->sock == -1) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "socket creation failed (%s)",
+                                strerror (errno));
+                        ret = -1;
+                        goto unlock;
+                }
+
+                ret = connect (priv->sock, SA (&this->peerinfo.sockaddr),
+                               this->peerinfo.sockaddr_len);
+                if (ret == -1) {
+                        gf_log (this->name, GF_LOG_DEBUG,
+                                "connection attempt on %s failed, (%s)",
+                                this->peerinfo.identifier, strerror (errno));
+                        __shm_reset (this);
+                        goto unlock;
+                }
+
+                this->myinfo.sockaddr_len = sizeof (this->myinfo.sockaddr);
+                getsockname (priv->sock, SA (&this->myinfo.sockaddr),
+                             &this->myinfo.sockaddr_len);
+                strcpy (this->myinfo.identifier,
+                        ((struct sockaddr_un *)&this->myinfo.sockaddr)
+                        ->sun_path);
+
+                ret = __shm_ring_setup (this);
+                if (ret) {
+                        __shm_reset (this);
+                        goto unlock;
+                }
+
+                shm_set_nonblock (priv->sock);
+
+                priv->connected = 0;
+                priv->is_server = _gf_false;
+                rpc_transport_ref (this);
+
+                priv->idx = event_register (ctx->event_pool, priv->sock,
+                                            shm_event_handler, this, 1, 0);
+                if (priv->idx == -1) {
+                        gf_log ("", GF_LOG_WARNING,
+                                "failed to register the event");
+                        __shm_reset (this);
+                        rpc_transport_unref (this);
+                        ret = -1;
+                }
+unlock:
+                sock = priv->sock;
+        }
+        pthread_mutex_unlock (&priv->lock);
+
+err:
+        /* Like socket, the DISCONNECT of a failed connect is notified from
+           another thread: our caller may hold locks the notify takes. */
+        if (ret == -1 && sock == -1 && this) {
+                arg = GF_CALLOC (1, sizeof (*arg), gf_shm_mt_error_state_t);
+                if (!arg)
+                        return ret;
+
+                arg->this = THIS;
+                arg->trans = this;
+                if (pthread_create (&th_id, NULL, shm_connect_error_cbk,
+                                    arg)) {
+                        gf_log (this->name, GF_LOG_ERROR, "pthread_create "
+                                "failed: %s", strerror (errno));
+                        GF_FREE (arg);
+                } else {
+                        pthread_detach (th_id);
+                }
+        }
+
+        return ret;
+}
+
+
+static int
+shm_server_event_handler (int fd, int idx, void *data,
+                          int poll_in, int poll_out, int poll_err)
+{
+        rpc_transport_t         *this         = NULL;
+        shm_private_t           *priv         = NULL;
+        rpc_transport_t         *new_trans    = NULL;
+        shm_private_t           *new_priv     = NULL;
+        struct sockaddr_storage  new_sockaddr = {0, };
+        socklen_t                addrlen      = sizeof (new_sockaddr);
+        int                      new_sock     = -1;
+        int                      ret          = 0;
+
+        this = data;
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", this->private, out);
+        GF_VALIDATE_OR_GOTO ("shm", this->xl, out);
+
+        THIS = this->xl;
+        priv = this->private;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                priv->idx = idx;
+
+                if (!poll_in)
+                        goto unlock;
+
+                new_sock = accept (priv->sock, SA (&new_sockaddr), &addrlen);
+                if (new_sock == -1) {
+                        gf_log (this->name, GF_LOG_WARNING,
+                                "accept on %d failed (%s)",
+                                priv->sock, strerror (errno));
+                        goto unlock;
+                }
+
+                new_trans = GF_CALLOC (1, sizeof (*new_trans),
+                                       gf_common_mt_rpc_trans_t);
+                if (!new_trans) {
+                        close (new_sock);
+                        goto unlock;
+                }
+
+                ret = pthread_mutex_init (&new_trans->lock, NULL);
+                if (ret) {
+                        close (new_sock);
+                        GF_FREE (new_trans);
+                        goto unlock;
+                }
+
+                new_trans->name = gf_strdup (this->name);
+
+                memcpy (&new_trans->peerinfo.sockaddr, &new_sockaddr,
+                        addrlen);
+                new_trans->peerinfo.sockaddr_len = addrlen;
+                strcpy (new_trans->peerinfo.identifier,
+                        ((struct sockaddr_un *)&new_sockaddr)->sun_path);
+                new_trans->myinfo = this->myinfo;
+
+                ret = shm_init (new_trans);
+                if (ret != 0) {
+                        close (new_sock);
+                        GF_FREE (new_trans->name);
+                        GF_FREE (new_trans);
+                        goto unlock;
+                }
+                new_trans->ops = this->ops;
+                new_trans->init = this->init;
+                new_trans->fini = this->fini;
+                new_trans->ctx = this->ctx;
+                new_trans->xl = this->xl;
+                new_trans->mydata = this->mydata;
+                new_trans->notify = this->notify;
+                new_trans->listener = this;
+
+                new_priv = new_trans->private;
+                new_priv->ring_size = priv->ring_size;
+                new_priv->sock = new_sock;
+                new_priv->is_server = _gf_true;
+
+                pthread_mutex_lock (&new_priv->lock);
+                {
+                        rpc_transport_ref (new_trans);
+
+                        ret = __shm_ring_setup (new_trans);
+                        if (ret == 0) {
+                                shm_set_nonblock (new_sock);
+                                new_priv->connected = 0;
+                                new_priv->idx =
+                                        event_register (this->ctx->event_pool,
+                                                        new_sock,
+                                                        shm_event_handler,
+                                                        new_trans, 1, 0);
+                                if (new_priv->idx == -1) {
+                                        gf_log (this->name, GF_LOG_WARNING,
+                                                "failed to register the "
+                                                "accepted connection");
+                                        ret = -1;
+                                }
+                        }
+                }
+                pthread_mutex_unlock (&new_priv->lock);
+
+                if (ret == -1) {
+                        gf_log (this->name, GF_LOG_DEBUG,
+                                "failed to set up the accepted connection");
+                        rpc_transport_unref (new_trans);
+                        goto unlock;
+                }
+
+                ret = rpc_transport_notify (this, RPC_TRANSPORT_ACCEPT,
+                                            new_trans);
+        }
+unlock:
+        pthread_mutex_unlock (&priv->lock);
+
+out:
+        return ret;
+}
+
+
+static int
+shm_listen (rpc_transport_t *this)
+{
+        shm_private_t *priv  = NULL;
+        int            ret   = -1;
+        int            check = -1;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", this->private, out);
+
+        priv = this->private;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                if (priv->sock != -1) {
+                        gf_log (this->name, GF_LOG_DEBUG,
+                                "already listening");
+                        goto unlock;
+                }
+
+                ret = shm_fill_sockaddr (this, &this->myinfo);
+                if (ret)
+                        goto unlock;
+
+                /* a socket file nobody listens on is left over from an
+                   earlier run */
+                check = socket (AF_UNIX, SOCK_STREAM, 0);
+                if (check >= 0) {
+                        ret = connect (check, SA (&this->myinfo.sockaddr),
+                                       this->myinfo.sockaddr_len);
+                        if ((ret == -1) && (ECONNREFUSED == errno))
+                                unlink (priv->path);
+                        close (check);
+                }
+
+                priv->sock = socket (AF_UNIX, SOCK_STREAM, 0);
+                if (priv->sock == -1) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "socket creation failed (%s)",
+                                strerror (errno));
+                        ret = -1;
+                        goto unlock;
+                }
+
+                shm_set_nonblock (priv->sock);
+
+                ret = bind (priv->sock, SA (&this->myinfo.sockaddr),
+                            this->myinfo.sockaddr_len);
+                if (ret == -1) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "binding to %s failed: %s",
+                                this->myinfo.identifier, strerror (errno));
+                        __shm_reset (this);
+                        goto unlock;
+                }
+
+                ret = listen (priv->sock, SHM_LISTEN_BACKLOG);
+                if (ret == -1) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "could not set socket %d to listen mode (%s)",
+                                priv->sock, strerror (errno));
+                        __shm_reset (this);
+                        goto unlock;
+                }
+
+                priv->listening = _gf_true;
+                rpc_transport_ref (this);
+
+                priv->idx = event_register (this->ctx->event_pool, priv->sock,
+                                            shm_server_event_handler,
+                                            this, 1, 0);
+                if (priv->idx == -1) {
+                        gf_log (this->name, GF_LOG_WARNING,
+                                "could not register socket %d with events",
+                                priv->sock);
+                        ret = -1;
+                        __shm_reset (this);
+                        goto unlock;
+                }
+        }
+unlock:
+        pthread_mutex_unlock (&priv->lock);
+
+out:
+        return ret;
+}
+
+
+static int
+shm_disconnect (rpc_transport_t *this)
+{
+        shm_private_t *priv = NULL;
+        int            ret  = -1;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", this->private, out);
+
+        priv = this->private;
+
+        /* the poller sees the hangup and does the rest */
+        pthread_mutex_lock (&priv->lock);
+        {
+                if (priv->sock != -1) {
+                        ret = shutdown (priv->sock, SHUT_RDWR);
+                        priv->connected = -1;
+                }
+        }
+        pthread_mutex_unlock (&priv->lock);
+
+out:
+        return ret;
+}
+
+
+static int32_t
+shm_submit (rpc_transport_t *this, rpc_transport_msg_t *msg)
+{
+        shm_private_t  *priv  = NULL;
+        struct shm_ioq *entry = NULL;
+        int             ret   = -1;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", this->private, out);
+
+        priv = this->private;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                if (priv->connected != 1) {
+                        if (!priv->submit_log) {
+                                gf_log (this->name, GF_LOG_INFO,
+                                        "not connected (priv->connected = %d)",
+                                        priv->connected);
+                                priv->submit_log = 1;
+                        }
+                        goto unlock;
+                }
+
+                priv->submit_log = 0;
+                entry = __shm_ioq_new (this, msg);
+                if (!entry)
+                        goto unlock;
+
+                list_add_tail (&entry->list, &priv->ioq);
+
+                ret = __shm_ioq_push (this);
+                if (ret == -1) {
+                        shutdown (priv->sock, SHUT_RDWR);
+                        priv->connected = -1;
+                } else {
+                        ret = 0;
+                }
+        }
+unlock:
+        pthread_mutex_unlock (&priv->lock);
+
+out:
+        return ret;
+}
+
+
+static int32_t
+shm_submit_request (rpc_transport_t *this, rpc_transport_req_t *req)
+{
+        return shm_submit (this, &req->msg);
+}
+
+
+static int32_t
+shm_submit_reply (rpc_transport_t *this, rpc_transport_reply_t *reply)
+{
+        return shm_submit (this, &reply->msg);
+}
+
+
+static int32_t
+shm_getpeername (rpc_transport_t *this, char *hostname, int hostlen)
+{
+        int32_t ret = -1;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", hostname, out);
+
+        if (hostlen < (strlen (this->peerinfo.identifier) + 1))
+                goto out;
+
+        strcpy (hostname, this->peerinfo.identifier);
+        ret = 0;
+out:
+        return ret;
+}
+
+
+static int32_t
+shm_getpeeraddr (rpc_transport_t *this, char *peeraddr, int addrlen,
+                 struct sockaddr_storage *sa, socklen_t salen)
+{
+        int32_t ret = -1;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", sa, out);
+
+        *sa = this->peerinfo.sockaddr;
+
+        if (peeraddr != NULL)
+                ret = shm_getpeername (this, peeraddr, addrlen);
+        ret = 0;
+out:
+        return ret;
+}
+
+
+static int32_t
+shm_getmyname (rpc_transport_t *this, char *hostname, int hostlen)
+{
+        int32_t ret = -1;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", hostname, out);
+
+        if (hostlen < (strlen (this->myinfo.identifier) + 1))
+                goto out;
+
+        strcpy (hostname, this->myinfo.identifier);
+        ret = 0;
+out:
+        return ret;
+}
+
+
+static int32_t
+shm_getmyaddr (rpc_transport_t *this, char *myaddr, int addrlen,
+               struct sockaddr_storage *sa, socklen_t salen)
+{
+        int32_t ret = 0;
+
+        GF_VALIDATE_OR_GOTO ("shm", this, out);
+        GF_VALIDATE_OR_GOTO ("shm", sa, out);
+
+        *sa = this->myinfo.sockaddr;
+
+        if (myaddr != NULL)
+                ret = shm_getmyname (this, myaddr, addrlen);
+out:
+        return ret;
+}
+
+
+/* Not polling for doorbells is enough: the peer fills the ring and then
+ * waits for us. */
+static int
+shm_throttle (rpc_transport_t *this, gf_boolean_t onoff)
+{
+        shm_private_t *priv = NULL;
+
+        priv = this->private;
+
+        priv->idx = event_select_on (this->ctx->event_pool, priv->sock,
+                                     priv->idx, (int) !onoff, -1);
+        return 0;
+}
+
+
+struct rpc_transport_ops tops = {
+        .listen             = shm_listen,
+        .connect            = shm_connect,
+        .disconnect         = shm_disconnect,
+        .submit_request     = shm_submit_request,
+        .submit_reply       = shm_submit_reply,
+        .get_peername       = shm_getpeername,
+        .get_peeraddr       = shm_getpeeraddr,
+        .get_myname         = shm_getmyname,
+        .get_myaddr         = shm_getmyaddr,
+        .throttle           = shm_throttle,
+};
+
+
+void
+fini (rpc_transport_t *this)
+{
+        shm_private_t *priv = NULL;
+
+        if (!this)
+                return;
+
+        priv = this->private;
+        if (priv) {
+                pthread_mutex_lock (&priv->lock);
+                {
+                        __shm_ioq_flush (this);
+                        __shm_reset (this);
+                }
+                pthread_mutex_unlock (&priv->lock);
+
+                if (priv->listening)
+                        unlink (priv->path);
+
+                gf_log (this->name, GF_LOG_TRACE,
+                        "transport %p destroyed", this);
+
+                pthread_mutex_destroy (&priv->lock);
+                GF_FREE (priv->path);
+                GF_FREE (priv);
+        }
+
+        this->private = NULL;
+}
+
+
+static int
+shm_init (rpc_transport_t *this)
+{
+        shm_private_t *priv      = NULL;
+        char          *optstr    = NULL;
+        uint64_t       ring_size = GF_SHM_DEFAULT_RING_SIZE;
+
+        if (this->private) {
+                gf_log_callingfn (this->name, GF_LOG_ERROR,
+                                  "double init attempted");
+                return -1;
+        }
+
+        priv = GF_CALLOC (1, sizeof (*priv), gf_shm_mt_private_t);
+        if (!priv)
+                return -1;
+
+        pthread_mutex_init (&priv->lock, NULL);
+
+        priv->sock = -1;
+        priv->idx = -1;
+        priv->connected = -1;
+        INIT_LIST_HEAD (&priv->ioq);
+
+        this->private = priv;
+
+        /* accepted transports take what they need from the listener */
+        if (!this->options)
+                goto out;
+
+        if (dict_get_str (this->options, "transport.shm.listen-path",
+                          &optstr) == 0 ||
+            dict_get_str (this->options, "transport.shm.connect-path",
+                          &optstr) == 0) {
+                priv->path = gf_strdup (optstr);
+                if (!priv->path)
+                        goto err;
+        }
+
+        if (dict_get_str (this->options, "transport.shm.ring-size",
+                          &optstr) == 0) {
+                if (gf_string2bytesize_uint64 (optstr, &ring_size) != 0) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "invalid number format: %s", optstr);
+                        goto err;
+                }
+        }
+out:
+        priv->ring_size = shm_ring_size_round (ring_size);
+
+        return 0;
+err:
+        pthread_mutex_destroy (&priv->lock);
+        GF_FREE (priv);
+        this->private = NULL;
+
+        return -1;
+}
+
+
+int32_t
+init (rpc_transport_t *this)
+{
+        int ret = -1;
+
+        ret = shm_init (this);
+        if (ret == -1)
+                gf_log (this->name, GF_LOG_DEBUG, "shm_init() failed");
+
+        return ret;
+}
+
+
+struct volume_options options[] = {
+        { .key   = {"transport.shm.listen-path"},
+          .type  = GF_OPTION_TYPE_PATH,
+          .description = "Unix socket the brick takes shm connections on."
+        },
+        { .key   = {"transport.shm.connect-path"},
+          .type  = GF_OPTION_TYPE_PATH,
+          .description = "Unix socket of the brick's shm listener."
+        },
+        { .key   = {"transport.shm.ring-size"},
+          .type  = GF_OPTION_TYPE_SIZET,
+          .min   = GF_SHM_MIN_RING_SIZE,
+          .max   = GF_SHM_MAX_RING_SIZE,
+          .default_value = "4MB",
+          .description = "Size of the ring each end writes its messages "
+                         "to, rounded up to a power of two. Messages "
+                         "larger than the ring go through it in pieces."
+        },
+        { .key = {NULL} }
+};
@@ -0,0 +1,116 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef _SHM_H
+#define _SHM_H
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "event.h"
+#include "rpc-transport.h"
+#include "logging.h"
+#include "dict.h"
+#include "mem-pool.h"
+#include "globals.h"
+
+/* The shm transport is for a client and a brick on the same node.
+ *
+ * The two ends meet on a unix socket. Each end then creates a ring in a
+ * memfd, maps it and hands the fd over the socket (SCM_RIGHTS); it is the
+ * producer of its own ring and the consumer of the peer's. Messages are
+ * copied into the ring as
+ *
+ *     struct shm_msg_hdr | rpc and program headers | program payload
+ *
+ * and out of it into iobufs, without going through the kernel. The socket
+ * is left to carry doorbells: a byte is sent only when the other end said
+ * it is about to sleep (reader_waiting when the ring was empty,
+ * writer_waiting when it was full), so a busy connection makes no system
+ * calls at all. */
+
+#ifndef MAX_IOVEC
+#define MAX_IOVEC 16
+#endif /* MAX_IOVEC */
+
+#define SHM_RING_MAGIC             0x47465348   /* "GFSH" */
+#define SHM_CACHELINE              64
+
+#define GF_SHM_DEFAULT_RING_SIZE   (4 * GF_UNIT_MB)
+#define GF_SHM_MIN_RING_SIZE       (64 * GF_UNIT_KB)
+#define GF_SHM_MAX_RING_SIZE       (256 * GF_UNIT_MB)
+
+#define SHM_MAX_MSG_SIZE           0x7fffffff
+#define SHM_LISTEN_BACKLOG         128
+
+/* Positions are free running; the offset in data is pos & (size - 1).
+ * head is only moved by the producer and tail by the consumer, each on
+ * its own cache line. */
+struct shm_ring {
+        uint32_t          magic;
+        uint32_t          size;
+        char              _pad0[SHM_CACHELINE - 8];
+        uint64_t          head;
+        uint32_t          writer_waiting;
+        char              _pad1[SHM_CACHELINE - 12];
+        uint64_t          tail;
+        uint32_t          reader_waiting;
+        char              _pad2[SHM_CACHELINE - 12];
+        char              data[];
+};
+
+struct shm_msg_hdr {
+        uint32_t          hdrlen;
+        uint32_t          payloadlen;
+};
+
+struct shm_ioq {
+        struct list_head   list;
+        struct shm_msg_hdr msghdr;
+        struct iovec       vector[MAX_IOVEC];
+        int                count;
+        struct iovec      *pending_vector;
+        int                pending_count;
+        struct iobref     *iobref;
+};
+
+struct shm_incoming {
+        struct shm_msg_hdr msghdr;
+        uint32_t           msghdr_read;
+        uint32_t           body_read;
+        struct iobuf      *iobuf;       /* rpc and program headers */
+        struct iobuf      *payload;
+};
+
+typedef struct {
+        int32_t            sock;
+        int32_t            idx;
+        /* -1 = not connected. 0 = waiting for the peer's ring.
+           1 = connected */
+        char               connected;
+        char               submit_log;
+        gf_boolean_t       is_server;
+        gf_boolean_t       listening;
+        struct list_head   ioq;
+        pthread_mutex_t    lock;
+        char              *path;
+        uint32_t           ring_size;
+        struct shm_ring   *tx;
+        size_t             tx_len;
+        struct shm_ring   *rx;
+        size_t             rx_len;
+        /* as checked when mapping, rx->size is the peer's to scribble */
+        uint32_t           rx_size;
+        struct shm_incoming incoming;
+} shm_private_t;
+
+#endif
@@ -50,6 +50,7 @@
 #define SSL_PRIVATE_KEY_OPT "transport.socket.ssl-private-key"
 #define SSL_CA_LIST_OPT     "transport.socket.ssl-ca-list"
 #define OWN_THREAD_OPT      "transport.socket.own-thread"
+#define SSL_KTLS_OPT        "ssl-ktls"
 
 /*
  * This list was derived by taking the cipher list "HIGH:!SSLv2" (the previous
@@ -348,6 +349,38 @@ out:
 #define ssl_read_one(t,b,l)  ssl_do((t),(b),(l),(SSL_trinary_func *)SSL_read)
 #define ssl_write_one(t,b,l) ssl_do((t),(b),(l),(SSL_trinary_func *)SSL_write)
 
+/*
+ * With ssl-ktls the context has SSL_OP_ENABLE_KTLS, and OpenSSL hands the
+ * session keys to the kernel at the end of the handshake when both the
+ * kernel and the cipher can do it. The kernel then does the records, and
+ * the connection takes the plain readv/writev path. Otherwise it stays on
+ * SSL_read/SSL_write.
+ */
+static void
+ssl_check_ktls (rpc_transport_t *this)
+{
+        socket_private_t *priv = NULL;
+
+        priv = this->private;
+        priv->ktls = _gf_false;
+
+        if (!priv->ktls_enabled)
+                return;
+
+#ifdef SSL_OP_ENABLE_KTLS
+        /* both ways, and nothing left behind in OpenSSL's buffers */
+        if (BIO_get_ktls_send (SSL_get_wbio (priv->ssl_ssl)) &&
+            BIO_get_ktls_recv (SSL_get_rbio (priv->ssl_ssl)) &&
+            !SSL_has_pending (priv->ssl_ssl))
+                priv->ktls = _gf_true;
+#endif
+
+        gf_log (this->name, priv->ktls ? GF_LOG_INFO : GF_LOG_WARNING,
+                "%s (cipher %s)", priv->ktls ? "using kernel TLS" :
+                "kernel TLS not available, using OpenSSL",
+                SSL_get_cipher_name (priv->ssl_ssl));
+}
+
 static char *
 ssl_setup_connection (rpc_transport_t *this, int server)
 {
@@ -399,6 +432,7 @@ ssl_setup_connection (rpc_transport_t *this, int server)
 		NID_commonName, peer_CN, sizeof(peer_CN)-1);
 	peer_CN[sizeof(peer_CN)-1] = '\0';
 	gf_log(this->name,GF_LOG_INFO,"peer CN = %s", peer_CN);
+        ssl_check_ktls (this);
         return gf_strdup(peer_CN);
 
 	/* Error paths. */
@@ -423,6 +457,7 @@ ssl_teardown_connection (socket_private_t *priv)
                 priv->ssl_ssl = NULL;
         }
         priv->use_ssl = _gf_false;
+        priv->ktls = _gf_false;
 }
 
 
@@ -436,7 +471,7 @@ __socket_ssl_readv (rpc_transport_t *this, struct iovec *opvector, int opcount)
 	priv = this->private;
 	sock = priv->sock;
 
-	if (priv->use_ssl) {
+	if (SOCKET_SSL_USERSPACE (priv)) {
 		ret = ssl_read_one (this, opvector->iov_base, opvector->iov_len);
 	} else {
 		ret = readv (sock, opvector, IOV_MIN(opcount));
@@ -593,12 +628,13 @@ __socket_rwv (rpc_transport_t *this, struct iovec *vector, int count,
                          */
                         ret = -1;
                 } else if (write) {
-			if (priv->use_ssl) {
+			if (SOCKET_SSL_USERSPACE (priv)) {
                                 ret = ssl_write_one (this, opvector->iov_base,
                                                      opvector->iov_len);
 			} else {
 				ret = writev (sock, opvector, IOV_MIN(opcount));
 			}
+                        this->total_write_calls++;
 
                         if (ret == 0 || (ret == -1 && errno == EAGAIN)) {
                                 /* done for now */
@@ -980,6 +1016,11 @@ __socket_reset (rpc_transport_t *this)
 
         memset (&priv->incoming, 0, sizeof (priv->incoming));
 
+        /* a kTLS connection handed over to the event threads has no thread
+           of its own left to free its SSL state */
+        if (priv->ssl_ssl)
+                ssl_teardown_connection (priv);
+
         event_unregister_close (this->ctx->event_pool, priv->sock, priv->idx);
 
         priv->sock = -1;
@@ -1117,12 +1158,36 @@ out:
 }
 
 
+static void
+__socket_ioq_entry_done (rpc_transport_t *this, struct ioq *entry, int direct)
+{
+	socket_private_t *priv = NULL;
+	char              a_byte = 0;
+
+        GF_ASSERT (entry->pending_count == 0);
+
+        this->total_msgs_write++;
+        __socket_ioq_entry_free (entry);
+
+        priv = this->private;
+        if (priv->own_thread) {
+                /*
+                 * The pipe should only remain readable if there are
+                 * more entries after this, so drain the byte
+                 * representing this entry.
+                 */
+                if (!direct && read(priv->pipe[0],&a_byte,1) < 1) {
+                        gf_log(this->name,GF_LOG_WARNING,
+                               "read error on pipe");
+                }
+        }
+}
+
+
 static int
 __socket_ioq_churn_entry (rpc_transport_t *this, struct ioq *entry, int direct)
 {
         int               ret = -1;
-	socket_private_t *priv = NULL;
-	char              a_byte = 0;
 
         ret = __socket_writev (this, entry->pending_vector,
                                entry->pending_count,
@@ -1131,20 +1196,63 @@ __socket_ioq_churn_entry (rpc_transport_t *this, struct ioq *entry, int direct)
 
         if (ret == 0) {
                 /* current entry was completely written */
-                GF_ASSERT (entry->pending_count == 0);
-                __socket_ioq_entry_free (entry);
-		priv = this->private;
-		if (priv->own_thread) {
-			/*
-			 * The pipe should only remain readable if there are
-			 * more entries after this, so drain the byte
-			 * representing this entry.
-			 */
-			if (!direct && read(priv->pipe[0],&a_byte,1) < 1) {
-				gf_log(this->name,GF_LOG_WARNING,
-				       "read error on pipe");
-			}
-		}
+                __socket_ioq_entry_done (this, entry, direct);
+        }
+
+        return ret;
+}
+
+
+/*
+ * __socket_ioq_churn_batch - write as many entries from the head of the
+ *                            ioq as fit in GF_SOCKET_BATCH_IOV iovecs with
+ *                            one writev().
+ *
+ * return value as of __socket_rwv()
+ */
+static int
+__socket_ioq_churn_batch (rpc_transport_t *this)
+{
+        socket_private_t *priv  = NULL;
+        struct iovec      vector[GF_SOCKET_BATCH_IOV];
+        struct ioq       *entry = NULL;
+        struct ioq       *next  = NULL;
+        int               count = 0;
+        size_t            bytes = 0;
+        int               ret   = -1;
+
+        priv = this->private;
+
+        list_for_each_entry (entry, &priv->ioq, list) {
+                if (count + entry->pending_count > GF_SOCKET_BATCH_IOV)
+                        break;
+
+                memcpy (&vector[count], entry->pending_vector,
+                        entry->pending_count * sizeof (*vector));
+                count += entry->pending_count;
+        }
+
+        ret = __socket_rwv (this, vector, count, NULL, NULL, &bytes, 1);
+
+        /* move the entries past what was written */
+        list_for_each_entry_safe (entry, next, &priv->ioq, list) {
+                while (entry->pending_count) {
+                        if (entry->pending_vector[0].iov_len > bytes) {
+                                entry->pending_vector[0].iov_base += bytes;
+                                entry->pending_vector[0].iov_len -= bytes;
+                                bytes = 0;
+                                break;
+                        }
+
+                        bytes -= entry->pending_vector[0].iov_len;
+                        entry->pending_vector++;
+                        entry->pending_count--;
+                }
+
+                if (entry->pending_count)
+                        break;
+
+                __socket_ioq_entry_done (this, entry, 0);
         }
 
         return ret;
@@ -1164,10 +1272,13 @@ __socket_ioq_churn (rpc_transport_t *this)
         priv = this->private;
 
         while (!list_empty (&priv->ioq)) {
-                /* pick next entry */
-                entry = priv->ioq_next;
-
-                ret = __socket_ioq_churn_entry (this, entry, 0);
+                if (SOCKET_SSL_USERSPACE (priv)) {
+                        /* SSL writes one iovec at a time anyway */
+                        entry = priv->ioq_next;
+                        ret = __socket_ioq_churn_entry (this, entry, 0);
+                } else {
+                        ret = __socket_ioq_churn_batch (this);
+                }
 
                 if (ret != 0)
                         break;
@@ -1184,6 +1295,39 @@ out:
 }
 
 
+/*
+ * __socket_cork - tell whether a message submitted now should wait in the
+ *                 ioq for the others of its burst, rather than be written
+ *                 right away. A message which does not follow closely
+ *                 another one is never held.
+ */
+static gf_boolean_t
+__socket_cork (rpc_transport_t *this)
+{
+        socket_private_t *priv = NULL;
+        struct timespec   now  = {0, };
+        int64_t           gap  = 0;
+
+        priv = this->private;
+
+        timespec_now (&now);
+        gap = (now.tv_sec - priv->last_submit.tv_sec) * 1000000
+                + (now.tv_nsec - priv->last_submit.tv_nsec) / 1000;
+        priv->last_submit = now;
+
+        if (gap > GF_SOCKET_CORK_USEC) {
+                priv->burst = 0;
+                return _gf_false;
+        }
+
+        if (priv->burst < GF_SOCKET_CORK_BURST)
+                priv->burst++;
+
+        return (!SOCKET_SSL_USERSPACE (priv) &&
+                priv->burst >= GF_SOCKET_CORK_BURST);
+}
+
+
 static int
 socket_event_poll_err (rpc_transport_t *this)
 {
@@ -1678,6 +1822,18 @@ __socket_read_accepted_successful_reply (rpc_transport_t *this)
                         in->payload_vector.iov_base = iobuf_ptr (iobuf);
 
                         in->payload_vector.iov_len = size;
+                } else {
+                        /* the payload may land in memory owned by the
+                           caller (zero-copy reads), never overrun it */
+                        size = (RPC_FRAGSIZE (in->fraghdr) - frag->bytes_read);
+                        if (size > (ssize_t)in->payload_vector.iov_len) {
+                                gf_log (this->name, GF_LOG_WARNING,
+                                        "read reply payload (%zd) exceeds "
+                                        "the buffer supplied (%zu)", size,
+                                        in->payload_vector.iov_len);
+                                ret = -1;
+                                goto out;
+                        }
                 }
 
                 frag->fragcurrent = in->payload_vector.iov_base;
@@ -2416,6 +2572,52 @@ out:
 }
 
 
+/*
+ * The handshake of a kTLS connection runs on its own thread, as ssl_do
+ * blocks until it is done. Once the kernel has the keys the connection is
+ * polled by the event threads like a clear one and the thread goes away.
+ * If it cannot be registered it just stays on its own thread.
+ */
+static int
+socket_ktls_handover (rpc_transport_t *this)
+{
+        socket_private_t *priv = this->private;
+        int               ret  = -1;
+
+        pthread_mutex_lock (&priv->lock);
+        {
+                /* disconnected meanwhile, the thread cleans up */
+                if (priv->ot_state != OT_RUNNING)
+                        goto unlock;
+
+                priv->own_thread = _gf_false;
+                priv->idx = event_register (this->ctx->event_pool, priv->sock,
+                                            socket_event_handler, this, 1,
+                                            !list_empty (&priv->ioq));
+                if (priv->idx == -1) {
+                        gf_log (this->name, GF_LOG_WARNING, "failed to "
+                                "register the socket with event, keeping "
+                                "the polling thread");
+                        priv->own_thread = _gf_true;
+                        goto unlock;
+                }
+
+                /* pipe() leaves both ends at 0 when it failed */
+                if (priv->pipe[0] != priv->pipe[1]) {
+                        close (priv->pipe[0]);
+                        close (priv->pipe[1]);
+                }
+                priv->pipe[0] = priv->pipe[1] = -1;
+                priv->ot_state = OT_IDLE;
+                ret = 0;
+        }
+unlock:
+        pthread_mutex_unlock (&priv->lock);
+
+        return ret;
+}
+
+
 static void *
 socket_poller (void *ctx)
 {
@@ -2470,6 +2672,11 @@ socket_poller (void *ctx)
                         "asynchronous rpc_transport_notify failed");
         }
 
+        /* the ref taken for this thread now belongs to the event */
+        if (priv->ktls_handover && priv->ktls &&
+            (socket_ktls_handover (this) == 0))
+                return NULL;
+
         gen = priv->ot_gen;
 	for (;;) {
 		pthread_mutex_lock(&priv->lock);
@@ -2747,6 +2954,8 @@ socket_server_event_handler (int fd, int idx, void *data,
 
 			new_priv->sock = new_sock;
 			new_priv->own_thread = priv->own_thread;
+                        new_priv->ktls_enabled = priv->ktls_enabled;
+                        new_priv->ktls_handover = priv->ktls_handover;
 
                         new_priv->ssl_ctx = priv->ssl_ctx;
 			if (new_priv->use_ssl && !new_priv->own_thread) {
@@ -2936,6 +3145,10 @@ socket_connect (rpc_transport_t *this, int port)
                         "connecting %p, state=%u gen=%u sock=%d", this,
                         priv->ot_state, priv->ot_gen, priv->sock);
 
+                /* the last connection may have been handed to epoll */
+                if (priv->ktls_handover)
+                        priv->own_thread = _gf_true;
+
                 ret = socket_client_get_remote_sockaddr (this, &sock_union.sa,
                                                      &sockaddr_len, &sa_family);
                 if (ret == -1) {
@@ -3339,6 +3552,7 @@ socket_submit_request (rpc_transport_t *this, rpc_transport_req_t *req)
         int               ret = -1;
         char              need_poll_out = 0;
         char              need_append = 1;
+        gf_boolean_t      corked = _gf_false;
         struct ioq       *entry = NULL;
         glusterfs_ctx_t  *ctx = NULL;
 	char              a_byte = 'j';
@@ -3366,7 +3580,12 @@ socket_submit_request (rpc_transport_t *this, rpc_transport_req_t *req)
                 if (!entry)
                         goto unlock;
 
-                if (list_empty (&priv->ioq)) {
+                corked = __socket_cork (this);
+
+                if (list_empty (&priv->ioq) && corked) {
+                        /* write it with the rest of the burst */
+                        need_poll_out = 1;
+                } else if (list_empty (&priv->ioq)) {
                         ret = __socket_ioq_churn_entry (this, entry, 1);
 
                         if (ret == 0) {
@@ -3413,6 +3632,7 @@ socket_submit_reply (rpc_transport_t *this, rpc_transport_reply_t *reply)
         int               ret = -1;
         char              need_poll_out = 0;
         char              need_append = 1;
+        gf_boolean_t      corked = _gf_false;
         struct ioq       *entry = NULL;
         glusterfs_ctx_t  *ctx = NULL;
 	char              a_byte = 'd';
@@ -3440,7 +3660,12 @@ socket_submit_reply (rpc_transport_t *this, rpc_transport_reply_t *reply)
                 if (!entry)
                         goto unlock;
 
-                if (list_empty (&priv->ioq)) {
+                corked = __socket_cork (this);
+
+                if (list_empty (&priv->ioq) && corked) {
+                        /* write it with the rest of the burst */
+                        need_poll_out = 1;
+                } else if (list_empty (&priv->ioq)) {
                         ret = __socket_ioq_churn_entry (this, entry, 1);
 
                         if (ret == 0) {
@@ -3945,6 +4170,21 @@ socket_init (rpc_transport_t *this)
          */
         priv->use_ssl = priv->ssl_enabled;
 
+        priv->ktls_enabled = _gf_false;
+        if (dict_get_str (this->options, SSL_KTLS_OPT, &optstr) == 0) {
+                if (gf_string2boolean (optstr, &priv->ktls_enabled) != 0) {
+                        gf_log (this->name, GF_LOG_WARNING,
+                                "invalid value given for ssl-ktls boolean");
+                }
+        }
+#ifndef SSL_OP_ENABLE_KTLS
+        if (priv->ktls_enabled) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "OpenSSL has no kernel TLS support, ignoring ssl-ktls");
+                priv->ktls_enabled = _gf_false;
+        }
+#endif
+
 	priv->own_thread = priv->use_ssl;
 	if (dict_get_str(this->options,OWN_THREAD_OPT,&optstr) == 0) {
                 gf_log (this->name, GF_LOG_INFO, "OWN_THREAD_OPT found");
@@ -3953,6 +4193,8 @@ socket_init (rpc_transport_t *this)
 				"invalid value given for own-thread boolean");
 		}
 	}
+        /* kTLS connections are polled like clear ones after the handshake */
+        priv->ktls_handover = priv->own_thread && priv->ktls_enabled;
 	gf_log(this->name, priv->own_thread ? GF_LOG_INFO: GF_LOG_DEBUG,
                "using %s polling thread",
 	       priv->own_thread ? "private" : "system");
@@ -4020,6 +4262,14 @@ socket_init (rpc_transport_t *this)
 					       sizeof(priv->ssl_session_id));
 
 		SSL_CTX_set_verify(priv->ssl_ctx,SSL_VERIFY_PEER,0);
+
+#ifdef SSL_OP_ENABLE_KTLS
+                /* renegotiation records would reach readv as errors */
+                if (priv->ktls_enabled)
+                        SSL_CTX_set_options (priv->ssl_ctx,
+                                             SSL_OP_ENABLE_KTLS |
+                                             SSL_OP_NO_RENEGOTIATION);
+#endif
 	}
 
         if (priv->own_thread) {
@@ -4182,5 +4432,13 @@ struct volume_options options[] = {
           .type = GF_OPTION_TYPE_STR,
           .description = "Allowed SSL ciphers  Ignored if SSL is not enabled."
         },
+        { .key = {SSL_KTLS_OPT},
+          .type = GF_OPTION_TYPE_BOOL,
+          .description = "Hand the session keys to the kernel (kTLS) after "
+                         "the handshake, so that SSL connections are polled "
+                         "and written like clear ones. Connections whose "
+                         "cipher the kernel can't do keep using OpenSSL. "
+                         "Ignored if SSL is not enabled."
+        },
         { .key = {NULL} }
 };
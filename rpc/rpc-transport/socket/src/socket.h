@@ -25,6 +25,7 @@
 #include "dict.h"
 #include "mem-pool.h"
 #include "globals.h"
+#include "timespec.h"
 
 #ifndef MAX_IOVEC
 #define MAX_IOVEC 16
@@ -32,6 +33,19 @@
 
 #define GF_DEFAULT_SOCKET_LISTEN_PORT  GF_DEFAULT_BASE_PORT
 
+/* most iovecs written from the ioq by one writev() */
+#define GF_SOCKET_BATCH_IOV   IOV_MAX
+
+/* Messages submitted less than GF_SOCKET_CORK_USEC apart make a burst.
+ * From the GF_SOCKET_CORK_BURST'th message of a burst on, messages are
+ * queued and written together on POLLOUT instead of one by one. */
+#define GF_SOCKET_CORK_USEC   50
+#define GF_SOCKET_CORK_BURST  4
+
+/* Records are done by SSL_read/SSL_write rather than by the kernel (kTLS),
+ * so the connection can't use the plain readv/writev path. */
+#define SOCKET_SSL_USERSPACE(priv) ((priv)->use_ssl && !(priv)->ktls)
+
 #define RPC_MAX_FRAGMENT_SIZE 0x7fffffff
 
 /* The default window size will be 0, indicating not to set
@@ -231,12 +245,19 @@ typedef struct {
 	char                  *ssl_own_cert;
 	char                  *ssl_private_key;
 	char                  *ssl_ca_list;
+        gf_boolean_t           ktls_enabled;    /* option ssl-ktls */
+        gf_boolean_t           ktls;            /* kernel took the keys */
+        gf_boolean_t           ktls_handover;   /* own thread only for the
+                                                   handshake of a kTLS
+                                                   connection */
 	pthread_t              thread;
 	int                    pipe[2];
 	gf_boolean_t           own_thread;
         ot_state_t             ot_state;
         uint32_t               ot_gen;
         gf_boolean_t           is_server;
+        struct timespec        last_submit;
+        uint32_t               burst;
 } socket_private_t;
 
 
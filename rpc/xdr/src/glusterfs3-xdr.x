@@ -651,6 +651,51 @@ struct gfs3_ipc_rsp {
 	opaque  xdata<>;
 };
 
+struct gfs3_seek_req {
+        opaque    gfid[16];
+        quad_t    fd;
+        u_quad_t  offset;
+        int       what;
+        opaque    xdata<>;
+};
+
+struct gfs3_seek_rsp {
+        int       op_ret;
+        int       op_errno;
+        u_quad_t  offset;
+        opaque    xdata<>;
+};
+
+/* The fops of a compound. The data of its write (at most one) follows the
+ * request, as for a plain write. */
+enum gfs3_compound_fop {
+        GFS3_COMPOUND_WRITE    = 1,
+        GFS3_COMPOUND_FXATTROP = 2
+};
+
+union compound_req switch (gfs3_compound_fop fop_enum) {
+        case GFS3_COMPOUND_WRITE:    gfs3_write_req    compound_write_req;
+        case GFS3_COMPOUND_FXATTROP: gfs3_fxattrop_req compound_fxattrop_req;
+};
+
+union compound_rsp switch (gfs3_compound_fop fop_enum) {
+        case GFS3_COMPOUND_WRITE:    gfs3_write_rsp    compound_write_rsp;
+        case GFS3_COMPOUND_FXATTROP: gfs3_fxattrop_rsp compound_fxattrop_rsp;
+};
+
+struct gfs3_compound_req {
+        compound_req  compound_req_array<>;
+        opaque        xdata<>;
+};
+
+/* one reply per fop that was run */
+struct gfs3_compound_rsp {
+        int           op_ret;
+        int           op_errno;
+        compound_rsp  compound_rsp_array<>;
+        opaque        xdata<>;
+};
+
 
  struct gf_setvolume_req {
         opaque dict<>;
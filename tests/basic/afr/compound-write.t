@@ -0,0 +1,56 @@
+#!/bin/bash
+#Test writes whose pre-op and write go to the bricks as one compound fop.
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+#Compound fops sent by the clients of the mount
+function compound_sent {
+        local statedump=$(generate_mount_statedump $V0)
+        grep "^compound_sent=" $statedump |
+                awk -F= '{sum += $2} END {print sum + 0}'
+        cleanup_mount_statedump $V0
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 2 $H0:$B0/${V0}{0,1}
+TEST $CLI volume set $V0 self-heal-daemon off
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume set $V0 cluster.eager-lock off
+TEST $CLI volume set $V0 cluster.use-compound-fops on
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+TEST dd if=/dev/urandom of=$M0/file bs=4k count=256
+md5=$(md5sum $M0/file | awk '{print $1}')
+EXPECT "$md5" echo $(md5sum $B0/${V0}0/file | awk '{print $1}')
+EXPECT "$md5" echo $(md5sum $B0/${V0}1/file | awk '{print $1}')
+
+#The pre-ops and writes went as compound fops
+TEST [ $(compound_sent) -gt 0 ]
+
+#Nothing is left pending after the post-op
+EXPECT "0x000000000000000000000000" afr_get_changelog_xattr $B0/${V0}0/file trusted.afr.$V0-client-1
+EXPECT "0x000000000000000000000000" afr_get_changelog_xattr $B0/${V0}1/file trusted.afr.$V0-client-0
+EXPECT "0" afr_get_pending_heal_count $V0
+
+#Writes with a brick down are marked pending against it, and heal
+TEST kill_brick $V0 $H0 $B0/${V0}0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "0" afr_child_up_status $V0 0
+TEST dd if=/dev/urandom of=$M0/file bs=4k count=256 conv=notrunc
+md5=$(md5sum $M0/file | awk '{print $1}')
+EXPECT "1" afr_get_pending_heal_count $V0
+
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status $V0 0
+TEST $CLI volume set $V0 self-heal-daemon on
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "Y" glustershd_up_status
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "1" afr_child_up_status_in_shd $V0 0
+TEST $CLI volume heal $V0
+EXPECT_WITHIN $HEAL_TIMEOUT "0" afr_get_pending_heal_count $V0
+EXPECT "$md5" echo $(md5sum $B0/${V0}0/file | awk '{print $1}')
+
+cleanup;
@@ -0,0 +1,45 @@
+#!/bin/bash
+#Test reads with read-hash-mode 3 (least loaded brick) and their failover.
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 3 $H0:$B0/brick{0,1,2}
+TEST $CLI volume set $V0 self-heal-daemon off
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 cluster.read-hash-mode 3
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+for i in {1..10}; do
+        TEST dd if=/dev/urandom of=$M0/file$i bs=128k count=8
+done
+md5=$(cat $M0/file* | md5sum)
+
+echo 3 > /proc/sys/vm/drop_caches
+EXPECT "$md5" echo $(cat $M0/file* | md5sum)
+
+#Every read was answered, and the latencies of the bricks read from were
+#sampled
+statedump=$(generate_mount_statedump $V0)
+EXPECT "3" echo $(grep -c "^read_pending\[[0-9]\]=0$" $statedump)
+TEST grep -q "^read_latency_usecs\[[0-9]\]=[1-9]" $statedump
+cleanup_mount_statedump $V0
+
+#Reads fail over to the remaining bricks
+TEST kill_brick $V0 $H0 $B0/brick0
+TEST kill_brick $V0 $H0 $B0/brick1
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "0" afr_child_up_status $V0 0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "0" afr_child_up_status $V0 1
+echo 3 > /proc/sys/vm/drop_caches
+EXPECT "$md5" echo $(cat $M0/file* | md5sum)
+
+TEST $CLI volume set $V0 cluster.read-hash-mode 1
+EXPECT "$md5" echo $(cat $M0/file* | md5sum)
+
+cleanup;
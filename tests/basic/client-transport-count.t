@@ -0,0 +1,57 @@
+#!/bin/bash
+#Test reads and writes spread over several connections to one brick.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+. $(dirname $0)/../fileio.rc
+
+function attached_stripes {
+        local statedump=$(generate_mount_statedump $V0)
+        grep -c "^stripe\.[0-9]*\.attached=1$" $statedump
+        cleanup_mount_statedump $V0
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 client.transport-count 4
+TEST $CLI volume set $V0 client.event-threads 4
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "3" attached_stripes
+
+TEST dd if=/dev/urandom of=$M0/file bs=1M count=32
+md5=$(md5sum $B0/${V0}0/file | awk '{print $1}')
+echo 3 > /proc/sys/vm/drop_caches
+EXPECT "$md5" echo $(md5sum $M0/file | awk '{print $1}')
+
+#The data went over the extra connections too
+statedump=$(generate_mount_statedump $V0)
+TEST grep -q "^stripe\.1\.total_bytes_written=[1-9]" $statedump
+TEST grep -q "^stripe\.1\.total_bytes_read=[1-9]" $statedump
+cleanup_mount_statedump $V0
+
+#Locks taken over the main connection hold for the others
+exec 5>$M0/file
+TEST flock -x 5
+TEST dd if=/dev/zero of=$M0/file bs=1M count=4 conv=notrunc
+TEST ! flock -x -n $M0/file -c true
+exec 5>&-
+
+#They all reconnect with the brick, once the fds open on it are reopened
+TEST fd=`fd_available`
+TEST fd_open $fd "rw" $M0/file
+TEST kill_brick $V0 $H0 $B0/${V0}0
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "0" attached_stripes
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $CHILD_UP_TIMEOUT "3" attached_stripes
+TEST dd if=$M0/file of=/dev/null bs=1M
+TEST fd_write $fd "written through the reopened fd"
+TEST fd_close $fd
+
+cleanup;
@@ -0,0 +1,44 @@
+#!/bin/bash
+#Test that server.event-sharding and server.event-cpu-affinity reach the
+#brick processes, and that IO works over sharded event threads.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function brick_has_arg {
+        tr '\0' '\n' < /proc/$(get_brick_pid $V0 $H0 $B0/${V0}0)/cmdline |
+                grep -c -- "^$1$"
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0 $H0:$B0/${V0}1
+TEST ! $CLI volume set $V0 server.event-sharding maybe
+TEST $CLI volume set $V0 server.event-sharding on
+TEST $CLI volume set $V0 server.event-cpu-affinity on
+TEST $CLI volume set $V0 server.event-threads 4
+TEST $CLI volume start $V0
+
+EXPECT "1" brick_has_arg --event-sharding
+EXPECT "1" brick_has_arg --event-cpu-affinity
+
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --event-sharding $M0
+TEST dd if=/dev/urandom of=$M0/file bs=128k count=64
+TEST cp $M0/file $M0/copy
+TEST cmp $M0/file $M0/copy
+
+#Fewer event threads move the connections of the retired ones
+TEST $CLI volume set $V0 server.event-threads 1
+TEST cp $M0/copy $M0/copy2
+TEST cmp $M0/file $M0/copy2
+
+#Back to the shared epoll instance after a restart
+TEST $CLI volume reset $V0 server.event-sharding
+TEST $CLI volume stop $V0
+TEST $CLI volume start $V0
+EXPECT "0" brick_has_arg --event-sharding
+EXPECT "0" brick_has_arg --event-cpu-affinity
+
+cleanup;
@@ -0,0 +1,185 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <pthread.h>
+#include <sys/uio.h>
+#include <glusterfs/api/glfs.h>
+
+/* Reads into caller buffers, which the client receives the reply into
+ * directly when a single buffer is read, and into which the reply is
+ * copied otherwise. */
+
+#define FILE_SIZE     (1024 * 1024 + 4000)
+#define ASYNC_READS   16
+#define ASYNC_SIZE    (64 * 1024)
+
+static char *data;
+static int   failures;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  cond = PTHREAD_COND_INITIALIZER;
+static int             pending;
+
+#define CHECK(cond) do {                                                \
+                if (!(cond)) {                                          \
+                        fprintf (stderr, "%s:%d: check failed: %s\n",   \
+                                 __FILE__, __LINE__, #cond);            \
+                        failures++;                                     \
+                }                                                       \
+        } while (0)
+
+/* reads @len bytes at @off into one buffer with guard bytes around it */
+static void
+check_pread (glfs_fd_t *fd, off_t off, size_t len)
+{
+        char    *buf = NULL;
+        ssize_t  ret = 0;
+        ssize_t  want = 0;
+
+        want = (off >= FILE_SIZE) ? 0 :
+               ((off + len > FILE_SIZE) ? FILE_SIZE - off : len);
+
+        buf = malloc (len + 2);
+        memset (buf, 0xa5, len + 2);
+
+        ret = glfs_pread (fd, buf + 1, len, off, 0);
+        CHECK (ret == want);
+        if (ret > 0)
+                CHECK (!memcmp (buf + 1, data + off, ret));
+        CHECK ((unsigned char)buf[0] == 0xa5);
+        CHECK ((unsigned char)buf[len + 1] == 0xa5);
+
+        free (buf);
+}
+
+/* the same read spread over several buffers */
+static void
+check_preadv (glfs_fd_t *fd, off_t off)
+{
+        char         buf[3][5000];
+        struct iovec iov[3];
+        ssize_t      ret = 0;
+        int          i = 0;
+
+        for (i = 0; i < 3; i++) {
+                iov[i].iov_base = buf[i];
+                iov[i].iov_len = sizeof (buf[i]);
+        }
+
+        ret = glfs_preadv (fd, iov, 3, off, 0);
+        CHECK (ret == sizeof (buf));
+        for (i = 0; ret == sizeof (buf) && i < 3; i++)
+                CHECK (!memcmp (buf[i], data + off + i * sizeof (buf[i]),
+                                sizeof (buf[i])));
+}
+
+static void
+read_cbk (glfs_fd_t *fd, ssize_t ret, void *data)
+{
+        pthread_mutex_lock (&lock);
+        {
+                *(ssize_t *)data = ret;
+                pending--;
+                pthread_cond_signal (&cond);
+        }
+        pthread_mutex_unlock (&lock);
+}
+
+/* several reads in flight at once, each into a buffer of its own */
+static void
+check_async (glfs_fd_t *fd)
+{
+        char         *bufs[ASYNC_READS];
+        struct iovec  iov[ASYNC_READS];
+        ssize_t       rets[ASYNC_READS];
+        int           i = 0;
+
+        pending = ASYNC_READS;
+        for (i = 0; i < ASYNC_READS; i++) {
+                bufs[i] = calloc (1, ASYNC_SIZE);
+                iov[i].iov_base = bufs[i];
+                iov[i].iov_len = ASYNC_SIZE;
+                rets[i] = -2;
+                if (glfs_preadv_async (fd, &iov[i], 1, i * ASYNC_SIZE + i, 0,
+                                       read_cbk, &rets[i])) {
+                        CHECK (!"glfs_preadv_async");
+                        pthread_mutex_lock (&lock);
+                        pending--;
+                        pthread_mutex_unlock (&lock);
+                }
+        }
+
+        pthread_mutex_lock (&lock);
+        while (pending)
+                pthread_cond_wait (&cond, &lock);
+        pthread_mutex_unlock (&lock);
+
+        for (i = 0; i < ASYNC_READS; i++) {
+                CHECK (rets[i] == ASYNC_SIZE);
+                if (rets[i] == ASYNC_SIZE)
+                        CHECK (!memcmp (bufs[i], data + i * ASYNC_SIZE + i,
+                                        ASYNC_SIZE));
+                free (bufs[i]);
+        }
+}
+
+int
+main (int argc, char *argv[])
+{
+        glfs_t    *fs = NULL;
+        glfs_fd_t *fd = NULL;
+        int        i = 0;
+
+        if (argc != 4) {
+                fprintf (stderr, "usage: %s <host> <volume> <logfile>\n",
+                         argv[0]);
+                return 1;
+        }
+
+        fs = glfs_new (argv[2]);
+        if (!fs ||
+            glfs_set_volfile_server (fs, "tcp", argv[1], 24007) ||
+            glfs_set_logging (fs, argv[3], 7) ||
+            glfs_init (fs)) {
+                fprintf (stderr, "glfs init failed: %s\n", strerror (errno));
+                return 1;
+        }
+
+        data = malloc (FILE_SIZE);
+        for (i = 0; i < FILE_SIZE; i++)
+                data[i] = random ();
+
+        fd = glfs_creat (fs, "read-dest", O_RDWR, 0644);
+        if (!fd || glfs_write (fd, data, FILE_SIZE, 0) != FILE_SIZE) {
+                fprintf (stderr, "write failed: %s\n", strerror (errno));
+                return 1;
+        }
+
+        check_pread (fd, 0, 128 * 1024);
+        check_pread (fd, 4095, 4097);
+        check_pread (fd, 65536 + 1, 1);
+        /* short read at the end of the file, and past it */
+        check_pread (fd, FILE_SIZE - 3000, 8192);
+        check_pread (fd, FILE_SIZE, 4096);
+        check_pread (fd, FILE_SIZE + 65536, 4096);
+        check_preadv (fd, 12345);
+        check_async (fd);
+
+        /* unaligned reads all over the file */
+        for (i = 0; i < 64; i++)
+                check_pread (fd, (i * 16411) % FILE_SIZE, 16384);
+
+        glfs_close (fd);
+        glfs_fini (fs);
+        free (data);
+
+        if (failures) {
+                fprintf (stderr, "%d checks failed\n", failures);
+                return 1;
+        }
+
+        return 0;
+}
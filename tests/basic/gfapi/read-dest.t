@@ -0,0 +1,37 @@
+#!/bin/bash
+#Test gfapi reads into caller buffers: straight from the transport for a
+#single buffer, copied for several, with and without the caching
+#translators above the client.
+
+. $(dirname $0)/../../include.rc
+. $(dirname $0)/../../volume.rc
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 replica 2 $H0:$B0/${V0}{0,1}
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.stat-prefetch off
+TEST $CLI volume start $V0
+
+logdir=`gluster --print-logdir`
+
+build_tester $(dirname $0)/read-dest.c -lgfapi -lpthread -o $(dirname $0)/read-dest
+
+TEST ./$(dirname $0)/read-dest $H0 $V0 $logdir/read-dest.log
+TEST cmp $B0/${V0}0/read-dest $B0/${V0}1/read-dest
+
+#The caching translators read through buffers of their own
+TEST $CLI volume reset $V0 performance.io-cache
+TEST $CLI volume reset $V0 performance.read-ahead
+TEST ./$(dirname $0)/read-dest $H0 $V0 $logdir/read-dest.log
+
+cleanup_tester $(dirname $0)/read-dest
+
+TEST $CLI volume stop $V0
+TEST $CLI volume delete $V0
+
+cleanup;
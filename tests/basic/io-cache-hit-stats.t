@@ -0,0 +1,56 @@
+#!/bin/bash
+#Test the io-cache hit statistics, and that reads stay correct while a scan
+#larger than the cache goes through it without evicting the hot file.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+#Hits or misses of io-cache, summed over the priorities
+function ioc_stat {
+        local statedump=$(generate_mount_statedump $V0)
+        grep "^priority\[[0-9]*\].$1=" $statedump |
+                awk -F= '{sum += $2} END {print sum + 0}'
+        cleanup_mount_statedump $V0
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.cache-size 4MB
+TEST $CLI volume set $V0 performance.cache-refresh-timeout 60
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+TEST dd if=/dev/urandom of=$M0/small bs=128k count=8
+TEST dd if=/dev/urandom of=$M0/large bs=1M count=16
+small_md5=$(md5sum $M0/small | awk '{print $1}')
+large_md5=$(md5sum $M0/large | awk '{print $1}')
+
+for i in {1..3}; do
+        echo 3 > /proc/sys/vm/drop_caches
+        EXPECT "$small_md5" echo $(md5sum $M0/small | awk '{print $1}')
+done
+
+echo 3 > /proc/sys/vm/drop_caches
+EXPECT "$large_md5" echo $(md5sum $M0/large | awk '{print $1}')
+
+#The scan of 16MB through the 4MB cache left the small file cached: reading
+#it again only hits, all of its 8 pages
+hits=$(ioc_stat hits)
+misses=$(ioc_stat misses)
+echo 3 > /proc/sys/vm/drop_caches
+EXPECT "$small_md5" echo $(md5sum $M0/small | awk '{print $1}')
+EXPECT "$misses" ioc_stat misses
+TEST [ $(ioc_stat hits) -ge $((hits + 8)) ]
+
+statedump=$(generate_mount_statedump $V0)
+TEST grep -q "^priority\[[0-9]\].hits=[1-9]" $statedump
+TEST grep -q "^priority\[[0-9]\].misses=[1-9]" $statedump
+TEST grep -q "^hot_used=[1-9]" $statedump
+cleanup_mount_statedump $V0
+
+cleanup;
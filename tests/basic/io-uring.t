@@ -0,0 +1,58 @@
+#!/bin/bash
+#Test reads, writes, fsyncs and fallocates of the bricks through io_uring.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function mount_md5 {
+        md5sum $M0/$1 | awk '{print $1}'
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 storage.io-uring on
+TEST $CLI volume set $V0 storage.io-uring-depth 64
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.write-behind off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+TEST dd if=/dev/urandom of=$B0/data bs=128k count=64
+md5=$(md5sum $B0/data | awk '{print $1}')
+
+#Parallel writes, then read back
+for i in {1..4}; do
+        dd if=$B0/data of=$M0/file$i bs=128k 2>/dev/null &
+done
+wait
+for i in {1..4}; do
+        EXPECT "$md5" mount_md5 file$i
+done
+
+TEST dd if=$B0/data of=$M0/sync bs=64k oflag=sync
+EXPECT "$md5" mount_md5 sync
+TEST dd if=$B0/data of=$M0/fsync bs=64k conv=fsync
+EXPECT "$md5" mount_md5 fsync
+
+#fallocate and discard
+TEST fallocate -l 1M $M0/falloc
+EXPECT "1048576" stat -c %s $M0/falloc
+TEST fallocate -p -o 0 -l 512K $M0/file1
+EXPECT "8388608" stat -c %s $M0/file1
+EXPECT "0" echo $(dd if=$M0/file1 bs=512K count=1 2>/dev/null | tr -d '\0' | wc -c)
+
+statedump=$(generate_brick_statedump $V0 $H0 $B0/${V0}0)
+TEST grep -q "^io_uring.sqes=[1-9]" $statedump
+cleanup_statedump $(get_brick_pid $V0 $H0 $B0/${V0}0)
+
+#Back to synchronous IO
+TEST $CLI volume set $V0 storage.io-uring off
+TEST dd if=$B0/data of=$M0/file5 bs=128k
+EXPECT "$md5" mount_md5 file5
+
+rm -f $B0/data
+cleanup;
@@ -0,0 +1,50 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1}
+# negative entries are only cached with upcalls from the bricks
+TEST ! $CLI volume set $V0 performance.nl-cache on
+TEST $CLI volume set $V0 features.cache-invalidation on
+TEST $CLI volume set $V0 performance.nl-cache on
+TEST ! $CLI volume set $V0 features.cache-invalidation off
+TEST $CLI volume start $V0
+
+# keep the kernel from caching the entries itself
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 --entry-timeout=0 \
+     --negative-timeout=0 $M0
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 --entry-timeout=0 \
+     --negative-timeout=0 $M1
+
+TEST mkdir $M0/dir
+
+# cached as a negative entry by the first mount
+TEST ! stat $M0/dir/file
+TEST ! stat $M0/dir/file
+
+# created through the same mount, the fop drops the entry
+TEST touch $M0/dir/file
+TEST stat $M0/dir/file
+
+TEST rm -f $M0/dir/file
+TEST ! stat $M0/dir/file
+
+# created through the other mount, the upcall for dir drops the entry
+TEST touch $M1/dir/file
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "Y" path_exists $M0/dir/file
+
+TEST ! stat $M0/dir/other
+TEST mv $M0/dir/file $M0/dir/other
+TEST stat $M0/dir/other
+TEST ! stat $M0/dir/file
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M1
+
+cleanup;
@@ -0,0 +1,37 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0..3}
+TEST $CLI volume set $V0 performance.parallel-readdir on
+TEST $CLI volume start $V0
+
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 $M0
+
+TEST mkdir $M0/dir
+TEST touch $M0/dir/file{1..500}
+TEST mkdir $M0/dir/subdir{1..10}
+EXPECT "510" echo $(ls $M0/dir | wc -l)
+
+# renames leave linkfiles behind, they must not be listed
+for i in {1..100}; do
+        mv $M0/dir/file$i $M0/dir/renamed$i
+done
+EXPECT "510" echo $(ls $M0/dir | wc -l)
+EXPECT "100" echo $(ls $M0/dir | grep -c renamed)
+
+TEST rm -rf $M0/dir/*
+EXPECT "0" echo $(ls $M0/dir | wc -l)
+
+TEST $CLI volume set $V0 performance.parallel-readdir off
+TEST mkdir $M0/dir2
+TEST touch $M0/dir2/file{1..100}
+EXPECT "100" echo $(ls $M0/dir2 | wc -l)
+
+cleanup;
@@ -0,0 +1,45 @@
+#!/bin/bash
+#Test reads of one fd by several interleaved sequential readers.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# Reads the four quarters of a file through one fd, 64KB from each in turn,
+# and prints the md5sum of the file put back together.
+function interleaved_md5 {
+        $PYTHON -c "
+import hashlib, os, sys
+fd = os.open(sys.argv[1], os.O_RDONLY)
+size = os.fstat(fd).st_size
+quarter = size // 4
+parts = [b''] * 4
+for off in range(0, quarter, 65536):
+        for i in range(4):
+                parts[i] += os.pread(fd, 65536, i * quarter + off)
+os.close(fd)
+print(hashlib.md5(b''.join(parts)).hexdigest())" $1
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead-max-page-count 32
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 --direct-io-mode=yes $M0;
+
+TEST dd if=/dev/urandom of=$M0/file bs=1M count=16
+md5=$(md5sum $B0/${V0}0/file | awk '{print $1}')
+
+EXPECT "$md5" interleaved_md5 $M0/file
+EXPECT "$md5" echo $(md5sum $M0/file | awk '{print $1}')
+
+#Reads stay right after a write in the middle
+TEST dd if=/dev/urandom of=$M0/file bs=64k count=4 seek=100 conv=notrunc
+md5=$(md5sum $B0/${V0}0/file | awk '{print $1}')
+EXPECT "$md5" interleaved_md5 $M0/file
+
+cleanup;
@@ -0,0 +1,70 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+# Blocks on disk of a file, summed over the bricks holding its data.
+function sparse_blocks {
+        du -k $B0/${V0}*/dir/$1 2>/dev/null | awk '{sum += $1} END {print sum}'
+}
+
+# Times the rebalance logged the holes it skipped in a file.
+function holes_skipped {
+        grep -c "skipped [0-9]* bytes of holes in /dir/$1\$" \
+                $($CLI --print-logdir)/${V0}-rebalance.log
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1}
+TEST $CLI volume start $V0
+
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 $M0
+
+TEST mkdir $M0/dir
+for i in {1..20}; do
+        # data at the start, in the middle and at the end of 64MB
+        dd if=/dev/urandom of=$M0/dir/sparse$i bs=128k count=3 \
+           2>/dev/null
+        dd if=/dev/urandom of=$M0/dir/sparse$i bs=1M count=1 seek=31 \
+           conv=notrunc 2>/dev/null
+        dd if=/dev/urandom of=$M0/dir/sparse$i bs=1k count=3 seek=65533 \
+           conv=notrunc 2>/dev/null
+done
+# nothing but a hole
+TEST truncate -s 64M $M0/dir/hole
+# dense files still go through several windows
+for i in {1..5}; do
+        dd if=/dev/urandom of=$M0/dir/dense$i bs=1M count=2 2>/dev/null
+done
+md5=$(cat $M0/dir/* | md5sum)
+
+TEST $CLI volume add-brick $V0 $H0:$B0/${V0}{2,3}
+TEST $CLI volume rebalance $V0 start force
+EXPECT_WITHIN $REBALANCE_TIMEOUT "completed" rebalance_status_field $V0
+
+# failures column
+EXPECT "0" echo $($CLI volume rebalance $V0 status | awk 'NR==3 {print $5}')
+EXPECT "$md5" echo $(cat $M0/dir/* | md5sum)
+EXPECT "67108864" stat -c %s $M0/dir/hole
+
+# the holes were not filled on the destinations
+for i in {1..20}; do
+        TEST [ $(sparse_blocks sparse$i) -lt 4096 ]
+done
+TEST [ $(sparse_blocks hole) -lt 128 ]
+
+# and they were skipped with seek rather than read
+migrated=0
+for f in hole sparse{1..20}; do
+        [ -e $B0/${V0}2/dir/$f -o -e $B0/${V0}3/dir/$f ] || continue
+        [ -k $B0/${V0}2/dir/$f -o -k $B0/${V0}3/dir/$f ] && continue
+        migrated=$((migrated + 1))
+        EXPECT "1" holes_skipped $f
+done
+TEST [ $migrated -gt 0 ]
+
+cleanup;
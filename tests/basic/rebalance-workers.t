@@ -0,0 +1,47 @@
+#!/bin/bash
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1}
+TEST $CLI volume start $V0
+
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 $M0
+
+TEST mkdir -p $M0/dir/subdir
+for i in {1..200}; do
+        dd if=/dev/zero of=$M0/dir/file$i bs=64k count=1 2>/dev/null
+done
+for i in {1..50}; do
+        ln $M0/dir/file$i $M0/dir/subdir/link$i
+done
+md5=$(cat $M0/dir/file* | md5sum)
+
+TEST $CLI volume add-brick $V0 $H0:$B0/${V0}{2,3}
+
+# several workers, at most one file at a time per subvolume
+TEST $CLI volume set $V0 cluster.rebalance-throttle aggressive
+TEST $CLI volume set $V0 cluster.rebalance-subvol-limit 1
+TEST $CLI volume rebalance $V0 start force
+EXPECT_WITHIN $REBALANCE_TIMEOUT "completed" rebalance_status_field $V0
+
+# failures column
+EXPECT "0" echo $($CLI volume rebalance $V0 status | awk 'NR==3 {print $5}')
+TEST $CLI volume rebalance $V0 status | grep -q "Migration workers"
+
+EXPECT "200" echo $(ls $M0/dir | grep -c file)
+EXPECT "50" echo $(ls $M0/dir/subdir | wc -l)
+EXPECT "$md5" echo $(cat $M0/dir/file* | md5sum)
+
+TEST $CLI volume add-brick $V0 $H0:$B0/${V0}4
+TEST $CLI volume set $V0 cluster.rebalance-throttle lazy
+TEST $CLI volume rebalance $V0 start force
+EXPECT_WITHIN $REBALANCE_TIMEOUT "completed" rebalance_status_field $V0
+EXPECT "$md5" echo $(cat $M0/dir/file* | md5sum)
+
+cleanup;
@@ -0,0 +1,98 @@
+#!/bin/bash
+#Test reads and truncates of sharded files: reads across holes and shard
+#boundaries, shrinking and extending truncates and the removal of the tail
+#shards in the background.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function shard_exists {
+        if [ -e $B0/${V0}0/.shard/$gfid.$1 ]; then
+                echo "Y"
+        else
+                echo "N"
+        fi
+}
+
+function shard_count {
+        ls $B0/${V0}0/.shard 2>/dev/null | grep -c "^$gfid\."
+}
+
+#md5 of @3 bytes of file @1 at offset @2, in units of 64k
+function range_md5 {
+        dd if=$1 bs=64k skip=$2 count=$3 2>/dev/null | md5sum | awk '{print $1}'
+}
+
+#Writes the same data into the sharded file and the reference copy
+function write_both {
+        dd if=$B0/data of=$M0/file bs=64k skip=$1 seek=$1 count=$2 \
+           conv=notrunc 2>/dev/null &&
+        dd if=$B0/data of=$B0/ref bs=64k skip=$1 seek=$1 count=$2 \
+           conv=notrunc 2>/dev/null
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 features.shard on
+TEST $CLI volume set $V0 features.shard-block-size 4MB
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume set $V0 performance.quick-read off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+TEST dd if=/dev/urandom of=$B0/data bs=1M count=24
+
+#Shard 1 is a hole, shard 2 holds 2MB at its start, the write at 14.5MB
+#crosses from shard 3 into 4 and shard 5 ends with 1MB of data.
+TEST touch $M0/file $B0/ref
+TEST write_both 0 64
+TEST write_both 128 32
+TEST write_both 232 32
+TEST write_both 368 16
+gfid=$(gf_gfid_xattr_to_str $(gf_get_gfid_xattr $B0/${V0}0/file))
+
+EXPECT "25165824" stat -c %s $M0/file
+EXPECT "N" shard_exists 1
+EXPECT "Y" shard_exists 5
+EXPECT "$(md5sum < $B0/ref | awk '{print $1}')" echo $(md5sum < $M0/file | awk '{print $1}')
+
+#Reads across the boundaries of data shards, holes and the end of the file
+for range in "60 8" "56 80" "100 60" "200 48" "240 80" "360 64"; do
+        EXPECT "$(range_md5 $B0/ref $range)" range_md5 $M0/file $range
+done
+
+#Shrink into shard 2: shards 3 to 5 go away in the background
+TEST truncate -s 9M $M0/file
+TEST truncate -s 9M $B0/ref
+EXPECT "9437184" stat -c %s $M0/file
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "N" shard_exists 5
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "N" shard_exists 3
+EXPECT "Y" shard_exists 2
+EXPECT "$(range_md5 $B0/ref 0 144)" range_md5 $M0/file 0 144
+
+#Extend again: everything past the old end reads as zeroes
+TEST perl -e "truncate ('$M0/file', 20 * 1024 * 1024) or die"
+TEST truncate -s 20M $B0/ref
+EXPECT "20971520" stat -c %s $M0/file
+EXPECT "$(range_md5 $B0/ref 0 320)" range_md5 $M0/file 0 320
+EXPECT "0" echo $(dd if=$M0/file bs=1M skip=9 2>/dev/null | tr -d '\0' | wc -c)
+
+#Shrink inside shard 0 and write right behind the removal of the tail
+TEST truncate -s 1M $M0/file
+TEST truncate -s 1M $B0/ref
+TEST write_both 96 64
+EXPECT "10485760" stat -c %s $M0/file
+EXPECT "$(range_md5 $B0/ref 0 160)" range_md5 $M0/file 0 160
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "2" shard_count
+
+#Truncate to zero drops all shards
+TEST truncate -s 0 $M0/file
+EXPECT "0" stat -c %s $M0/file
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "0" shard_count
+
+rm -f $B0/data $B0/ref
+cleanup;
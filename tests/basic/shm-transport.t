@@ -0,0 +1,70 @@
+#!/bin/bash
+#Test clients on the bricks' node talking to them over shared memory.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+function shm_clients {
+        local statedump=$(generate_mount_statedump $V0)
+        grep -c "^shm=1$" $statedump
+        cleanup_mount_statedump $V0
+}
+
+function mount_md5 {
+        md5sum $M0/$1 | awk '{print $1}'
+}
+
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}{0,1}
+TEST $CLI volume set $V0 transport.shm on
+TEST $CLI volume set $V0 performance.io-cache off
+TEST $CLI volume set $V0 performance.read-ahead off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+#Both bricks are local
+EXPECT "2" shm_clients
+
+TEST dd if=/dev/urandom of=$M0/file0 bs=1M count=16
+TEST dd if=/dev/urandom of=$M0/file1 bs=64k count=64
+for f in file0 file1; do
+        md5=$(cat $B0/${V0}*/$f 2>/dev/null | md5sum | awk '{print $1}')
+        EXPECT "$md5" mount_md5 $f
+done
+
+#It reconnects when the brick comes back
+TEST kill_brick $V0 $H0 $B0/${V0}0
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "2" online_brick_count
+for f in file0 file1; do
+        md5=$(cat $B0/${V0}*/$f 2>/dev/null | md5sum | awk '{print $1}')
+        EXPECT_WITHIN $CHILD_UP_TIMEOUT "$md5" mount_md5 $f
+done
+EXPECT "2" shm_clients
+
+#A killed brick leaves its socket behind, new clients reach it over tcp
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST kill_brick $V0 $H0 $B0/${V0}0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+EXPECT "1" shm_clients
+TEST $CLI volume start $V0 force
+EXPECT_WITHIN $PROCESS_UP_TIMEOUT "2" online_brick_count
+for f in file0 file1; do
+        md5=$(cat $B0/${V0}*/$f 2>/dev/null | md5sum | awk '{print $1}')
+        EXPECT_WITHIN $CHILD_UP_TIMEOUT "$md5" mount_md5 $f
+done
+
+#shm peers have no address for auth.reject to match, so it keeps to tcp
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST $CLI volume set $V0 auth.reject 192.0.2.1
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+EXPECT "0" shm_clients
+for f in file0 file1; do
+        md5=$(cat $B0/${V0}*/$f 2>/dev/null | md5sum | awk '{print $1}')
+        EXPECT_WITHIN $CHILD_UP_TIMEOUT "$md5" mount_md5 $f
+done
+
+cleanup;
@@ -0,0 +1,39 @@
+#!/bin/bash
+#Test a burst of small replies on one connection, and the write statistics
+#of the socket transport.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+cleanup;
+
+TEST glusterd
+TEST pidof glusterd
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 performance.stat-prefetch off
+TEST $CLI volume start $V0
+TEST $GFS --volfile-id=$V0 --volfile-server=$H0 $M0;
+
+TEST mkdir $M0/dir
+for i in {1..8}; do
+        (for j in {1..100}; do echo $i$j > $M0/dir/file$i.$j; done) &
+done
+wait
+
+for i in {1..8}; do
+        (for j in {1..100}; do stat $M0/dir/file$i.$j; done) > /dev/null &
+done
+wait
+
+EXPECT "800" echo $(ls $M0/dir | wc -l)
+EXPECT "8100" echo $(cat $M0/dir/file8.100)
+
+statedump=$(generate_brick_statedump $V0 $H0 $B0/${V0}0)
+TEST grep -q "^server.total-msgs-write=[1-9]" $statedump
+TEST grep -q "^server.write-calls-per-msg=" $statedump
+cleanup_statedump $(get_brick_pid $V0 $H0 $B0/${V0}0)
+
+statedump=$(generate_mount_statedump $V0)
+TEST grep -q "^write_calls_per_msg=" $statedump
+cleanup_mount_statedump $V0
+
+cleanup;
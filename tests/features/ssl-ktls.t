@@ -0,0 +1,62 @@
+#!/bin/bash
+#Test SSL connections with ssl.ktls, whether the kernel takes the keys or
+#they fall back to OpenSSL.
+
+. $(dirname $0)/../include.rc
+. $(dirname $0)/../volume.rc
+
+SSL_BASE=/etc/ssl
+SSL_KEY=$SSL_BASE/glusterfs.key
+SSL_CERT=$SSL_BASE/glusterfs.pem
+SSL_CA=$SSL_BASE/glusterfs.ca
+MOUNT_LOG=$B0/ktls-mount.log
+
+cleanup;
+rm -f $SSL_BASE/glusterfs.*
+mkdir -p $B0
+
+TEST openssl genrsa -out $SSL_KEY 2048
+TEST openssl req -new -x509 -key $SSL_KEY -subj /CN=Anyone -out $SSL_CERT
+ln $SSL_CERT $SSL_CA
+
+TEST glusterd
+TEST pidof glusterd
+
+TEST $CLI volume create $V0 $H0:$B0/${V0}0
+TEST $CLI volume set $V0 server.ssl on
+TEST $CLI volume set $V0 client.ssl on
+TEST $CLI volume set $V0 ssl.cipher-list ECDHE-RSA-AES128-GCM-SHA256
+TEST $CLI volume set $V0 ssl.ktls on
+TEST $CLI volume set $V0 auth.ssl-allow Anyone
+TEST $CLI volume start $V0
+
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 --log-file=$MOUNT_LOG $M0
+TEST dd if=/dev/urandom of=$M0/file bs=1M count=16
+md5=$(md5sum $B0/${V0}0/file | awk '{print $1}')
+echo 3 > /proc/sys/vm/drop_caches
+EXPECT "$md5" echo $(md5sum $M0/file | awk '{print $1}')
+
+#Every SSL connection said which way it went, with the keys in the kernel
+#when it can take them
+if [ -d /sys/module/tls ] || modprobe tls 2>/dev/null; then
+        TEST grep -q "using kernel TLS" $MOUNT_LOG
+else
+        TEST grep -q "kernel TLS not available" $MOUNT_LOG
+fi
+
+#A peer that never starts its handshake only holds up its own thread
+port=$($CLI volume status $V0 detail | grep "^TCP Port " | awk '{print $4}')
+exec 5<>/dev/tcp/$H0/$port
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 --log-file=$MOUNT_LOG $M1
+EXPECT "$md5" echo $(md5sum $M1/file | awk '{print $1}')
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M1
+exec 5>&-
+
+#The data survives a remount
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+TEST glusterfs --volfile-server=$H0 --volfile-id=$V0 --log-file=$MOUNT_LOG $M0
+EXPECT "$md5" echo $(md5sum $M0/file | awk '{print $1}')
+
+EXPECT_WITHIN $UMOUNT_TIMEOUT "Y" force_umount $M0
+rm -f $SSL_BASE/glusterfs.* $MOUNT_LOG
+cleanup;
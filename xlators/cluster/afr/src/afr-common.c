@@ -883,6 +883,50 @@ afr_hash_child (inode_t *inode, int32_t child_count, int hashmode)
 }
 
 
+/* Picks the readable child with the lowest latency weighted by its
+   outstanding reads. The scan starts from the hashed child, so that idle
+   children are shared among the files. A child whose latency was not
+   sampled for AFR_READ_STATS_STALE seconds costs its outstanding reads
+   only, in order to be probed again. */
+static int
+afr_least_loaded_child (inode_t *inode, afr_private_t *priv,
+			unsigned char *readable)
+{
+	afr_read_stats_t *stats = NULL;
+	time_t now = 0;
+	int64_t latency = 0;
+	int64_t cost = 0;
+	int64_t min_cost = 0;
+	int start = 0;
+	int child = -1;
+	int i = 0;
+	int j = 0;
+
+	now = time (NULL);
+	start = afr_hash_child (inode, priv->child_count,
+				AFR_READ_POLICY_GFID_HASH);
+
+	for (j = 0; j < priv->child_count; j++) {
+		i = (start + j) % priv->child_count;
+		if (!readable[i])
+			continue;
+
+		stats = &priv->read_stats[i];
+		latency = stats->latency;
+		if (now - stats->updated > AFR_READ_STATS_STALE)
+			latency = 0;
+
+		cost = (latency + 1) * (stats->pending + 1);
+		if (child == -1 || cost < min_cost) {
+			child = i;
+			min_cost = cost;
+		}
+	}
+
+	return child;
+}
+
+
 int
 afr_read_subvol_select_by_policy (inode_t *inode, xlator_t *this,
 				  unsigned char *readable)
@@ -894,9 +938,18 @@ afr_read_subvol_select_by_policy (inode_t *inode, xlator_t *this,
 	priv = this->private;
 
 	/* first preference - explicitly specified or local subvolume */
-	if (priv->read_child >= 0 && readable[priv->read_child])
+	if (priv->read_child >= 0 && readable[priv->read_child] &&
+	    !(priv->read_child_local &&
+	      priv->hash_mode == AFR_READ_POLICY_LEAST_LOAD))
 		return priv->read_child;
 
+	if (priv->hash_mode == AFR_READ_POLICY_LEAST_LOAD &&
+	    priv->read_stats) {
+		read_subvol = afr_least_loaded_child (inode, priv, readable);
+		if (read_subvol >= 0)
+			return read_subvol;
+	}
+
 	/* second preference - use hashed mode */
 	read_subvol = afr_hash_child (inode, priv->child_count,
 				      priv->hash_mode);
@@ -1051,6 +1104,8 @@ afr_local_cleanup (afr_local_t *local, xlator_t *this)
 
 	syncbarrier_destroy (&local->barrier);
 
+	afr_read_txn_done (local, this);
+
         if (local->transaction.eager_lock_on &&
             !list_empty (&local->transaction.eager_locked))
                 afr_remove_eager_lock_stub (local);
@@ -1554,6 +1609,7 @@ afr_local_discovery_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                         "selecting local read_child %s",
                         priv->children[child_index]->name);
                 priv->read_child = child_index;
+                priv->read_child_local = _gf_true;
         }
 out:
         STACK_DESTROY(frame->root);
@@ -3645,6 +3701,14 @@ afr_priv_dump (xlator_t *this)
         gf_proc_dump_write("metadata_change_log", "%d", priv->metadata_change_log);
         gf_proc_dump_write("entry-change_log", "%d", priv->entry_change_log);
         gf_proc_dump_write("read_child", "%d", priv->read_child);
+        gf_proc_dump_write("read_hash_mode", "%u", priv->hash_mode);
+        for (i = 0; priv->read_stats && i < priv->child_count; i++) {
+                sprintf (key, "read_latency_usecs[%d]", i);
+                gf_proc_dump_write(key, "%"PRId64,
+                                   priv->read_stats[i].latency);
+                sprintf (key, "read_pending[%d]", i);
+                gf_proc_dump_write(key, "%d", priv->read_stats[i].pending);
+        }
         gf_proc_dump_write("favorite_child", "%d", priv->favorite_child);
         gf_proc_dump_write("wait_count", "%u", priv->wait_count);
         gf_proc_dump_write("quorum-reads", "%d", priv->quorum_reads);
@@ -4168,6 +4232,7 @@ afr_priv_destroy (afr_private_t *priv)
         GF_FREE (priv->pending_key);
         GF_FREE (priv->children);
         GF_FREE (priv->child_up);
+        GF_FREE (priv->read_stats);
         LOCK_DESTROY (&priv->lock);
 
         GF_FREE (priv);
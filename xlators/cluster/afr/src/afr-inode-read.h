@@ -31,6 +31,10 @@ int32_t
 afr_readv (call_frame_t *frame, xlator_t *this,
 	   fd_t *fd, size_t size, off_t offset, uint32_t flags, dict_t *xdata);
 
+int32_t
+afr_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+          gf_seek_what_t what, dict_t *xdata);
+
 int32_t
 afr_getxattr (call_frame_t *frame, xlator_t *this,
 	      loc_t *loc, const char *name, dict_t *xdata);
@@ -11,17 +11,82 @@
 #include "afr.h"
 #include "afr-transaction.h"
 
+/* Ends the accounting of the read in flight, if any, in the stats of the
+   child it was wound to. */
+void
+afr_read_txn_done (afr_local_t *local, xlator_t *this)
+{
+	afr_private_t *priv = NULL;
+	afr_read_stats_t *stats = NULL;
+	struct timeval now = {0, };
+	int64_t sample = 0;
+	int64_t old = 0;
+	int64_t new = 0;
+
+	if (!local->read_txn_inflight)
+		return;
+	local->read_txn_inflight = _gf_false;
+
+	priv = this->private;
+	stats = &priv->read_stats[local->read_txn_subvol];
+
+	gettimeofday (&now, NULL);
+	sample = (now.tv_sec - local->read_txn_start.tv_sec) * 1000000 +
+		 (now.tv_usec - local->read_txn_start.tv_usec);
+
+	/* moving average weighing the new sample by 1/8, restarted when
+	   the child was not read from for a while */
+	do {
+		old = stats->latency;
+		if (now.tv_sec - stats->updated > AFR_READ_STATS_STALE)
+			new = sample;
+		else
+			new = old + (sample - old) / 8;
+	} while (!__sync_bool_compare_and_swap (&stats->latency, old, new));
+
+	stats->updated = now.tv_sec;
+	__sync_fetch_and_sub (&stats->pending, 1);
+}
+
+
+static void
+afr_read_txn_wind (call_frame_t *frame, xlator_t *this, int subvol)
+{
+	afr_local_t *local = NULL;
+	afr_private_t *priv = NULL;
+
+	local = frame->local;
+	priv = this->private;
+
+	/* the attempt before a failover is over */
+	afr_read_txn_done (local, this);
+
+	if (subvol >= 0 && priv->read_stats &&
+	    priv->hash_mode == AFR_READ_POLICY_LEAST_LOAD) {
+		__sync_fetch_and_add (&priv->read_stats[subvol].pending, 1);
+		gettimeofday (&local->read_txn_start, NULL);
+		local->read_txn_subvol = subvol;
+		local->read_txn_inflight = _gf_true;
+	}
+
+	/* @local can be gone once readfn returns */
+	local->readfn (frame, this, subvol);
+}
+
+
 int
 afr_read_txn_next_subvol (call_frame_t *frame, xlator_t *this)
 {
 	afr_local_t *local = NULL;
 	afr_private_t *priv = NULL;
+	unsigned char *remaining = NULL;
 	int i = 0;
 	int subvol = -1;
 
 	local = frame->local;
 	priv = this->private;
 
+	remaining = alloca0 (priv->child_count);
 
 	for (i = 0; i < priv->child_count; i++) {
 		if (!local->readable[i]) {
@@ -32,17 +97,23 @@ afr_read_txn_next_subvol (call_frame_t *frame, xlator_t *this)
 		}
 
 		if (!local->read_attempted[i]) {
-			subvol = i;
-			break;
+			remaining[i] = 1;
+			if (subvol == -1)
+				subvol = i;
 		}
 	}
 
+	/* fail over to the least loaded of the remaining subvols */
+	if (subvol != -1 && priv->hash_mode == AFR_READ_POLICY_LEAST_LOAD)
+		subvol = afr_read_subvol_select_by_policy (local->inode, this,
+							   remaining);
+
 	/* If no more subvols were available for reading, we leave
 	   @subvol as -1, which is an indication we have run out of
 	   readable subvols. */
 	if (subvol != -1)
 		local->read_attempted[subvol] = 1;
-	local->readfn (frame, this, subvol);
+	afr_read_txn_wind (frame, this, subvol);
 
 	return 0;
 }
@@ -103,7 +174,7 @@ readfn:
                 if ((ret == 0) && spb_choice >= 0)
                         read_subvol = spb_choice;
         }
-	local->readfn (frame, this, read_subvol);
+	afr_read_txn_wind (frame, this, read_subvol);
 
 	return 0;
 }
@@ -145,6 +216,8 @@ afr_read_txn_wipe (call_frame_t *frame, xlator_t *this)
 	local = frame->local;
 	priv = this->private;
 
+	afr_read_txn_done (local, this);
+
 	local->readfn = NULL;
 
 	if (local->inode)
@@ -249,7 +322,7 @@ afr_read_txn (call_frame_t *frame, xlator_t *this, inode_t *inode,
 	local->read_attempted[read_subvol] = 1;
 
 read:
-	local->readfn (frame, this, read_subvol);
+	afr_read_txn_wind (frame, this, read_subvol);
 
 	return 0;
 
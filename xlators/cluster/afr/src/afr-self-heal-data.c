@@ -164,10 +164,9 @@ __afr_selfheal_data_read_write (call_frame_t *frame, xlator_t *this, fd_t *fd,
 			continue;
 
 		/*
-		 * TODO: Use fiemap() and discard() to heal holes
-		 * in the future.
-		 *
-		 * For now,
+		 * Holes of the source past the end of all the sinks are
+		 * skipped with seek() before getting here. When seek() is
+		 * not supported by the source, or for the blocks read anyway,
 		 *
 		 * - if the source had any holes at all,
 		 * AND
@@ -332,6 +331,60 @@ afr_data_self_heal_type_get (afr_private_t *priv, unsigned char *healed_sinks,
         return type;
 }
 
+/*
+ * Returns the offset of the first block from @off on which has to be healed.
+ * Blocks which are a hole on the source and lie past the end of every sink
+ * are holes on the sinks already, they are skipped without being read. The
+ * block holding EOF is always healed, its write sets the size of the sinks.
+ * @hole caches the end of the data region found by the last seek.
+ */
+static off_t
+afr_selfheal_data_skip_holes (xlator_t *this, fd_t *fd, int source,
+			      unsigned char *healed_sinks,
+			      struct afr_reply *replies, off_t off,
+			      size_t block, off_t *hole, gf_boolean_t *seek)
+{
+	afr_private_t *priv = NULL;
+	off_t size = 0;
+	off_t data = 0;
+	int ret = 0;
+	int i = 0;
+
+	priv = this->private;
+	size = replies[source].poststat.ia_size;
+
+	if (off < *hole)
+		return off;
+
+	for (i = 0; i < priv->child_count; i++) {
+		if (healed_sinks[i] && replies[i].poststat.ia_size > off)
+			return off;
+	}
+
+	ret = syncop_seek (priv->children[source], fd, off, GF_SEEK_DATA,
+			   NULL, &data);
+	if (ret == -ENXIO) {
+		data = size;
+		*hole = size;
+	} else if (!ret) {
+		ret = syncop_seek (priv->children[source], fd, data,
+				   GF_SEEK_HOLE, NULL, hole);
+	}
+
+	if (ret && ret != -ENXIO) {
+		gf_log (this->name, GF_LOG_DEBUG, "seek failed on %s (%s), "
+			"reading the holes", priv->children[source]->name,
+			strerror (-ret));
+		*seek = _gf_false;
+		return off;
+	}
+
+	data = min (data, size - 1);
+	data -= data % block;
+
+	return max (off, data);
+}
+
 static int
 afr_selfheal_data_do (call_frame_t *frame, xlator_t *this, fd_t *fd,
 		      int source, unsigned char *healed_sinks,
@@ -343,12 +396,16 @@ afr_selfheal_data_do (call_frame_t *frame, xlator_t *this, fd_t *fd,
 	int type = AFR_SELFHEAL_DATA_FULL;
 	int ret = -1;
 	call_frame_t *iter_frame = NULL;
+	off_t hole = 0;
+	gf_boolean_t seek = _gf_false;
 
 	priv = this->private;
 
         type = afr_data_self_heal_type_get (priv, healed_sinks, source,
                                             replies);
 
+	seek = HAS_HOLES ((&replies[source].poststat));
+
 	iter_frame = afr_copy_frame (frame);
 	if (!iter_frame)
 		return -ENOMEM;
@@ -359,6 +416,14 @@ afr_selfheal_data_do (call_frame_t *frame, xlator_t *this, fd_t *fd,
                         goto out;
                 }
 
+		if (seek) {
+			off = afr_selfheal_data_skip_holes (this, fd, source,
+							    healed_sinks,
+							    replies, off,
+							    block, &hole,
+							    &seek);
+		}
+
 		ret = afr_selfheal_data_block (iter_frame, this, fd, source,
 					       healed_sinks, off, block, type,
 					       replies);
@@ -12,9 +12,11 @@
 #include "byte-order.h"
 #include "common-utils.h"
 #include "timer.h"
+#include "compound-fop-utils.h"
 
 #include "afr.h"
 #include "afr-transaction.h"
+#include "afr-inode-write.h"
 
 #include <signal.h>
 
@@ -953,6 +955,154 @@ afr_changelog_do (call_frame_t *frame, xlator_t *this, dict_t *xattr,
 }
 
 
+static void
+afr_pre_op_writev_args_free (xlator_t *this, compound_args_t **compound)
+{
+	afr_private_t *priv = NULL;
+	int i = 0;
+
+	priv = this->private;
+
+	for (i = 0; i < priv->child_count; i++)
+		compound_args_destroy (compound[i]);
+
+	GF_FREE (compound);
+}
+
+
+int
+afr_pre_op_writev_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+		       int op_ret, int op_errno, compound_args_t *args,
+		       dict_t *xdata)
+{
+	afr_local_t *local = NULL;
+	afr_private_t *priv = NULL;
+	compound_args_t **compound = NULL;
+	compound_rsp_t *rsp = NULL;
+	int child_index = (long) cookie;
+	int call_count = -1;
+	int i = 0;
+
+	local = frame->local;
+	priv = this->private;
+
+	if (local->transaction.compound_args[child_index]->rsp[0].op_ret < 0)
+		afr_transaction_fop_failed (frame, this, child_index);
+
+	call_count = afr_frame_return (frame);
+	if (call_count)
+		return 0;
+
+	/* Every pre-op is done, go on as afr_transaction_perform_fop()
+	   would after the write replies. */
+	afr_changelog_pre_op_update (frame, this);
+
+	compound = local->transaction.compound_args;
+	local->transaction.compound_args = NULL;
+
+	call_count = 0;
+	for (i = 0; i < priv->child_count; i++)
+		if (compound[i])
+			call_count++;
+	local->call_count = call_count;
+
+	/* the last reply may unwind and destroy the frame */
+	for (i = 0; i < priv->child_count; i++) {
+		if (!compound[i])
+			continue;
+
+		rsp = &compound[i]->rsp[1];
+		afr_writev_wind_cbk (frame, (void *) (long) i, this,
+				     rsp->op_ret, rsp->op_errno,
+				     &rsp->prestat, &rsp->poststat,
+				     rsp->xdata);
+	}
+
+	afr_pre_op_writev_args_free (this, compound);
+
+	return 0;
+}
+
+
+/* The pre-op and the write go to each child in one compound fop, which
+   stops before the write where the pre-op failed. */
+static int
+afr_pre_op_writev_do (call_frame_t *frame, xlator_t *this, dict_t *xattr)
+{
+	afr_local_t *local = NULL;
+	afr_private_t *priv = NULL;
+	compound_args_t **compound = NULL;
+	int call_count = 0;
+	int ret = 0;
+	int i = 0;
+
+	local = frame->local;
+	priv = this->private;
+
+	compound = GF_CALLOC (priv->child_count, sizeof (*compound),
+			      gf_afr_mt_compound_args_t);
+	if (!compound)
+		return -ENOMEM;
+
+	for (i = 0; i < priv->child_count; i++) {
+		if (!local->transaction.pre_op[i])
+			continue;
+
+		compound[i] = compound_args_new (2);
+		if (!compound[i]) {
+			ret = -ENOMEM;
+			goto err;
+		}
+
+		ret = compound_args_fxattrop (compound[i], 0, local->fd,
+					      GF_XATTROP_ADD_ARRAY, xattr,
+					      NULL);
+		if (ret)
+			goto err;
+
+		ret = compound_args_writev (compound[i], 1, local->fd,
+					    local->cont.writev.vector,
+					    local->cont.writev.count,
+					    local->cont.writev.offset,
+					    local->cont.writev.flags,
+					    local->cont.writev.iobref,
+					    local->xdata_req);
+		if (ret)
+			goto err;
+
+		call_count++;
+	}
+
+	local->transaction.compound_args = compound;
+	local->call_count = call_count;
+
+	/* as in afr_transaction_perform_fop() */
+	afr_save_lk_owner (frame);
+	frame->root->lk_owner =
+		local->transaction.main_frame->root->lk_owner;
+
+	afr_delayed_changelog_wake_up (this, local->fd);
+
+	for (i = 0; i < priv->child_count; i++) {
+		if (!compound[i])
+			continue;
+
+		STACK_WIND_COOKIE (frame, afr_pre_op_writev_cbk,
+				   (void *) (long) i, priv->children[i],
+				   priv->children[i]->fops->compound,
+				   compound[i], NULL);
+
+		if (!--call_count)
+			break;
+	}
+
+	return 0;
+err:
+	afr_pre_op_writev_args_free (this, compound);
+	return ret;
+}
+
+
 int
 afr_changelog_pre_op (call_frame_t *frame, xlator_t *this)
 {
@@ -1062,7 +1212,10 @@ afr_changelog_pre_op (call_frame_t *frame, xlator_t *this)
 		goto next;
 	}
 
-	afr_changelog_do (frame, this, xdata_req, afr_transaction_perform_fop);
+	if (!priv->use_compound_fops || local->op != GF_FOP_WRITE ||
+	    afr_pre_op_writev_do (frame, this, xdata_req))
+		afr_changelog_do (frame, this, xdata_req,
+				  afr_transaction_perform_fop);
 
 	if (xdata_req)
 		dict_unref (xdata_req);
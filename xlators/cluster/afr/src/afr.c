@@ -167,6 +167,7 @@ reconfigure (xlator_t *this, dict_t *options)
                         goto out;
                 }
                 priv->read_child = index;
+                priv->read_child_local = _gf_false;
         }
 
         GF_OPTION_RECONF ("read-subvolume-index",read_subvol_index, options,int32,out);
@@ -179,9 +180,12 @@ reconfigure (xlator_t *this, dict_t *options)
                         goto out;
                 }
                 priv->read_child = index;
+                priv->read_child_local = _gf_false;
         }
 
         GF_OPTION_RECONF ("pre-op-compat", priv->pre_op_compat, options, bool, out);
+        GF_OPTION_RECONF ("use-compound-fops", priv->use_compound_fops,
+                          options, bool, out);
 
         GF_OPTION_RECONF ("eager-lock", priv->eager_lock, options, bool, out);
         GF_OPTION_RECONF ("quorum-type", qtype, options, str, out);
@@ -347,6 +351,8 @@ init (xlator_t *this)
         GF_OPTION_INIT ("entrylk-trace", priv->entrylk_trace, bool, out);
 
         GF_OPTION_INIT ("pre-op-compat", priv->pre_op_compat, bool, out);
+        GF_OPTION_INIT ("use-compound-fops", priv->use_compound_fops,
+                        bool, out);
 
         GF_OPTION_INIT ("eager-lock", priv->eager_lock, bool, out);
         GF_OPTION_INIT ("quorum-type", qtype, str, out);
@@ -391,6 +397,13 @@ init (xlator_t *this)
                 goto out;
         }
 
+        priv->read_stats = GF_CALLOC (sizeof (*priv->read_stats), child_count,
+                                      gf_afr_mt_read_stats_t);
+        if (!priv->read_stats) {
+                ret = -ENOMEM;
+                goto out;
+        }
+
         priv->pending_key = GF_CALLOC (sizeof (*priv->pending_key),
                                        child_count,
                                        gf_afr_mt_char);
@@ -490,6 +503,7 @@ struct xlator_fops fops = {
         .getxattr    = afr_getxattr,
         .fgetxattr   = afr_fgetxattr,
         .readv       = afr_readv,
+        .seek        = afr_seek,
 
         /* inode write */
         .writev      = afr_writev,
@@ -555,7 +569,7 @@ struct volume_options options[] = {
         { .key = {"read-hash-mode" },
           .type = GF_OPTION_TYPE_INT,
           .min = 0,
-          .max = 2,
+          .max = 3,
           .default_value = "1",
           .description = "inode-read fops happen only on one of the bricks in "
                          "replicate. AFR will prefer the one computed using "
@@ -563,7 +577,11 @@ struct volume_options options[] = {
                          "0 = first up server, "
                          "1 = hash by GFID of file (all clients use "
                                                     "same subvolume), "
-                         "2 = hash by GFID of file and client PID",
+                         "2 = hash by GFID of file and client PID, "
+                         "3 = brick with the least load, measured by the "
+                              "latency and the number of outstanding reads "
+                              "of this client. A local brick chosen by "
+                              "choose-local is not preferred in this mode.",
         },
         { .key  = {"choose-local" },
           .type = GF_OPTION_TYPE_BOOL,
@@ -675,6 +693,15 @@ struct volume_options options[] = {
 	  .description = "Use separate pre-op xattrop() FOP rather than "
 	                 "overloading xdata of the OP"
 	},
+        { .key = {"use-compound-fops"},
+          .type = GF_OPTION_TYPE_BOOL,
+          .default_value = "off",
+          .description = "Send the pre-op and the write of a write "
+                         "transaction to each brick in a single compound "
+                         "fop, saving a network round trip. Bricks without "
+                         "compound fops get the two fops one after the "
+                         "other."
+        },
         { .key = {"eager-lock"},
           .type = GF_OPTION_TYPE_BOOL,
           .default_value = "on",
@@ -39,6 +39,17 @@
 #define AFR_DOM_COUNT_MAX    3
 #define AFR_NUM_CHANGE_LOGS            3 /*data + metadata + entry*/
 
+/* values of read-hash-mode */
+enum {
+        AFR_READ_POLICY_FIRST_UP = 0,
+        AFR_READ_POLICY_GFID_HASH,
+        AFR_READ_POLICY_GFID_PID_HASH,
+        AFR_READ_POLICY_LEAST_LOAD,
+};
+
+/* seconds after which the latency of a child not read from is forgotten */
+#define AFR_READ_STATS_STALE           2
+
 typedef int (*afr_lock_cbk_t) (call_frame_t *frame, xlator_t *this);
 
 typedef int (*afr_read_txn_wind_t) (call_frame_t *frame, xlator_t *this, int subvol);
@@ -52,6 +63,14 @@ typedef int (*afr_changelog_resume_t) (call_frame_t *frame, xlator_t *this);
 #define AFR_INTERSECT(dst,src1,src2,max) ({int __i; for (__i = 0; __i < max; __i++) dst[__i] = src1[__i] && src2[__i];})
 #define AFR_CMP(a1,a2,len) ({int __cmp = 0; int __i; for (__i = 0; __i < len; __i++) if (a1[__i] != a2[__i]) { __cmp = 1; break;} __cmp;})
 
+/* Load of a child as seen by the reads of this client, for the least-load
+   read policy. Updated without locks. */
+typedef struct _afr_read_stats {
+        int64_t         latency;    /* moving average of reads, in usecs */
+        int32_t         pending;    /* reads wound and not answered yet */
+        time_t          updated;    /* time of the last latency sample */
+} afr_read_stats_t;
+
 typedef struct _afr_private {
         gf_lock_t lock;               /* to guard access to child_count, etc */
         unsigned int child_count;     /* total number of children   */
@@ -80,7 +99,9 @@ typedef struct _afr_private {
 
 	gf_boolean_t metadata_splitbrain_forced_heal; /* on/off */
         int read_child;               /* read-subvolume */
+        gf_boolean_t read_child_local; /* read_child set by choose-local */
         unsigned int hash_mode;       /* for when read_child is not set */
+        afr_read_stats_t *read_stats; /* per child, for read-hash-mode 3 */
         int favorite_child;  /* subvolume to be preferred in resolving
                                          split-brain cases */
 
@@ -95,6 +116,7 @@ typedef struct _afr_private {
         gf_boolean_t      optimistic_change_log;
         gf_boolean_t      eager_lock;
         gf_boolean_t      pre_op_compat;      /* on/off */
+        gf_boolean_t      use_compound_fops;
 	uint32_t          post_op_delay_secs;
         unsigned int      quorum_count;
         gf_boolean_t      quorum_reads;
@@ -397,6 +419,15 @@ typedef struct _afr_local {
 
 	afr_inode_refresh_cbk_t refreshfn;
 
+	/* @read_txn_inflight:
+
+	   a read of the read transaction is wound to @read_txn_subvol
+	   since @read_txn_start, and is accounted in priv->read_stats.
+	*/
+	gf_boolean_t read_txn_inflight;
+	int read_txn_subvol;
+	struct timeval read_txn_start;
+
 	/* @refreshinode:
 
 	   Inode currently getting refreshed.
@@ -492,6 +523,11 @@ typedef struct _afr_local {
                         uint32_t flags;
                 } readv;
 
+                struct {
+                        off_t offset;
+                        gf_seek_what_t what;
+                } seek;
+
                 /* dir read */
 
                 struct {
@@ -703,6 +739,11 @@ typedef struct _afr_local {
 
 		afr_changelog_resume_t changelog_resume;
 
+		/* @compound_args: per child, the pre-op and the write sent
+		   as one compound fop
+		*/
+		compound_args_t **compound_args;
+
                 call_frame_t *main_frame;
 
                 int (*wind) (call_frame_t *frame, xlator_t *this, int subvol);
@@ -770,6 +811,9 @@ int
 afr_read_subvol_select_by_policy (inode_t *inode, xlator_t *this,
 				  unsigned char *readable);
 
+void
+afr_read_txn_done (afr_local_t *local, xlator_t *this);
+
 int
 afr_inode_read_subvol_type_get (inode_t *inode, xlator_t *this,
 				unsigned char *readable, int *event_p,
@@ -879,6 +923,8 @@ afr_cleanup_fd_ctx (xlator_t *this, fd_t *fd);
                         __this = frame->this;                   \
                         frame->local = NULL;                    \
                 }                                               \
+                if (__local)                                    \
+                        afr_read_txn_done (__local, __this);    \
                 STACK_UNWIND_STRICT (fop, frame, params);       \
                 if (__local) {                                  \
                         afr_local_cleanup (__local, __this);    \
@@ -3814,8 +3814,10 @@ dht_opendir (call_frame_t *frame, xlator_t *this, loc_t *loc, fd_t *fd,
 {
         dht_local_t  *local  = NULL;
         dht_conf_t   *conf = NULL;
+        dict_t       *dict = NULL;
         int           op_errno = -1;
         int           i = -1;
+        int           ret = -1;
 
         VALIDATE_OR_GOTO (frame, err);
         VALIDATE_OR_GOTO (this, err);
@@ -3831,15 +3833,40 @@ dht_opendir (call_frame_t *frame, xlator_t *this, loc_t *loc, fd_t *fd,
                 goto err;
         }
 
+        /* With parallel-readdir, a readdir-ahead sits on top of each
+         * subvolume and starts prefetching at opendir with these xattrs.
+         * Ask for the linkto xattr as dht_do_readdir would, so linkfiles
+         * can still be filtered out of the prefetched entries. */
+        if (conf->parallel_readdir) {
+                if (xdata)
+                        dict = dict_copy_with_ref (xdata, NULL);
+                else
+                        dict = dict_new ();
+
+                if (dict) {
+                        ret = dict_set_uint32 (dict, conf->link_xattr_name,
+                                               256);
+                        if (ret)
+                                gf_msg (this->name, GF_LOG_WARNING, 0,
+                                        DHT_MSG_DICT_SET_FAILED,
+                                        "Failed to set dictionary value"
+                                        " : key = %s",
+                                        conf->link_xattr_name);
+                }
+        }
+
         local->call_cnt = conf->subvolume_cnt;
 
         for (i = 0; i < conf->subvolume_cnt; i++) {
                 STACK_WIND (frame, dht_fd_cbk,
                             conf->subvolumes[i],
                             conf->subvolumes[i]->fops->opendir,
-                            loc, fd, xdata);
+                            loc, fd, dict ? dict : xdata);
         }
 
+        if (dict)
+                dict_unref (dict);
+
         return 0;
 
 err:
@@ -42,6 +42,25 @@ typedef int (*dht_defrag_cbk_fn_t) (xlator_t        *this, call_frame_t *frame,
                                     int              ret);
 
 
+/* Non-empty ranges of a layout sorted by start, for a binary search of
+ * the hashed subvolume. Only built for layouts without overlaps. */
+struct dht_layout_table {
+        int                cnt;
+        struct dht_layout_range {
+                uint32_t   start;
+                uint32_t   stop;
+                xlator_t  *xlator;
+        } range[];
+};
+typedef struct dht_layout_table dht_layout_table_t;
+
+#define DHT_LAYOUT_TABLE_MIN_CNT 8
+
+#define DHT_LAYOUT_RANGES_CHANGING(layout) do {                         \
+                if ((layout)->table)                                    \
+                        (layout)->table_stale = _gf_true;               \
+        } while (0)
+
 struct dht_layout {
         int                spread_cnt;  /* layout spread count per directory,
                                            is controlled by 'setxattr()' with
@@ -52,7 +71,13 @@ struct dht_layout {
         int                type;
         int                ref; /* use with dht_conf_t->layout_lock */
         gf_boolean_t       search_unhashed;
-        struct {
+        /* built when the layout is first installed in an inode ctx, kept
+           until the layout is freed. Changing the ranges of a layout that
+           has a table sets table_stale and dht_layout_search goes back to
+           walking the list. */
+        dht_layout_table_t *table;
+        gf_boolean_t       table_stale;
+        struct dht_layout_entry {
                 int        err;   /* 0 = normal
                                      -1 = dir exists and no xattr
                                      >0 = dir lookup failed with errno
@@ -290,6 +315,39 @@ struct gf_defrag_pattern_list {
         gf_defrag_pattern_list_t  *next;
 };
 
+#define GF_DEFRAG_MAX_WORKERS   64
+#define GF_DEFRAG_QUEUE_LIMIT   500
+
+enum gf_defrag_throttle {
+        GF_DEFRAG_THROTTLE_LAZY,
+        GF_DEFRAG_THROTTLE_NORMAL,
+        GF_DEFRAG_THROTTLE_AGGRESSIVE,
+};
+typedef enum gf_defrag_throttle gf_defrag_throttle_t;
+
+/* A file found by the crawler, waiting for a migration worker */
+struct gf_defrag_job {
+        struct list_head             list;
+        loc_t                        loc;
+        dict_t                      *migrate_data;
+        gf_boolean_t                 hardlinked;
+};
+typedef struct gf_defrag_job gf_defrag_job_t;
+
+struct gf_defrag_worker {
+        pthread_t                    thread;
+        int                          id;
+        xlator_t                    *this;
+        gf_boolean_t                 started;
+        /* gfid of the file being migrated, to keep the other workers
+         * away from its hardlinks */
+        uuid_t                       gfid;
+        uint64_t                     files;
+        uint64_t                     data;
+        double                       busy;
+};
+typedef struct gf_defrag_worker gf_defrag_worker_t;
+
 struct gf_defrag_info_ {
         uint64_t                     total_files;
         uint64_t                     total_data;
@@ -317,6 +375,24 @@ struct gf_defrag_info_ {
         uint64_t                     total_files_demoted;
         int                          write_freq_threshold;
         int                          read_freq_threshold;
+
+        /* The crawler queues the files, the workers migrate them. All of
+         * it is protected by q_mutex. */
+        struct list_head             queue;
+        uint32_t                     q_entries;
+        pthread_mutex_t              q_mutex;
+        pthread_cond_t               q_cond;
+        pthread_cond_t               crawler_cond;
+        pthread_cond_t               subvol_cond;
+        gf_boolean_t                 crawl_done;
+        gf_defrag_throttle_t         throttle;
+        uint32_t                     threads;
+        uint32_t                     active_workers;
+        uint32_t                     worker_cnt;
+        gf_defrag_worker_t           workers[GF_DEFRAG_MAX_WORKERS];
+        /* files migrated at once from or to a subvolume, 0 for no limit */
+        uint32_t                     subvol_limit;
+        int32_t                     *subvol_busy;
 };
 
 typedef struct gf_defrag_info_ gf_defrag_info_t;
@@ -376,11 +452,17 @@ struct dht_conf {
 
         gf_boolean_t    readdir_optimize;
 
+        /* a readdir-ahead is loaded on top of each subvolume */
+        gf_boolean_t    parallel_readdir;
+
         /* Support regex-based name reinterpretation. */
         regex_t         rsync_regex;
         gf_boolean_t    rsync_regex_valid;
         regex_t         extra_regex;
         gf_boolean_t    extra_regex_valid;
+        /* first character any match must start with, 0 if unknown */
+        char            rsync_regex_lead;
+        char            extra_regex_lead;
 
         /* Support variable xattr names. */
         char            *xattr_name;
@@ -576,6 +658,7 @@ int       dht_get_du_info_for_subvol (xlator_t *this, int subvol_idx);
 
 int dht_layout_preset (xlator_t *this, xlator_t *subvol, inode_t *inode);
 int           dht_layout_set (xlator_t *this, inode_t *inode, dht_layout_t *layout);;
+int           dht_layout_table_build (xlator_t *this, dht_layout_t *layout);
 void          dht_layout_unref (xlator_t *this, dht_layout_t *layout);
 dht_layout_t *dht_layout_ref (xlator_t *this, dht_layout_t *layout);
 xlator_t     *dht_first_up_subvol (xlator_t *this);
@@ -799,6 +882,8 @@ int32_t dht_discard(call_frame_t *frame, xlator_t *this, fd_t *fd,
 		    off_t offset, size_t len, dict_t *xdata);
 int32_t dht_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd,
                     off_t offset, off_t len, dict_t *xdata);
+int32_t dht_seek (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                  off_t offset, gf_seek_what_t what, dict_t *xdata);
 
 int
 dht_set_subvol_range(xlator_t *this);
@@ -844,6 +929,12 @@ gf_defrag_stop (gf_defrag_info_t *defrag, gf_defrag_status_t status,
 void*
 gf_defrag_start (void *this);
 
+int
+gf_defrag_throttle_parse (const char *str, gf_defrag_throttle_t *throttle);
+
+void
+gf_defrag_set_workers (xlator_t *this, gf_defrag_info_t *defrag);
+
 int32_t
 gf_defrag_handle_hardlink (xlator_t *this, loc_t *loc, dict_t  *xattrs,
                            struct iatt *stbuf);
@@ -84,14 +84,17 @@ dht_hash_compute (xlator_t *this, int type, const char *name, uint32_t *hash_p)
          * inline.
          */
 
-        if (priv->extra_regex_valid) {
+        /* Names that cannot match a regex skip regexec and the copy. */
+        if (priv->extra_regex_valid &&
+            (!priv->extra_regex_lead || (name[0] == priv->extra_regex_lead))) {
                 len = strlen(name) + 1;
                 rsync_friendly_name = alloca(len);
                 munged = dht_munge_name (name, rsync_friendly_name, len,
                                          &priv->extra_regex);
         }
 
-        if (!munged && priv->rsync_regex_valid) {
+        if (!munged && priv->rsync_regex_valid &&
+            (!priv->rsync_regex_lead || (name[0] == priv->rsync_regex_lead))) {
                 len = strlen(name) + 1;
                 rsync_friendly_name = alloca(len);
                 gf_msg_trace (this->name, 0, "trying regex for %s", name);
@@ -101,6 +101,10 @@ dht_layout_set (xlator_t *this, inode_t *inode, dht_layout_t *layout)
         if (!conf || !layout)
                 goto out;
 
+        if (!layout->table && !layout->preset &&
+            (layout->cnt >= DHT_LAYOUT_TABLE_MIN_CNT))
+                dht_layout_table_build (this, layout);
+
         LOCK (&conf->layout_lock);
         {
                 oldret = dht_inode_ctx_layout_get (inode, this, &old_layout);
@@ -136,8 +140,10 @@ dht_layout_unref (xlator_t *this, dht_layout_t *layout)
         }
         UNLOCK (&conf->layout_lock);
 
-        if (!ref)
+        if (!ref) {
+                GF_FREE (layout->table);
                 GF_FREE (layout);
+        }
 }
 
 
@@ -160,13 +166,98 @@ dht_layout_ref (xlator_t *this, dht_layout_t *layout)
 }
 
 
+static int
+dht_layout_range_cmp (const void *a, const void *b)
+{
+        const struct dht_layout_range *ra = a;
+        const struct dht_layout_range *rb = b;
+
+        if (ra->start != rb->start)
+                return (ra->start < rb->start) ? -1 : 1;
+
+        return 0;
+}
+
+/* Builds the search table of a layout, unless its non-empty ranges
+ * overlap: the list order decides which subvolume wins an overlap, so
+ * those keep walking the list. (0, 0) entries are left out, they only
+ * ever matter for a hash of 0, which is always looked up in the list.
+ */
+int
+dht_layout_table_build (xlator_t *this, dht_layout_t *layout)
+{
+        int                  i     = 0;
+        int                  cnt   = 0;
+        dht_layout_table_t  *table = NULL;
+
+        for (i = 0; i < layout->cnt; i++) {
+                if ((layout->list[i].start > layout->list[i].stop) ||
+                    (!layout->list[i].start && !layout->list[i].stop))
+                        continue;
+                cnt++;
+        }
+
+        table = GF_CALLOC (1, sizeof (*table) + cnt * sizeof (table->range[0]),
+                           gf_dht_mt_layout_table_t);
+        if (!table)
+                return -1;
+
+        for (i = 0; i < layout->cnt; i++) {
+                if ((layout->list[i].start > layout->list[i].stop) ||
+                    (!layout->list[i].start && !layout->list[i].stop))
+                        continue;
+                table->range[table->cnt].start = layout->list[i].start;
+                table->range[table->cnt].stop = layout->list[i].stop;
+                table->range[table->cnt].xlator = layout->list[i].xlator;
+                table->cnt++;
+        }
+
+        qsort (table->range, table->cnt, sizeof (table->range[0]),
+               dht_layout_range_cmp);
+
+        for (i = 1; i < table->cnt; i++) {
+                if (table->range[i].start <= table->range[i - 1].stop) {
+                        GF_FREE (table);
+                        return -1;
+                }
+        }
+
+        /* a layout can be installed on several inodes at once */
+        if (!__sync_bool_compare_and_swap (&layout->table, NULL, table))
+                GF_FREE (table);
+
+        return 0;
+}
+
+static xlator_t *
+dht_layout_table_search (dht_layout_table_t *table, uint32_t hash)
+{
+        int lo  = 0;
+        int hi  = 0;
+        int mid = 0;
+
+        hi = table->cnt - 1;
+        while (lo <= hi) {
+                mid = lo + (hi - lo) / 2;
+                if (hash < table->range[mid].start)
+                        hi = mid - 1;
+                else if (hash > table->range[mid].stop)
+                        lo = mid + 1;
+                else
+                        return table->range[mid].xlator;
+        }
+
+        return NULL;
+}
+
 xlator_t *
 dht_layout_search (xlator_t *this, dht_layout_t *layout, const char *name)
 {
-        uint32_t   hash = 0;
-        xlator_t  *subvol = NULL;
-        int        i = 0;
-        int        ret = 0;
+        uint32_t            hash = 0;
+        xlator_t           *subvol = NULL;
+        dht_layout_table_t *table = NULL;
+        int                 i = 0;
+        int                 ret = 0;
 
         ret = dht_hash_compute (this, layout->type, name, &hash);
         if (ret != 0) {
@@ -176,6 +267,12 @@ dht_layout_search (xlator_t *this, dht_layout_t *layout, const char *name)
                 goto out;
         }
 
+        table = layout->table;
+        if (table && !layout->table_stale && hash) {
+                subvol = dht_layout_table_search (table, hash);
+                goto found;
+        }
+
         for (i = 0; i < layout->cnt; i++) {
                 if (layout->list[i].start <= hash
                     && layout->list[i].stop >= hash) {
@@ -184,6 +281,7 @@ dht_layout_search (xlator_t *this, dht_layout_t *layout, const char *name)
                 }
         }
 
+found:
         if (!subvol) {
                 gf_log (this->name, GF_LOG_WARNING,
                         "no subvolume for hash (value) = %u", hash);
@@ -333,6 +431,7 @@ dht_disk_layout_merge (xlator_t *this, dht_layout_t *layout,
         start_off = ntoh32 (disk_layout[2]);
         stop_off  = ntoh32 (disk_layout[3]);
 
+        DHT_LAYOUT_RANGES_CHANGING (layout);
         layout->list[pos].start = start_off;
         layout->list[pos].stop  = stop_off;
 
@@ -360,6 +459,8 @@ dht_layout_merge (xlator_t *this, dht_layout_t *layout, xlator_t *subvol,
                 err = op_errno;
         }
 
+        DHT_LAYOUT_RANGES_CHANGING (layout);
+
         for (i = 0; i < layout->cnt; i++) {
                 if (layout->list[i].xlator == NULL) {
                         layout->list[i].err    = err;
@@ -412,6 +513,8 @@ dht_layout_entry_swap (dht_layout_t *layout, int i, int j)
         xlator_t *xlator_swap = 0;
         int       err_swap = 0;
 
+        DHT_LAYOUT_RANGES_CHANGING (layout);
+
         start_swap  = layout->list[i].start;
         stop_swap   = layout->list[i].stop;
         xlator_swap = layout->list[i].xlator;
@@ -434,6 +537,8 @@ dht_layout_range_swap (dht_layout_t *layout, int i, int j)
         uint32_t  start_swap = 0;
         uint32_t  stop_swap = 0;
 
+        DHT_LAYOUT_RANGES_CHANGING (layout);
+
         start_swap  = layout->list[i].start;
         stop_swap   = layout->list[i].stop;
 
@@ -487,22 +592,44 @@ out:
 }
 
 
+/* Same order as dht_layout_entry_cmp: zeroed out ranges first, then by
+ * start. */
+static int
+dht_layout_entry_qsort_cmp (const void *a, const void *b)
+{
+        const struct dht_layout_entry *ea = a;
+        const struct dht_layout_entry *eb = b;
+        gf_boolean_t                   za = (!ea->start && !ea->stop);
+        gf_boolean_t                   zb = (!eb->start && !eb->stop);
+
+        if (za != zb)
+                return (za) ? -1 : 1;
+
+        if (ea->start != eb->start)
+                return (ea->start < eb->start) ? -1 : 1;
+
+        if (ea->stop != eb->stop)
+                return (ea->stop < eb->stop) ? -1 : 1;
+
+        return 0;
+}
+
+static int
+dht_layout_entry_qsort_cmp_volname (const void *a, const void *b)
+{
+        const struct dht_layout_entry *ea = a;
+        const struct dht_layout_entry *eb = b;
+
+        return strcmp (ea->xlator->name, eb->xlator->name);
+}
+
 int
 dht_layout_sort (dht_layout_t *layout)
 {
-        int       i = 0;
-        int       j = 0;
-        int64_t   ret = 0;
+        DHT_LAYOUT_RANGES_CHANGING (layout);
 
-        /* TODO: O(n^2) -- bad bad */
-
-        for (i = 0; i < layout->cnt - 1; i++) {
-                for (j = i + 1; j < layout->cnt; j++) {
-                        ret = dht_layout_entry_cmp (layout, i, j);
-                        if (ret > 0)
-                                dht_layout_entry_swap (layout, i, j);
-                }
-        }
+        qsort (layout->list, layout->cnt, sizeof (layout->list[0]),
+               dht_layout_entry_qsort_cmp);
 
         return 0;
 }
@@ -510,19 +637,10 @@ dht_layout_sort (dht_layout_t *layout)
 int
 dht_layout_sort_volname (dht_layout_t *layout)
 {
-        int       i = 0;
-        int       j = 0;
-        int64_t   ret = 0;
+        DHT_LAYOUT_RANGES_CHANGING (layout);
 
-        /* TODO: O(n^2) -- bad bad */
-
-        for (i = 0; i < layout->cnt - 1; i++) {
-                for (j = i + 1; j < layout->cnt; j++) {
-                        ret = dht_layout_entry_cmp_volname (layout, i, j);
-                        if (ret > 0)
-                                dht_layout_entry_swap (layout, i, j);
-                }
-        }
+        qsort (layout->list, layout->cnt, sizeof (layout->list[0]),
+               dht_layout_entry_qsort_cmp_volname);
 
         return 0;
 }
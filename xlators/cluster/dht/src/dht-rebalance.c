@@ -23,6 +23,25 @@
 #define GF_DISK_SECTOR_SIZE             512
 #define DHT_REBALANCE_PID               4242 /* Change it if required */
 #define DHT_REBALANCE_BLKSIZE           (128 * 1024)
+#define DHT_REBALANCE_WINDOWS           4 /* blocks in flight per file */
+
+/* State shared by the windows copying the data of one file. */
+struct dht_migrate_data {
+        xlator_t       *from;
+        xlator_t       *to;
+        fd_t           *src;
+        fd_t           *dst;
+        off_t           ia_size;
+        int             hole_exists;
+        syncbarrier_t   barrier;
+
+        synclock_t      lock;       /* guards the members below */
+        off_t           cursor;     /* next offset to hand to a window */
+        off_t           data_end;   /* end of the data region at cursor */
+        gf_boolean_t    seek;       /* holes are found with seek */
+        uint64_t        skipped;    /* bytes of holes not read */
+        int             op_ret;
+};
 
 static int
 dht_write_with_holes (xlator_t *to, fd_t *fd, struct iovec *vec, int count,
@@ -594,59 +613,202 @@ out:
         return ret;
 }
 
-static inline int
-__dht_rebalance_migrate_data (xlator_t *from, xlator_t *to, fd_t *src, fd_t *dst,
-                             uint64_t ia_size, int hole_exists)
+/* Hands the next block to copy to a window, in @offset and @size. Holes of
+ * the source are skipped: the destination was truncated to the size of the
+ * file, so they are holes there already. Returns 1 once the whole file was
+ * handed out. */
+static int
+dht_migrate_data_next (struct dht_migrate_data *data, off_t *offset,
+                       size_t *size)
 {
-        int            ret    = 0;
-        int            count  = 0;
-        off_t          offset = 0;
-        struct iovec  *vector = NULL;
-        struct iobref *iobref = NULL;
-        uint64_t       total  = 0;
-        size_t         read_size = 0;
-
-        /* if file size is '0', no need to enter this loop */
-        while (total < ia_size) {
-                read_size = (((ia_size - total) > DHT_REBALANCE_BLKSIZE) ?
-                             DHT_REBALANCE_BLKSIZE : (ia_size - total));
-                ret = syncop_readv (from, src, read_size,
-                                    offset, 0, &vector, &count, &iobref, NULL,
-                                    NULL);
-                if (!ret || (ret < 0)) {
-                        break;
+        off_t   start = 0;
+        off_t   end   = 0;
+        int     ret   = 0;
+
+        synclock_lock (&data->lock);
+        {
+                if ((data->op_ret < 0) || (data->cursor >= data->ia_size)) {
+                        ret = 1;
+                        goto unlock;
+                }
+
+                if (data->seek && (data->cursor >= data->data_end)) {
+                        ret = syncop_seek (data->from, data->src, data->cursor,
+                                           GF_SEEK_DATA, NULL, &start);
+                        if (ret == -ENXIO) {
+                                /* the rest of the file is a hole */
+                                data->skipped += data->ia_size - data->cursor;
+                                data->cursor = data->ia_size;
+                                ret = 1;
+                                goto unlock;
+                        }
+                        if (!ret)
+                                ret = syncop_seek (data->from, data->src,
+                                                   start, GF_SEEK_HOLE, NULL,
+                                                   &end);
+                        if (ret) {
+                                /* older bricks, striped or sharded files */
+                                gf_msg_debug (THIS->name, 0, "seek failed on "
+                                              "%s (%s), copying the holes",
+                                              data->from->name,
+                                              strerror (-ret));
+                                data->seek = _gf_false;
+                                data->data_end = data->ia_size;
+                        } else {
+                                if (start > data->cursor)
+                                        data->skipped += min (start,
+                                                              data->ia_size) -
+                                                         data->cursor;
+                                data->cursor = start;
+                                data->data_end = min (end, data->ia_size);
+                        }
+                        ret = 0;
+
+                        if (data->cursor >= data->ia_size) {
+                                ret = 1;
+                                goto unlock;
+                        }
+                }
+
+                *offset = data->cursor;
+                *size = min (DHT_REBALANCE_BLKSIZE,
+                             data->data_end - data->cursor);
+                data->cursor += *size;
+        }
+unlock:
+        synclock_unlock (&data->lock);
+
+        return ret;
+}
+
+static int
+dht_migrate_data_window (void *opaque)
+{
+        struct dht_migrate_data *data   = opaque;
+        int                      ret    = 0;
+        int                      count  = 0;
+        off_t                    offset = 0;
+        size_t                   size   = 0;
+        struct iovec            *vector = NULL;
+        struct iobref           *iobref = NULL;
+
+        while (dht_migrate_data_next (data, &offset, &size) == 0) {
+                while (size) {
+                        ret = syncop_readv (data->from, data->src, size,
+                                            offset, 0, &vector, &count,
+                                            &iobref, NULL, NULL);
+                        /* the file shrunk while being migrated */
+                        if (!ret || (ret < 0))
+                                break;
+
+                        if (data->hole_exists)
+                                ret = dht_write_with_holes (data->to,
+                                                            data->dst, vector,
+                                                            count, ret, offset,
+                                                            iobref);
+                        else
+                                ret = syncop_writev (data->to, data->dst,
+                                                     vector, count, offset,
+                                                     iobref, 0, NULL, NULL);
+                        GF_FREE (vector);
+                        if (iobref)
+                                iobref_unref (iobref);
+                        iobref = NULL;
+                        vector = NULL;
+
+                        if (ret < 0)
+                                break;
+
+                        offset += ret;
+                        size -= ret;
                 }
 
-                if (hole_exists)
-                        ret = dht_write_with_holes (to, dst, vector, count,
-                                                    ret, offset, iobref);
-                else
-                        ret = syncop_writev (to, dst, vector, count,
-                                             offset, iobref, 0, NULL, NULL);
                 if (ret < 0) {
+                        synclock_lock (&data->lock);
+                        {
+                                data->op_ret = -1;
+                        }
+                        synclock_unlock (&data->lock);
                         break;
                 }
-                offset += ret;
-                total += ret;
-
-                GF_FREE (vector);
-                if (iobref)
-                        iobref_unref (iobref);
-                iobref = NULL;
-                vector = NULL;
         }
-        if (iobref)
-                iobref_unref (iobref);
-        GF_FREE (vector);
 
-        if (ret >= 0)
-                ret = 0;
-        else
-                ret = -1;
+        return 0;
+}
 
-        return ret;
+static int
+dht_migrate_data_window_done (int ret, call_frame_t *frame, void *opaque)
+{
+        struct dht_migrate_data *data = opaque;
+
+        syncbarrier_wake (&data->barrier);
+
+        return 0;
 }
 
+/* Copies the data in blocks of DHT_REBALANCE_BLKSIZE, with up to
+ * DHT_REBALANCE_WINDOWS blocks read or written at the same time. The
+ * caller is one of the windows, the others run as synctasks. The bytes of
+ * holes that were skipped are returned in @skipped. */
+static inline int
+__dht_rebalance_migrate_data (xlator_t *from, xlator_t *to, fd_t *src, fd_t *dst,
+                             uint64_t ia_size, int hole_exists,
+                             uint64_t *skipped)
+{
+        struct dht_migrate_data  data    = {0,};
+        struct synctask         *task    = NULL;
+        call_frame_t            *frame   = NULL;
+        xlator_t                *this    = NULL;
+        int                      windows = 0;
+        int                      i       = 0;
+
+        this = THIS;
+
+        data.from = from;
+        data.to = to;
+        data.src = src;
+        data.dst = dst;
+        data.ia_size = ia_size;
+        data.hole_exists = hole_exists;
+        /* a file without holes is one data region */
+        data.seek = hole_exists;
+        data.data_end = hole_exists ? 0 : ia_size;
+
+        synclock_init (&data.lock);
+        syncbarrier_init (&data.barrier);
+
+        if ((ia_size > DHT_REBALANCE_BLKSIZE) && this->ctx->env) {
+                /* the windows send their fops as the caller does */
+                task = synctask_get ();
+                if (task)
+                        frame = copy_frame (task->opframe);
+                else
+                        frame = syncop_create_frame (this);
+        }
+
+        for (i = 1; frame && (i < DHT_REBALANCE_WINDOWS); i++) {
+                if (synctask_new (this->ctx->env, dht_migrate_data_window,
+                                  dht_migrate_data_window_done, frame,
+                                  &data))
+                        break;
+                windows++;
+        }
+
+        dht_migrate_data_window (&data);
+
+        if (windows)
+                syncbarrier_wait (&data.barrier, windows);
+
+        if (frame)
+                STACK_DESTROY (frame->root);
+
+        syncbarrier_destroy (&data.barrier);
+        synclock_destroy (&data.lock);
+
+        *skipped = data.skipped;
+
+        return (data.op_ret < 0) ? -1 : 0;
+}
 
 static inline int
 __dht_rebalance_open_src_file (xlator_t *from, xlator_t *to, loc_t *loc,
@@ -897,6 +1059,7 @@ dht_migrate_file (xlator_t *this, loc_t *loc, xlator_t *from, xlator_t *to,
         dict_t         *xattr                = NULL;
         dict_t         *xattr_rsp            = NULL;
         int             file_has_holes       = 0;
+        uint64_t        skipped              = 0;
         dht_conf_t     *conf                 = this->private;
         int             rcvd_enoent_from_src = 0;
         struct gf_flock flock                = {0, };
@@ -1022,7 +1185,8 @@ dht_migrate_file (xlator_t *this, loc_t *loc, xlator_t *from, xlator_t *to,
 
         /* All I/O happens in this function */
         ret = __dht_rebalance_migrate_data (from, to, src_fd, dst_fd,
-					    stbuf.ia_size, file_has_holes);
+					    stbuf.ia_size, file_has_holes,
+                                            &skipped);
         if (ret) {
                 gf_msg (this->name, GF_LOG_ERROR, 0,
                         DHT_MSG_MIGRATE_FILE_FAILED,
@@ -1186,6 +1350,11 @@ dht_migrate_file (xlator_t *this, loc_t *loc, xlator_t *from, xlator_t *to,
                 DHT_MSG_MIGRATE_FILE_COMPLETE,
                 "completed migration of %s from subvolume %s to %s",
                 loc->path, from->name, to->name);
+        if (skipped)
+                gf_msg (this->name, GF_LOG_INFO, 0,
+                        DHT_MSG_MIGRATE_FILE_COMPLETE,
+                        "skipped %"PRIu64" bytes of holes in %s",
+                        skipped, loc->path);
 
         ret = 0;
 out:
@@ -1405,9 +1574,500 @@ gf_defrag_pattern_match (gf_defrag_info_t *defrag, char *name, uint64_t size)
         return ret;
 }
 
+static void
+gf_defrag_job_free (gf_defrag_job_t *job)
+{
+        loc_wipe (&job->loc);
+        if (job->migrate_data)
+                dict_unref (job->migrate_data);
+        GF_FREE (job);
+}
+
+/* Waits until @from and @to can take one more migration. The slots are
+ * given back with gf_defrag_subvols_put. */
+static void
+gf_defrag_subvols_get (gf_defrag_info_t *defrag, int from, int to)
+{
+        pthread_mutex_lock (&defrag->q_mutex);
+        {
+                while (defrag->subvol_limit &&
+                       (defrag->defrag_status == GF_DEFRAG_STATUS_STARTED) &&
+                       ((defrag->subvol_busy[from] >= defrag->subvol_limit) ||
+                        (defrag->subvol_busy[to] >= defrag->subvol_limit)))
+                        pthread_cond_wait (&defrag->subvol_cond,
+                                           &defrag->q_mutex);
+
+                defrag->subvol_busy[from]++;
+                defrag->subvol_busy[to]++;
+        }
+        pthread_mutex_unlock (&defrag->q_mutex);
+}
+
+static void
+gf_defrag_subvols_put (gf_defrag_info_t *defrag, int from, int to)
+{
+        pthread_mutex_lock (&defrag->q_mutex);
+        {
+                defrag->subvol_busy[from]--;
+                defrag->subvol_busy[to]--;
+                pthread_cond_broadcast (&defrag->subvol_cond);
+        }
+        pthread_mutex_unlock (&defrag->q_mutex);
+}
+
+/* Migrates a file queued by the crawler. The lookup and the checks of the
+ * owning node are done here as well, so that they are spread over the
+ * workers too. */
+static int
+gf_defrag_migrate_file (xlator_t *this, gf_defrag_info_t *defrag,
+                        gf_defrag_worker_t *worker, gf_defrag_job_t *job)
+{
+        int                      ret            = -1;
+        loc_t                   *entry_loc      = &job->loc;
+        dict_t                  *dict           = NULL;
+        struct iatt              iatt           = {0,};
+        int32_t                  op_errno       = 0;
+        char                    *uuid_str       = NULL;
+        uuid_t                   node_uuid      = {0,};
+        struct timeval           end            = {0,};
+        double                   elapsed        = {0,};
+        struct timeval           start          = {0,};
+        int                      loglevel       = GF_LOG_TRACE;
+        xlator_t                *from           = NULL;
+        xlator_t                *to             = NULL;
+        int                      from_idx       = -1;
+        int                      to_idx         = -1;
+
+        gettimeofday (&start, NULL);
+
+        ret = syncop_lookup (this, entry_loc, &iatt, NULL, NULL, NULL);
+        if (ret) {
+                gf_msg (this->name, GF_LOG_ERROR, 0,
+                        DHT_MSG_MIGRATE_FILE_FAILED,
+                        "Migrate file failed:%s lookup failed",
+                        entry_loc->path);
+                ret = 0;
+                goto out;
+        }
+
+        ret = syncop_getxattr (this, entry_loc, &dict, GF_XATTR_NODE_UUID_KEY,
+                               NULL, NULL);
+        if (ret < 0) {
+                gf_msg (this->name, GF_LOG_ERROR, 0,
+                        DHT_MSG_MIGRATE_FILE_FAILED,
+                        "Migrate file failed:"
+                        "Failed to get node-uuid for %s",
+                        entry_loc->path);
+                ret = 0;
+                goto out;
+        }
+
+        ret = dict_get_str (dict, GF_XATTR_NODE_UUID_KEY, &uuid_str);
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_ERROR, "Failed to "
+                        "get node-uuid from dict for %s",
+                        entry_loc->path);
+                ret = 0;
+                goto out;
+        }
+
+        if (gf_uuid_parse (uuid_str, node_uuid)) {
+                gf_log (this->name, GF_LOG_ERROR, "gf_uuid_parse "
+                        "failed for %s", entry_loc->path);
+                ret = 0;
+                goto out;
+        }
+
+        /* if file belongs to different node, skip migration
+         * the other node will take responsibility of migration
+         */
+        if (gf_uuid_compare (node_uuid, defrag->node_uuid)) {
+                gf_msg_trace (this->name, 0, "%s does not"
+                              "belong to this node", entry_loc->path);
+                ret = 0;
+                goto out;
+        }
+
+        /* if distribute is present, it will honor this key.
+         * -1, ENODATA is returned if distribute is not present
+         * or file doesn't have a link-file. If file has
+         * link-file, the path of link-file will be the value,
+         * and also that guarantees that file has to be mostly
+         * migrated */
+
+        ret = syncop_getxattr (this, entry_loc, NULL, GF_XATTR_LINKINFO_KEY,
+                               NULL, NULL);
+        if (ret < 0) {
+                if (-ret != ENODATA) {
+                        loglevel = GF_LOG_ERROR;
+                        LOCK (&defrag->lock);
+                        {
+                                defrag->total_failures += 1;
+                        }
+                        UNLOCK (&defrag->lock);
+                } else {
+                        loglevel = GF_LOG_TRACE;
+                }
+                gf_log (this->name, loglevel, "%s: failed to "
+                        "get "GF_XATTR_LINKINFO_KEY" key - %s",
+                        entry_loc->path, strerror (-ret));
+                ret = 0;
+                goto out;
+        }
+
+        /* the lookup left the layout of the file in the inode */
+        from = dht_subvol_get_cached (this, entry_loc->inode);
+        to = dht_subvol_get_hashed (this, entry_loc);
+        if (from && to && (from != to)) {
+                from_idx = dht_subvol_cnt (this, from);
+                to_idx = dht_subvol_cnt (this, to);
+        }
+        if ((from_idx >= 0) && (to_idx >= 0))
+                gf_defrag_subvols_get (defrag, from_idx, to_idx);
+
+        ret = syncop_setxattr (this, entry_loc, job->migrate_data, 0, NULL,
+                               NULL);
+
+        if ((from_idx >= 0) && (to_idx >= 0))
+                gf_defrag_subvols_put (defrag, from_idx, to_idx);
+
+        if (ret < 0) {
+                op_errno = -ret;
+                /* errno is overloaded. See
+                 * rebalance_task_completion () */
+                LOCK (&defrag->lock);
+                {
+                        if (op_errno == ENOSPC)
+                                defrag->skipped += 1;
+                        else
+                                defrag->total_failures += 1;
+                }
+                UNLOCK (&defrag->lock);
+
+                if (op_errno == ENOSPC) {
+                        gf_msg_debug (this->name, 0,
+                                      "migrate-data skipped for %s due to "
+                                      "space constraints", entry_loc->path);
+                } else {
+                        gf_msg (this->name, GF_LOG_ERROR, 0,
+                                DHT_MSG_MIGRATE_FILE_FAILED,
+                                "migrate-data failed for %s",
+                                entry_loc->path);
+                }
+
+                ret = gf_defrag_handle_migrate_error (op_errno, defrag);
+
+                if (!ret)
+                        gf_msg_debug (this->name, 0,
+                                      "migrate-data on %s failed: %s",
+                                      entry_loc->path, strerror (op_errno));
+                else if (ret == 1)
+                        ret = 0;
+                goto out;
+        } else if (ret > 0) {
+                gf_msg (this->name, GF_LOG_ERROR, 0,
+                        DHT_MSG_MIGRATE_FILE_FAILED,
+                        "migrate-data failed for %s", entry_loc->path);
+                LOCK (&defrag->lock);
+                {
+                        defrag->total_failures += 1;
+                }
+                UNLOCK (&defrag->lock);
+        }
+
+        gettimeofday (&end, NULL);
+        elapsed = (end.tv_sec - start.tv_sec) * 1e6 +
+                  (end.tv_usec - start.tv_usec);
+
+        LOCK (&defrag->lock);
+        {
+                defrag->total_files += 1;
+                defrag->total_data += iatt.ia_size;
+                worker->files += 1;
+                worker->data += iatt.ia_size;
+                worker->busy += elapsed / 1e6;
+        }
+        UNLOCK (&defrag->lock);
+
+        if (defrag->stats == _gf_true) {
+                gf_log (this->name, GF_LOG_INFO, "Migration of "
+                        "file:%s size:%"PRIu64" bytes took %.2f"
+                        "secs", entry_loc->path, iatt.ia_size,
+                         elapsed/1e6);
+        }
+
+        ret = 0;
+out:
+        if (dict)
+                dict_unref (dict);
+
+        return ret;
+}
+
+/* Takes the first queued job that no other worker is busy with a hardlink
+ * of. Workers above the active count are parked. */
+static gf_defrag_job_t *
+__gf_defrag_job_get (gf_defrag_info_t *defrag, gf_defrag_worker_t *worker)
+{
+        gf_defrag_job_t *job   = NULL;
+        gf_boolean_t     taken = _gf_false;
+        int              i     = 0;
+
+        if (worker->id >= defrag->active_workers)
+                return NULL;
+
+        list_for_each_entry (job, &defrag->queue, list) {
+                taken = _gf_false;
+                if (job->hardlinked) {
+                        for (i = 0; i < defrag->worker_cnt; i++) {
+                                if (!gf_uuid_compare (defrag->workers[i].gfid,
+                                                      job->loc.gfid)) {
+                                        taken = _gf_true;
+                                        break;
+                                }
+                        }
+                }
+                if (taken)
+                        continue;
+
+                list_del_init (&job->list);
+                defrag->q_entries--;
+                gf_uuid_copy (worker->gfid, job->loc.gfid);
+                pthread_cond_signal (&defrag->crawler_cond);
+                return job;
+        }
+
+        return NULL;
+}
+
+static void *
+gf_defrag_worker (void *data)
+{
+        gf_defrag_worker_t      *worker = data;
+        xlator_t                *this   = NULL;
+        dht_conf_t              *conf   = NULL;
+        gf_defrag_info_t        *defrag = NULL;
+        gf_defrag_job_t         *job    = NULL;
+        gf_boolean_t             hardlinked = _gf_false;
+        int                      ret    = 0;
+
+        this = worker->this;
+        THIS = this;
+        conf = this->private;
+        defrag = conf->defrag;
+
+        /* the frames of the syncops are sent as the rebalance process */
+        syncopctx_setfspid (&defrag->pid);
+
+        for (;;) {
+                pthread_mutex_lock (&defrag->q_mutex);
+                {
+                        gf_uuid_clear (worker->gfid);
+                        /* a hardlink of the file may be waiting for it */
+                        if (hardlinked)
+                                pthread_cond_broadcast (&defrag->q_cond);
+
+                        while (!(job = __gf_defrag_job_get (defrag, worker))) {
+                                if (defrag->crawl_done && !defrag->q_entries)
+                                        break;
+                                pthread_cond_wait (&defrag->q_cond,
+                                                   &defrag->q_mutex);
+                        }
+                }
+                pthread_mutex_unlock (&defrag->q_mutex);
+
+                if (!job)
+                        break;
+
+                hardlinked = job->hardlinked;
+                if (defrag->defrag_status == GF_DEFRAG_STATUS_STARTED) {
+                        ret = gf_defrag_migrate_file (this, defrag, worker,
+                                                      job);
+                        if (ret < 0) {
+                                gf_msg (this->name, GF_LOG_ERROR, 0,
+                                        DHT_MSG_MIGRATE_DATA_FAILED,
+                                        "migration worker %d: aborting "
+                                        "rebalance", worker->id);
+                                /* the crawler may wait for room in the
+                                 * queue */
+                                pthread_mutex_lock (&defrag->q_mutex);
+                                {
+                                        defrag->defrag_status =
+                                                GF_DEFRAG_STATUS_FAILED;
+                                        pthread_cond_broadcast
+                                                (&defrag->crawler_cond);
+                                }
+                                pthread_mutex_unlock (&defrag->q_mutex);
+                        }
+                }
+
+                gf_defrag_job_free (job);
+        }
+
+        return NULL;
+}
+
+int
+gf_defrag_throttle_parse (const char *str, gf_defrag_throttle_t *throttle)
+{
+        if (!strcasecmp (str, "lazy"))
+                *throttle = GF_DEFRAG_THROTTLE_LAZY;
+        else if (!strcasecmp (str, "normal"))
+                *throttle = GF_DEFRAG_THROTTLE_NORMAL;
+        else if (!strcasecmp (str, "aggressive"))
+                *throttle = GF_DEFRAG_THROTTLE_AGGRESSIVE;
+        else
+                return -1;
+
+        return 0;
+}
+
+static uint32_t
+gf_defrag_worker_count (gf_defrag_info_t *defrag)
+{
+        long     cores = 0;
+        uint32_t count = 0;
+
+        if (defrag->threads) {
+                count = defrag->threads;
+                goto out;
+        }
+
+        cores = sysconf (_SC_NPROCESSORS_ONLN);
+
+        /* a few cores are left to the bricks and the other daemons */
+        switch (defrag->throttle) {
+        case GF_DEFRAG_THROTTLE_LAZY:
+                count = 1;
+                break;
+        case GF_DEFRAG_THROTTLE_NORMAL:
+                count = max (2, (cores - 4) / 2);
+                break;
+        case GF_DEFRAG_THROTTLE_AGGRESSIVE:
+                count = max (4, cores - 4);
+                break;
+        }
+out:
+        return min (count, GF_DEFRAG_MAX_WORKERS);
+}
+
+/* Starts the migration workers the throttle asks for, or parks the ones
+ * above it. Called when the crawl starts and on reconfigure. */
+void
+gf_defrag_set_workers (xlator_t *this, gf_defrag_info_t *defrag)
+{
+        gf_defrag_worker_t      *worker = NULL;
+        uint32_t                 count  = 0;
+        int                      ret    = 0;
+
+        count = gf_defrag_worker_count (defrag);
+
+        pthread_mutex_lock (&defrag->q_mutex);
+        {
+                /* nothing to migrate, or the crawl has already ended */
+                if (!defrag->subvol_busy || defrag->crawl_done)
+                        goto unlock;
+
+                while (defrag->worker_cnt < count) {
+                        worker = &defrag->workers[defrag->worker_cnt];
+                        worker->id = defrag->worker_cnt;
+                        worker->this = this;
+                        ret = gf_thread_create (&worker->thread, NULL,
+                                                gf_defrag_worker, worker);
+                        if (ret) {
+                                gf_msg (this->name, GF_LOG_WARNING, errno,
+                                        DHT_MSG_REBALANCE_START_FAILED,
+                                        "failed to start migration "
+                                        "worker %d", worker->id);
+                                break;
+                        }
+                        worker->started = _gf_true;
+                        defrag->worker_cnt++;
+                }
+
+                defrag->active_workers = min (count, defrag->worker_cnt);
+                pthread_cond_broadcast (&defrag->q_cond);
+
+                gf_msg (this->name, GF_LOG_INFO, 0,
+                        DHT_MSG_REBALANCE_STATUS,
+                        "%u migration workers active, %u started",
+                        defrag->active_workers, defrag->worker_cnt);
+        }
+unlock:
+        pthread_mutex_unlock (&defrag->q_mutex);
+}
+
+/* Hands a file over to the workers, waiting for room in the queue. The
+ * ref on @entry_loc is taken over. */
+static int
+gf_defrag_queue_file (gf_defrag_info_t *defrag, loc_t *entry_loc,
+                      dict_t *migrate_data, gf_boolean_t hardlinked)
+{
+        gf_defrag_job_t         *job    = NULL;
+
+        job = GF_CALLOC (1, sizeof (*job), gf_dht_mt_defrag_job_t);
+        if (!job)
+                return -1;
+
+        INIT_LIST_HEAD (&job->list);
+        job->loc = *entry_loc;
+        memset (entry_loc, 0, sizeof (*entry_loc));
+        job->migrate_data = dict_ref (migrate_data);
+        job->hardlinked = hardlinked;
+
+        pthread_mutex_lock (&defrag->q_mutex);
+        {
+                while ((defrag->q_entries >= GF_DEFRAG_QUEUE_LIMIT) &&
+                       (defrag->defrag_status == GF_DEFRAG_STATUS_STARTED))
+                        pthread_cond_wait (&defrag->crawler_cond,
+                                           &defrag->q_mutex);
+
+                list_add_tail (&job->list, &defrag->queue);
+                defrag->q_entries++;
+                pthread_cond_signal (&defrag->q_cond);
+        }
+        pthread_mutex_unlock (&defrag->q_mutex);
+
+        return 0;
+}
+
+/* Lets the workers drain the queue and waits for them, or throws the
+ * queued files away if the rebalance was stopped or failed. */
+static void
+gf_defrag_workers_stop (gf_defrag_info_t *defrag)
+{
+        gf_defrag_job_t *job = NULL;
+        gf_defrag_job_t *tmp = NULL;
+        int              i   = 0;
+
+        pthread_mutex_lock (&defrag->q_mutex);
+        {
+                defrag->crawl_done = _gf_true;
+                if (defrag->defrag_status != GF_DEFRAG_STATUS_STARTED) {
+                        list_for_each_entry_safe (job, tmp, &defrag->queue,
+                                                  list) {
+                                list_del_init (&job->list);
+                                gf_defrag_job_free (job);
+                        }
+                        defrag->q_entries = 0;
+                }
+
+                /* the parked workers drain the queue as well */
+                defrag->active_workers = defrag->worker_cnt;
+                pthread_cond_broadcast (&defrag->q_cond);
+                pthread_cond_broadcast (&defrag->subvol_cond);
+        }
+        pthread_mutex_unlock (&defrag->q_mutex);
+
+        for (i = 0; i < defrag->worker_cnt; i++) {
+                if (defrag->workers[i].started)
+                        pthread_join (defrag->workers[i].thread, NULL);
+        }
+}
+
 /* We do a depth first traversal of directories. But before we move into
- * subdirs, we complete the data migration of those directories whose layouts
- * have been fixed
+ * subdirs, we queue the files of those directories whose layouts have been
+ * fixed for the migration workers
  */
 
 int
@@ -1422,16 +2082,9 @@ gf_defrag_migrate_data (xlator_t *this, gf_defrag_info_t *defrag, loc_t *loc,
         gf_dirent_t             *entry          = NULL;
         gf_boolean_t             free_entries   = _gf_false;
         off_t                    offset         = 0;
-        dict_t                  *dict           = NULL;
-        struct iatt              iatt           = {0,};
-        int32_t                  op_errno       = 0;
-        char                    *uuid_str       = NULL;
-        uuid_t                   node_uuid      = {0,};
         struct timeval           dir_start      = {0,};
         struct timeval           end            = {0,};
         double                   elapsed        = {0,};
-        struct timeval           start          = {0,};
-        int                      loglevel       = GF_LOG_TRACE;
 
         gf_log (this->name, GF_LOG_INFO, "migrate data called on %s",
                 loc->path);
@@ -1476,11 +2129,6 @@ gf_defrag_migrate_data (xlator_t *this, gf_defrag_info_t *defrag, loc_t *loc,
 
                 list_for_each_entry_safe (entry, tmp, &entries.list, list) {
 
-                        if (dict) {
-                                dict_unref (dict);
-                                dict = NULL;
-                        }
-
                         if (defrag->defrag_status != GF_DEFRAG_STATUS_STARTED) {
                                 ret = 1;
                                 goto out;
@@ -1496,9 +2144,6 @@ gf_defrag_migrate_data (xlator_t *this, gf_defrag_info_t *defrag, loc_t *loc,
                                 continue;
 
                         defrag->num_files_lookedup++;
-                        if (defrag->stats == _gf_true) {
-                                gettimeofday (&start, NULL);
-                        }
 
                         if (defrag->defrag_pattern &&
                             (gf_defrag_pattern_match (defrag, entry->d_name,
@@ -1538,138 +2183,15 @@ gf_defrag_migrate_data (xlator_t *this, gf_defrag_info_t *defrag, loc_t *loc,
 
                         entry_loc.inode->ia_type = entry->d_stat.ia_type;
 
-                        ret = syncop_lookup (this, &entry_loc, &iatt, NULL,
-                                             NULL, NULL);
+                        ret = gf_defrag_queue_file (defrag, &entry_loc,
+                                                    migrate_data,
+                                                    (entry->d_stat.ia_nlink
+                                                     > 1));
                         if (ret) {
-                                gf_msg (this->name, GF_LOG_ERROR, 0,
-                                        DHT_MSG_MIGRATE_FILE_FAILED,
-                                        "Migrate file failed:%s lookup failed",
-                                        entry_loc.path);
-                                ret = -1;
-                                continue;
-                        }
-
-                        ret = syncop_getxattr (this, &entry_loc, &dict,
-                                               GF_XATTR_NODE_UUID_KEY, NULL,
-                                               NULL);
-                        if(ret < 0) {
-                                gf_msg (this->name, GF_LOG_ERROR, 0,
-                                        DHT_MSG_MIGRATE_FILE_FAILED,
-                                        "Migrate file failed:"
-                                        "Failed to get node-uuid for %s",
-                                        entry_loc.path);
-                                ret = -1;
-                                continue;
-                        }
-
-                        ret = dict_get_str (dict, GF_XATTR_NODE_UUID_KEY,
-                                            &uuid_str);
-                        if(ret < 0) {
                                 gf_log (this->name, GF_LOG_ERROR, "Failed to "
-                                        "get node-uuid from dict for %s",
-                                        entry_loc.path);
-                                ret = -1;
-                                continue;
-                        }
-
-                        if (gf_uuid_parse (uuid_str, node_uuid)) {
-                                gf_log (this->name, GF_LOG_ERROR, "gf_uuid_parse "
-                                        "failed for %s", entry_loc.path);
-                                continue;
-                        }
-
-                        /* if file belongs to different node, skip migration
-                         * the other node will take responsibility of migration
-                         */
-                        if (gf_uuid_compare (node_uuid, defrag->node_uuid)) {
-                                gf_msg_trace (this->name, 0, "%s does not"
-                                              "belong to this node",
-                                              entry_loc.path);
-                                continue;
-                        }
-
-                        uuid_str = NULL;
-
-                        /* if distribute is present, it will honor this key.
-                         * -1, ENODATA is returned if distribute is not present
-                         * or file doesn't have a link-file. If file has
-                         * link-file, the path of link-file will be the value,
-                         * and also that guarantees that file has to be mostly
-                         * migrated */
-
-                        ret = syncop_getxattr (this, &entry_loc, NULL,
-                                               GF_XATTR_LINKINFO_KEY, NULL,
-                                               NULL);
-                        if (ret < 0) {
-                                if (-ret != ENODATA) {
-                                        loglevel = GF_LOG_ERROR;
-                                        defrag->total_failures += 1;
-                                } else {
-                                        loglevel = GF_LOG_TRACE;
-                                }
-                                gf_log (this->name, loglevel, "%s: failed to "
-                                        "get "GF_XATTR_LINKINFO_KEY" key - %s",
-                                        entry_loc.path, strerror (-ret));
-                                ret = -1;
-                                continue;
-                        }
-
-                        ret = syncop_setxattr (this, &entry_loc, migrate_data,
-                                               0, NULL, NULL);
-                        if (ret < 0) {
-                                op_errno = -ret;
-                                /* errno is overloaded. See
-                                 * rebalance_task_completion () */
-                                if (op_errno == ENOSPC) {
-                                        gf_msg_debug (this->name, 0,
-                                                      "migrate-data skipped for"
-                                                      " %s due to space "
-                                                      "constraints",
-                                                      entry_loc.path);
-                                        defrag->skipped +=1;
-                                } else{
-                                        gf_msg (this->name, GF_LOG_ERROR, 0,
-                                                DHT_MSG_MIGRATE_FILE_FAILED,
-                                                "migrate-data failed for %s",
-                                                entry_loc.path);
-                                        defrag->total_failures +=1;
-                                }
-
-                                ret = gf_defrag_handle_migrate_error (op_errno,
-                                                                      defrag);
-
-                                if (!ret)
-                                        gf_msg_debug (this->name, 0,
-                                                      "migrate-data on %s "
-                                                      "failed: %s",
-                                                      entry_loc.path,
-                                                      strerror (op_errno));
-                                else if (ret == 1)
-                                        continue;
-                                else if (ret == -1)
-                                        goto out;
-                        } else if (ret > 0) {
-                                gf_msg (this->name, GF_LOG_ERROR, 0,
-                                        DHT_MSG_MIGRATE_FILE_FAILED,
-                                        "migrate-data failed for %s",
+                                        "queue %s for migration",
                                         entry_loc.path);
-                                defrag->total_failures +=1;
-                        }
-
-                        LOCK (&defrag->lock);
-                        {
-                                defrag->total_files += 1;
-                                defrag->total_data += iatt.ia_size;
-                        }
-                        UNLOCK (&defrag->lock);
-                        if (defrag->stats == _gf_true) {
-                                gettimeofday (&end, NULL);
-                                elapsed = (end.tv_sec - start.tv_sec) * 1e6 +
-                                          (end.tv_usec - start.tv_usec);
-                                gf_log (this->name, GF_LOG_INFO, "Migration of "
-                                        "file:%s size:%"PRIu64" bytes took %.2f"
-                                        "secs", entry_loc.path, iatt.ia_size,
-                                         elapsed/1e6);
+                                goto out;
                         }
                 }
 
@@ -1681,7 +2203,7 @@ gf_defrag_migrate_data (xlator_t *this, gf_defrag_info_t *defrag, loc_t *loc,
         gettimeofday (&end, NULL);
         elapsed = (end.tv_sec - dir_start.tv_sec) * 1e6 +
                   (end.tv_usec - dir_start.tv_usec);
-        gf_log (this->name, GF_LOG_INFO, "Migration operation on dir %s took "
+        gf_log (this->name, GF_LOG_INFO, "Crawling dir %s for migration took "
                 "%.2f secs", loc->path, elapsed/1e6);
         ret = 0;
 out:
@@ -1690,9 +2212,6 @@ out:
 
         loc_wipe (&entry_loc);
 
-        if (dict)
-                dict_unref(dict);
-
         if (fd)
                 fd_unref (fd);
         return ret;
@@ -1971,9 +2490,33 @@ gf_defrag_start_crawl (void *data)
                         goto out;
         }
 
+        if (migrate_data) {
+                defrag->subvol_busy = GF_CALLOC (conf->subvolume_cnt,
+                                                 sizeof (int32_t),
+                                                 gf_dht_mt_int32_t);
+                if (!defrag->subvol_busy) {
+                        ret = -1;
+                        goto out;
+                }
+                gf_defrag_set_workers (this, defrag);
+
+                /* nobody would take the queued files */
+                if (!defrag->worker_cnt) {
+                        gf_msg (this->name, GF_LOG_ERROR, 0,
+                                DHT_MSG_REBALANCE_START_FAILED,
+                                "no migration worker could be started");
+                        defrag->defrag_status = GF_DEFRAG_STATUS_FAILED;
+                        ret = -1;
+                        goto out;
+                }
+        }
+
         ret = gf_defrag_fix_layout (this, defrag, &loc, fix_layout,
                                     migrate_data);
 
+        if (migrate_data)
+                gf_defrag_workers_stop (defrag);
+
         if (defrag->cmd == GF_DEFRAG_CMD_START_TIER) {
                 methods = conf->methods;
                 if (!methods) {
@@ -2006,6 +2549,11 @@ out:
         UNLOCK (&defrag->lock);
 
         if (defrag) {
+                GF_FREE (defrag->subvol_busy);
+                pthread_mutex_destroy (&defrag->q_mutex);
+                pthread_cond_destroy (&defrag->q_cond);
+                pthread_cond_destroy (&defrag->crawler_cond);
+                pthread_cond_destroy (&defrag->subvol_cond);
                 GF_FREE (defrag);
                 conf->defrag = NULL;
         }
@@ -2068,6 +2616,46 @@ out:
         return NULL;
 }
 
+/* One line per migration worker with its throughput over the run time,
+ * as shown by 'rebalance status'. */
+static char *
+gf_defrag_workers_str (gf_defrag_info_t *defrag, double elapsed)
+{
+        gf_defrag_worker_t *worker = NULL;
+        char               *str    = NULL;
+        char               *size   = NULL;
+        size_t              len    = 0;
+        size_t              off    = 0;
+        int                 i      = 0;
+
+        if (!defrag->worker_cnt)
+                return NULL;
+
+        len = defrag->worker_cnt * 128;
+        str = GF_CALLOC (1, len, gf_common_mt_char);
+        if (!str)
+                return NULL;
+
+        for (i = 0; i < defrag->worker_cnt; i++) {
+                worker = &defrag->workers[i];
+                size = gf_uint64_2human_readable (worker->data);
+                off += snprintf (str + off, len - off, "%sworker %d: %"PRIu64
+                                 " files, %s, %.2f files/sec, %.2f MB/sec%s",
+                                 off ? "\n" : "", i, worker->files,
+                                 size ? size : "0Bytes",
+                                 elapsed ? worker->files / elapsed : 0,
+                                 elapsed ?
+                                 worker->data / elapsed / 1048576 : 0,
+                                 (i >= defrag->active_workers) ?
+                                 " (parked)" : "");
+                GF_FREE (size);
+                if (off >= len)
+                        break;
+        }
+
+        return str;
+}
+
 int
 gf_defrag_status_get (gf_defrag_info_t *defrag, dict_t *dict)
 {
@@ -2080,6 +2668,9 @@ gf_defrag_status_get (gf_defrag_info_t *defrag, dict_t *dict)
         char     *status = "";
         double   elapsed = 0;
         struct timeval end = {0,};
+        char     *workers = NULL;
+        gf_defrag_worker_t *worker = NULL;
+        int      i = 0;
 
 
         if (!defrag)
@@ -2138,6 +2729,16 @@ gf_defrag_status_get (gf_defrag_info_t *defrag, dict_t *dict)
         if (ret)
                 gf_log (THIS->name, GF_LOG_WARNING,
                         "failed to set skipped file count");
+
+        workers = gf_defrag_workers_str (defrag, elapsed);
+        if (workers) {
+                ret = dict_set_dynstr (dict, "workers", workers);
+                if (ret) {
+                        gf_log (THIS->name, GF_LOG_WARNING,
+                                "failed to set worker throughput");
+                        GF_FREE (workers);
+                }
+        }
 log:
         switch (defrag->defrag_status) {
         case GF_DEFRAG_STATUS_NOT_STARTED:
@@ -2167,6 +2768,13 @@ log:
                 PRIu64", lookups: %"PRIu64", failures: %"PRIu64", skipped: "
                 "%"PRIu64, files, size, lookup, failures, skipped);
 
+        for (i = 0; i < defrag->worker_cnt; i++) {
+                worker = &defrag->workers[i];
+                gf_msg (THIS->name, GF_LOG_INFO, 0, DHT_MSG_REBALANCE_STATUS,
+                        "Migration worker %d: files: %"PRIu64", size: %"
+                        PRIu64", busy: %.2f secs", i, worker->files,
+                        worker->data, worker->busy);
+        }
 
 out:
         return 0;
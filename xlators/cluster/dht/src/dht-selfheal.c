@@ -21,6 +21,7 @@
 #include "glusterfs-acl.h"
 
 #define DHT_SET_LAYOUT_RANGE(layout,i,srt,chunk,path)    do {           \
+                DHT_LAYOUT_RANGES_CHANGING (layout);                    \
                 layout->list[i].start = srt;                            \
                 layout->list[i].stop  = srt + chunk - 1;                \
                                                                         \
@@ -33,6 +34,7 @@
 
 #define DHT_RESET_LAYOUT_RANGE(layout)    do {                          \
                 int cnt = 0;                                            \
+                DHT_LAYOUT_RANGES_CHANGING (layout);                    \
                 for (cnt = 0; cnt < layout->cnt; cnt++ ) {              \
                         layout->list[cnt].start = 0;                    \
                         layout->list[cnt].stop  = 0;                    \
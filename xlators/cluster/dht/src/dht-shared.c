@@ -313,9 +313,42 @@ out:
 
         return ret;
 }
+/* The character every match has to start with, for patterns anchored on a
+ * literal like the default rsync one; 0 when it cannot be told. Lets
+ * dht_hash_compute skip regexec for most names.
+ */
+static char
+dht_regex_lead (const char *pattern)
+{
+        char        lead = 0;
+        const char *next = NULL;
+
+        if ((pattern[0] != '^') || strchr (pattern, '|'))
+                return 0;
+
+        if (pattern[1] == '\\') {
+                /* only escaped punctuation is a literal */
+                if (!pattern[2] || isalnum ((unsigned char)pattern[2]))
+                        return 0;
+                lead = pattern[2];
+                next = pattern + 3;
+        } else {
+                if (!pattern[1] || strchr (".[]()*+?{}^$", pattern[1]))
+                        return 0;
+                lead = pattern[1];
+                next = pattern + 2;
+        }
+
+        /* the literal must not be optional */
+        if ((*next == '*') || (*next == '?') || (*next == '{'))
+                return 0;
+
+        return lead;
+}
+
 void
 dht_init_regex (xlator_t *this, dict_t *odict, char *name,
-                regex_t *re, gf_boolean_t *re_valid)
+                regex_t *re, gf_boolean_t *re_valid, char *re_lead)
 {
         char    *temp_str;
 
@@ -330,6 +363,7 @@ dht_init_regex (xlator_t *this, dict_t *odict, char *name,
                 regfree(re);
                 *re_valid = _gf_false;
         }
+        *re_lead = 0;
 
         if (!strcmp(temp_str,"none")) {
                 return;
@@ -339,6 +373,7 @@ dht_init_regex (xlator_t *this, dict_t *odict, char *name,
                 gf_log (this->name, GF_LOG_DEBUG,
                         "using regex %s = %s", name, temp_str);
                 *re_valid = _gf_true;
+                *re_lead = dht_regex_lead (temp_str);
         }
         else {
                 gf_log (this->name, GF_LOG_WARNING,
@@ -422,6 +457,8 @@ dht_reconfigure (xlator_t *this, dict_t *options)
 
         GF_OPTION_RECONF ("readdir-optimize", conf->readdir_optimize, options,
                           bool, out);
+        GF_OPTION_RECONF ("parallel-readdir", conf->parallel_readdir,
+                          options, bool, out);
         GF_OPTION_RECONF ("randomize-hash-range-by-gfid",
                           conf->randomize_by_gfid,
                           options, bool, out);
@@ -429,6 +466,18 @@ dht_reconfigure (xlator_t *this, dict_t *options)
         if (conf->defrag) {
                 GF_OPTION_RECONF ("rebalance-stats", conf->defrag->stats,
                                   options, bool, out);
+
+                GF_OPTION_RECONF ("rebalance-throttle", temp_str, options,
+                                  str, out);
+                if (gf_defrag_throttle_parse (temp_str,
+                                              &conf->defrag->throttle))
+                        goto out;
+                GF_OPTION_RECONF ("rebalance-threads", conf->defrag->threads,
+                                  options, uint32, out);
+                GF_OPTION_RECONF ("rebalance-subvol-limit",
+                                  conf->defrag->subvol_limit, options, uint32,
+                                  out);
+                gf_defrag_set_workers (this, conf->defrag);
         }
 
         if (dict_get_str (options, "decommissioned-bricks", &temp_str) == 0) {
@@ -442,9 +491,11 @@ dht_reconfigure (xlator_t *this, dict_t *options)
         }
 
         dht_init_regex (this, options, "rsync-hash-regex",
-                        &conf->rsync_regex, &conf->rsync_regex_valid);
+                        &conf->rsync_regex, &conf->rsync_regex_valid,
+                        &conf->rsync_regex_lead);
         dht_init_regex (this, options, "extra-hash-regex",
-                        &conf->extra_regex, &conf->extra_regex_valid);
+                        &conf->extra_regex, &conf->extra_regex_valid,
+                        &conf->extra_regex_lead);
 
         GF_OPTION_RECONF ("weighted-rebalance", conf->do_weighting, options,
                           bool, out);
@@ -566,6 +617,12 @@ dht_init (xlator_t *this)
 
                 LOCK_INIT (&defrag->lock);
 
+                INIT_LIST_HEAD (&defrag->queue);
+                pthread_mutex_init (&defrag->q_mutex, NULL);
+                pthread_cond_init (&defrag->q_cond, NULL);
+                pthread_cond_init (&defrag->crawler_cond, NULL);
+                pthread_cond_init (&defrag->subvol_cond, NULL);
+
                 defrag->is_exiting = 0;
 
                 conf->defrag = defrag;
@@ -624,8 +681,24 @@ dht_init (xlator_t *this)
 
         GF_OPTION_INIT ("readdir-optimize", conf->readdir_optimize, bool, err);
 
+        GF_OPTION_INIT ("parallel-readdir", conf->parallel_readdir, bool, err);
+
         if (defrag) {
                 GF_OPTION_INIT ("rebalance-stats", defrag->stats, bool, err);
+
+                GF_OPTION_INIT ("rebalance-throttle", temp_str, str, err);
+                if (gf_defrag_throttle_parse (temp_str, &defrag->throttle)) {
+                        gf_msg (this->name, GF_LOG_ERROR, 0,
+                                DHT_MSG_INVALID_OPTION,
+                                "Invalid option: rebalance-throttle %s",
+                                temp_str);
+                        goto err;
+                }
+                GF_OPTION_INIT ("rebalance-threads", defrag->threads, uint32,
+                                err);
+                GF_OPTION_INIT ("rebalance-subvol-limit", defrag->subvol_limit,
+                                uint32, err);
+
                 if (dict_get_str (this->options, "rebalance-filter", &temp_str)
                     == 0) {
                         if (gf_defrag_pattern_list_fill (this, defrag, temp_str)
@@ -658,9 +731,11 @@ dht_init (xlator_t *this)
         }
 
         dht_init_regex (this, this->options, "rsync-hash-regex",
-                        &conf->rsync_regex, &conf->rsync_regex_valid);
+                        &conf->rsync_regex, &conf->rsync_regex_valid,
+                        &conf->rsync_regex_lead);
         dht_init_regex (this, this->options, "extra-hash-regex",
-                        &conf->extra_regex, &conf->extra_regex_valid);
+                        &conf->extra_regex, &conf->extra_regex_valid,
+                        &conf->extra_regex_lead);
 
         ret = dht_layouts_init (this, conf);
         if (ret == -1) {
@@ -809,6 +884,31 @@ struct volume_options options[] = {
           "process. If set to OFF, the rebalance logs will only display the "
           "time spent in each directory."
         },
+        { .key = {"rebalance-throttle"},
+          .type = GF_OPTION_TYPE_STR,
+          .default_value = "normal",
+          .value = { "lazy", "normal", "aggressive" },
+          .description = "Sets the number of files migrated in parallel by "
+          "a rebalance process. 'lazy' migrates one file at a time, "
+          "'normal' and 'aggressive' use more migration workers on nodes "
+          "with more cores."
+        },
+        { .key = {"rebalance-threads"},
+          .type = GF_OPTION_TYPE_INT,
+          .min  = 0,
+          .max  = GF_DEFRAG_MAX_WORKERS,
+          .default_value = "0",
+          .description = "Number of migration workers of a rebalance "
+          "process. If 0, it is derived from rebalance-throttle."
+        },
+        { .key = {"rebalance-subvol-limit"},
+          .type = GF_OPTION_TYPE_INT,
+          .min  = 0,
+          .max  = GF_DEFRAG_MAX_WORKERS,
+          .default_value = "2",
+          .description = "Maximum number of files a rebalance process "
+          "migrates at once from or to one subvolume, 0 for no limit."
+        },
         { .key = {"readdir-optimize"},
           .type = GF_OPTION_TYPE_BOOL,
           .default_value = "off",
@@ -816,6 +916,13 @@ struct volume_options options[] = {
           "that allows DHT to requests non-first subvolumes to filter out "
           "directory entries."
         },
+        { .key = {"parallel-readdir"},
+          .type = GF_OPTION_TYPE_BOOL,
+          .default_value = "off",
+          .description = "Set by volgen when a readdir-ahead is loaded on "
+          "top of each subvolume. DHT then requests the linkto xattr at "
+          "opendir, so that the prefetched entries can be filtered."
+        },
         { .key = {"rsync-hash-regex"},
           .type = GF_OPTION_TYPE_STR,
           /* Setting a default here doesn't work.  See dht_init_regex. */
@@ -58,6 +58,7 @@ struct xlator_fops fops = {
         .getxattr    = dht_getxattr,
         .fgetxattr    = dht_fgetxattr,
         .readv       = dht_readv,
+        .seek        = dht_seek,
         .flush       = dht_flush,
         .fsync       = dht_fsync,
         .inodelk     = dht_inodelk,
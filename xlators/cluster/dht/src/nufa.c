@@ -651,6 +651,7 @@ struct xlator_fops fops = {
         .removexattr = dht_removexattr,
         .open        = dht_open,
         .readv       = dht_readv,
+        .seek        = dht_seek,
         .writev      = dht_writev,
         .flush       = dht_flush,
         .fsync       = dht_fsync,
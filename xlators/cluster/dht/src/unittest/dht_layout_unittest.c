@@ -115,9 +115,80 @@ test_dht_layout_new(void **state)
     helper_xlator_destroy(xl);
 }
 
+static void
+helper_layout_fill(dht_layout_t *layout, xlator_t *subvols, int cnt)
+{
+    uint32_t chunk = 0xffffffff / cnt;
+    int i;
+
+    // handed out in reverse, as a merge from disk would leave them
+    for (i = 0; i < cnt; i++) {
+            layout->list[cnt - 1 - i].start = i * chunk;
+            layout->list[cnt - 1 - i].stop = (i == cnt - 1) ?
+                    0xffffffff : (i + 1) * chunk - 1;
+            layout->list[cnt - 1 - i].xlator = &subvols[i];
+    }
+}
+
+static void
+test_dht_layout_table(void **state)
+{
+    xlator_t *xl;
+    xlator_t subvols[16];
+    dht_layout_t *layout;
+    char name[32];
+    uint32_t hash;
+    int i, cnt;
+
+    xl = helper_xlator_init(10);
+    cnt = 16;
+    layout = dht_layout_new(xl, cnt);
+    assert_non_null(layout);
+    helper_layout_fill(layout, subvols, cnt);
+
+    assert_int_equal(dht_layout_table_build(xl, layout), 0);
+    assert_non_null(layout->table);
+    assert_int_equal(layout->table->cnt, cnt);
+
+    // the table agrees with the list at every range boundary
+    for (i = 0; i < cnt; i++) {
+            hash = layout->list[i].start;
+            if (hash) {
+                    snprintf(name, sizeof(name), "%u", hash);
+                    assert_ptr_equal(dht_layout_search(xl, layout, name),
+                                     layout->list[i].xlator);
+            }
+            snprintf(name, sizeof(name), "%u", layout->list[i].stop);
+            assert_ptr_equal(dht_layout_search(xl, layout, name),
+                             layout->list[i].xlator);
+    }
+
+    // sorting marks the table stale, the list is searched again
+    dht_layout_sort(layout);
+    assert_true(layout->table_stale);
+    for (i = 1; i < cnt; i++)
+            assert_true(layout->list[i - 1].start < layout->list[i].start);
+    snprintf(name, sizeof(name), "%u", 0xffffffff);
+    assert_ptr_equal(dht_layout_search(xl, layout, name), &subvols[cnt - 1]);
+    free(layout->table);
+    free(layout);
+
+    // overlapping ranges keep walking the list
+    layout = dht_layout_new(xl, cnt);
+    assert_non_null(layout);
+    helper_layout_fill(layout, subvols, cnt);
+    layout->list[3].stop = layout->list[2].start + 1;
+    assert_int_equal(dht_layout_table_build(xl, layout), -1);
+    assert_null(layout->table);
+    free(layout);
+
+    helper_xlator_destroy(xl);
+}
+
 int main(void) {
     const struct CMUnitTest xlator_dht_layout_tests[] = {
         unit_test(test_dht_layout_new),
+        unit_test(test_dht_layout_table),
     };
 
     return cmocka_run_group_tests(xlator_dht_layout_tests, NULL, NULL);
@@ -775,8 +775,9 @@ void ec_lookup_rebuild(ec_t * ec, ec_fop_data_t * fop, ec_cbk_data_t * cbk)
                 buff = GF_MALLOC(size * ec->fragments, gf_common_mt_char);
                 if (buff != NULL)
                 {
-                    size = ec_method_decode(size, ec->fragments, values,
-                                            blocks, buff);
+                    size = ec_method_decode(&ec->matrices, size,
+                                            ec->fragments, values, blocks,
+                                            buff);
                     if (size > fop->size)
                     {
                         size = fop->size;
@@ -0,0 +1,24 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#include <inttypes.h>
+
+#include "ec-gf.h"
+
+#ifdef EC_GF_SIMD_X86
+
+#pragma GCC target ("avx2")
+
+#define EC_GF_VECTOR_SIZE  32
+#define EC_GF_MULADD_TABLE ec_gf_muladd_avx2
+
+#include "ec-gf.c"
+
+#endif /* EC_GF_SIMD_X86 */
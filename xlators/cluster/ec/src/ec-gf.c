@@ -13,6 +13,24 @@
 
 #include "ec-gf.h"
 
+/* The bit-sliced kernels below operate on uint64_t words by default. The
+ * ec-gf-<extension>.c files include this file again after defining
+ * EC_GF_VECTOR_SIZE and EC_GF_MULADD_TABLE, so that the very same code is
+ * compiled for wider vector registers. The layout of the data is the same
+ * in all cases: each of the 8 bit planes of a chunk is 'width' uint64_t
+ * words long, and vector variants just process several words at once. */
+#ifndef EC_GF_VECTOR_SIZE
+#define EC_GF_GENERIC
+#define EC_GF_VECTOR_SIZE  8
+#define EC_GF_MULADD_TABLE ec_gf_muladd_generic
+typedef uint64_t ec_gf_word_t;
+#else
+typedef uint64_t ec_gf_word_t __attribute__ ((vector_size (EC_GF_VECTOR_SIZE),
+                                              aligned (8)));
+#endif
+
+#define EC_GF_WORDS(width) ((width) * sizeof(uint64_t) / EC_GF_VECTOR_SIZE)
+
 static void gf8_muladd_00(uint8_t * out, uint8_t * in, unsigned int width)
 {
     memcpy(out, in, sizeof(uint64_t) * 8 * width);
@@ -21,8 +39,10 @@ static void gf8_muladd_00(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_01(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
@@ -43,21 +63,23 @@ static void gf8_muladd_01(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_02(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in7;
         out1 = in0;
@@ -85,22 +107,24 @@ static void gf8_muladd_02(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_03(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in0 ^ in7;
         tmp0 = in2 ^ in7;
@@ -129,22 +153,24 @@ static void gf8_muladd_03(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_04(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in6;
         out1 = in7;
@@ -173,21 +199,23 @@ static void gf8_muladd_04(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_05(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in0 ^ in6;
         out1 = in1 ^ in7;
@@ -215,22 +243,24 @@ static void gf8_muladd_05(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_06(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in6 ^ in7;
         tmp0 = in1 ^ in6;
@@ -259,22 +289,24 @@ static void gf8_muladd_06(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_07(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in6;
         tmp1 = in5 ^ in6;
@@ -306,21 +338,23 @@ static void gf8_muladd_07(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_08(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in5;
         out1 = in6;
@@ -348,22 +382,24 @@ static void gf8_muladd_08(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_09(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in0 ^ in5;
         tmp0 = in3 ^ in6;
@@ -392,21 +428,23 @@ static void gf8_muladd_09(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_0A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in5 ^ in7;
         out1 = in0 ^ in6;
@@ -434,22 +472,24 @@ static void gf8_muladd_0A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_0B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in0 ^ in6;
@@ -480,22 +520,24 @@ static void gf8_muladd_0B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_0C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in5 ^ in6;
         out1 = in6 ^ in7;
@@ -525,22 +567,24 @@ static void gf8_muladd_0C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_0D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in5;
         tmp1 = in5 ^ in6;
@@ -571,22 +615,24 @@ static void gf8_muladd_0D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_0E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in2 ^ in5;
@@ -618,22 +664,24 @@ static void gf8_muladd_0E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_0F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in6 ^ in7;
         tmp1 = tmp0 ^ in1;
@@ -665,22 +713,24 @@ static void gf8_muladd_0F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_10(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in4;
         out1 = in5;
@@ -710,21 +760,23 @@ static void gf8_muladd_10(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_11(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out7 = in3;
         out0 = in0 ^ in4;
@@ -752,22 +804,24 @@ static void gf8_muladd_11(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_12(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in4 ^ in7;
         out1 = in0 ^ in5;
@@ -797,22 +851,24 @@ static void gf8_muladd_12(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_13(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out7 = in3 ^ in6;
         tmp0 = in0 ^ in5;
@@ -842,22 +898,24 @@ static void gf8_muladd_13(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_14(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in4 ^ in6;
         out1 = in5 ^ in7;
@@ -887,22 +945,24 @@ static void gf8_muladd_14(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_15(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out7 = in3 ^ in5;
         tmp0 = in0 ^ in4;
@@ -931,22 +991,24 @@ static void gf8_muladd_15(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_16(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in4 ^ in7;
@@ -978,22 +1040,24 @@ static void gf8_muladd_16(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_17(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in3 ^ in6;
@@ -1025,22 +1089,24 @@ static void gf8_muladd_17(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_18(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in4 ^ in5;
         out1 = in5 ^ in6;
@@ -1070,22 +1136,24 @@ static void gf8_muladd_18(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_19(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in1 ^ in2;
         out7 = in3 ^ in4;
@@ -1115,22 +1183,24 @@ static void gf8_muladd_19(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_1A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in5;
         tmp1 = in5 ^ in6;
@@ -1162,22 +1232,24 @@ static void gf8_muladd_1A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_1B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = in2 ^ in5;
@@ -1210,22 +1282,24 @@ static void gf8_muladd_1B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_1C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in4 ^ in6;
@@ -1258,22 +1332,24 @@ static void gf8_muladd_1C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_1D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in0 ^ in4;
@@ -1306,22 +1382,24 @@ static void gf8_muladd_1D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_1E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in4;
         tmp1 = in2 ^ in7;
@@ -1353,22 +1431,24 @@ static void gf8_muladd_1E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_1F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in6;
         tmp1 = tmp0 ^ in5;
@@ -1398,22 +1478,24 @@ static void gf8_muladd_1F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_20(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in4;
         out0 = in3 ^ in7;
@@ -1443,22 +1525,24 @@ static void gf8_muladd_20(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_21(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in1 ^ in4;
         tmp0 = in4 ^ in6;
@@ -1487,21 +1571,23 @@ static void gf8_muladd_21(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_22(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in3;
         out1 = in0 ^ in4;
@@ -1529,21 +1615,23 @@ static void gf8_muladd_22(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_23(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out7 = in2;
         out0 = in0 ^ in3;
@@ -1571,22 +1659,24 @@ static void gf8_muladd_23(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_24(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in4 ^ in7;
         tmp0 = in3 ^ in4;
@@ -1616,22 +1706,24 @@ static void gf8_muladd_24(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_25(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in1 ^ in4;
         tmp0 = in2 ^ in5;
@@ -1660,22 +1752,24 @@ static void gf8_muladd_25(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_26(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in3 ^ in6;
         tmp0 = in4 ^ in7;
@@ -1706,21 +1800,23 @@ static void gf8_muladd_26(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_27(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out7 = in2 ^ in5;
         out0 = in0 ^ in3 ^ in6;
@@ -1748,22 +1844,24 @@ static void gf8_muladd_27(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_28(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in3;
         out1 = in4 ^ in6;
@@ -1794,22 +1892,24 @@ static void gf8_muladd_28(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_29(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in2 ^ in3;
         tmp0 = in1 ^ in3;
@@ -1840,22 +1940,24 @@ static void gf8_muladd_29(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_2A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in3 ^ in5;
         tmp0 = in1 ^ in3;
@@ -1885,22 +1987,24 @@ static void gf8_muladd_2A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_2B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in1 ^ in6;
         out7 = in2 ^ in4;
@@ -1930,22 +2034,24 @@ static void gf8_muladd_2B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_2C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in2 ^ in3 ^ in4;
@@ -1977,22 +2083,24 @@ static void gf8_muladd_2C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_2D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         out4 = tmp0 ^ in1;
@@ -2024,22 +2132,24 @@ static void gf8_muladd_2D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_2E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in7;
         out0 = in3 ^ in5 ^ in6;
@@ -2070,22 +2180,24 @@ static void gf8_muladd_2E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_2F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in2 ^ in5;
@@ -2116,22 +2228,24 @@ static void gf8_muladd_2F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_30(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in4 ^ in5;
         tmp0 = in3 ^ in6;
@@ -2161,22 +2275,24 @@ static void gf8_muladd_30(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_31(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in5 ^ in6;
         tmp0 = in4 ^ in5;
@@ -2207,22 +2323,24 @@ static void gf8_muladd_31(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_32(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in3 ^ in4;
         out7 = in2 ^ in3;
@@ -2252,22 +2370,24 @@ static void gf8_muladd_32(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_33(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in0 ^ in4;
@@ -2300,22 +2420,24 @@ static void gf8_muladd_33(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_34(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in4 ^ in5;
@@ -2348,22 +2470,24 @@ static void gf8_muladd_34(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_35(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in6;
         tmp1 = in5 ^ in7;
@@ -2394,22 +2518,24 @@ static void gf8_muladd_35(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_36(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in0 ^ in2;
         tmp0 = in1 ^ in3;
@@ -2439,22 +2565,24 @@ static void gf8_muladd_36(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_37(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in4;
@@ -2486,22 +2614,24 @@ static void gf8_muladd_37(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_38(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in0 ^ in3;
         tmp0 = in3 ^ in4;
@@ -2532,22 +2662,24 @@ static void gf8_muladd_38(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_39(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in0;
         tmp0 = in1 ^ in5;
@@ -2578,22 +2710,24 @@ static void gf8_muladd_39(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_3A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in0 ^ in2;
@@ -2627,22 +2761,24 @@ static void gf8_muladd_3A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_3B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in6;
         tmp1 = in2 ^ in7;
@@ -2673,22 +2809,24 @@ static void gf8_muladd_3B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_3C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in2 ^ in7;
@@ -2719,22 +2857,24 @@ static void gf8_muladd_3C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_3D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = tmp0 ^ in3;
@@ -2765,22 +2905,24 @@ static void gf8_muladd_3D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_3E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = tmp0 ^ in4;
@@ -2810,22 +2952,24 @@ static void gf8_muladd_3E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_3F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         out3 = tmp0 ^ in2 ^ in6;
@@ -2856,22 +3000,24 @@ static void gf8_muladd_3F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_40(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in3 ^ in7;
         tmp0 = in3 ^ in4;
@@ -2901,22 +3047,24 @@ static void gf8_muladd_40(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_41(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in2 ^ in3;
         tmp0 = in5 ^ in6;
@@ -2946,21 +3094,23 @@ static void gf8_muladd_41(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_42(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in2 ^ in6;
         out5 = in3 ^ in5;
@@ -2988,21 +3138,23 @@ static void gf8_muladd_42(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_43(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in3;
         out7 = in1 ^ in5;
@@ -3030,22 +3182,24 @@ static void gf8_muladd_43(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_44(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in3;
         out0 = in2 ^ in7;
@@ -3074,21 +3228,23 @@ static void gf8_muladd_44(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_45(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in1 ^ in3;
         out7 = in1 ^ in6;
@@ -3116,21 +3272,23 @@ static void gf8_muladd_45(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_46(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in2;
         out1 = in0 ^ in3;
@@ -3158,22 +3316,24 @@ static void gf8_muladd_46(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_47(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in6;
         out7 = in1;
@@ -3202,22 +3362,24 @@ static void gf8_muladd_47(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_48(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         out1 = in3 ^ in6 ^ in7;
@@ -3247,22 +3409,24 @@ static void gf8_muladd_48(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_49(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in0 ^ in2;
         tmp0 = in2 ^ in5;
@@ -3292,22 +3456,24 @@ static void gf8_muladd_49(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_4A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in6;
         tmp1 = in3 ^ in7;
@@ -3337,22 +3503,24 @@ static void gf8_muladd_4A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_4B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in0 ^ in7;
         tmp0 = in1 ^ in5;
@@ -3384,22 +3552,24 @@ static void gf8_muladd_4B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_4C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in3 ^ in6;
         tmp0 = in2 ^ in5;
@@ -3430,22 +3600,24 @@ static void gf8_muladd_4C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_4D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in1 ^ in6;
@@ -3476,21 +3648,23 @@ static void gf8_muladd_4D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_4E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in2 ^ in5;
         out7 = in1 ^ in4 ^ in7;
@@ -3518,21 +3692,23 @@ static void gf8_muladd_4E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_4F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in2 ^ in6;
         out7 = in1 ^ in4;
@@ -3560,22 +3736,24 @@ static void gf8_muladd_4F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_50(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in2 ^ in7;
         tmp0 = in3 ^ in5;
@@ -3606,21 +3784,23 @@ static void gf8_muladd_50(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_51(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in7;
         out3 = in2 ^ in4 ^ in6 ^ in7;
@@ -3648,22 +3828,24 @@ static void gf8_muladd_51(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_52(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in1 ^ in2;
         tmp0 = in2 ^ in4;
@@ -3695,21 +3877,23 @@ static void gf8_muladd_52(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_53(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in1;
         out3 = in4 ^ in6;
@@ -3737,22 +3921,24 @@ static void gf8_muladd_53(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_54(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in3 ^ in5;
         tmp0 = in1 ^ in3;
@@ -3784,22 +3970,24 @@ static void gf8_muladd_54(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_55(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in1 ^ in4;
@@ -3830,22 +4018,24 @@ static void gf8_muladd_55(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_56(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in2 ^ in4;
         tmp0 = in0 ^ in2;
@@ -3874,22 +4064,24 @@ static void gf8_muladd_56(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_57(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in1 ^ in7;
@@ -3919,22 +4111,24 @@ static void gf8_muladd_57(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_58(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in2 ^ in5;
         tmp0 = in2 ^ in3 ^ in4;
@@ -3964,22 +4158,24 @@ static void gf8_muladd_58(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_59(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in5;
         tmp0 = in0 ^ in5 ^ in7;
@@ -4009,22 +4205,24 @@ static void gf8_muladd_59(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_5A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in5;
@@ -4055,22 +4253,24 @@ static void gf8_muladd_5A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_5B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in0 ^ in4;
@@ -4103,22 +4303,24 @@ static void gf8_muladd_5B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_5C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in6;
         tmp1 = in0 ^ in2 ^ in5;
@@ -4149,22 +4351,24 @@ static void gf8_muladd_5C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_5D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in0 ^ in6;
@@ -4197,22 +4401,24 @@ static void gf8_muladd_5D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_5E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = in3 ^ in5;
@@ -4245,22 +4451,24 @@ static void gf8_muladd_5E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_5F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in5;
         tmp1 = in0 ^ in6;
@@ -4292,22 +4500,24 @@ static void gf8_muladd_5F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_60(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in2 ^ in5;
         tmp0 = in3 ^ in6;
@@ -4337,22 +4547,24 @@ static void gf8_muladd_60(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_61(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in5;
         out4 = tmp0 ^ in4;
@@ -4382,22 +4594,24 @@ static void gf8_muladd_61(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_62(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in4 ^ in5;
         tmp0 = in0 ^ in3 ^ in4;
@@ -4429,22 +4643,24 @@ static void gf8_muladd_62(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_63(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in1 ^ in7;
@@ -4477,22 +4693,24 @@ static void gf8_muladd_63(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_64(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in2 ^ in3;
         out1 = in3 ^ in4;
@@ -4522,22 +4740,24 @@ static void gf8_muladd_64(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_65(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in4 ^ in5;
@@ -4569,22 +4789,24 @@ static void gf8_muladd_65(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_66(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in3;
@@ -4617,22 +4839,24 @@ static void gf8_muladd_66(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_67(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = tmp0 ^ in1;
@@ -4664,22 +4888,24 @@ static void gf8_muladd_67(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_68(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in2 ^ in3 ^ in5;
@@ -4711,22 +4937,24 @@ static void gf8_muladd_68(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_69(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in6 ^ in7;
         out2 = tmp0 ^ in3 ^ in4;
@@ -4755,22 +4983,24 @@ static void gf8_muladd_69(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_6A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in6;
         out3 = in0 ^ in4 ^ in6;
@@ -4801,22 +5031,24 @@ static void gf8_muladd_6A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_6B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in6;
         out2 = tmp0 ^ in1 ^ in3;
@@ -4846,22 +5078,24 @@ static void gf8_muladd_6B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_6C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in1;
         tmp0 = in2 ^ in3;
@@ -4891,22 +5125,24 @@ static void gf8_muladd_6C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_6D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in1 ^ in4;
         tmp0 = in0 ^ in2;
@@ -4936,22 +5172,24 @@ static void gf8_muladd_6D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_6E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in0 ^ in4;
@@ -4982,22 +5220,24 @@ static void gf8_muladd_6E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_6F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in7;
         tmp1 = tmp0 ^ in4;
@@ -5028,22 +5268,24 @@ static void gf8_muladd_6F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_70(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in2;
         tmp0 = in2 ^ in4;
@@ -5074,22 +5316,24 @@ static void gf8_muladd_70(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_71(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in3 ^ in5;
         out3 = in2 ^ in3;
@@ -5120,22 +5364,24 @@ static void gf8_muladd_71(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_72(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in7;
         tmp0 = in0 ^ in4;
@@ -5166,21 +5412,23 @@ static void gf8_muladd_72(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_73(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in3 ^ in7;
         out2 = out3 ^ in1 ^ in5;
@@ -5208,22 +5456,24 @@ static void gf8_muladd_73(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_74(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in1 ^ in2 ^ in6;
@@ -5253,22 +5503,24 @@ static void gf8_muladd_74(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_75(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in0 ^ in7;
         tmp0 = in1 ^ in3;
@@ -5299,22 +5551,24 @@ static void gf8_muladd_75(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_76(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in1 ^ in6;
         tmp0 = in0 ^ in5;
@@ -5346,22 +5600,24 @@ static void gf8_muladd_76(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_77(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in0 ^ in3;
         tmp0 = in1 ^ in4;
@@ -5393,22 +5649,24 @@ static void gf8_muladd_77(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_78(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in2 ^ in7;
@@ -5439,22 +5697,24 @@ static void gf8_muladd_78(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_79(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in3 ^ in7;
         tmp0 = in3 ^ in4;
@@ -5486,22 +5746,24 @@ static void gf8_muladd_79(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_7A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         out2 = tmp0 ^ in3;
@@ -5531,22 +5793,24 @@ static void gf8_muladd_7A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_7B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in1 ^ in3;
         tmp0 = in0 ^ in5;
@@ -5577,22 +5841,24 @@ static void gf8_muladd_7B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_7C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = tmp0 ^ in4;
@@ -5622,22 +5888,24 @@ static void gf8_muladd_7C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_7D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = tmp0 ^ in3;
@@ -5669,22 +5937,24 @@ static void gf8_muladd_7D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_7E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in4;
         tmp1 = in0 ^ in5;
@@ -5715,22 +5985,24 @@ static void gf8_muladd_7E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_7F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in7;
         tmp1 = tmp0 ^ in3 ^ in5;
@@ -5762,22 +6034,24 @@ static void gf8_muladd_7F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_80(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         tmp1 = in4 ^ in5;
@@ -5808,22 +6082,24 @@ static void gf8_muladd_80(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_81(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in6;
         tmp1 = tmp0 ^ in3;
@@ -5853,22 +6129,24 @@ static void gf8_muladd_81(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_82(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in1 ^ in2;
         tmp0 = in6 ^ in7;
@@ -5897,22 +6175,24 @@ static void gf8_muladd_82(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_83(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in2 ^ in5;
@@ -5945,21 +6225,23 @@ static void gf8_muladd_83(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_84(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in2 ^ in6;
         out6 = in3 ^ in5;
@@ -5987,22 +6269,24 @@ static void gf8_muladd_84(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_85(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in6;
         tmp1 = in3 ^ in6;
@@ -6034,21 +6318,23 @@ static void gf8_muladd_85(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_86(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out6 = in3;
         out7 = in0 ^ in4;
@@ -6076,22 +6362,24 @@ static void gf8_muladd_86(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_87(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out6 = in3 ^ in6;
         tmp0 = in0 ^ in1;
@@ -6121,22 +6409,24 @@ static void gf8_muladd_87(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_88(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in2 ^ in7;
         tmp0 = in5 ^ in6;
@@ -6166,22 +6456,24 @@ static void gf8_muladd_88(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_89(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in7;
         tmp1 = in2 ^ in7;
@@ -6212,21 +6504,23 @@ static void gf8_muladd_89(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_8A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in1 ^ in6;
         out7 = in0 ^ in5;
@@ -6254,22 +6548,24 @@ static void gf8_muladd_8A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_8B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in3 ^ in6;
@@ -6302,21 +6598,23 @@ static void gf8_muladd_8B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_8C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in2;
         out0 = in1 ^ in7;
@@ -6344,22 +6642,24 @@ static void gf8_muladd_8C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_8D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in1 ^ in2;
         tmp0 = in6 ^ in7;
@@ -6388,21 +6688,23 @@ static void gf8_muladd_8D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_8E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in1;
         out4 = in5;
@@ -6430,22 +6732,24 @@ static void gf8_muladd_8E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_8F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in0 ^ in1;
         tmp0 = in0 ^ in3;
@@ -6474,22 +6778,24 @@ static void gf8_muladd_8F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_90(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in2 ^ in6 ^ in7;
@@ -6520,22 +6826,24 @@ static void gf8_muladd_90(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_91(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = tmp0 ^ in3 ^ in5;
@@ -6567,22 +6875,24 @@ static void gf8_muladd_91(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_92(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in1;
         tmp0 = in4 ^ in5;
@@ -6612,22 +6922,24 @@ static void gf8_muladd_92(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_93(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in1 ^ in3;
         tmp0 = in2 ^ in7;
@@ -6658,22 +6970,24 @@ static void gf8_muladd_93(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_94(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in2 ^ in6;
         tmp0 = in1 ^ in4 ^ in5;
@@ -6702,22 +7016,24 @@ static void gf8_muladd_94(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_95(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         out3 = tmp0 ^ in6;
@@ -6751,22 +7067,24 @@ static void gf8_muladd_95(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_96(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in6 ^ in7;
         tmp0 = in1 ^ in5;
@@ -6797,22 +7115,24 @@ static void gf8_muladd_96(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_97(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in4;
         tmp1 = in2 ^ in6;
@@ -6844,22 +7164,24 @@ static void gf8_muladd_97(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_98(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in5 ^ in7;
         tmp1 = in1 ^ in4 ^ in7;
@@ -6889,22 +7211,24 @@ static void gf8_muladd_98(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_99(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         out5 = in1 ^ in3 ^ in4;
@@ -6935,22 +7259,24 @@ static void gf8_muladd_99(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_9A(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in3 ^ in4;
         tmp0 = in0 ^ in5;
@@ -6981,22 +7307,24 @@ static void gf8_muladd_9A(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_9B(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in1 ^ in3;
         tmp0 = in3 ^ in5;
@@ -7025,22 +7353,24 @@ static void gf8_muladd_9B(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_9C(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out1 = in2 ^ in5;
         tmp0 = in0 ^ in3 ^ in6;
@@ -7069,22 +7399,24 @@ static void gf8_muladd_9C(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_9D(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out6 = in2 ^ in5;
         tmp0 = in0 ^ in3;
@@ -7113,22 +7445,24 @@ static void gf8_muladd_9D(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_9E(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in1 ^ in4;
         tmp0 = in0 ^ in5;
@@ -7157,22 +7491,24 @@ static void gf8_muladd_9E(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_9F(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out6 = in2;
         out7 = in0 ^ in3;
@@ -7201,22 +7537,24 @@ static void gf8_muladd_9F(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A0(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in6;
         out2 = tmp0 ^ in7;
@@ -7248,22 +7586,24 @@ static void gf8_muladd_A0(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A1(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = tmp0 ^ in1;
@@ -7294,22 +7634,24 @@ static void gf8_muladd_A1(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A2(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in6;
         tmp0 = in1 ^ in3 ^ in5;
@@ -7338,22 +7680,24 @@ static void gf8_muladd_A2(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A3(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in2 ^ in6;
         out3 = in1 ^ in5 ^ in6;
@@ -7383,22 +7727,24 @@ static void gf8_muladd_A3(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A4(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in3;
         tmp1 = in2 ^ in4;
@@ -7431,22 +7777,24 @@ static void gf8_muladd_A4(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A5(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in2 ^ in5;
         tmp0 = in1 ^ in6;
@@ -7477,21 +7825,23 @@ static void gf8_muladd_A5(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A6(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in0;
         out3 = in3 ^ in5 ^ in7;
@@ -7519,21 +7869,23 @@ static void gf8_muladd_A6(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A7(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in0 ^ in2;
         out3 = in5 ^ in7;
@@ -7561,22 +7913,24 @@ static void gf8_muladd_A7(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A8(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = in1 ^ in6;
@@ -7607,21 +7961,23 @@ static void gf8_muladd_A8(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_A9(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in2 ^ in6;
         out6 = in1 ^ in4;
@@ -7649,22 +8005,24 @@ static void gf8_muladd_A9(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_AA(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in1 ^ in3;
@@ -7695,22 +8053,24 @@ static void gf8_muladd_AA(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_AB(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in0 ^ in1;
         tmp0 = in1 ^ in4;
@@ -7740,22 +8100,24 @@ static void gf8_muladd_AB(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_AC(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in1 ^ in3;
         out1 = in2 ^ in4;
@@ -7784,21 +8146,23 @@ static void gf8_muladd_AC(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_AD(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in7;
         out5 = in0;
@@ -7826,22 +8190,24 @@ static void gf8_muladd_AD(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_AE(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in3 ^ in4;
         tmp0 = in0 ^ in4;
@@ -7872,22 +8238,24 @@ static void gf8_muladd_AE(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_AF(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in3;
         tmp0 = in0 ^ in7;
@@ -7916,22 +8284,24 @@ static void gf8_muladd_AF(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B0(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in4;
         tmp1 = in3 ^ in6;
@@ -7963,22 +8333,24 @@ static void gf8_muladd_B0(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B1(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in4;
         out2 = tmp0 ^ in2 ^ in7;
@@ -8008,22 +8380,24 @@ static void gf8_muladd_B1(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B2(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in4;
         tmp0 = in4 ^ in7;
@@ -8056,22 +8430,24 @@ static void gf8_muladd_B2(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B3(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in2 ^ in4;
         tmp0 = in0 ^ in5;
@@ -8102,22 +8478,24 @@ static void gf8_muladd_B3(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B4(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in0 ^ in1;
         out5 = out4 ^ in2;
@@ -8146,22 +8524,24 @@ static void gf8_muladd_B4(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B5(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in2 ^ in4;
@@ -8192,22 +8572,24 @@ static void gf8_muladd_B5(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B6(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in3 ^ in4;
         tmp0 = in1 ^ in2;
@@ -8239,22 +8621,24 @@ static void gf8_muladd_B6(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B7(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in4;
         tmp0 = in0 ^ in4;
@@ -8284,22 +8668,24 @@ static void gf8_muladd_B7(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B8(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in4;
         tmp1 = in2 ^ in5;
@@ -8330,22 +8716,24 @@ static void gf8_muladd_B8(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_B9(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in4 ^ in5;
@@ -8376,22 +8764,24 @@ static void gf8_muladd_B9(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_BA(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in5 ^ in7;
         out2 = tmp0 ^ in4;
@@ -8422,22 +8812,24 @@ static void gf8_muladd_BA(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_BB(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in2 ^ in4 ^ in5 ^ in7;
         tmp0 = out2 ^ in1;
@@ -8467,22 +8859,24 @@ static void gf8_muladd_BB(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_BC(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in2 ^ in4;
@@ -8513,22 +8907,24 @@ static void gf8_muladd_BC(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_BD(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in1 ^ in4;
@@ -8559,22 +8955,24 @@ static void gf8_muladd_BD(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_BE(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3 ^ in6;
         out4 = tmp0 ^ in5;
@@ -8603,22 +9001,24 @@ static void gf8_muladd_BE(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_BF(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in4;
         out3 = tmp0 ^ in5 ^ in6;
@@ -8650,22 +9050,24 @@ static void gf8_muladd_BF(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C0(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in2 ^ in5;
         tmp0 = in1 ^ in4;
@@ -8695,22 +9097,24 @@ static void gf8_muladd_C0(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C1(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in2;
         tmp0 = in0 ^ in1;
@@ -8740,22 +9144,24 @@ static void gf8_muladd_C1(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C2(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in1 ^ in3 ^ in4;
         tmp0 = in0 ^ in3 ^ in6;
@@ -8785,22 +9191,24 @@ static void gf8_muladd_C2(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C3(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in1 ^ in3;
         tmp0 = in0 ^ in2;
@@ -8831,22 +9239,24 @@ static void gf8_muladd_C3(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C4(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in7;
         out3 = tmp0 ^ in4;
@@ -8876,22 +9286,24 @@ static void gf8_muladd_C4(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C5(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in4 ^ in7;
         tmp0 = in3 ^ in7;
@@ -8920,22 +9332,24 @@ static void gf8_muladd_C5(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C6(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in5 ^ in6;
         tmp1 = in1 ^ in7;
@@ -8969,22 +9383,24 @@ static void gf8_muladd_C6(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C7(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in2 ^ in4;
         tmp0 = in3 ^ in5;
@@ -9014,22 +9430,24 @@ static void gf8_muladd_C7(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C8(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out0 = in1 ^ in2;
         out1 = in2 ^ in3;
@@ -9059,22 +9477,24 @@ static void gf8_muladd_C8(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_C9(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in5 ^ in6;
         out7 = in0 ^ in1;
@@ -9103,22 +9523,24 @@ static void gf8_muladd_C9(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_CA(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in7;
         tmp1 = in2 ^ in7;
@@ -9150,22 +9572,24 @@ static void gf8_muladd_CA(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_CB(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in7;
         tmp1 = in5 ^ in7;
@@ -9196,22 +9620,24 @@ static void gf8_muladd_CB(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_CC(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = in1 ^ in6;
@@ -9243,22 +9669,24 @@ static void gf8_muladd_CC(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_CD(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in3 ^ in6;
         tmp0 = in0 ^ in1;
@@ -9288,22 +9716,24 @@ static void gf8_muladd_CD(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_CE(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in5;
         tmp1 = tmp0 ^ in3;
@@ -9334,22 +9764,24 @@ static void gf8_muladd_CE(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_CF(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in6;
         tmp1 = in0 ^ in1 ^ in5;
@@ -9380,22 +9812,24 @@ static void gf8_muladd_CF(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D0(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         tmp1 = in1 ^ in4;
@@ -9428,22 +9862,24 @@ static void gf8_muladd_D0(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D1(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in5 ^ in6;
         tmp1 = tmp0 ^ in1;
@@ -9474,22 +9910,24 @@ static void gf8_muladd_D1(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D2(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in5 ^ in6;
         out2 = tmp0 ^ in2 ^ in3;
@@ -9518,22 +9956,24 @@ static void gf8_muladd_D2(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D3(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in3 ^ in5 ^ in6;
         tmp0 = out2 ^ in2;
@@ -9565,22 +10005,24 @@ static void gf8_muladd_D3(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D4(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in3 ^ in5;
         tmp0 = in1 ^ in5;
@@ -9611,22 +10053,24 @@ static void gf8_muladd_D4(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D5(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in5;
         tmp0 = in0 ^ in4;
@@ -9657,22 +10101,24 @@ static void gf8_muladd_D5(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D6(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2 ^ in4 ^ in6;
         out5 = tmp0 ^ in3;
@@ -9702,22 +10148,24 @@ static void gf8_muladd_D6(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D7(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in3;
         out3 = in2 ^ in5 ^ in7;
@@ -9748,22 +10196,24 @@ static void gf8_muladd_D7(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D8(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in0;
         out5 = in1;
@@ -9793,21 +10243,23 @@ static void gf8_muladd_D8(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_D9(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in0 ^ in4;
         out5 = in1 ^ in5;
@@ -9835,22 +10287,24 @@ static void gf8_muladd_D9(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_DA(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out5 = in1 ^ in4;
         tmp0 = in2 ^ in7;
@@ -9880,22 +10334,24 @@ static void gf8_muladd_DA(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_DB(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in1 ^ in5;
@@ -9928,22 +10384,24 @@ static void gf8_muladd_DB(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_DC(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in2;
         tmp1 = in0 ^ in3;
@@ -9975,21 +10433,23 @@ static void gf8_muladd_DC(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_DD(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in0 ^ in6;
         out2 = in0 ^ in1 ^ in3;
@@ -10017,22 +10477,24 @@ static void gf8_muladd_DD(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_DE(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3 ^ in6;
         tmp1 = in3 ^ in4 ^ in7;
@@ -10062,22 +10524,24 @@ static void gf8_muladd_DE(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_DF(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in0 ^ in3 ^ in7;
         tmp0 = out2 ^ in1 ^ in5;
@@ -10108,22 +10572,24 @@ static void gf8_muladd_DF(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E0(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in1 ^ in7;
         tmp0 = in2 ^ in4;
@@ -10153,22 +10619,24 @@ static void gf8_muladd_E0(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E1(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in1 ^ in4;
         tmp0 = in1 ^ in7;
@@ -10200,21 +10668,23 @@ static void gf8_muladd_E1(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E2(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in1 ^ in2;
         out4 = in1 ^ in5;
@@ -10242,22 +10712,24 @@ static void gf8_muladd_E2(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E3(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in4 ^ in7;
         tmp0 = in1 ^ in3;
@@ -10290,22 +10762,24 @@ static void gf8_muladd_E3(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E4(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in6;
         tmp0 = in0 ^ in4;
@@ -10336,22 +10810,24 @@ static void gf8_muladd_E4(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E5(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in3 ^ in6;
         tmp0 = in0 ^ in1;
@@ -10382,21 +10858,23 @@ static void gf8_muladd_E5(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E6(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in2 ^ in6 ^ in7;
         out2 = out3 ^ in0 ^ in4;
@@ -10424,22 +10902,24 @@ static void gf8_muladd_E6(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E7(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in3;
         out3 = tmp0 ^ in6 ^ in7;
@@ -10472,22 +10952,24 @@ static void gf8_muladd_E7(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E8(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in3 ^ in6;
         tmp0 = in4 ^ in7;
@@ -10519,22 +11001,24 @@ static void gf8_muladd_E8(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_E9(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = in3 ^ in6;
@@ -10565,21 +11049,23 @@ static void gf8_muladd_E9(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_EA(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in6 ^ in7;
         out5 = in0 ^ in7;
@@ -10607,22 +11093,24 @@ static void gf8_muladd_EA(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_EB(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in4 ^ in5;
         tmp0 = in0 ^ in1;
@@ -10652,21 +11140,23 @@ static void gf8_muladd_EB(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_EC(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out3 = in0 ^ in5;
         out4 = in2 ^ in3 ^ in7;
@@ -10694,22 +11184,24 @@ static void gf8_muladd_EC(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_ED(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in2 ^ in4;
         tmp1 = in3 ^ in5;
@@ -10739,22 +11231,24 @@ static void gf8_muladd_ED(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_EE(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in2;
         tmp0 = in0 ^ in1;
@@ -10786,22 +11280,24 @@ static void gf8_muladd_EE(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_EF(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out4 = in2 ^ in4;
         tmp0 = in0 ^ in5;
@@ -10831,22 +11327,24 @@ static void gf8_muladd_EF(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F0(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in4 ^ in5;
@@ -10878,22 +11376,24 @@ static void gf8_muladd_F0(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F1(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in1 ^ in6;
         tmp0 = in3 ^ in5;
@@ -10925,22 +11425,24 @@ static void gf8_muladd_F1(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F2(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in4 ^ in5;
         out2 = in2 ^ in6 ^ in7;
@@ -10972,22 +11474,24 @@ static void gf8_muladd_F2(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F3(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in6 ^ in7;
         tmp0 = in0 ^ in1;
@@ -11017,22 +11521,24 @@ static void gf8_muladd_F3(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F4(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in0 ^ in1 ^ in2;
         tmp0 = out2 ^ in3;
@@ -11061,22 +11567,24 @@ static void gf8_muladd_F4(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F5(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in0 ^ in1;
         tmp0 = out2 ^ in2;
@@ -11105,22 +11613,24 @@ static void gf8_muladd_F5(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F6(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in7;
         out2 = tmp0 ^ in2;
@@ -11150,22 +11660,24 @@ static void gf8_muladd_F6(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F7(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in0 ^ in7;
         tmp0 = out2 ^ in1;
@@ -11194,22 +11706,24 @@ static void gf8_muladd_F7(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F8(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in4;
         tmp1 = in3 ^ in5;
@@ -11240,22 +11754,24 @@ static void gf8_muladd_F8(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_F9(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in3 ^ in5;
         tmp1 = in0 ^ in6;
@@ -11288,22 +11804,24 @@ static void gf8_muladd_F9(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_FA(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in1;
         tmp1 = tmp0 ^ in2;
@@ -11335,22 +11853,24 @@ static void gf8_muladd_FA(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_FB(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in5 ^ in6;
         tmp0 = in0 ^ in1;
@@ -11380,22 +11900,24 @@ static void gf8_muladd_FB(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_FC(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in1 ^ in2;
         tmp1 = in0 ^ in7;
@@ -11427,22 +11949,24 @@ static void gf8_muladd_FC(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_FD(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in5;
         tmp1 = in1 ^ in7;
@@ -11474,22 +11998,24 @@ static void gf8_muladd_FD(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_FE(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3, tmp4;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3, tmp4;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         tmp0 = in0 ^ in2;
         out2 = tmp0 ^ in5;
@@ -11522,22 +12048,24 @@ static void gf8_muladd_FE(uint8_t * out, uint8_t * in, unsigned int width)
 static void gf8_muladd_FF(uint8_t * out, uint8_t * in, unsigned int width)
 {
     unsigned int i;
-    uint64_t * in_ptr = (uint64_t *)in;
-    uint64_t * out_ptr = (uint64_t *)out;
+    ec_gf_word_t * in_ptr = (ec_gf_word_t *)in;
+    ec_gf_word_t * out_ptr = (ec_gf_word_t *)out;
+
+    width = EC_GF_WORDS(width);
 
     for (i = 0; i < width; i++)
     {
-        uint64_t out0, out1, out2, out3, out4, out5, out6, out7;
-        uint64_t tmp0, tmp1, tmp2, tmp3;
+        ec_gf_word_t out0, out1, out2, out3, out4, out5, out6, out7;
+        ec_gf_word_t tmp0, tmp1, tmp2, tmp3;
 
-        uint64_t in0 = out_ptr[0];
-        uint64_t in1 = out_ptr[width];
-        uint64_t in2 = out_ptr[width * 2];
-        uint64_t in3 = out_ptr[width * 3];
-        uint64_t in4 = out_ptr[width * 4];
-        uint64_t in5 = out_ptr[width * 5];
-        uint64_t in6 = out_ptr[width * 6];
-        uint64_t in7 = out_ptr[width * 7];
+        ec_gf_word_t in0 = out_ptr[0];
+        ec_gf_word_t in1 = out_ptr[width];
+        ec_gf_word_t in2 = out_ptr[width * 2];
+        ec_gf_word_t in3 = out_ptr[width * 3];
+        ec_gf_word_t in4 = out_ptr[width * 4];
+        ec_gf_word_t in5 = out_ptr[width * 5];
+        ec_gf_word_t in6 = out_ptr[width * 6];
+        ec_gf_word_t in7 = out_ptr[width * 7];
 
         out2 = in0 ^ in5;
         tmp0 = in4 ^ in7;
@@ -11566,7 +12094,7 @@ static void gf8_muladd_FF(uint8_t * out, uint8_t * in, unsigned int width)
     }
 }
 
-void (* ec_gf_muladd[])(uint8_t * out, uint8_t * in, unsigned int width) =
+ec_gf_muladd_t EC_GF_MULADD_TABLE[] =
 {
     gf8_muladd_00, gf8_muladd_01, gf8_muladd_02, gf8_muladd_03,
     gf8_muladd_04, gf8_muladd_05, gf8_muladd_06, gf8_muladd_07,
@@ -11633,3 +12161,81 @@ void (* ec_gf_muladd[])(uint8_t * out, uint8_t * in, unsigned int width) =
     gf8_muladd_F8, gf8_muladd_F9, gf8_muladd_FA, gf8_muladd_FB,
     gf8_muladd_FC, gf8_muladd_FD, gf8_muladd_FE, gf8_muladd_FF
 };
+
+#ifdef EC_GF_GENERIC
+
+ec_gf_muladd_t * ec_gf_muladd = ec_gf_muladd_generic;
+
+typedef struct _ec_gf_ext
+{
+    const char *     name;
+    ec_gf_muladd_t * table;
+    int32_t       (* supported)(void);
+} ec_gf_ext_t;
+
+static int32_t ec_gf_ext_generic(void)
+{
+    return 1;
+}
+
+#ifdef EC_GF_SIMD_X86
+
+/* __builtin_cpu_supports() only accepts string literals. */
+
+static int32_t ec_gf_ext_sse2(void)
+{
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports("sse2");
+}
+
+static int32_t ec_gf_ext_avx2(void)
+{
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports("avx2");
+}
+
+static int32_t ec_gf_ext_avx512(void)
+{
+    __builtin_cpu_init();
+
+    return __builtin_cpu_supports("avx512f");
+}
+
+#endif /* EC_GF_SIMD_X86 */
+
+/* Ordered from the fastest to the slowest one. */
+static ec_gf_ext_t ec_gf_extensions[] =
+{
+#ifdef EC_GF_SIMD_X86
+    { "avx512", ec_gf_muladd_avx512,  ec_gf_ext_avx512 },
+    { "avx2",   ec_gf_muladd_avx2,    ec_gf_ext_avx2 },
+    { "sse2",   ec_gf_muladd_sse2,    ec_gf_ext_sse2 },
+#endif
+    { "none",   ec_gf_muladd_generic, ec_gf_ext_generic },
+    { NULL,     NULL,                 NULL }
+};
+
+const char * ec_gf_initialize(const char * name)
+{
+    ec_gf_ext_t * ext;
+
+    for (ext = ec_gf_extensions; ext->name != NULL; ext++)
+    {
+        if ((strcmp(name, "auto") != 0) && (strcmp(name, ext->name) != 0))
+        {
+            continue;
+        }
+        if (ext->supported())
+        {
+            ec_gf_muladd = ext->table;
+
+            return ext->name;
+        }
+    }
+
+    return NULL;
+}
+
+#endif /* EC_GF_GENERIC */
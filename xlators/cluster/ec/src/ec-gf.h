@@ -17,7 +17,30 @@
 #define EC_GF_SIZE (1 << EC_GF_BITS)
 #define EC_GF_WORD_SIZE sizeof(uint64_t)
 
-extern void (* ec_gf_muladd[])(uint8_t * out, uint8_t * in,
-                               unsigned int width);
+/* Vectorized variants of the GF(2^8) kernels are only built by GCC for x86
+ * targets, where the CPU can be probed at run time. */
+#if defined(__GNUC__) && !defined(__clang__) && \
+    ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9))) && \
+    (defined(__x86_64__) || defined(__i386__))
+#define EC_GF_SIMD_X86
+#endif
+
+typedef void (* ec_gf_muladd_t)(uint8_t * out, uint8_t * in,
+                                unsigned int width);
+
+extern ec_gf_muladd_t ec_gf_muladd_generic[];
+#ifdef EC_GF_SIMD_X86
+extern ec_gf_muladd_t ec_gf_muladd_sse2[];
+extern ec_gf_muladd_t ec_gf_muladd_avx2[];
+extern ec_gf_muladd_t ec_gf_muladd_avx512[];
+#endif
+
+/* Table of kernels selected by ec_gf_initialize() */
+extern ec_gf_muladd_t * ec_gf_muladd;
+
+/* Selects the kernels for the named CPU extension ("none", "sse2", "avx2",
+ * "avx512") or the best one supported by the CPU ("auto"). Returns the name
+ * of the selected extension, or NULL if it is not available. */
+const char * ec_gf_initialize(const char * name);
 
 #endif /* __EC_GF8_H__ */
@@ -1118,8 +1118,9 @@ int32_t ec_readv_rebuild(ec_t * ec, ec_fop_data_t * fop, ec_cbk_data_t * cbk)
         }
 
         vector[0].iov_base = iobuf->ptr;
-        vector[0].iov_len = ec_method_decode(fsize, ec->fragments, values,
-                                             blocks, iobuf->ptr);
+        vector[0].iov_len = ec_method_decode(&ec->matrices, fsize,
+                                             ec->fragments, values, blocks,
+                                             iobuf->ptr);
 
         iobuf_unref(iobuf);
 
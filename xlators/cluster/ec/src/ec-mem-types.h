@@ -21,6 +21,7 @@ enum gf_ec_mem_types_
     ec_mt_ec_fd_t,
     ec_mt_ec_heal_t,
     ec_mt_subvol_healer_t,
+    ec_mt_ec_method_matrix_t,
     ec_mt_end
 };
 
@@ -13,6 +13,7 @@
 
 #include "ec-gf.h"
 #include "ec-method.h"
+#include "ec-mem-types.h"
 
 static uint32_t GfPow[EC_GF_SIZE << 1];
 static uint32_t GfLog[EC_GF_SIZE << 1];
@@ -79,20 +80,16 @@ size_t ec_method_encode(size_t size, uint32_t columns, uint32_t row,
     return size * EC_METHOD_CHUNK_SIZE;
 }
 
-size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
-                        uint8_t ** in, uint8_t * out)
+static void ec_method_matrix_build(ec_method_matrix_t * matrix,
+                                   uint32_t columns, uint32_t * rows)
 {
-    uint32_t i, j, k, off, last, value;
+    uint32_t i, j, k, last, value;
     uint32_t f;
     uint8_t inv[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS + 1];
     uint8_t mtx[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS];
-    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
-
-    size /= EC_METHOD_CHUNK_SIZE;
 
     memset(inv, 0, sizeof(inv));
     memset(mtx, 0, sizeof(mtx));
-    memset(dummy, 0, sizeof(dummy));
     for (i = 0; i < columns; i++)
     {
         inv[i][i] = 1;
@@ -128,32 +125,245 @@ size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
             }
         }
     }
+
+    /* Each output column is computed Horner-style: the accumulated value
+     * is multiplied by the ratio between consecutive non-zero coefficients
+     * before adding the next input, and by the last coefficient at the end.
+     * inv[i][columns] is always 1, so the scan always stops there. */
+    matrix->columns = columns;
+    for (i = 0; i < columns; i++)
+    {
+        last = 0;
+        k = 0;
+        for (j = 0; j < columns; j++)
+        {
+            if (inv[i][j] != 0)
+            {
+                value = ec_method_div(last, inv[i][j]);
+                last = inv[i][j];
+                matrix->plan[i][k].func = value;
+                matrix->plan[i][k].in = j;
+                k++;
+            }
+        }
+        matrix->steps[i] = k;
+        matrix->last[i] = last;
+    }
+}
+
+void ec_method_matrix_list_init(ec_method_matrix_list_t * list,
+                                uint32_t max)
+{
+    INIT_LIST_HEAD(&list->lru);
+    LOCK_INIT(&list->lock);
+    list->count = 0;
+    list->max = max;
+    list->hits = 0;
+    list->misses = 0;
+}
+
+static void ec_method_matrix_unref(ec_method_matrix_list_t * list,
+                                   ec_method_matrix_t * matrix)
+{
+    int32_t refs;
+
+    LOCK(&list->lock);
+
+    refs = --matrix->refs;
+
+    UNLOCK(&list->lock);
+
+    if (refs == 0)
+    {
+        GF_FREE(matrix);
+    }
+}
+
+/* Drops every cached matrix that uses a row outside of 'mask'. Matrices
+ * still being used by a decode are freed when it finishes. */
+void ec_method_matrix_list_invalidate(ec_method_matrix_list_t * list,
+                                      uint64_t mask)
+{
+    ec_method_matrix_t * matrix, * tmp;
+    struct list_head dead;
+
+    INIT_LIST_HEAD(&dead);
+
+    LOCK(&list->lock);
+
+    list_for_each_entry_safe(matrix, tmp, &list->lru, lru)
+    {
+        if ((matrix->mask & ~mask) != 0)
+        {
+            list_move(&matrix->lru, &dead);
+            list->count--;
+        }
+    }
+
+    UNLOCK(&list->lock);
+
+    list_for_each_entry_safe(matrix, tmp, &dead, lru)
+    {
+        list_del_init(&matrix->lru);
+        ec_method_matrix_unref(list, matrix);
+    }
+}
+
+void ec_method_matrix_list_fini(ec_method_matrix_list_t * list)
+{
+    ec_method_matrix_list_invalidate(list, 0);
+
+    LOCK_DESTROY(&list->lock);
+}
+
+static ec_method_matrix_t * ec_method_matrix_get(
+                                            ec_method_matrix_list_t * list,
+                                            uint32_t columns, uint32_t * rows)
+{
+    ec_method_matrix_t * matrix, * tmp, * victim = NULL;
+    uint64_t mask = 0;
+    uint32_t i;
+
+    for (i = 0; i < columns; i++)
+    {
+        if (rows[i] >= 64)
+        {
+            return NULL;
+        }
+        mask |= 1ULL << rows[i];
+    }
+
+    LOCK(&list->lock);
+
+    list_for_each_entry(matrix, &list->lru, lru)
+    {
+        if (matrix->mask == mask)
+        {
+            list_move(&matrix->lru, &list->lru);
+            matrix->refs++;
+            list->hits++;
+
+            UNLOCK(&list->lock);
+
+            return matrix;
+        }
+    }
+    list->misses++;
+
+    UNLOCK(&list->lock);
+
+    matrix = GF_MALLOC(sizeof(*matrix), ec_mt_ec_method_matrix_t);
+    if (matrix == NULL)
+    {
+        return NULL;
+    }
+    ec_method_matrix_build(matrix, columns, rows);
+    matrix->mask = mask;
+    matrix->refs = 2;
+
+    LOCK(&list->lock);
+
+    /* Another thread could have built the same matrix meanwhile */
+    list_for_each_entry(tmp, &list->lru, lru)
+    {
+        if (tmp->mask == mask)
+        {
+            list_move(&tmp->lru, &list->lru);
+            tmp->refs++;
+
+            UNLOCK(&list->lock);
+
+            GF_FREE(matrix);
+
+            return tmp;
+        }
+    }
+
+    list_add(&matrix->lru, &list->lru);
+    if (list->count < list->max)
+    {
+        list->count++;
+    }
+    else
+    {
+        victim = list_entry(list->lru.prev, ec_method_matrix_t, lru);
+        list_del_init(&victim->lru);
+        if (--victim->refs != 0)
+        {
+            victim = NULL;
+        }
+    }
+
+    UNLOCK(&list->lock);
+
+    GF_FREE(victim);
+
+    return matrix;
+}
+
+size_t ec_method_decode(ec_method_matrix_list_t * list, size_t size,
+                        uint32_t columns, uint32_t * rows,
+                        uint8_t ** in, uint8_t * out)
+{
+    ec_method_matrix_t local, * matrix = NULL, * plan;
+    ec_method_step_t * step;
+    uint32_t sorted_rows[EC_METHOD_MAX_FRAGMENTS];
+    uint8_t * sorted_in[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t i, j, row;
+    uint32_t f, off;
+    uint8_t * ptr;
+    uint8_t dummy[EC_METHOD_CHUNK_SIZE];
+
+    size /= EC_METHOD_CHUNK_SIZE;
+
+    /* Matrices are cached by row set, so rows are always handled in
+     * ascending order. */
+    for (i = 0; i < columns; i++)
+    {
+        row = rows[i];
+        ptr = in[i];
+        for (j = i; (j > 0) && (sorted_rows[j - 1] > row); j--)
+        {
+            sorted_rows[j] = sorted_rows[j - 1];
+            sorted_in[j] = sorted_in[j - 1];
+        }
+        sorted_rows[j] = row;
+        sorted_in[j] = ptr;
+    }
+
+    if (list != NULL)
+    {
+        matrix = ec_method_matrix_get(list, columns, sorted_rows);
+    }
+    plan = matrix;
+    if (plan == NULL)
+    {
+        ec_method_matrix_build(&local, columns, sorted_rows);
+        plan = &local;
+    }
+
+    memset(dummy, 0, sizeof(dummy));
     off = 0;
     for (f = 0; f < size; f++)
     {
         for (i = 0; i < columns; i++)
         {
-            last = 0;
-            j = 0;
-            do
+            step = plan->plan[i];
+            for (j = plan->steps[i]; j > 0; j--, step++)
             {
-                while (inv[i][j] == 0)
-                {
-                    j++;
-                }
-                if (j < columns)
-                {
-                    value = ec_method_div(last, inv[i][j]);
-                    last = inv[i][j];
-                    ec_gf_muladd[value](out, in[j] + off, EC_METHOD_WIDTH);
-                    j++;
-                }
-            } while (j < columns);
-            ec_gf_muladd[last](out, dummy, EC_METHOD_WIDTH);
+                ec_gf_muladd[step->func](out, sorted_in[step->in] + off,
+                                         EC_METHOD_WIDTH);
+            }
+            ec_gf_muladd[plan->last[i]](out, dummy, EC_METHOD_WIDTH);
             out += EC_METHOD_CHUNK_SIZE;
         }
         off += EC_METHOD_CHUNK_SIZE;
     }
 
+    if (matrix != NULL)
+    {
+        ec_method_matrix_unref(list, matrix);
+    }
+
     return size * EC_METHOD_CHUNK_SIZE * columns;
 }
@@ -11,6 +11,10 @@
 #ifndef __EC_METHOD_H__
 #define __EC_METHOD_H__
 
+#include "xlator.h"
+#include "list.h"
+#include "locking.h"
+
 #include "ec-gf.h"
 
 /* Determines the maximum size of the matrix used to encode/decode data */
@@ -23,10 +27,49 @@
 #define EC_METHOD_CHUNK_SIZE (EC_METHOD_WORD_SIZE * EC_GF_BITS)
 #define EC_METHOD_WIDTH (EC_METHOD_WORD_SIZE / EC_GF_WORD_SIZE)
 
+/* Maximum number of inverted matrices kept per disperse xlator */
+#define EC_METHOD_MATRIX_CACHE_SIZE 32
+
+/* One call to ec_gf_muladd[func] using fragment 'in' as input */
+typedef struct _ec_method_step
+{
+    uint8_t func;
+    uint8_t in;
+} ec_method_step_t;
+
+/* Inverted decode matrix for one set of rows, compiled into the sequence
+ * of muladd calls needed to rebuild each output column. */
+typedef struct _ec_method_matrix
+{
+    struct list_head lru;
+    uint64_t         mask;
+    int32_t          refs;
+    uint32_t         columns;
+    uint32_t         steps[EC_METHOD_MAX_FRAGMENTS];
+    uint32_t         last[EC_METHOD_MAX_FRAGMENTS];
+    ec_method_step_t plan[EC_METHOD_MAX_FRAGMENTS][EC_METHOD_MAX_FRAGMENTS];
+} ec_method_matrix_t;
+
+typedef struct _ec_method_matrix_list
+{
+    struct list_head lru;
+    gf_lock_t        lock;
+    uint32_t         count;
+    uint32_t         max;
+    uint64_t         hits;
+    uint64_t         misses;
+} ec_method_matrix_list_t;
+
 void ec_method_initialize(void);
+void ec_method_matrix_list_init(ec_method_matrix_list_t * list,
+                                uint32_t max);
+void ec_method_matrix_list_fini(ec_method_matrix_list_t * list);
+void ec_method_matrix_list_invalidate(ec_method_matrix_list_t * list,
+                                      uint64_t mask);
 size_t ec_method_encode(size_t size, uint32_t columns, uint32_t row,
                         uint8_t * in, uint8_t * out);
-size_t ec_method_decode(size_t size, uint32_t columns, uint32_t * rows,
+size_t ec_method_decode(ec_method_matrix_list_t * list, size_t size,
+                        uint32_t columns, uint32_t * rows,
                         uint8_t ** in, uint8_t * out);
 
 #endif /* __EC_METHOD_H__ */
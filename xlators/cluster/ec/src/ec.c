@@ -194,6 +194,8 @@ void __ec_destroy_private(xlator_t * this)
 
         LOCK_DESTROY(&ec->lock);
 
+        ec_method_matrix_list_fini(&ec->matrices);
+
         if (ec->leaf_to_subvolid)
                 dict_unref (ec->leaf_to_subvolid);
         GF_FREE(ec);
@@ -213,14 +215,40 @@ int32_t mem_acct_init(xlator_t * this)
     return 0;
 }
 
+static int32_t
+ec_assign_cpu_extensions (xlator_t *this, char *extensions)
+{
+        const char *selected;
+
+        /* The kernels are shared by all disperse xlators of the process, so
+         * the last configured value wins. */
+        selected = ec_gf_initialize (extensions);
+        if (selected == NULL) {
+                gf_log (this->name, GF_LOG_ERROR, "CPU extension '%s' is not "
+                        "supported by this CPU or build", extensions);
+
+                return -1;
+        }
+
+        gf_log (this->name, GF_LOG_INFO, "Using '%s' CPU extensions for "
+                "erasure coding (requested '%s')", selected, extensions);
+
+        return 0;
+}
+
 int32_t
 reconfigure (xlator_t *this, dict_t *options)
 {
         ec_t *ec = this->private;
+        char *extensions = NULL;
 
         GF_OPTION_RECONF ("self-heal-daemon", ec->shd.enabled, options, bool, failed);
         GF_OPTION_RECONF ("iam-self-heal-daemon", ec->shd.iamshd, options,
                           bool, failed);
+        GF_OPTION_RECONF ("cpu-extensions", extensions, options, str, failed);
+
+        if (ec_assign_cpu_extensions (this, extensions) != 0)
+                goto failed;
 
         return 0;
 failed:
@@ -341,6 +369,8 @@ ec_handle_up (xlator_t *this, ec_t *ec, int32_t idx)
         if (((ec->xl_up >> idx) & 1) == 0) { /* Duplicate event */
                 ec->xl_up |= 1ULL << idx;
                 ec->xl_up_count++;
+
+                ec_method_matrix_list_invalidate(&ec->matrices, ec->xl_up);
         }
 }
 
@@ -357,6 +387,8 @@ ec_handle_down (xlator_t *this, ec_t *ec, int32_t idx)
 
                 ec->xl_up ^= 1ULL << idx;
                 ec->xl_up_count--;
+
+                ec_method_matrix_list_invalidate(&ec->matrices, ec->xl_up);
         }
 }
 
@@ -458,6 +490,7 @@ int32_t
 init (xlator_t *this)
 {
     ec_t *ec = NULL;
+    char *extensions = NULL;
 
     if (this->parents == NULL)
     {
@@ -477,6 +510,7 @@ init (xlator_t *this)
 
     ec->xl = this;
     LOCK_INIT(&ec->lock);
+    ec_method_matrix_list_init(&ec->matrices, EC_METHOD_MATRIX_CACHE_SIZE);
 
     ec->fop_pool = mem_pool_new(ec_fop_data_t, 1024);
     ec->cbk_pool = mem_pool_new(ec_cbk_data_t, 4096);
@@ -504,6 +538,11 @@ init (xlator_t *this)
     }
 
     ec_method_initialize();
+    GF_OPTION_INIT ("cpu-extensions", extensions, str, failed);
+    if (ec_assign_cpu_extensions(this, extensions) != 0)
+    {
+        goto failed;
+    }
     GF_OPTION_INIT ("self-heal-daemon", ec->shd.enabled, bool, failed);
     GF_OPTION_INIT ("iam-self-heal-daemon", ec->shd.iamshd, bool, failed);
 
@@ -1034,6 +1073,14 @@ int32_t ec_gf_zerofill(call_frame_t * frame, xlator_t * this, fd_t * fd,
     return 0;
 }
 
+int32_t ec_gf_seek(call_frame_t * frame, xlator_t * this, fd_t * fd,
+                   off_t offset, gf_seek_what_t what, dict_t * xdata)
+{
+    default_seek_failure_cbk(frame, ENOTSUP);
+
+    return 0;
+}
+
 int32_t ec_gf_forget(xlator_t * this, inode_t * inode)
 {
     uint64_t value = 0;
@@ -1095,6 +1142,10 @@ int32_t ec_dump_private(xlator_t *this)
     gf_proc_dump_write("childs_up", "%u", ec->xl_up_count);
     gf_proc_dump_write("childs_up_mask", "%s",
                        ec_bin(tmp, sizeof(tmp), ec->xl_up, ec->nodes));
+    gf_proc_dump_write("decode_matrices", "%u", ec->matrices.count);
+    gf_proc_dump_write("decode_matrix_hits", "%"PRIu64, ec->matrices.hits);
+    gf_proc_dump_write("decode_matrix_misses", "%"PRIu64,
+                       ec->matrices.misses);
 
     return 0;
 }
@@ -1143,7 +1194,8 @@ struct xlator_fops fops =
     .fsetattr     = ec_gf_fsetattr,
     .fallocate    = ec_gf_fallocate,
     .discard      = ec_gf_discard,
-    .zerofill     = ec_gf_zerofill
+    .zerofill     = ec_gf_zerofill,
+    .seek         = ec_gf_seek
 };
 
 struct xlator_cbks cbks =
@@ -1178,5 +1230,13 @@ struct volume_options options[] =
                      "translator is running as part of self-heal-daemon "
                      "or not."
     },
+    { .key = {"cpu-extensions"},
+      .type = GF_OPTION_TYPE_STR,
+      .value = { "none", "auto", "sse2", "avx2", "avx512" },
+      .default_value = "auto",
+      .description = "Force the CPU extensions used to accelerate the "
+                     "galois field computations. 'auto' selects the best "
+                     "one supported by the CPU, 'none' uses portable code."
+    },
     { }
 };
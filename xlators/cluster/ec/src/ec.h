@@ -14,6 +14,7 @@
 #include "xlator.h"
 #include "timer.h"
 #include "ec-heald.h"
+#include "ec-method.h"
 #include "libxlator.h"
 
 #define EC_XATTR_PREFIX  "trusted.ec."
@@ -48,5 +49,6 @@ struct _ec
     ec_self_heald_t   shd;
     char              vol_uuid[UUID_SIZE + 1];
     dict_t           *leaf_to_subvolid;
+    ec_method_matrix_list_t matrices;
 };
 #endif /* __EC_H__ */
@@ -0,0 +1,196 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+/*
+ * Decode throughput of ec_method_decode() for healthy row sets (the first
+ * 'fragments' bricks answered) and degraded ones (one or two of them are
+ * missing and redundancy rows are used instead), with and without the
+ * per-xlator cache of inverted matrices. Fragments are always encoded with
+ * the portable GF(2^8) kernels and decoded with each of the CPU extensions
+ * available, which also checks that all of them share the same layout.
+ *
+ *   ./ec_method_bench [fragment-size] [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "glusterfs.h"
+#include "globals.h"
+#include "xlator.h"
+
+#include "ec-mem-types.h"
+#include "ec-gf.h"
+#include "ec-method.h"
+
+struct ec_bench_config {
+        uint32_t fragments;
+        uint32_t redundancy;
+};
+
+static struct ec_bench_config configs[] = {
+        { 2, 1 }, { 4, 2 }, { 8, 3 }, { 16, 4 },
+};
+
+static const char *extensions[] = {
+        "none", "sse2", "avx2", "avx512",
+};
+
+static double
+ec_bench_decode (ec_method_matrix_list_t *list, size_t fsize,
+                 uint32_t fragments, uint32_t *rows, uint8_t **in,
+                 uint8_t *out, int iterations)
+{
+        struct timespec start = {0, };
+        struct timespec end = {0, };
+        double          secs = 0;
+        int             i = 0;
+
+        clock_gettime (CLOCK_MONOTONIC, &start);
+        for (i = 0; i < iterations; i++)
+                ec_method_decode (list, fsize, fragments, rows, in, out);
+        clock_gettime (CLOCK_MONOTONIC, &end);
+
+        secs = (end.tv_sec - start.tv_sec) +
+               (end.tv_nsec - start.tv_nsec) / 1e9;
+
+        return (fsize * fragments * (double)iterations) / secs / 1048576;
+}
+
+static int
+ec_bench_config (struct ec_bench_config *cfg, const char *ext, size_t fsize,
+                 int iterations)
+{
+        ec_method_matrix_list_t list;
+        uint32_t                nodes = cfg->fragments + cfg->redundancy;
+        uint32_t                rows[EC_METHOD_MAX_FRAGMENTS];
+        uint8_t                *in[EC_METHOD_MAX_FRAGMENTS];
+        uint8_t                *data = NULL;
+        uint8_t                *out = NULL;
+        uint8_t               **encoded = NULL;
+        uint32_t                missing = 0;
+        uint32_t                i = 0;
+        uint32_t                j = 0;
+        size_t                  k = 0;
+
+        data = malloc (fsize * cfg->fragments);
+        out = malloc (fsize * cfg->fragments);
+        encoded = calloc (nodes, sizeof (*encoded));
+        if (!data || !out || !encoded)
+                return -1;
+
+        for (k = 0; k < fsize * cfg->fragments; k++)
+                data[k] = random ();
+
+        ec_gf_initialize ("none");
+        for (i = 0; i < nodes; i++) {
+                encoded[i] = calloc (1, fsize);
+                if (!encoded[i])
+                        return -1;
+                ec_method_encode (fsize * cfg->fragments, cfg->fragments, i,
+                                  data, encoded[i]);
+        }
+
+        ec_gf_initialize (ext);
+        ec_method_matrix_list_init (&list, EC_METHOD_MATRIX_CACHE_SIZE);
+
+        for (missing = 0; (missing <= cfg->redundancy) && (missing <= 2);
+             missing++) {
+                /* the first 'missing' bricks are down */
+                for (i = 0, j = missing; i < cfg->fragments; i++, j++) {
+                        rows[i] = j;
+                        in[i] = encoded[j];
+                }
+
+                memset (out, 0, fsize * cfg->fragments);
+                ec_method_decode (&list, fsize, cfg->fragments, rows, in,
+                                  out);
+                if (memcmp (out, data, fsize * cfg->fragments) != 0) {
+                        fprintf (stderr, "%s %u+%u: decode mismatch with "
+                                 "%u bricks down\n", ext, cfg->fragments,
+                                 cfg->redundancy, missing);
+                        return -1;
+                }
+
+                printf ("%-7s %4u+%-4u %-10s %14.1f %14.1f\n", ext,
+                        cfg->fragments,
+                        cfg->redundancy, (missing == 0) ? "healthy" :
+                        (missing == 1) ? "1 down" : "2 down",
+                        ec_bench_decode (NULL, fsize, cfg->fragments, rows,
+                                         in, out, iterations),
+                        ec_bench_decode (&list, fsize, cfg->fragments, rows,
+                                         in, out, iterations));
+        }
+
+        ec_method_matrix_list_fini (&list);
+
+        for (i = 0; i < nodes; i++)
+                free (encoded[i]);
+        free (encoded);
+        free (out);
+        free (data);
+
+        return 0;
+}
+
+int
+main (int argc, char *argv[])
+{
+        glusterfs_ctx_t *ctx = NULL;
+        size_t           fsize = 4096;
+        int              iterations = 20000;
+        int              i = 0;
+        int              e = 0;
+
+        if (argc > 1)
+                fsize = strtoul (argv[1], NULL, 0);
+        if (argc > 2)
+                iterations = atoi (argv[2]);
+
+        fsize -= fsize % EC_METHOD_CHUNK_SIZE;
+        if (fsize == 0) {
+                fprintf (stderr, "fragment size must be at least %d\n",
+                         EC_METHOD_CHUNK_SIZE);
+                return 1;
+        }
+
+        ctx = glusterfs_ctx_new ();
+        if (!ctx || glusterfs_globals_init (ctx)) {
+                fprintf (stderr, "failed to initialize glusterfs context\n");
+                return 1;
+        }
+        THIS->ctx = ctx;
+        if (xlator_mem_acct_init (THIS, ec_mt_end + 1)) {
+                fprintf (stderr, "failed to initialize memory accounting\n");
+                return 1;
+        }
+
+        ec_method_initialize ();
+
+        printf ("fragment size %zu bytes, %d decodes per row set\n", fsize,
+                iterations);
+        printf ("%-7s %-9s %-10s %14s %14s\n", "ext", "config", "rows",
+                "uncached MB/s", "cached MB/s");
+        for (e = 0; e < sizeof (extensions) / sizeof (extensions[0]); e++) {
+                if (ec_gf_initialize (extensions[e]) == NULL) {
+                        printf ("%-7s not supported\n", extensions[e]);
+                        continue;
+                }
+                for (i = 0; i < sizeof (configs) / sizeof (configs[0]); i++) {
+                        if (ec_bench_config (&configs[i], extensions[e],
+                                             fsize, iterations) != 0)
+                                return 1;
+                }
+        }
+
+        return 0;
+}
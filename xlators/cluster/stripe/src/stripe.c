@@ -4270,6 +4270,16 @@ err:
         return 0;
 }
 
+/* The holes of a striped file are spread over all the subvolumes. Callers
+ * have to read the whole range instead. */
+int32_t
+stripe_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+             gf_seek_what_t what, dict_t *xdata)
+{
+        STRIPE_STACK_UNWIND (seek, frame, -1, ENOTSUP, 0, NULL);
+        return 0;
+}
+
 int32_t
 stripe_release (xlator_t *this, fd_t *fd)
 {
@@ -5718,6 +5728,7 @@ struct xlator_fops fops = {
 	.fallocate	= stripe_fallocate,
 	.discard	= stripe_discard,
         .zerofill       = stripe_zerofill,
+        .seek           = stripe_seek,
 };
 
 struct xlator_cbks cbks = {
@@ -109,6 +109,22 @@ rot13_writev (call_frame_t *frame,
               struct iobref *iobref, dict_t *xdata)
 {
 	rot_13_private_t *priv = (rot_13_private_t *)this->private;
+	struct iovec copy = {0, };
+	struct iobref *copy_iobref = NULL;
+
+	/* never scramble the application's own buffers */
+	if (priv->encrypt_write && iobref && iobref_has_external (iobref)) {
+		if (iobuf_copy_iovec (this->ctx->iobuf_pool, vector, count,
+				      &copy, &copy_iobref)) {
+			STACK_UNWIND_STRICT (writev, frame, -1, ENOMEM, NULL,
+					     NULL, NULL);
+			return 0;
+		}
+		vector = &copy;
+		count = 1;
+		iobref = copy_iobref;
+	}
+
 	if (priv->encrypt_write)
 		rot13_iovec (vector, count);
 
@@ -118,6 +134,9 @@ rot13_writev (call_frame_t *frame,
 		    FIRST_CHILD (this)->fops->writev,
 		    fd, vector, count, offset, flags,
                     iobref, xdata);
+
+	if (copy_iobref)
+		iobref_unref (copy_iobref);
 	return 0;
 }
 
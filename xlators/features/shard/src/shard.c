@@ -14,6 +14,7 @@
 #include "shard-mem-types.h"
 #include "byte-order.h"
 #include "defaults.h"
+#include "call-stub.h"
 
 static gf_boolean_t
 __is_shard_dir (uuid_t gfid)
@@ -63,6 +64,8 @@ __shard_inode_ctx_get (inode_t *inode, xlator_t *this, shard_inode_ctx_t **ctx)
         if (!ctx_p)
                 return ret;
 
+        INIT_LIST_HEAD (&ctx_p->bg_waiters);
+
         ret = __inode_ctx_set (inode, this, (uint64_t *)&ctx_p);
         if (ret < 0) {
                 GF_FREE (ctx_p);
@@ -199,13 +202,23 @@ shard_local_wipe (shard_local_t *local)
         if (local->xattr_rsp)
                 dict_unref (local->xattr_rsp);
 
-        for (i = 0; i < count; i++) {
+        for (i = 0; local->inode_list && (i < count); i++) {
                 if (local->inode_list[i])
                         inode_unref (local->inode_list[i]);
         }
 
         GF_FREE (local->inode_list);
 
+        for (i = 0; local->read_blocks && (i < count); i++) {
+                if (local->read_blocks[i].fd)
+                        fd_unref (local->read_blocks[i].fd);
+                GF_FREE (local->read_blocks[i].vector);
+                if (local->read_blocks[i].iobref)
+                        iobref_unref (local->read_blocks[i].iobref);
+        }
+
+        GF_FREE (local->read_blocks);
+
         GF_FREE (local->vector);
         if (local->iobref)
                 iobref_unref (local->iobref);
@@ -251,6 +264,152 @@ shard_call_count_return (call_frame_t *frame)
         return call_count;
 }
 
+int
+shard_truncate_tail_done (call_frame_t *frame, xlator_t *this);
+
+void
+shard_truncate_tail_cancel (call_frame_t *frame, xlator_t *this);
+
+void
+shard_common_failure_unwind (glusterfs_fop_t fop, call_frame_t *frame,
+                             int32_t op_ret, int32_t op_errno)
+{
+        shard_local_t  *local = NULL;
+
+        local = frame->local;
+
+        if (local && local->truncate.background) {
+                /* tail shards unlinked in the background after a truncate,
+                 * there is nobody to unwind to.
+                 */
+                gf_log (THIS->name, GF_LOG_WARNING, "Failed to remove the "
+                        "shards past the end of a truncated file (%s)",
+                        strerror (op_errno));
+                shard_truncate_tail_done (frame, THIS);
+                return;
+        }
+
+        if (local && local->truncate.bg_frame)
+                shard_truncate_tail_cancel (frame, THIS);
+
+        switch (fop) {
+        case GF_FOP_WRITE:
+                SHARD_STACK_UNWIND (writev, frame, op_ret, op_errno, NULL,
+                                    NULL, NULL);
+                break;
+        case GF_FOP_READ:
+                SHARD_STACK_UNWIND (readv, frame, op_ret, op_errno, NULL, 0,
+                                    NULL, NULL, NULL);
+                break;
+        case GF_FOP_TRUNCATE:
+                SHARD_STACK_UNWIND (truncate, frame, op_ret, op_errno, NULL,
+                                    NULL, NULL);
+                break;
+        case GF_FOP_FTRUNCATE:
+                SHARD_STACK_UNWIND (ftruncate, frame, op_ret, op_errno, NULL,
+                                    NULL, NULL);
+                break;
+        default:
+                gf_log (THIS->name, GF_LOG_WARNING, "Invalid fop id = %d",
+                        fop);
+                break;
+        }
+}
+
+/* Queues @stub behind the background truncates of @inode if any of them
+ * still has to unlink @block or a block after it. Returns 0 when queued.
+ */
+int
+shard_bg_truncate_wait (xlator_t *this, inode_t *inode, int block,
+                        call_stub_t *stub)
+{
+        int                 ret = -1;
+        shard_inode_ctx_t  *ctx = NULL;
+
+        LOCK (&inode->lock);
+        {
+                if (__shard_inode_ctx_get (inode, this, &ctx))
+                        goto unlock;
+
+                if (ctx->bg_truncates && (block >= ctx->bg_tail_first)) {
+                        list_add_tail (&stub->list, &ctx->bg_waiters);
+                        ret = 0;
+                }
+        }
+unlock:
+        UNLOCK (&inode->lock);
+
+        return ret;
+}
+
+gf_boolean_t
+shard_bg_truncate_pending (xlator_t *this, inode_t *inode, int block)
+{
+        gf_boolean_t        pending = _gf_false;
+        shard_inode_ctx_t  *ctx     = NULL;
+
+        LOCK (&inode->lock);
+        {
+                if (__shard_inode_ctx_get (inode, this, &ctx))
+                        goto unlock;
+
+                pending = (ctx->bg_truncates && (block >= ctx->bg_tail_first));
+        }
+unlock:
+        UNLOCK (&inode->lock);
+
+        return pending;
+}
+
+int
+shard_bg_truncate_start (xlator_t *this, inode_t *inode, int tail_first)
+{
+        int                 ret = -1;
+        shard_inode_ctx_t  *ctx = NULL;
+
+        LOCK (&inode->lock);
+        {
+                ret = __shard_inode_ctx_get (inode, this, &ctx);
+                if (ret)
+                        goto unlock;
+
+                if (!ctx->bg_truncates || (tail_first < ctx->bg_tail_first))
+                        ctx->bg_tail_first = tail_first;
+                ctx->bg_truncates++;
+        }
+unlock:
+        UNLOCK (&inode->lock);
+
+        return ret;
+}
+
+void
+shard_bg_truncate_done (xlator_t *this, inode_t *inode)
+{
+        shard_inode_ctx_t  *ctx  = NULL;
+        call_stub_t        *stub = NULL;
+        call_stub_t        *tmp  = NULL;
+        struct list_head    waiters;
+
+        INIT_LIST_HEAD (&waiters);
+
+        LOCK (&inode->lock);
+        {
+                if (__shard_inode_ctx_get (inode, this, &ctx))
+                        goto unlock;
+
+                if (--ctx->bg_truncates == 0)
+                        list_splice_init (&ctx->bg_waiters, &waiters);
+        }
+unlock:
+        UNLOCK (&inode->lock);
+
+        list_for_each_entry_safe (stub, tmp, &waiters, list) {
+                list_del_init (&stub->list);
+                call_resume (stub);
+        }
+}
+
 int
 shard_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                   int32_t op_ret, int32_t op_errno, inode_t *inode,
@@ -380,28 +539,6 @@ shard_fstat (call_frame_t *frame, xlator_t *this, fd_t *fd, dict_t *xdata)
         return 0;
 }
 
-int
-shard_truncate (call_frame_t *frame, xlator_t *this, loc_t *loc, off_t offset,
-                dict_t *xdata)
-{
-        /*TBD - once the ability to determine the size/number of shards for a
-         * file in place, this can be filled.
-         */
-        SHARD_STACK_UNWIND (truncate, frame, -1, ENOTCONN, NULL, NULL, NULL);
-        return 0;
-}
-
-int
-shard_ftruncate (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
-                 dict_t *xdata)
-{
-        /*TBD - once the ability to determine the size/number of shards for a
-         * file in place, this can be filled.
-         */
-        SHARD_STACK_UNWIND (ftruncate, frame, -1, ENOTCONN, NULL, NULL, NULL);
-        return 0;
-}
-
 int
 shard_mknod_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                  int32_t op_ret, int32_t op_errno, inode_t *inode,
@@ -646,75 +783,6 @@ shard_open (call_frame_t *frame, xlator_t *this, loc_t *loc, int32_t flags,
         return 0;
 }
 
-/* - Incomplete - TBD */
-int
-shard_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
-             off_t offset, uint32_t flags, dict_t *xdata)
-{
-/*
-        int             i                       = 0;
-        int32_t         op_errno                = ENOMEM;
-        uint64_t        block_size              = 0;
-        int             highest_block           = 0;
-        int             num_blocks              = 0;
-        int             cur_block               = 0;
-        char            shard_abspath[PATH_MAX] = {0,};
-        off_t           cur_offset              = 0;
-        size_t          total_size              = 0;
-        fd_t           *cur_fd                  = NULL;
-        inode_t        *inode                   = NULL;
-        shard_local_t  *local                   = NULL;
-
-        ret = shard_inode_ctx_get_block_size (fd->inode, this, &block_size);
-        if (ret) {
-                gf_log (this->name, GF_LOG_ERROR, "Failed to get inode ctx for "
-                        "%s", uuid_utoa(fd->inode->gfid));
-                goto out;
-        }
-
-        if (!block_size) {
-                STACK_WIND (frame, default_readv_cbk, FIRST_CHILD(this),
-                            FIRST_CHILD(this)->fops->readv, fd, size, offset,
-                            flags, xdata);
-                return 0;
-        }
-
-        local = mem_get0 (this->local_pool);
-        if (!local)
-                goto err;
-
-        frame->local = local;
-
-        local->block_size = block_size;
-        local->offset = offset;
-        local->len = size;
-        local->first_block = get_lowest_block (offset, block_size);
-        highest_block = get_highest_block (offset, size, block_size);
-        num_blocks = local->num_blocks = highest_block - local->first_block + 1;
-
-        while (num_blocks--) {
-                cur_fd = (local->first_block == 0) ? fd_ref (fd) :
-                         fd_anonymous (inode);
-                cur_offset = (cur_block == local->first_block) ?
-                              get_shard_offset(offset, block_size):0;
-                STACK_WIND_COOKIE (frame, shard_readv_cbk, cur_fd,
-                                   FIRST_CHILD(this),
-                                   FIRST_CHILD(this)->fops->readv, cur_fd,
-                                   cur_size, cur_offset, flags, xdata);
-        }
-
-        return 0;
-
-err:
-        SHARD_STACK_UNWIND (readv, frame, -1, op_errno, NULL, 0, NULL, NULL,
-                            NULL);
-*/
-        SHARD_STACK_UNWIND (readv, frame, -1, ENOTCONN, NULL, 0, NULL, NULL,
-                            NULL);
-        return 0;
-
-}
-
 int
 shard_update_file_size_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                             int32_t op_ret, int32_t op_errno, dict_t *xdata)
@@ -729,27 +797,32 @@ shard_update_file_size_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                 goto err;
         }
 
-        SHARD_STACK_UNWIND (writev, frame, local->written_size, local->op_errno,
-                            &local->prebuf, &local->postbuf, local->xattr_rsp);
+        local->handler (frame, this);
         return 0;
 
 err:
-        SHARD_STACK_UNWIND (writev, frame, -1, local->op_errno, NULL,
-                            NULL, NULL);
+        shard_common_failure_unwind (local->fop, frame, -1, local->op_errno);
         return 0;
 }
 
+/* Stores the aggregated size and block count of the file in the xattr on
+ * the base file, through @fd when the fop has one, else through the loc.
+ */
 int
-shard_update_file_size (call_frame_t *frame, xlator_t *this)
+shard_update_file_size (call_frame_t *frame, xlator_t *this,
+                        shard_post_fop_handler_t handler)
 {
         int            ret       = -1;
         uint64_t      *size_attr = NULL;
         fd_t          *fd        = NULL;
+        inode_t       *inode     = NULL;
         shard_local_t *local     = NULL;
         dict_t        *xattr_req = NULL;
 
         local = frame->local;
         fd = local->fd;
+        inode = local->resolver_base_inode;
+        local->handler = handler;
 
         xattr_req = dict_new ();
         if (!xattr_req)
@@ -759,7 +832,7 @@ shard_update_file_size (call_frame_t *frame, xlator_t *this)
                                     local->postbuf.ia_blocks, &size_attr);
         if (ret) {
                 gf_log (this->name, GF_LOG_ERROR, "Failed to set size attrs for"
-                        " %s", uuid_utoa (fd->inode->gfid));
+                        " %s", uuid_utoa (inode->gfid));
                 goto err;
         }
 
@@ -768,13 +841,21 @@ shard_update_file_size (call_frame_t *frame, xlator_t *this)
         if (ret) {
                 gf_log (this->name, GF_LOG_ERROR, "Failed to set key %s into "
                         "dict. gfid=%s", GF_XATTR_SHARD_FILE_SIZE,
-                        uuid_utoa (fd->inode->gfid));
+                        uuid_utoa (inode->gfid));
                 GF_FREE (size_attr);
                 goto err;
         }
 
-        STACK_WIND (frame, shard_update_file_size_cbk, FIRST_CHILD(this),
-                    FIRST_CHILD(this)->fops->fsetxattr, fd, xattr_req, 0, NULL);
+        if (fd)
+                STACK_WIND (frame, shard_update_file_size_cbk,
+                            FIRST_CHILD(this),
+                            FIRST_CHILD(this)->fops->fsetxattr, fd, xattr_req,
+                            0, NULL);
+        else
+                STACK_WIND (frame, shard_update_file_size_cbk,
+                            FIRST_CHILD(this),
+                            FIRST_CHILD(this)->fops->setxattr, &local->loc,
+                            xattr_req, 0, NULL);
 
         dict_unref (xattr_req);
         return 0;
@@ -782,11 +863,23 @@ shard_update_file_size (call_frame_t *frame, xlator_t *this)
 err:
         if (xattr_req)
                 dict_unref (xattr_req);
-        SHARD_STACK_UNWIND (writev, frame, -1, ENOMEM, NULL, NULL, NULL);
+        shard_common_failure_unwind (local->fop, frame, -1, ENOMEM);
         return 0;
 
 }
 
+int
+shard_post_update_size_writev_handler (call_frame_t *frame, xlator_t *this)
+{
+        shard_local_t *local = NULL;
+
+        local = frame->local;
+
+        SHARD_STACK_UNWIND (writev, frame, local->written_size, local->op_errno,
+                            &local->prebuf, &local->postbuf, local->xattr_rsp);
+        return 0;
+}
+
 int
 shard_writev_do_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                      int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
@@ -819,14 +912,15 @@ shard_writev_do_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                 } else {
                         if (xdata)
                                 local->xattr_rsp = dict_ref (xdata);
-                        shard_update_file_size (frame, this);
+                        shard_update_file_size (frame, this,
+                                       shard_post_update_size_writev_handler);
                 }
         }
 
         return 0;
 }
 
-int
+int32_t
 shard_writev_do (call_frame_t *frame, xlator_t *this)
 {
         int             i                 = 0;
@@ -942,34 +1036,42 @@ shard_lookup_base_file_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 
         local->postbuf = local->prebuf;
 
-        shard_writev_do (frame, this);
+        local->handler (frame, this);
 
         return 0;
 
 unwind:
-        SHARD_STACK_UNWIND (writev, frame, op_ret, op_errno, NULL, NULL, NULL);
+        shard_common_failure_unwind (local->fop, frame, op_ret, op_errno);
         return 0;
 
 }
 
+/* Fetches the aggregated size and block count of the file from its base
+ * file, then continues with @handler. Fops that come with a loc look it up
+ * as is, fd based ones do a nameless lookup on the gfid.
+ */
 int
-shard_lookup_base_file (call_frame_t *frame, xlator_t *this)
+shard_lookup_base_file (call_frame_t *frame, xlator_t *this,
+                        shard_post_fop_handler_t handler)
 {
-        fd_t               *fd    = NULL;
+        inode_t            *inode = NULL;
         shard_local_t      *local = NULL;
         dict_t             *xattr_req = NULL;
 
         local = frame->local;
-        fd = local->fd;
+        inode = local->resolver_base_inode;
+        local->handler = handler;
 
         xattr_req = dict_new ();
         if (!xattr_req)
                 goto err;
 
-        local->loc.inode = inode_new (fd->inode->table);
-        gf_uuid_copy (local->loc.gfid, fd->inode->gfid);
+        if (!local->loc.inode) {
+                local->loc.inode = inode_new (inode->table);
+                gf_uuid_copy (local->loc.gfid, inode->gfid);
+        }
 
-        SHARD_MD_READ_FOP_INIT_REQ_DICT (this, xattr_req, fd->inode->gfid, err);
+        SHARD_MD_READ_FOP_INIT_REQ_DICT (this, xattr_req, inode->gfid, err);
 
         STACK_WIND (frame, shard_lookup_base_file_cbk, FIRST_CHILD (this),
                     FIRST_CHILD(this)->fops->lookup, &local->loc,
@@ -981,7 +1083,7 @@ shard_lookup_base_file (call_frame_t *frame, xlator_t *this)
 err:
         if (xattr_req)
                 dict_unref (xattr_req);
-        SHARD_STACK_UNWIND (writev, frame, -1, ENOMEM, NULL, NULL, NULL);
+        shard_common_failure_unwind (local->fop, frame, -1, ENOMEM);
         return 0;
 
 }
@@ -996,8 +1098,8 @@ shard_link_block_inode (shard_local_t *local, int block_num, inode_t *inode,
 
         priv = THIS->private;
 
-        shard_make_block_bname (block_num, local->fd->inode->gfid, block_bname,
-                                sizeof (block_bname));
+        shard_make_block_bname (block_num, local->resolver_base_inode->gfid,
+                                block_bname, sizeof (block_bname));
 
         linked_inode = inode_link (inode, priv->dot_shard_inode, block_bname,
                                    buf);
@@ -1010,7 +1112,7 @@ shard_link_block_inode (shard_local_t *local, int block_num, inode_t *inode,
 }
 
 int
-shard_writev_lookup_shards_cbk (call_frame_t *frame, void *cookie,
+shard_common_lookup_shards_cbk (call_frame_t *frame, void *cookie,
                                 xlator_t *this, int32_t op_ret,
                                 int32_t op_errno, inode_t *inode,
                                 struct iatt *buf, dict_t *xdata,
@@ -1023,6 +1125,11 @@ shard_writev_lookup_shards_cbk (call_frame_t *frame, void *cookie,
         local = frame->local;
 
         if (op_ret < 0) {
+                /* Only writes need every shard to exist, anyone else
+                 * treats a missing shard as a hole.
+                 */
+                if ((op_errno == ENOENT) && (local->fop != GF_FOP_WRITE))
+                        goto done;
                 local->op_ret = op_ret;
                 local->op_errno = op_errno;
                 goto done;
@@ -1036,13 +1143,13 @@ done:
                 if (local->op_ret < 0)
                         goto unwind;
                 else
-                        shard_lookup_base_file (frame, this);
+                        local->post_res_handler (frame, this);
         }
         return 0;
 
 unwind:
-        SHARD_STACK_UNWIND (writev, frame, local->op_ret, local->op_errno, NULL,
-                            NULL, NULL);
+        shard_common_failure_unwind (local->fop, frame, local->op_ret,
+                                     local->op_errno);
         return 0;
 }
 
@@ -1077,8 +1184,11 @@ out:
         return new;
 }
 
+/* Looks up, all in parallel, the shards of the block range that are not
+ * in the inode table yet.
+ */
 int
-shard_writev_lookup_shards (call_frame_t *frame, xlator_t *this)
+shard_common_lookup_shards (call_frame_t *frame, xlator_t *this)
 {
         int            i              = 0;
         int            ret            = 0;
@@ -1088,7 +1198,7 @@ shard_writev_lookup_shards (call_frame_t *frame, xlator_t *this)
         char           path[PATH_MAX] = {0,};
         char          *bname          = NULL;
         loc_t          loc            = {0,};
-        fd_t          *fd             = NULL;
+        inode_t       *base_inode     = NULL;
         shard_local_t *local          = NULL;
         shard_priv_t  *priv           = NULL;
         gf_boolean_t   wind_failed    = _gf_false;
@@ -1096,7 +1206,7 @@ shard_writev_lookup_shards (call_frame_t *frame, xlator_t *this)
 
         priv = this->private;
         local = frame->local;
-        fd = local->fd;
+        base_inode = local->resolver_base_inode;
         call_count = local->call_count;
         shard_idx_iter = local->first_block;
         last_block = local->last_block;
@@ -1109,14 +1219,14 @@ shard_writev_lookup_shards (call_frame_t *frame, xlator_t *this)
                 }
 
                 if (wind_failed) {
-                        shard_writev_lookup_shards_cbk (frame,
+                        shard_common_lookup_shards_cbk (frame,
                                                  (void *) (long) shard_idx_iter,
                                                         this, -1, ENOMEM, NULL,
                                                         NULL, NULL, NULL);
                         goto next;
                 }
 
-                shard_make_block_abspath (shard_idx_iter, fd->inode->gfid,
+                shard_make_block_abspath (shard_idx_iter, base_inode->gfid,
                                           path, sizeof(path));
 
                 bname = strrchr (path, '/') + 1;
@@ -1129,7 +1239,7 @@ shard_writev_lookup_shards (call_frame_t *frame, xlator_t *this)
                         local->op_ret = -1;
                         local->op_errno = ENOMEM;
                         loc_wipe (&loc);
-                        shard_writev_lookup_shards_cbk (frame,
+                        shard_common_lookup_shards_cbk (frame,
                                                  (void *) (long) shard_idx_iter,
                                                         this, -1, ENOMEM, NULL,
                                                         NULL, NULL, NULL);
@@ -1146,14 +1256,14 @@ shard_writev_lookup_shards (call_frame_t *frame, xlator_t *this)
                         local->op_errno = ENOMEM;
                         wind_failed = _gf_true;
                         loc_wipe (&loc);
-                        shard_writev_lookup_shards_cbk (frame,
+                        shard_common_lookup_shards_cbk (frame,
                                                  (void *) (long) shard_idx_iter,
                                                         this, -1, ENOMEM, NULL,
                                                         NULL, NULL, NULL);
                         goto next;
                 }
 
-                STACK_WIND_COOKIE (frame, shard_writev_lookup_shards_cbk,
+                STACK_WIND_COOKIE (frame, shard_common_lookup_shards_cbk,
                                    (void *) (long) shard_idx_iter,
                                    FIRST_CHILD(this),
                                    FIRST_CHILD(this)->fops->lookup, &loc,
@@ -1205,10 +1315,10 @@ done:
                         goto unwind;
                 } else {
                         if (!local->eexist_count) {
-                                shard_lookup_base_file (frame, this);
+                                local->post_res_handler (frame, this);
                         } else {
                                 local->call_count = local->eexist_count;
-                                shard_writev_lookup_shards (frame, this);
+                                shard_common_lookup_shards (frame, this);
                         }
                 }
         }
@@ -1234,21 +1344,21 @@ shard_writev_resume_mknod (call_frame_t *frame, xlator_t *this)
         shard_inode_ctx_t   ctx_tmp        = {0,};
         shard_local_t      *local          = NULL;
         gf_boolean_t        wind_failed    = _gf_false;
-        fd_t               *fd             = NULL;
+        inode_t            *base_inode     = NULL;
         loc_t               loc            = {0,};
         dict_t             *xattr_req      = NULL;
 
         local = frame->local;
         priv = this->private;
-        fd = local->fd;
+        base_inode = local->resolver_base_inode;
         shard_idx_iter = local->first_block;
         last_block = local->last_block;
         call_count = local->call_count;
 
-        ret = shard_inode_ctx_get_all (fd->inode, this, &ctx_tmp);
+        ret = shard_inode_ctx_get_all (base_inode, this, &ctx_tmp);
         if (ret) {
                 gf_log (this->name, GF_LOG_ERROR, "Failed to get inode ctx for"
-                        " %s", uuid_utoa (fd->inode->gfid));
+                        " %s", uuid_utoa (base_inode->gfid));
                 goto err;
         }
 
@@ -1267,7 +1377,7 @@ shard_writev_resume_mknod (call_frame_t *frame, xlator_t *this)
                         goto next;
                 }
 
-                shard_make_block_abspath (shard_idx_iter, fd->inode->gfid,
+                shard_make_block_abspath (shard_idx_iter, base_inode->gfid,
                                           path, sizeof(path));
 
                 xattr_req = shard_create_gfid_dict (local->xattr_req);
@@ -1331,29 +1441,43 @@ err:
         return 0;
 }
 
+/* Finds the inodes of the shards in [first_block, last_block], from the
+ * inode table where possible. The missing ones are created for writes and
+ * looked up for everything else, then @post_res_handler is called. Without
+ * a /.shard there are no shards beyond the base file, so they are all holes.
+ */
 int
-shard_common_resolve_shards (call_frame_t *frame, xlator_t *this)
+shard_common_resolve_shards (call_frame_t *frame, xlator_t *this,
+                             shard_post_fop_handler_t post_res_handler)
 {
         int            i              = -1;
         uint32_t       shard_idx_iter = 0;
         char           path[PATH_MAX] = {0,};
-        fd_t          *fd             = NULL;
+        inode_t       *base_inode     = NULL;
         inode_t       *inode          = NULL;
         shard_local_t *local          = NULL;
+        shard_priv_t  *priv           = NULL;
 
         local = frame->local;
-        fd = local->fd;
+        priv = this->private;
+        base_inode = local->resolver_base_inode;
         shard_idx_iter = local->first_block;
+        local->post_res_handler = post_res_handler;
 
         while (shard_idx_iter <= local->last_block) {
                 i++;
                 if (shard_idx_iter == 0) {
-                        local->inode_list[i] = inode_ref (fd->inode);
+                        local->inode_list[i] = inode_ref (base_inode);
+                        shard_idx_iter++;
+                        continue;
+                }
+
+                if (!priv->dot_shard_inode) {
                         shard_idx_iter++;
                         continue;
                 }
 
-                shard_make_block_abspath (shard_idx_iter, fd->inode->gfid,
+                shard_make_block_abspath (shard_idx_iter, base_inode->gfid,
                                           path, sizeof(path));
 
                 inode = NULL;
@@ -1376,10 +1500,12 @@ shard_common_resolve_shards (call_frame_t *frame, xlator_t *this)
                 }
         }
 
-        if (local->call_count)
+        if (!local->call_count)
+                post_res_handler (frame, this);
+        else if (local->fop == GF_FOP_WRITE)
                 shard_writev_resume_mknod (frame, this);
         else
-                shard_lookup_base_file (frame, this);
+                shard_common_lookup_shards (frame, this);
 
         return 0;
 }
@@ -1409,8 +1535,15 @@ shard_lookup_dot_shard_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 
         local = frame->local;
 
-        if (op_ret)
+        if (op_ret) {
+                /* no shard was ever created on this volume */
+                if ((op_errno == ENOENT) && (local->fop != GF_FOP_WRITE)) {
+                        shard_common_resolve_shards (frame, this,
+                                                     local->post_res_handler);
+                        return 0;
+                }
                 goto unwind;
+        }
 
         if (!IA_ISDIR (buf->ia_type)) {
                 gf_log (this->name, GF_LOG_CRITICAL, "/.shard already exists "
@@ -1421,16 +1554,45 @@ shard_lookup_dot_shard_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         }
 
         shard_link_dot_shard_inode (local, inode, buf);
-        shard_common_resolve_shards (frame, this);
+        shard_common_resolve_shards (frame, this, local->post_res_handler);
         return 0;
 
 unwind:
-        SHARD_STACK_UNWIND (writev, frame, -1, op_errno, NULL, NULL, NULL);
+        shard_common_failure_unwind (local->fop, frame, -1, op_errno);
+        return 0;
+}
+
+int
+shard_init_dot_shard_loc (xlator_t *this, shard_local_t *local)
+{
+        int    ret           = -1;
+        loc_t *dot_shard_loc = NULL;
+
+        dot_shard_loc = &local->dot_shard_loc;
+
+        dot_shard_loc->inode = inode_new (this->itable);
+        dot_shard_loc->parent = inode_ref (this->itable->root);
+        ret = inode_path (dot_shard_loc->parent, GF_SHARD_DIR,
+                          (char **)&dot_shard_loc->path);
+        if (ret < 0 || !(dot_shard_loc->inode)) {
+                gf_log (this->name, GF_LOG_ERROR, "Inode path failed on"
+                        " %s", GF_SHARD_DIR);
+                return -1;
+        }
+
+        dot_shard_loc->name = strrchr (dot_shard_loc->path, '/');
+        if (dot_shard_loc->name)
+                dot_shard_loc->name++;
+
         return 0;
 }
 
+/* Looks up /.shard, then resolves the shards of the fop and continues with
+ * @post_res_handler.
+ */
 int
-shard_lookup_dot_shard (call_frame_t *frame, xlator_t *this)
+shard_lookup_dot_shard (call_frame_t *frame, xlator_t *this,
+                        shard_post_fop_handler_t post_res_handler)
 {
         int                 ret       = -1;
         dict_t             *xattr_req = NULL;
@@ -1439,14 +1601,19 @@ shard_lookup_dot_shard (call_frame_t *frame, xlator_t *this)
 
         local = frame->local;
         priv = this->private;
+        local->post_res_handler = post_res_handler;
 
         xattr_req = dict_new ();
         if (!xattr_req)
                 goto err;
 
+        if (!local->dot_shard_loc.inode &&
+            shard_init_dot_shard_loc (this, local))
+                goto err;
+
         ret = dict_set_static_bin (xattr_req, "gfid-req", priv->dot_shard_gfid,
                                    16);
-        if (!ret) {
+        if (ret) {
                 gf_log (this->name, GF_LOG_ERROR, "Failed to set gfid of "
                         "/.shard into dict");
                 goto err;
@@ -1461,7 +1628,14 @@ shard_lookup_dot_shard (call_frame_t *frame, xlator_t *this)
 err:
         if (xattr_req)
                 dict_unref (xattr_req);
-        SHARD_STACK_UNWIND (writev, frame, -1, ENOMEM, NULL, NULL, NULL);
+        shard_common_failure_unwind (local->fop, frame, -1, ENOMEM);
+        return 0;
+}
+
+int
+shard_post_resolve_writev_handler (call_frame_t *frame, xlator_t *this)
+{
+        shard_lookup_base_file (frame, this, shard_writev_do);
         return 0;
 }
 
@@ -1482,13 +1656,15 @@ shard_writev_mkdir_dot_shard_cbk (call_frame_t *frame, void *cookie,
                 } else {
                         gf_log (this->name, GF_LOG_DEBUG, "mkdir on /.shard "
                                 "failed with EEXIST. Attempting lookup now");
-                        shard_lookup_dot_shard (frame, this);
+                        shard_lookup_dot_shard (frame, this,
+                                           shard_post_resolve_writev_handler);
                         return 0;
                 }
         }
 
         shard_link_dot_shard_inode (local, inode, buf);
-        shard_common_resolve_shards (frame, this);
+        shard_common_resolve_shards (frame, this,
+                                     shard_post_resolve_writev_handler);
         return 0;
 
 unwind:
@@ -1502,7 +1678,6 @@ shard_writev_mkdir_dot_shard (call_frame_t *frame, xlator_t *this)
         int             ret           = -1;
         shard_local_t  *local         = NULL;
         shard_priv_t   *priv          = NULL;
-        loc_t          *dot_shard_loc = NULL;
         dict_t         *xattr_req     = NULL;
 
         local = frame->local;
@@ -1512,21 +1687,9 @@ shard_writev_mkdir_dot_shard (call_frame_t *frame, xlator_t *this)
         if (!xattr_req)
                 goto err;
 
-        dot_shard_loc = &local->dot_shard_loc;
-
-        dot_shard_loc->inode = inode_new (this->itable);
-        dot_shard_loc->parent = inode_ref (this->itable->root);
-        ret = inode_path (dot_shard_loc->parent, GF_SHARD_DIR,
-                                          (char **)&dot_shard_loc->path);
-        if (ret < 0) {
-                gf_log (this->name, GF_LOG_ERROR, "Inode path failed on"
-                        " %s", GF_SHARD_DIR);
+        ret = shard_init_dot_shard_loc (this, local);
+        if (ret)
                 goto err;
-        }
-
-        dot_shard_loc->name = strrchr (dot_shard_loc->path, '/');
-        if (dot_shard_loc->name)
-                dot_shard_loc->name++;
 
         ret = dict_set_static_bin (xattr_req, "gfid-req", priv->dot_shard_gfid,
                                    16);
@@ -1556,7 +1719,10 @@ shard_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
 {
         int             ret            = 0;
         int             i              = 0;
+        int             last_block     = 0;
+        size_t          total_size     = 0;
         uint64_t        block_size     = 0;
+        call_stub_t    *stub           = NULL;
         shard_local_t  *local          = NULL;
         shard_priv_t   *priv           = NULL;
 
@@ -1583,12 +1749,30 @@ shard_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
         if (!this->itable)
                 this->itable = fd->inode->table;
 
+        /* Writes into shards a background truncate is still unlinking wait
+         * for it, or the new shards could be removed with the old ones.
+         */
+        for (i = 0; i < count; i++)
+                total_size += vector[i].iov_len;
+        last_block = get_highest_block (offset, total_size, block_size);
+        if (shard_bg_truncate_pending (this, fd->inode, last_block)) {
+                stub = fop_writev_stub (frame, shard_writev, fd, vector, count,
+                                        offset, flags, iobref, xdata);
+                if (!stub)
+                        goto out;
+                if (!shard_bg_truncate_wait (this, fd->inode, last_block,
+                                             stub))
+                        return 0;
+                call_stub_destroy (stub);
+        }
+
         local = mem_get0 (this->local_pool);
         if (!local)
                 goto out;
 
         frame->local = local;
 
+        local->fop = GF_FOP_WRITE;
         local->xattr_req = (xdata) ? dict_ref (xdata) : dict_new ();
         if (!local->xattr_req)
                 goto out;
@@ -1597,18 +1781,16 @@ shard_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
         if (!local->vector)
                 goto out;
 
-        for (i = 0; i < count; i++)
-                local->total_size += vector[i].iov_len;
-
+        local->total_size = total_size;
         local->count = count;
         local->offset = offset;
         local->flags = flags;
         local->iobref = iobref_ref (iobref);
         local->fd = fd_ref (fd);
+        local->resolver_base_inode = fd->inode;
         local->block_size = block_size;
         local->first_block = get_lowest_block (offset, local->block_size);
-        local->last_block = get_highest_block (offset, local->total_size,
-                                               local->block_size);
+        local->last_block = last_block;
         local->num_blocks = local->last_block - local->first_block + 1;
         local->inode_list = GF_CALLOC (local->num_blocks, sizeof (inode_t *),
                                        gf_shard_mt_inode_list);
@@ -1626,7 +1808,8 @@ shard_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
         if (!local->dot_shard_loc.inode)
                 shard_writev_mkdir_dot_shard (frame, this);
         else
-                shard_common_resolve_shards (frame, this);
+                shard_common_resolve_shards (frame, this,
+                                           shard_post_resolve_writev_handler);
 
         return 0;
 out:
@@ -1635,36 +1818,891 @@ out:
 }
 
 int
-shard_flush_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
-                 int32_t op_ret, int32_t op_errno, dict_t *xdata)
-{
-        /* To-Do: Wind flush on all shards of the file */
-        SHARD_STACK_UNWIND (flush, frame, op_ret, op_errno, xdata);
-        return 0;
-}
+shard_readv_do_unwind (call_frame_t *frame, xlator_t *this)
+{
+        int                  i      = 0;
+        int                  j      = 0;
+        int                  count  = 0;
+        size_t               pad    = 0;
+        size_t               gap    = 0;
+        char                *zeroes = NULL;
+        struct iovec        *vector = NULL;
+        struct iobuf        *iobuf  = NULL;
+        struct iobref       *iobref = NULL;
+        shard_read_block_t  *block  = NULL;
+        shard_local_t       *local  = NULL;
 
-int
-shard_flush (call_frame_t *frame, xlator_t *this, fd_t *fd, dict_t *xdata)
-{
-        STACK_WIND (frame, shard_flush_cbk, FIRST_CHILD(this),
-                    FIRST_CHILD(this)->fops->flush, fd, xdata);
+        local = frame->local;
+
+        if (local->op_ret < 0)
+                goto err;
+
+        /* Holes and shards shorter than the file size claims read as
+         * zeroes, carved out of a single zeroed buffer. The data itself is
+         * passed up in the buffers it was read into.
+         */
+        for (i = 0; i < local->num_blocks; i++) {
+                block = &local->read_blocks[i];
+                count += block->count;
+                if (block->op_ret < block->size) {
+                        pad += block->size - block->op_ret;
+                        count++;
+                }
+        }
+
+        vector = GF_CALLOC (count, sizeof (struct iovec), gf_shard_mt_iovec);
+        iobref = iobref_new ();
+        if (!vector || !iobref)
+                goto nomem;
+
+        if (pad) {
+                iobuf = iobuf_get2 (this->ctx->iobuf_pool, pad);
+                if (!iobuf)
+                        goto nomem;
+                memset (iobuf->ptr, 0, pad);
+                iobref_add (iobref, iobuf);
+                zeroes = iobuf->ptr;
+                iobuf_unref (iobuf);
+        }
+
+        for (i = 0; i < local->num_blocks; i++) {
+                block = &local->read_blocks[i];
+                if (block->count) {
+                        memcpy (&vector[j], block->vector,
+                                block->count * sizeof (struct iovec));
+                        j += block->count;
+                        iobref_merge (iobref, block->iobref);
+                }
+
+                if (block->op_ret < block->size) {
+                        gap = block->size - block->op_ret;
+                        vector[j].iov_base = zeroes;
+                        vector[j].iov_len = gap;
+                        zeroes += gap;
+                        j++;
+                }
+        }
+
+        SHARD_STACK_UNWIND (readv, frame, local->total_size, 0, vector, count,
+                            &local->prebuf, iobref, NULL);
+        GF_FREE (vector);
+        iobref_unref (iobref);
         return 0;
-}
 
-int
-shard_fsync_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
-                 int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
-                 struct iatt *postbuf, dict_t *xdata)
-{
-        /* To-Do: Wind fsync on all shards of the file */
-        SHARD_STACK_UNWIND (fsync, frame, op_ret, op_errno, prebuf, postbuf,
-                            xdata);
+nomem:
+        local->op_errno = ENOMEM;
+        GF_FREE (vector);
+        if (iobref)
+                iobref_unref (iobref);
+err:
+        SHARD_STACK_UNWIND (readv, frame, -1, local->op_errno, NULL, 0, NULL,
+                            NULL, NULL);
         return 0;
 }
 
 int
-shard_fsync (call_frame_t *frame, xlator_t *this, fd_t *fd, int32_t datasync,
-             dict_t *xdata)
+shard_readv_do_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                    int32_t op_ret, int32_t op_errno, struct iovec *vector,
+                    int32_t count, struct iatt *stbuf, struct iobref *iobref,
+                    dict_t *xdata)
+{
+        int                  call_count = 0;
+        shard_read_block_t  *block      = NULL;
+        shard_local_t       *local      = NULL;
+
+        local = frame->local;
+        block = &local->read_blocks[(long) cookie];
+
+        if (op_ret < 0) {
+                local->op_ret = op_ret;
+                local->op_errno = op_errno;
+                goto done;
+        }
+
+        block->op_ret = op_ret;
+        if (op_ret > 0) {
+                block->vector = iov_dup (vector, count);
+                if (!block->vector) {
+                        local->op_ret = -1;
+                        local->op_errno = ENOMEM;
+                        goto done;
+                }
+                block->count = count;
+                block->iobref = iobref_ref (iobref);
+        }
+
+done:
+        call_count = shard_call_count_return (frame);
+        if (call_count == 0)
+                shard_readv_do_unwind (frame, this);
+
+        return 0;
+}
+
+int32_t
+shard_readv_do (call_frame_t *frame, xlator_t *this)
+{
+        int             i            = 0;
+        int             call_count   = 0;
+        uint32_t        cur_block    = 0;
+        uint32_t        flags        = 0;
+        fd_t           *fd           = NULL;
+        fd_t           *anon_fd      = NULL;
+        dict_t         *xattr_req    = NULL;
+        shard_local_t  *local        = NULL;
+        off_t           shard_offset = 0;
+        size_t          read_size    = 0;
+
+        local = frame->local;
+        fd = local->fd;
+        flags = local->flags;
+        xattr_req = local->xattr_req;
+        cur_block = local->first_block;
+        shard_offset = local->offset % local->block_size;
+        local->call_count = call_count = local->num_blocks;
+
+        /* The last callback unwinds, @local must not be touched after the
+         * last read has been wound.
+         */
+        for (i = 0; i < call_count; i++, cur_block++, shard_offset = 0) {
+                read_size = local->read_blocks[i].size;
+
+                if (cur_block == 0) {
+                        anon_fd = fd_ref (fd);
+                } else if (!local->inode_list[i]) {
+                        /* hole */
+                        shard_readv_do_cbk (frame, (void *) (long) i, this, 0,
+                                            0, NULL, 0, NULL, NULL, NULL);
+                        continue;
+                } else {
+                        anon_fd = fd_anonymous (local->inode_list[i]);
+                        if (!anon_fd) {
+                                shard_readv_do_cbk (frame, (void *) (long) i,
+                                                    this, -1, ENOMEM, NULL, 0,
+                                                    NULL, NULL, NULL);
+                                continue;
+                        }
+                }
+
+                local->read_blocks[i].fd = anon_fd;
+
+                STACK_WIND_COOKIE (frame, shard_readv_do_cbk, (void *) (long) i,
+                                   FIRST_CHILD(this),
+                                   FIRST_CHILD(this)->fops->readv, anon_fd,
+                                   read_size, shard_offset, flags, xattr_req);
+        }
+
+        return 0;
+}
+
+int
+shard_post_lookup_readv_handler (call_frame_t *frame, xlator_t *this)
+{
+        int             i           = 0;
+        off_t           offset      = 0;
+        size_t          remaining   = 0;
+        size_t          read_size   = 0;
+        struct iovec    vec         = {0,};
+        struct iobref  *iobref      = NULL;
+        shard_local_t  *local       = NULL;
+        shard_priv_t   *priv        = NULL;
+
+        local = frame->local;
+        priv = this->private;
+
+        if ((local->offset >= local->prebuf.ia_size) || !local->total_size) {
+                /* at or past EOF */
+                iobref = iobref_new ();
+                if (!iobref)
+                        goto err;
+                SHARD_STACK_UNWIND (readv, frame, 0, 0, &vec, 1,
+                                    &local->prebuf, iobref, NULL);
+                iobref_unref (iobref);
+                return 0;
+        }
+
+        if (local->offset + local->total_size > local->prebuf.ia_size)
+                local->total_size = local->prebuf.ia_size - local->offset;
+
+        local->first_block = get_lowest_block (local->offset,
+                                               local->block_size);
+        local->last_block = get_highest_block (local->offset,
+                                               local->total_size,
+                                               local->block_size);
+        local->num_blocks = local->last_block - local->first_block + 1;
+
+        local->inode_list = GF_CALLOC (local->num_blocks, sizeof (inode_t *),
+                                       gf_shard_mt_inode_list);
+        local->read_blocks = GF_CALLOC (local->num_blocks,
+                                        sizeof (shard_read_block_t),
+                                        gf_shard_mt_read_blocks);
+        if (!local->inode_list || !local->read_blocks)
+                goto err;
+
+        offset = local->offset;
+        remaining = local->total_size;
+        for (i = 0; i < local->num_blocks; i++) {
+                read_size = local->block_size - (offset % local->block_size);
+                if (read_size > remaining)
+                        read_size = remaining;
+                local->read_blocks[i].size = read_size;
+                offset += read_size;
+                remaining -= read_size;
+        }
+
+        gf_log (this->name, GF_LOG_TRACE, "gfid=%s first_block=%d "
+                "last_block=%d num_blocks=%d offset=%"PRId64" total_size=%zu",
+                uuid_utoa (local->resolver_base_inode->gfid),
+                local->first_block, local->last_block, local->num_blocks,
+                local->offset, local->total_size);
+
+        if (local->last_block && !priv->dot_shard_inode)
+                shard_lookup_dot_shard (frame, this, shard_readv_do);
+        else
+                shard_common_resolve_shards (frame, this, shard_readv_do);
+
+        return 0;
+
+err:
+        SHARD_STACK_UNWIND (readv, frame, -1, ENOMEM, NULL, 0, NULL, NULL,
+                            NULL);
+        return 0;
+}
+
+int
+shard_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
+             off_t offset, uint32_t flags, dict_t *xdata)
+{
+        int             ret        = 0;
+        uint64_t        block_size = 0;
+        shard_local_t  *local      = NULL;
+
+        ret = shard_inode_ctx_get_block_size (fd->inode, this, &block_size);
+        if (ret) {
+                gf_log (this->name, GF_LOG_ERROR, "Failed to get block size "
+                        "for %s from its inode ctx",
+                        uuid_utoa (fd->inode->gfid));
+                goto err;
+        }
+
+        if (!block_size) {
+                /* block_size = 0 means that the file was created before
+                 * sharding was enabled on the volume.
+                 */
+                STACK_WIND (frame, default_readv_cbk, FIRST_CHILD(this),
+                            FIRST_CHILD(this)->fops->readv, fd, size, offset,
+                            flags, xdata);
+                return 0;
+        }
+
+        if (!this->itable)
+                this->itable = fd->inode->table;
+
+        local = mem_get0 (this->local_pool);
+        if (!local)
+                goto err;
+
+        frame->local = local;
+
+        local->fop = GF_FOP_READ;
+        local->fd = fd_ref (fd);
+        local->resolver_base_inode = fd->inode;
+        local->block_size = block_size;
+        local->offset = offset;
+        local->total_size = size;
+        local->flags = flags;
+        if (xdata)
+                local->xattr_req = dict_ref (xdata);
+
+        shard_lookup_base_file (frame, this, shard_post_lookup_readv_handler);
+        return 0;
+
+err:
+        SHARD_STACK_UNWIND (readv, frame, -1, ENOMEM, NULL, 0, NULL, NULL,
+                            NULL);
+        return 0;
+}
+
+int
+shard_truncate_tail_batch (call_frame_t *frame, xlator_t *this);
+
+int
+shard_truncate_tail_done (call_frame_t *frame, xlator_t *this)
+{
+        shard_local_t  *local = NULL;
+
+        local = frame->local;
+        frame->local = NULL;
+
+        shard_bg_truncate_done (this, local->resolver_base_inode);
+
+        shard_local_wipe (local);
+        mem_put (local);
+        STACK_DESTROY (frame->root);
+        return 0;
+}
+
+int
+shard_truncate_tail_unlink_cbk (call_frame_t *frame, void *cookie,
+                                xlator_t *this, int32_t op_ret,
+                                int32_t op_errno, struct iatt *preparent,
+                                struct iatt *postparent, dict_t *xdata)
+{
+        int             i                      = (long) cookie;
+        int             call_count             = 0;
+        char            block_bname[256]       = {0,};
+        shard_priv_t   *priv                   = NULL;
+        shard_local_t  *local                  = NULL;
+
+        local = frame->local;
+        priv = this->private;
+
+        if ((op_ret < 0) && (op_errno != ENOENT)) {
+                gf_log (this->name, GF_LOG_WARNING, "Failed to remove shard "
+                        "%d of %s (%s)", local->first_block + i,
+                        uuid_utoa (local->resolver_base_inode->gfid),
+                        strerror (op_errno));
+        } else {
+                /* later writes to this block must create a new shard */
+                shard_make_block_bname (local->first_block + i,
+                                        local->resolver_base_inode->gfid,
+                                        block_bname, sizeof (block_bname));
+                inode_unlink (local->inode_list[i], priv->dot_shard_inode,
+                              block_bname);
+        }
+
+        call_count = shard_call_count_return (frame);
+        if (call_count == 0) {
+                local->first_block = local->last_block + 1;
+                shard_truncate_tail_batch (frame, this);
+        }
+
+        return 0;
+}
+
+int
+shard_truncate_tail_unlink (call_frame_t *frame, xlator_t *this)
+{
+        int             i                = 0;
+        int             call_count       = 0;
+        int             num_blocks       = 0;
+        int             ret              = 0;
+        char            block_bname[256] = {0,};
+        loc_t           loc              = {0,};
+        shard_priv_t   *priv             = NULL;
+        shard_local_t  *local            = NULL;
+
+        local = frame->local;
+        priv = this->private;
+        num_blocks = local->num_blocks;
+
+        for (i = 0; i < num_blocks; i++) {
+                if (local->inode_list[i])
+                        call_count++;
+        }
+
+        if (!call_count) {
+                local->first_block = local->last_block + 1;
+                shard_truncate_tail_batch (frame, this);
+                return 0;
+        }
+
+        /* The last callback moves on to the next batch and replaces
+         * inode_list, stop looking at it once every unlink is wound.
+         */
+        local->call_count = call_count;
+        for (i = 0; i < num_blocks; i++) {
+                if (!local->inode_list[i])
+                        continue;
+
+                shard_make_block_bname (local->first_block + i,
+                                        local->resolver_base_inode->gfid,
+                                        block_bname, sizeof (block_bname));
+
+                loc.inode = inode_ref (local->inode_list[i]);
+                loc.parent = inode_ref (priv->dot_shard_inode);
+                gf_uuid_copy (loc.gfid, loc.inode->gfid);
+                ret = inode_path (loc.parent, block_bname,
+                                  (char **) &(loc.path));
+                if (ret < 0) {
+                        gf_log (this->name, GF_LOG_ERROR, "Inode path failed "
+                                "on %s", block_bname);
+                        loc_wipe (&loc);
+                        shard_truncate_tail_unlink_cbk (frame,
+                                                        (void *) (long) i,
+                                                        this, -1, ENOMEM, NULL,
+                                                        NULL, NULL);
+                        goto next;
+                }
+
+                loc.name = strrchr (loc.path, '/');
+                if (loc.name)
+                        loc.name++;
+
+                STACK_WIND_COOKIE (frame, shard_truncate_tail_unlink_cbk,
+                                   (void *) (long) i, FIRST_CHILD(this),
+                                   FIRST_CHILD(this)->fops->unlink, &loc, 0,
+                                   NULL);
+                loc_wipe (&loc);
+next:
+                if (!--call_count)
+                        break;
+        }
+
+        return 0;
+}
+
+/* Resolves and unlinks the next SHARD_TRUNCATE_BATCH shards of the tail. */
+int
+shard_truncate_tail_batch (call_frame_t *frame, xlator_t *this)
+{
+        int             i     = 0;
+        shard_priv_t   *priv  = NULL;
+        shard_local_t  *local = NULL;
+
+        local = frame->local;
+        priv = this->private;
+
+        for (i = 0; local->inode_list && (i < local->num_blocks); i++) {
+                if (local->inode_list[i])
+                        inode_unref (local->inode_list[i]);
+        }
+        GF_FREE (local->inode_list);
+        local->inode_list = NULL;
+        local->num_blocks = 0;
+
+        if ((local->first_block > local->truncate.tail_last) ||
+            !priv->dot_shard_inode) {
+                shard_truncate_tail_done (frame, this);
+                return 0;
+        }
+
+        local->last_block = local->first_block + SHARD_TRUNCATE_BATCH - 1;
+        if (local->last_block > local->truncate.tail_last)
+                local->last_block = local->truncate.tail_last;
+
+        local->num_blocks = local->last_block - local->first_block + 1;
+        local->inode_list = GF_CALLOC (local->num_blocks, sizeof (inode_t *),
+                                       gf_shard_mt_inode_list);
+        if (!local->inode_list) {
+                local->num_blocks = 0;
+                shard_common_failure_unwind (local->fop, frame, -1, ENOMEM);
+                return 0;
+        }
+
+        local->call_count = 0;
+        shard_common_resolve_shards (frame, this, shard_truncate_tail_unlink);
+        return 0;
+}
+
+/* Sets up the frame that unlinks the shards past the new end of the file,
+ * so that the truncate does not wait for what can be thousands of unlinks.
+ * Writes and truncates that reach into the tail wait for it from now on.
+ * This happens before the truncate changes anything, so that it can still
+ * fail without leaving the tail shards behind.
+ */
+int
+shard_truncate_tail_prepare (call_frame_t *frame, xlator_t *this)
+{
+        int             ret      = -1;
+        call_frame_t   *bg_frame = NULL;
+        shard_local_t  *local    = NULL;
+        shard_local_t  *bg_local = NULL;
+
+        local = frame->local;
+
+        bg_frame = copy_frame (frame);
+        if (!bg_frame)
+                goto err;
+
+        bg_frame->root->uid = 0;
+        bg_frame->root->gid = 0;
+
+        bg_local = mem_get0 (this->local_pool);
+        if (!bg_local)
+                goto err;
+
+        bg_frame->local = bg_local;
+
+        bg_local->fop = GF_FOP_TRUNCATE;
+        bg_local->truncate.background = _gf_true;
+        bg_local->loc.inode = inode_ref (local->resolver_base_inode);
+        gf_uuid_copy (bg_local->loc.gfid, bg_local->loc.inode->gfid);
+        bg_local->resolver_base_inode = bg_local->loc.inode;
+        bg_local->block_size = local->block_size;
+        bg_local->first_block = local->truncate.tail_first;
+        bg_local->truncate.tail_first = local->truncate.tail_first;
+        bg_local->truncate.tail_last = local->truncate.tail_last;
+
+        ret = shard_bg_truncate_start (this, bg_local->resolver_base_inode,
+                                       bg_local->first_block);
+        if (ret)
+                goto err;
+
+        local->truncate.bg_frame = bg_frame;
+        return 0;
+
+err:
+        gf_log (this->name, GF_LOG_ERROR, "Failed to set up the removal of "
+                "shards %d-%d of %s", local->truncate.tail_first,
+                local->truncate.tail_last,
+                uuid_utoa (local->resolver_base_inode->gfid));
+        if (bg_frame) {
+                bg_frame->local = NULL;
+                if (bg_local) {
+                        shard_local_wipe (bg_local);
+                        mem_put (bg_local);
+                }
+                STACK_DESTROY (bg_frame->root);
+        }
+        return -1;
+}
+
+/* The truncate failed, nothing is unlinked */
+void
+shard_truncate_tail_cancel (call_frame_t *frame, xlator_t *this)
+{
+        shard_local_t  *local = NULL;
+
+        local = frame->local;
+
+        shard_truncate_tail_done (local->truncate.bg_frame, this);
+        local->truncate.bg_frame = NULL;
+}
+
+void
+shard_truncate_tail_begin (call_frame_t *frame, xlator_t *this)
+{
+        call_frame_t   *bg_frame = NULL;
+        shard_local_t  *local    = NULL;
+
+        local = frame->local;
+
+        bg_frame = local->truncate.bg_frame;
+        local->truncate.bg_frame = NULL;
+
+        shard_truncate_tail_batch (bg_frame, this);
+}
+
+int
+shard_post_update_size_truncate_handler (call_frame_t *frame, xlator_t *this)
+{
+        shard_local_t  *local = NULL;
+
+        local = frame->local;
+
+        if (local->truncate.bg_frame)
+                shard_truncate_tail_begin (frame, this);
+
+        if (local->fop == GF_FOP_TRUNCATE)
+                SHARD_STACK_UNWIND (truncate, frame, 0, 0, &local->prebuf,
+                                    &local->postbuf, NULL);
+        else
+                SHARD_STACK_UNWIND (ftruncate, frame, 0, 0, &local->prebuf,
+                                    &local->postbuf, NULL);
+        return 0;
+}
+
+int
+shard_truncate_do_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                       int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                       struct iatt *postbuf, dict_t *xdata)
+{
+        int64_t         blocks  = 0;
+        int64_t         max     = 0;
+        fd_t           *anon_fd = cookie;
+        shard_local_t  *local   = NULL;
+
+        local = frame->local;
+
+        if (anon_fd)
+                fd_unref (anon_fd);
+
+        if (op_ret < 0) {
+                shard_common_failure_unwind (local->fop, frame, op_ret,
+                                             op_errno);
+                return 0;
+        }
+
+        if (prebuf && postbuf)
+                local->truncate.block_delta = postbuf->ia_blocks -
+                                              prebuf->ia_blocks;
+
+        /* The blocks held by the tail shards are only known once they are
+         * unlinked; until then the count is bounded by the new size.
+         */
+        blocks = local->prebuf.ia_blocks + local->truncate.block_delta;
+        if (local->truncate.tail_first) {
+                max = (local->truncate.new_size + 511) / 512;
+                if (blocks > max)
+                        blocks = max;
+        }
+        if (blocks < 0)
+                blocks = 0;
+
+        local->postbuf.ia_size = local->truncate.new_size;
+        local->postbuf.ia_blocks = blocks;
+
+        shard_update_file_size (frame, this,
+                                shard_post_update_size_truncate_handler);
+        return 0;
+}
+
+/* Truncates the block that holds the new end of the file. The base file is
+ * always truncated to the new size when it is that block; a shard is only
+ * shrunk, since extending is all in the size xattr.
+ */
+int32_t
+shard_truncate_do (call_frame_t *frame, xlator_t *this)
+{
+        off_t           shard_size = 0;
+        fd_t           *anon_fd    = NULL;
+        shard_local_t  *local      = NULL;
+
+        local = frame->local;
+
+        if (local->truncate.trunc_block == 0) {
+                if (local->fd)
+                        STACK_WIND (frame, shard_truncate_do_cbk,
+                                    FIRST_CHILD(this),
+                                    FIRST_CHILD(this)->fops->ftruncate,
+                                    local->fd, local->truncate.new_size,
+                                    local->xattr_req);
+                else
+                        STACK_WIND (frame, shard_truncate_do_cbk,
+                                    FIRST_CHILD(this),
+                                    FIRST_CHILD(this)->fops->truncate,
+                                    &local->loc, local->truncate.new_size,
+                                    local->xattr_req);
+                return 0;
+        }
+
+        if ((local->truncate.new_size >= local->prebuf.ia_size) ||
+            !local->inode_list[0]) {
+                /* extending, or the block is a hole */
+                shard_truncate_do_cbk (frame, NULL, this, 0, 0, NULL, NULL,
+                                       NULL);
+                return 0;
+        }
+
+        anon_fd = fd_anonymous (local->inode_list[0]);
+        if (!anon_fd) {
+                shard_common_failure_unwind (local->fop, frame, -1, ENOMEM);
+                return 0;
+        }
+
+        shard_size = local->truncate.new_size -
+                     (local->truncate.trunc_block * local->block_size);
+
+        STACK_WIND_COOKIE (frame, shard_truncate_do_cbk, anon_fd,
+                           FIRST_CHILD(this),
+                           FIRST_CHILD(this)->fops->ftruncate, anon_fd,
+                           shard_size, local->xattr_req);
+        return 0;
+}
+
+int
+shard_post_lookup_truncate_handler (call_frame_t *frame, xlator_t *this)
+{
+        int             last_block = 0;
+        off_t           new_size   = 0;
+        off_t           old_size   = 0;
+        shard_local_t  *local      = NULL;
+        shard_priv_t   *priv       = NULL;
+
+        local = frame->local;
+        priv = this->private;
+
+        new_size = local->truncate.new_size;
+        old_size = local->prebuf.ia_size;
+
+        local->truncate.trunc_block = (new_size) ?
+                get_lowest_block (new_size - 1, local->block_size) : 0;
+
+        if ((new_size < old_size) && old_size) {
+                last_block = get_lowest_block (old_size - 1, local->block_size);
+                if (last_block > local->truncate.trunc_block) {
+                        local->truncate.tail_first =
+                                local->truncate.trunc_block + 1;
+                        local->truncate.tail_last = last_block;
+                }
+        }
+
+        if (local->truncate.tail_first &&
+            shard_truncate_tail_prepare (frame, this)) {
+                shard_common_failure_unwind (local->fop, frame, -1, ENOMEM);
+                return 0;
+        }
+
+        local->first_block = local->last_block = local->truncate.trunc_block;
+        local->num_blocks = 1;
+        local->inode_list = GF_CALLOC (local->num_blocks, sizeof (inode_t *),
+                                       gf_shard_mt_inode_list);
+        if (!local->inode_list) {
+                shard_common_failure_unwind (local->fop, frame, -1, ENOMEM);
+                return 0;
+        }
+
+        if ((new_size < old_size) && last_block && !priv->dot_shard_inode)
+                shard_lookup_dot_shard (frame, this, shard_truncate_do);
+        else
+                shard_common_resolve_shards (frame, this, shard_truncate_do);
+
+        return 0;
+}
+
+int
+shard_truncate (call_frame_t *frame, xlator_t *this, loc_t *loc, off_t offset,
+                dict_t *xdata)
+{
+        int             ret        = 0;
+        uint64_t        block_size = 0;
+        call_stub_t    *stub       = NULL;
+        shard_local_t  *local      = NULL;
+
+        ret = shard_inode_ctx_get_block_size (loc->inode, this, &block_size);
+        if (ret) {
+                gf_log (this->name, GF_LOG_ERROR, "Failed to get block size "
+                        "for %s from its inode ctx",
+                        uuid_utoa (loc->inode->gfid));
+                goto err;
+        }
+
+        if (!block_size) {
+                STACK_WIND (frame, default_truncate_cbk, FIRST_CHILD(this),
+                            FIRST_CHILD(this)->fops->truncate, loc, offset,
+                            xdata);
+                return 0;
+        }
+
+        if (!this->itable)
+                this->itable = loc->inode->table;
+
+        /* Any truncate can reach into a tail that is still being removed */
+        if (shard_bg_truncate_pending (this, loc->inode, INT_MAX)) {
+                stub = fop_truncate_stub (frame, shard_truncate, loc, offset,
+                                          xdata);
+                if (!stub)
+                        goto err;
+                if (!shard_bg_truncate_wait (this, loc->inode, INT_MAX, stub))
+                        return 0;
+                call_stub_destroy (stub);
+        }
+
+        local = mem_get0 (this->local_pool);
+        if (!local)
+                goto err;
+
+        frame->local = local;
+
+        local->fop = GF_FOP_TRUNCATE;
+        loc_copy (&local->loc, loc);
+        local->resolver_base_inode = loc->inode;
+        local->block_size = block_size;
+        local->truncate.new_size = offset;
+        if (xdata)
+                local->xattr_req = dict_ref (xdata);
+
+        shard_lookup_base_file (frame, this,
+                                shard_post_lookup_truncate_handler);
+        return 0;
+
+err:
+        SHARD_STACK_UNWIND (truncate, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+}
+
+int
+shard_ftruncate (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+                 dict_t *xdata)
+{
+        int             ret        = 0;
+        uint64_t        block_size = 0;
+        call_stub_t    *stub       = NULL;
+        shard_local_t  *local      = NULL;
+
+        ret = shard_inode_ctx_get_block_size (fd->inode, this, &block_size);
+        if (ret) {
+                gf_log (this->name, GF_LOG_ERROR, "Failed to get block size "
+                        "for %s from its inode ctx",
+                        uuid_utoa (fd->inode->gfid));
+                goto err;
+        }
+
+        if (!block_size) {
+                STACK_WIND (frame, default_ftruncate_cbk, FIRST_CHILD(this),
+                            FIRST_CHILD(this)->fops->ftruncate, fd, offset,
+                            xdata);
+                return 0;
+        }
+
+        if (!this->itable)
+                this->itable = fd->inode->table;
+
+        if (shard_bg_truncate_pending (this, fd->inode, INT_MAX)) {
+                stub = fop_ftruncate_stub (frame, shard_ftruncate, fd, offset,
+                                           xdata);
+                if (!stub)
+                        goto err;
+                if (!shard_bg_truncate_wait (this, fd->inode, INT_MAX, stub))
+                        return 0;
+                call_stub_destroy (stub);
+        }
+
+        local = mem_get0 (this->local_pool);
+        if (!local)
+                goto err;
+
+        frame->local = local;
+
+        local->fop = GF_FOP_FTRUNCATE;
+        local->fd = fd_ref (fd);
+        local->resolver_base_inode = fd->inode;
+        local->block_size = block_size;
+        local->truncate.new_size = offset;
+        if (xdata)
+                local->xattr_req = dict_ref (xdata);
+
+        shard_lookup_base_file (frame, this,
+                                shard_post_lookup_truncate_handler);
+        return 0;
+
+err:
+        SHARD_STACK_UNWIND (ftruncate, frame, -1, ENOMEM, NULL, NULL, NULL);
+        return 0;
+}
+
+int
+shard_flush_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, dict_t *xdata)
+{
+        /* To-Do: Wind flush on all shards of the file */
+        SHARD_STACK_UNWIND (flush, frame, op_ret, op_errno, xdata);
+        return 0;
+}
+
+int
+shard_flush (call_frame_t *frame, xlator_t *this, fd_t *fd, dict_t *xdata)
+{
+        STACK_WIND (frame, shard_flush_cbk, FIRST_CHILD(this),
+                    FIRST_CHILD(this)->fops->flush, fd, xdata);
+        return 0;
+}
+
+int
+shard_fsync_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, struct iatt *prebuf,
+                 struct iatt *postbuf, dict_t *xdata)
+{
+        /* To-Do: Wind fsync on all shards of the file */
+        SHARD_STACK_UNWIND (fsync, frame, op_ret, op_errno, prebuf, postbuf,
+                            xdata);
+        return 0;
+}
+
+int
+shard_fsync (call_frame_t *frame, xlator_t *this, fd_t *fd, int32_t datasync,
+             dict_t *xdata)
 {
         STACK_WIND (frame, shard_fsync_cbk, FIRST_CHILD(this),
                     FIRST_CHILD(this)->fops->fsync, fd, datasync, xdata);
@@ -1826,6 +2864,15 @@ shard_zerofill (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
         return 0;
 }
 
+int
+shard_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+            gf_seek_what_t what, dict_t *xdata)
+{
+        /* TBD */
+        SHARD_STACK_UNWIND (seek, frame, -1, ENOTSUP, 0, NULL);
+        return 0;
+}
+
 int32_t
 mem_acct_init (xlator_t *this)
 {
@@ -1986,6 +3033,7 @@ struct xlator_fops fops = {
         .fallocate   = shard_fallocate,
         .discard     = shard_discard,
         .zerofill    = shard_zerofill,
+        .seek        = shard_seek,
         .readdir     = shard_readdir,
         .readdirp    = shard_readdirp,
         .create      = shard_create,
@@ -114,6 +114,15 @@
 } while (0)
 
 
+/* Continuation run once an asynchronous step common to several fops (the
+ * lookup of the base file, the resolution of the shards) completes.
+ */
+typedef int32_t (*shard_post_fop_handler_t) (call_frame_t *frame,
+                                             xlator_t *this);
+
+/* Number of tail shards unlinked in parallel by a background truncate */
+#define SHARD_TRUNCATE_BATCH 64
+
 typedef struct shard_priv {
         uint64_t block_size;
         uuid_t dot_shard_gfid;
@@ -126,7 +135,17 @@ typedef struct {
         char *domain;
 } shard_lock_t;
 
+typedef struct shard_read_block {
+        fd_t *fd;
+        struct iovec *vector;
+        int count;
+        int32_t op_ret;
+        size_t size;     /* bytes expected from this block */
+        struct iobref *iobref;
+} shard_read_block_t;
+
 typedef struct shard_local {
+        glusterfs_fop_t fop;
         int op_ret;
         int op_errno;
         int first_block;
@@ -151,6 +170,19 @@ typedef struct shard_local {
         struct iatt postbuf;
         struct iovec *vector;
         struct iobref *iobref;
+        inode_t *resolver_base_inode;
+        shard_post_fop_handler_t handler;
+        shard_post_fop_handler_t post_res_handler;
+        shard_read_block_t *read_blocks;
+        struct {
+                off_t new_size;
+                int trunc_block;         /* block holding the new EOF */
+                int tail_first;          /* tail shards to unlink */
+                int tail_last;
+                int64_t block_delta;     /* ia_blocks freed in trunc_block */
+                gf_boolean_t background; /* frame unlinking the tail */
+                call_frame_t *bg_frame;  /* set up to unlink the tail */
+        } truncate;
         struct {
                 int lock_count;
                 fop_inodelk_cbk_t inodelk_cbk;
@@ -163,6 +195,13 @@ typedef struct shard_inode_ctx {
         uint64_t block_size; /* The block size with which this inode is
                                 sharded */
         mode_t mode;
+        /* Background truncates still unlinking tail shards. Writes and
+         * truncates reaching into the tail wait on @bg_waiters until they
+         * are done.
+         */
+        int bg_truncates;
+        int bg_tail_first;
+        struct list_head bg_waiters;
 } shard_inode_ctx_t;
 
 #endif /* __SHARD_H__ */
@@ -345,9 +345,16 @@ upcall_cache_invalidate (call_frame_t *frame, xlator_t *this, client_t *client,
         upcall_client_t *up_client_entry = NULL;
         upcall_client_t *tmp             = NULL;
         upcall_inode_ctx_t *up_inode_ctx = NULL;
+        upcall_local_t  *local           = NULL;
         gf_boolean_t     found           = _gf_false;
 
-        up_inode_ctx = ((upcall_local_t *)frame->local)->upcall_inode_ctx;
+        if (!client || !inode)
+                return;
+
+        /* the ctx cached in local only belongs to local->inode */
+        local = frame->local;
+        if (local && (local->inode == inode))
+                up_inode_ctx = local->upcall_inode_ctx;
 
         if (!up_inode_ctx)
                 up_inode_ctx = upcall_inode_ctx_get (inode, this);
@@ -404,6 +404,9 @@ up_rename_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         flags = UP_PARENT_DENTRY_FLAGS;
         CACHE_INVALIDATE_DIR (frame, this, client, local->inode, flags);
 
+        /* the new name appeared in the new parent */
+        CACHE_INVALIDATE (frame, this, client, local->parent, flags);
+
         /* XXX: notify oldparent as well */
 /*        if (gf_uuid_compare (preoldparent->ia_gfid, prenewparent->ia_gfid))
                 CACHE_INVALIDATE (frame, this, client, prenewparent->ia_gfid, flags);*/
@@ -430,6 +433,7 @@ up_rename (call_frame_t *frame, xlator_t *this,
                 op_errno = ENOMEM;
                 goto err;
         }
+        local->parent = inode_ref (newloc->parent);
 
 out:
         STACK_WIND (frame, up_rename_cbk,
@@ -526,7 +530,9 @@ up_link_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         flags = UP_NLINK_FLAGS;
         CACHE_INVALIDATE (frame, this, client, local->inode, flags);
 
-        /* do we need to update parent as well?? */
+        /* a new name appeared in the parent */
+        flags = UP_PARENT_DENTRY_FLAGS;
+        CACHE_INVALIDATE (frame, this, client, local->parent, flags);
 out:
         UPCALL_STACK_UNWIND (link, frame, op_ret, op_errno,
                              inode, stbuf, preparent, postparent, xdata);
@@ -548,6 +554,7 @@ up_link (call_frame_t *frame, xlator_t *this, loc_t *oldloc,
                 op_errno = ENOMEM;
                 goto err;
         }
+        local->parent = inode_ref (newloc->parent);
 
 out:
         STACK_WIND (frame, up_link_cbk,
@@ -648,6 +655,7 @@ up_mkdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         /* invalidate parent's entry too */
         flags = UP_PARENT_DENTRY_FLAGS;
         CACHE_INVALIDATE_DIR (frame, this, client, local->inode, flags);
+        CACHE_INVALIDATE (frame, this, client, local->parent, flags);
 
 out:
         UPCALL_STACK_UNWIND (mkdir, frame, op_ret, op_errno,
@@ -670,6 +678,7 @@ up_mkdir (call_frame_t *frame, xlator_t *this,
                 op_errno = ENOMEM;
                 goto err;
         }
+        local->parent = inode_ref (loc->parent);
 
 out:
         STACK_WIND (frame, up_mkdir_cbk,
@@ -709,6 +718,7 @@ up_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         /* However invalidate parent's entry */
         flags = UP_PARENT_DENTRY_FLAGS;
         CACHE_INVALIDATE_DIR (frame, this, client, local->inode, flags);
+        CACHE_INVALIDATE (frame, this, client, local->parent, flags);
 
 out:
         UPCALL_STACK_UNWIND (create, frame, op_ret, op_errno, fd,
@@ -733,6 +743,7 @@ up_create (call_frame_t *frame, xlator_t *this,
                 op_errno = ENOMEM;
                 goto err;
         }
+        local->parent = inode_ref (loc->parent);
 
 out:
         STACK_WIND (frame, up_create_cbk,
@@ -749,6 +760,164 @@ err:
         return 0;
 }
 
+int
+up_mknod_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+              int op_ret, int op_errno, inode_t *inode,
+              struct iatt *buf, struct iatt *preparent,
+              struct iatt *postparent, dict_t *xdata)
+{
+        client_t         *client        = NULL;
+        uint32_t         flags          = 0;
+        upcall_local_t   *local         = NULL;
+
+        EXIT_IF_UPCALL_OFF (this, out);
+
+        client = frame->root->client;
+        local = frame->local;
+
+        if ((op_ret < 0) || !local) {
+                goto out;
+        }
+
+        /* new entry, only the parent has to be invalidated */
+        flags = UP_PARENT_DENTRY_FLAGS;
+        CACHE_INVALIDATE (frame, this, client, local->parent, flags);
+
+out:
+        UPCALL_STACK_UNWIND (mknod, frame, op_ret, op_errno,
+                             inode, buf, preparent, postparent, xdata);
+
+        return 0;
+}
+
+int
+up_mknod (call_frame_t *frame, xlator_t *this, loc_t *loc, mode_t mode,
+          dev_t rdev, mode_t umask, dict_t *xdata)
+{
+        int32_t          op_errno        = -1;
+        upcall_local_t   *local          = NULL;
+
+        EXIT_IF_UPCALL_OFF (this, out);
+
+        local = upcall_local_init (frame, this, loc->inode);
+        if (!local) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+        local->parent = inode_ref (loc->parent);
+
+out:
+        STACK_WIND (frame, up_mknod_cbk,
+                    FIRST_CHILD(this), FIRST_CHILD(this)->fops->mknod,
+                    loc, mode, rdev, umask, xdata);
+
+        return 0;
+
+err:
+        op_errno = (op_errno == -1) ? errno : op_errno;
+        UPCALL_STACK_UNWIND (mknod, frame, -1, op_errno, NULL,
+                             NULL, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int
+up_symlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int op_ret, int op_errno, inode_t *inode,
+                struct iatt *buf, struct iatt *preparent,
+                struct iatt *postparent, dict_t *xdata)
+{
+        client_t         *client        = NULL;
+        uint32_t         flags          = 0;
+        upcall_local_t   *local         = NULL;
+
+        EXIT_IF_UPCALL_OFF (this, out);
+
+        client = frame->root->client;
+        local = frame->local;
+
+        if ((op_ret < 0) || !local) {
+                goto out;
+        }
+
+        /* new entry, only the parent has to be invalidated */
+        flags = UP_PARENT_DENTRY_FLAGS;
+        CACHE_INVALIDATE (frame, this, client, local->parent, flags);
+
+out:
+        UPCALL_STACK_UNWIND (symlink, frame, op_ret, op_errno,
+                             inode, buf, preparent, postparent, xdata);
+
+        return 0;
+}
+
+int
+up_symlink (call_frame_t *frame, xlator_t *this, const char *linkpath,
+            loc_t *loc, mode_t umask, dict_t *xdata)
+{
+        int32_t          op_errno        = -1;
+        upcall_local_t   *local          = NULL;
+
+        EXIT_IF_UPCALL_OFF (this, out);
+
+        local = upcall_local_init (frame, this, loc->inode);
+        if (!local) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+        local->parent = inode_ref (loc->parent);
+
+out:
+        STACK_WIND (frame, up_symlink_cbk,
+                    FIRST_CHILD(this), FIRST_CHILD(this)->fops->symlink,
+                    linkpath, loc, umask, xdata);
+
+        return 0;
+
+err:
+        op_errno = (op_errno == -1) ? errno : op_errno;
+        UPCALL_STACK_UNWIND (symlink, frame, -1, op_errno, NULL,
+                             NULL, NULL, NULL, NULL);
+
+        return 0;
+}
+
+int
+up_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int op_ret, int op_errno, inode_t *inode,
+               struct iatt *stbuf, dict_t *xdata, struct iatt *postparent)
+{
+        client_t         *client        = NULL;
+        inode_t          *parent        = cookie;
+
+        EXIT_IF_UPCALL_OFF (this, out);
+
+        client = frame->root->client;
+
+        /* A client may cache this ENOENT, it has to hear about entries
+         * created in the parent later on. UP_ATIME only records the
+         * access, nobody is notified. */
+        if ((op_ret < 0) && (op_errno == ENOENT) && parent)
+                CACHE_INVALIDATE (frame, this, client, parent, UP_ATIME);
+
+out:
+        STACK_UNWIND_STRICT (lookup, frame, op_ret, op_errno, inode, stbuf,
+                             xdata, postparent);
+
+        return 0;
+}
+
+int
+up_lookup (call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
+{
+        /* loc is held by the caller until the lookup unwinds */
+        STACK_WIND_COOKIE (frame, up_lookup_cbk, loc->parent,
+                           FIRST_CHILD(this), FIRST_CHILD(this)->fops->lookup,
+                           loc, xdata);
+
+        return 0;
+}
+
 int32_t
 mem_acct_init (xlator_t *this)
 {
@@ -774,6 +943,8 @@ upcall_local_wipe (xlator_t *this, upcall_local_t *local)
 {
         if (local) {
                 inode_unref (local->inode);
+                if (local->parent)
+                        inode_unref (local->parent);
                 mem_put (local);
         }
 }
@@ -953,19 +1124,20 @@ struct xlator_fops fops = {
         .link        = up_link, /* invalidate both file and parent dir */
         .create      = up_create, /* update only direntry */
         .mkdir       = up_mkdir, /* update only dirent */
+        .mknod       = up_mknod, /* update only dirent */
+        .symlink     = up_symlink, /* update only dirent */
+        .lookup      = up_lookup, /* registers clients caching ENOENT */
 #ifdef WIP
         .ftruncate   = up_ftruncate, /* reqd? */
         .getattr     = up_getattr, /* ?? */
         .getxattr    = up_getxattr, /* ?? */
         .access      = up_access,
-        .lookup      = up_lookup,
-        .symlink     = up_symlink, /* invalidate both file and parent dir maybe */
         .readlink    = up_readlink, /* Needed? readlink same as read? */
         .readdirp    = up_readdirp,
         .readdir     = up_readdir,
 /*  other fops to be considered - Bug1200271
- *   lookup, stat, opendir, readdir, readdirp, readlink, mknod, statfs, flush,
- *   fsync, mknod, fsyncdir, setxattr, removexattr, rchecksum, fallocate, discard,
+ *   stat, opendir, readdir, readdirp, readlink, statfs, flush,
+ *   fsync, fsyncdir, setxattr, removexattr, rchecksum, fallocate, discard,
  *   zerofill, (also variants of above similar to fsetattr)
  */
 #endif
@@ -102,6 +102,8 @@ struct upcall_local {
          */
         upcall_inode_ctx_t *upcall_inode_ctx;
         inode_t   *inode;
+        /* parent of the entry created, its clients are notified too */
+        inode_t   *parent;
 };
 typedef struct upcall_local upcall_local_t;
 
@@ -587,6 +587,13 @@ meta_default_zerofill (call_frame_t *frame, xlator_t *this, fd_t *fd,
         return default_zerofill_failure_cbk (frame, EPERM);
 }
 
+int
+meta_default_seek (call_frame_t *frame, xlator_t *this, fd_t *fd,
+		   off_t offset, gf_seek_what_t what, dict_t *xdata)
+{
+        return default_seek_failure_cbk (frame, EPERM);
+}
+
 #define SET_META_DEFAULT_FOP(f,name) do { if (!f->name) f->name = meta_default_##name ; } while (0)
 
 struct xlator_fops *
@@ -636,6 +643,7 @@ meta_defaults_init (struct xlator_fops *fops)
 	SET_META_DEFAULT_FOP (fops,fallocate);
 	SET_META_DEFAULT_FOP (fops,discard);
         SET_META_DEFAULT_FOP (fops,zerofill);
+        SET_META_DEFAULT_FOP (fops,seek);
 
 	return fops;
 }
@@ -771,6 +771,7 @@ glusterd_volinfo_delete (glusterd_volinfo_t *volinfo)
         GF_FREE (volinfo->logdir);
         if (volinfo->rebal.dict)
                 dict_unref (volinfo->rebal.dict);
+        GF_FREE (volinfo->rebal.rebalance_workers);
 
         gf_store_handle_destroy (volinfo->quota_conf_shandle);
 
@@ -1442,6 +1443,23 @@ glusterd_set_brick_socket_filepath (glusterd_volinfo_t *volinfo,
         glusterd_set_socket_filepath (sock_filepath, sockpath, len);
 }
 
+/* The shm socket of a brick is named from what both the brick's and the
+ * clients' volfiles know about it, so that any node computes the same path.
+ */
+void
+glusterd_set_brick_shm_filepath (glusterd_volinfo_t *volinfo, char *hostname,
+                                 char *brickpath, char *sockpath, size_t len)
+{
+        char                    export_path[PATH_MAX] = {0,};
+        char                    sock_filepath[PATH_MAX] = {0,};
+
+        GLUSTERD_REMOVE_SLASH_FROM_PATH (brickpath, export_path);
+        snprintf (sock_filepath, PATH_MAX, "shm-%s-%s-%s",
+                  volinfo->volname, hostname, export_path);
+
+        glusterd_set_socket_filepath (sock_filepath, sockpath, len);
+}
+
 /* connection happens only if it is not aleady connected,
  * reconnections are taken care by rpc-layer
  */
@@ -1655,6 +1673,15 @@ glusterd_volume_start_glusterfs (glusterd_volinfo_t  *volinfo,
         if (volinfo->memory_accounting)
                 runner_add_arg (&runner, "--mem-accounting");
 
+        if (dict_get_str_boolean (volinfo->dict, GLUSTERD_EVENT_SHARDING_KEY,
+                                  _gf_false) > 0) {
+                runner_add_arg (&runner, "--event-sharding");
+                if (dict_get_str_boolean (volinfo->dict,
+                                          GLUSTERD_EVENT_CPU_AFFINITY_KEY,
+                                          _gf_false) > 0)
+                        runner_add_arg (&runner, "--event-cpu-affinity");
+        }
+
         runner_log (&runner, "", GF_LOG_DEBUG, "Starting GlusterFS");
         if (wait) {
                 synclock_unlock (&priv->big_lock);
@@ -3642,6 +3669,8 @@ gd_check_and_update_rebalance_info (glusterd_volinfo_t *old_volinfo,
         new->skipped_files      = old->skipped_files;
         new->rebalance_failures = old->rebalance_failures;
         new->rebalance_time     = old->rebalance_time;
+        new->rebalance_workers  = (old->rebalance_workers ?
+                                   gf_strdup (old->rebalance_workers) : NULL);
         new->dict               = (old->dict ? dict_ref (old->dict) : NULL);
 
         /* glusterd_rebalance_t.{op, id, defrag_cmd} are copied during volume
@@ -6624,6 +6653,8 @@ glusterd_volinfo_reset_defrag_stats (glusterd_volinfo_t *volinfo)
         rebal->rebalance_failures = 0;
         rebal->rebalance_time = 0;
         rebal->skipped_files = 0;
+        GF_FREE (rebal->rebalance_workers);
+        rebal->rebalance_workers = NULL;
 
 }
 
@@ -6695,6 +6726,7 @@ glusterd_defrag_volume_status_update (glusterd_volinfo_t *volinfo,
         uint64_t                        skipped = 0;
         xlator_t                       *this = NULL;
         double                          run_time = 0;
+        char                           *workers = NULL;
 
         this = THIS;
 
@@ -6733,6 +6765,11 @@ glusterd_defrag_volume_status_update (glusterd_volinfo_t *volinfo,
                 gf_log (this->name, GF_LOG_TRACE,
                         "failed to get run-time");
 
+        ret = dict_get_str (rsp_dict, "workers", &workers);
+        if (ret)
+                gf_log (this->name, GF_LOG_TRACE,
+                        "failed to get worker throughput");
+
         if (files)
                 volinfo->rebal.rebalance_files = files;
         if (size)
@@ -6747,6 +6784,10 @@ glusterd_defrag_volume_status_update (glusterd_volinfo_t *volinfo,
                 volinfo->rebal.skipped_files = skipped;
         if (run_time)
                 volinfo->rebal.rebalance_time = run_time;
+        if (workers) {
+                GF_FREE (volinfo->rebal.rebalance_workers);
+                volinfo->rebal.rebalance_workers = gf_strdup (workers);
+        }
 
         return ret;
 }
@@ -7650,6 +7691,7 @@ glusterd_volume_rebalance_use_rsp_dict (dict_t *aggr, dict_t *rsp_dict)
         char                *volname       = NULL;
         dict_t              *ctx_dict      = NULL;
         double               elapsed_time  = 0;
+        char                *workers       = NULL;
         glusterd_conf_t     *conf          = NULL;
         glusterd_op_t        op            = GD_OP_NONE;
         glusterd_peerinfo_t *peerinfo      = NULL;
@@ -7820,6 +7862,19 @@ glusterd_volume_rebalance_use_rsp_dict (dict_t *aggr, dict_t *rsp_dict)
                 }
         }
 
+        memset (key, 0, 256);
+        snprintf (key, 256, "workers-%d", index);
+        ret = dict_get_str (rsp_dict, key, &workers);
+        if (!ret) {
+                memset (key, 0, 256);
+                snprintf (key, 256, "workers-%d", current_index);
+                ret = dict_set_dynstr_with_alloc (ctx_dict, key, workers);
+                if (ret) {
+                        gf_log (THIS->name, GF_LOG_DEBUG,
+                                "failed to set worker throughput");
+                }
+        }
+
         ret = 0;
 
 out:
@@ -8424,6 +8479,16 @@ glusterd_defrag_volume_node_rsp (dict_t *req_dict, dict_t *rsp_dict,
                 gf_log (THIS->name, GF_LOG_ERROR,
                         "failed to set run-time");
 
+        if (volinfo->rebal.rebalance_workers) {
+                memset (key, 0, 256);
+                snprintf (key, 256, "workers-%d", i);
+                ret = dict_set_dynstr_with_alloc (op_ctx, key,
+                                             volinfo->rebal.rebalance_workers);
+                if (ret)
+                        gf_log (THIS->name, GF_LOG_ERROR,
+                                "failed to set worker throughput");
+        }
+
 out:
         return ret;
 }
@@ -1966,6 +1966,32 @@ out:
         return ret;
 }
 
+/* A shm peer has no address for auth.allow and auth.reject to match, and
+ * no certificate for the ssl options to check, so volumes using any of
+ * them keep to tcp. */
+static gf_boolean_t
+volgen_shm_transport_enabled (dict_t *set_dict)
+{
+        char *value = NULL;
+
+        if (dict_get_str_boolean (set_dict, SHM_TRANSPORT_OPT, _gf_false) <= 0)
+                return _gf_false;
+
+        if ((dict_get_str (set_dict, AUTH_ALLOW_MAP_KEY, &value) == 0) &&
+            strcmp (value, "*"))
+                return _gf_false;
+
+        if (dict_get (set_dict, AUTH_REJECT_MAP_KEY) ||
+            dict_get (set_dict, "auth.ssl-allow"))
+                return _gf_false;
+
+        if ((dict_get_str_boolean (set_dict, "server.ssl", _gf_false) > 0) ||
+            (dict_get_str_boolean (set_dict, "client.ssl", _gf_false) > 0))
+                return _gf_false;
+
+        return _gf_true;
+}
+
 static int
 brick_graph_add_server (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
                          dict_t *set_dict, glusterd_brickinfo_t *brickinfo)
@@ -1978,6 +2004,7 @@ brick_graph_add_server (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
         char            key[1024] = {0};
         char            *ssl_user = NULL;
         char            *value = NULL;
+        char            shm_path[PATH_MAX] = {0,};
 
         if (!graph || !volinfo || !set_dict || !brickinfo)
                 goto out;
@@ -1991,6 +2018,9 @@ brick_graph_add_server (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
         if (!xl)
                 goto out;
 
+        if (volgen_shm_transport_enabled (set_dict))
+                strcat (transt, ",shm");
+
         ret = xlator_set_option (xl, "transport-type", transt);
         if (ret)
                 goto out;
@@ -2023,6 +2053,25 @@ brick_graph_add_server (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
                 }
         }
 
+        if (dict_get_str (set_dict, SSL_KTLS_OPT, &value) == 0) {
+                ret = xlator_set_option (xl, "ssl-ktls", value);
+                if (ret) {
+                        gf_log ("glusterd", GF_LOG_WARNING,
+                                "failed to set ssl-ktls");
+                        return -1;
+                }
+        }
+
+        if (volgen_shm_transport_enabled (set_dict)) {
+                glusterd_set_brick_shm_filepath (volinfo, brickinfo->hostname,
+                                                 brickinfo->path, shm_path,
+                                                 sizeof (shm_path));
+                ret = xlator_set_option (xl, "transport.shm.listen-path",
+                                         shm_path);
+                if (ret)
+                        return -1;
+        }
+
         if (username) {
                 memset (key, 0, sizeof (key));
                 snprintf (key, sizeof (key), "auth.login.%s.allow",
@@ -2116,6 +2165,15 @@ brick_graph_add_pump (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
                         }
                 }
 
+                if (dict_get_str (set_dict, SSL_KTLS_OPT, &value) == 0) {
+                        ret = xlator_set_option (rbxl, "ssl-ktls", value);
+                        if (ret) {
+                                gf_log ("glusterd", GF_LOG_WARNING,
+                                        "failed to set ssl-ktls");
+                                return -1;
+                        }
+                }
+
                 if (username) {
                         ret = xlator_set_option (rbxl, "username", username);
                         if (ret)
@@ -2342,6 +2400,7 @@ perfxl_option_handler (volgen_graph_t *graph, struct volopt_map_entry *vme,
 {
         gf_boolean_t enabled = _gf_false;
         glusterd_volinfo_t *volinfo = NULL;
+        xlator_t *xl = NULL;
 
         GF_ASSERT (param);
         volinfo = param;
@@ -2354,16 +2413,33 @@ perfxl_option_handler (volgen_graph_t *graph, struct volopt_map_entry *vme,
         if (!enabled)
                 return 0;
 
-        /* Check op-version before adding the 'open-behind' xlator in the graph
+        /* Check op-version before adding the 'open-behind' and 'nl-cache'
+         * xlators in the graph
          */
-        if (!strcmp (vme->key, "performance.open-behind") &&
+        if ((!strcmp (vme->key, "performance.open-behind") ||
+             !strcmp (vme->key, "performance.nl-cache")) &&
             (vme->op_version > volinfo->client_op_version))
                 return 0;
 
-        if (volgen_graph_add (graph, vme->voltype, volinfo->volname))
+        /* With parallel-readdir the entries are already prefetched below
+         * distribute, a readdir-ahead on top would only buffer them again */
+        if (!strcmp (vme->key, "performance.readdir-ahead") &&
+            dict_get_str_boolean (volinfo->dict,
+                                  "performance.parallel-readdir", 0))
                 return 0;
-        else
+
+        xl = volgen_graph_add (graph, vme->voltype, volinfo->volname);
+        if (!xl)
                 return -1;
+
+        /* nl-cache passes everything through unless the bricks send
+         * cache invalidation upcalls */
+        if (!strcmp (vme->key, "performance.nl-cache") &&
+            dict_get_str_boolean (volinfo->dict,
+                                  "features.cache-invalidation", 0))
+                return xlator_set_option (xl, "cache-invalidation", "on");
+
+        return 0;
 }
 
 static int
@@ -2593,6 +2669,7 @@ volgen_graph_build_client (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
         char                    *ssl_str            = NULL;
         gf_boolean_t             ssl_bool           = _gf_false;
         char                    *value              = NULL;
+        char                     shm_path[PATH_MAX] = {0,};
 
         GF_ASSERT (graph);
         GF_ASSERT (subvol);
@@ -2675,6 +2752,26 @@ volgen_graph_build_client (volgen_graph_t *graph, glusterd_volinfo_t *volinfo,
                 }
         }
 
+        if (dict_get_str (set_dict, SSL_KTLS_OPT, &value) == 0) {
+                ret = xlator_set_option (xl, "ssl-ktls", value);
+                if (ret) {
+                        gf_log ("glusterd", GF_LOG_WARNING,
+                                "failed to set ssl-ktls");
+                        goto err;
+                }
+        }
+
+        /* the client takes it only if the socket exists where it runs */
+        if (hostname && !strcmp (transt, "tcp") &&
+            volgen_shm_transport_enabled (set_dict)) {
+                glusterd_set_brick_shm_filepath (volinfo, hostname, subvol,
+                                                 shm_path, sizeof (shm_path));
+                ret = xlator_set_option (xl, "transport.shm.connect-path",
+                                         shm_path);
+                if (ret)
+                        goto err;
+        }
+
         return xl;
 err:
         return NULL;
@@ -2994,6 +3091,7 @@ volgen_graph_build_dht_cluster (volgen_graph_t *graph,
         xlator_t                *dht                     = NULL;
         char                    *voltype                 = "cluster/distribute";
         char                    *name_fmt                = NULL;
+        gf_boolean_t            parallel_readdir         = _gf_false;
 
         /* NUFA and Switch section */
         if (dict_get_str_boolean (volinfo->dict, "cluster.nufa", 0) &&
@@ -3017,6 +3115,21 @@ volgen_graph_build_dht_cluster (volgen_graph_t *graph,
         else
                 name_fmt = "%s-dht";
 
+        /* Load a readdir-ahead on top of each subvolume, so that readdirp
+         * is prefetched from all of them at opendir instead of one
+         * subvolume after the other. */
+        if (!is_quotad &&
+            dict_get_str_boolean (volinfo->dict,
+                                  "performance.parallel-readdir", 0)) {
+                clusters = volgen_link_bricks_from_list_tail (graph, volinfo,
+                                                "performance/readdir-ahead",
+                                                "%s-readdir-ahead-%d",
+                                                child_count, 1);
+                if (clusters < 0)
+                        goto out;
+                parallel_readdir = _gf_true;
+        }
+
         clusters = volgen_link_bricks_from_list_tail (graph,  volinfo,
                                                 voltype,
                                                 name_fmt,
@@ -3026,6 +3139,11 @@ volgen_graph_build_dht_cluster (volgen_graph_t *graph,
                 goto out;
 
         dht = first_of (graph);
+        if (parallel_readdir) {
+                ret = xlator_set_option (dht, "parallel-readdir", "on");
+                if (ret)
+                        goto out;
+        }
         ret = _graph_get_decommissioned_children (dht, volinfo,
                                                   &decommissioned_children);
         if (ret)
@@ -4702,6 +4820,15 @@ glusterd_snapdsvc_generate_volfile (volgen_graph_t *graph,
                 }
         }
 
+        if (dict_get_str (set_dict, SSL_KTLS_OPT, &value) == 0) {
+                ret = xlator_set_option (xl, "ssl-ktls", value);
+                if (ret) {
+                        gf_log ("glusterd", GF_LOG_WARNING,
+                                "failed to set ssl-ktls");
+                        return -1;
+                }
+        }
+
         username = glusterd_auth_get_username (volinfo);
         passwd = glusterd_auth_get_password (volinfo);
 
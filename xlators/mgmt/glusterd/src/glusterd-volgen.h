@@ -45,6 +45,8 @@
 
 #define SSL_CERT_DEPTH_OPT  "ssl.certificate-depth"
 #define SSL_CIPHER_LIST_OPT "ssl.cipher-list"
+#define SSL_KTLS_OPT        "ssl.ktls"
+#define SHM_TRANSPORT_OPT   "transport.shm"
 
 
 typedef enum {
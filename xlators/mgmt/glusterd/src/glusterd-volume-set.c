@@ -73,6 +73,60 @@ out:
         return ret;
 }
 
+/* nl-cache only learns about names created through other clients from
+ * the cache invalidation upcalls of the bricks. */
+static int
+validate_nl_cache (glusterd_volinfo_t *volinfo, dict_t *dict, char *key,
+                   char *value, char **op_errstr)
+{
+        char                 errstr[2048] = "";
+        int                  ret          = 0;
+        xlator_t            *this         = NULL;
+        gf_boolean_t         b            = _gf_false;
+        gf_boolean_t         nl_cache     = _gf_false;
+
+        this = THIS;
+        GF_ASSERT (this);
+
+        ret = gf_string2boolean (value, &b);
+        if (ret) {
+                snprintf (errstr, sizeof (errstr), "%s is not a valid boolean "
+                          "value. %s expects a valid boolean value.", value,
+                          key);
+                gf_log (this->name, GF_LOG_ERROR, "%s", errstr);
+                *op_errstr = gf_strdup (errstr);
+                goto out;
+        }
+
+        if (!volinfo)
+                goto out;
+
+        nl_cache = (strstr (key, "nl-cache") != NULL);
+
+        if (nl_cache && b &&
+            !dict_get_str_boolean (volinfo->dict,
+                                   "features.cache-invalidation", 0)) {
+                snprintf (errstr, sizeof (errstr), "Cannot set %s. Enable "
+                          "features.cache-invalidation first.", key);
+                ret = -1;
+        } else if (!nl_cache && !b &&
+                   dict_get_str_boolean (volinfo->dict,
+                                         "performance.nl-cache", 0)) {
+                snprintf (errstr, sizeof (errstr), "Cannot disable %s while "
+                          "performance.nl-cache is on.", key);
+                ret = -1;
+        }
+
+        if (ret) {
+                gf_log (this->name, GF_LOG_ERROR, "%s", errstr);
+                *op_errstr = gf_strdup (errstr);
+        }
+out:
+        gf_log (this->name, GF_LOG_DEBUG, "Returning %d", ret);
+
+        return ret;
+}
+
 static int
 validate_quota (glusterd_volinfo_t *volinfo, dict_t *dict, char *key,
                 char *value, char **op_errstr)
@@ -137,6 +191,32 @@ out:
         return ret;
 }
 
+static int
+validate_boolean (glusterd_volinfo_t *volinfo, dict_t *dict, char *key,
+                  char *value, char **op_errstr)
+{
+        char                 errstr[2048]  = "";
+        int                  ret           = 0;
+        xlator_t            *this          = NULL;
+        gf_boolean_t         b             = _gf_false;
+
+        this = THIS;
+        GF_ASSERT (this);
+
+        ret = gf_string2boolean (value, &b);
+        if (ret) {
+                snprintf (errstr, sizeof (errstr), "%s is not a valid boolean "
+                          "value. %s expects a valid boolean value.", value,
+                          key);
+                gf_log (this->name, GF_LOG_ERROR, "%s", errstr);
+                *op_errstr = gf_strdup (errstr);
+        }
+
+        gf_log (this->name, GF_LOG_DEBUG, "Returning %d", ret);
+
+        return ret;
+}
+
 static int
 validate_stripe (glusterd_volinfo_t *volinfo, dict_t *dict, char *key,
                  char *value, char **op_errstr)
@@ -319,6 +399,23 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .op_version = 2,
           .flags      = OPT_FLAG_CLIENT_OPT
         },
+        { .key         = "cluster.rebalance-throttle",
+          .voltype     = "cluster/distribute",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .description = "Sets the number of files migrated in parallel by "
+                         "a rebalance process: lazy, normal or aggressive.",
+          .flags       = OPT_FLAG_CLIENT_OPT
+        },
+        { .key         = "cluster.rebalance-threads",
+          .voltype     = "cluster/distribute",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .flags       = OPT_FLAG_CLIENT_OPT
+        },
+        { .key         = "cluster.rebalance-subvol-limit",
+          .voltype     = "cluster/distribute",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .flags       = OPT_FLAG_CLIENT_OPT
+        },
         { .key         = "cluster.subvols-per-directory",
           .voltype     = "cluster/distribute",
           .option      = "directory-layout-spread",
@@ -479,6 +576,11 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .op_version = 1,
           .flags      = OPT_FLAG_CLIENT_OPT
         },
+        { .key        = "cluster.use-compound-fops",
+          .voltype    = "cluster/replicate",
+          .op_version = GD_OP_VERSION_3_7_1,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
         { .key        = "cluster.quorum-type",
           .voltype    = "cluster/replicate",
           .option     = "quorum-type",
@@ -685,6 +787,11 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .voltype     = "performance/io-threads",
           .op_version  = 2
         },
+        { .key         = "performance.io-thread-queues",
+          .voltype     = "performance/io-threads",
+          .option      = "worker-queues",
+          .op_version  = GD_OP_VERSION_3_7_0
+        },
 
         /* Other perf xlators' options */
         { .key        = "performance.cache-size",
@@ -759,12 +866,30 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .op_version = 1,
           .flags      = OPT_FLAG_CLIENT_OPT
         },
+        { .key        = "performance.read-ahead-max-page-count",
+          .voltype    = "performance/read-ahead",
+          .option     = "max-page-count",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
         { .key        = "performance.md-cache-timeout",
           .voltype    = "performance/md-cache",
           .option     = "md-cache-timeout",
           .op_version = 2,
           .flags      = OPT_FLAG_CLIENT_OPT
         },
+        { .key        = "performance.nl-cache-timeout",
+          .voltype    = "performance/nl-cache",
+          .option     = "nl-cache-timeout",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
+        { .key        = "performance.nl-cache-limit",
+          .voltype    = "performance/nl-cache",
+          .option     = "nl-cache-limit",
+          .op_version = GD_OP_VERSION_3_7_0,
+          .flags      = OPT_FLAG_CLIENT_OPT
+        },
 
  	/* Crypt xlator options */
 
@@ -845,6 +970,10 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .voltype     = "protocol/client",
           .op_version  = GD_OP_VERSION_3_7_0,
         },
+        { .key         = "client.transport-count",
+          .voltype     = "protocol/client",
+          .op_version  = GD_OP_VERSION_3_7_0,
+        },
 
         /* Server xlator options */
         { .key         = "network.ping-timeout",
@@ -958,6 +1087,25 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .voltype     = "protocol/server",
           .op_version  = GD_OP_VERSION_3_7_0,
         },
+        /* passed to the brick processes on their command line */
+        { .key         = GLUSTERD_EVENT_SHARDING_KEY,
+          .voltype     = "mgmt/glusterd",
+          .value       = "off",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .validate_fn = validate_boolean,
+          .description = "Give every event thread of the bricks its own "
+                         "epoll instance and set of connections. Takes "
+                         "effect when the bricks are restarted."
+        },
+        { .key         = GLUSTERD_EVENT_CPU_AFFINITY_KEY,
+          .voltype     = "mgmt/glusterd",
+          .value       = "off",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .validate_fn = validate_boolean,
+          .description = "Pin each event thread of the bricks to a CPU, "
+                         "with server.event-sharding on. Takes effect when "
+                         "the bricks are restarted."
+        },
 
         /* Generic transport options */
         { .key         = SSL_CERT_DEPTH_OPT,
@@ -970,6 +1118,22 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .option      = "!ssl-cipher-list",
           .op_version  = GD_OP_VERSION_3_6_0,
         },
+        { .key         = SSL_KTLS_OPT,
+          .voltype     = "rpc-transport/socket",
+          .option      = "!ssl-ktls",
+          .op_version  = GD_OP_VERSION_3_7_0,
+        },
+        { .key         = SHM_TRANSPORT_OPT,
+          .voltype     = "rpc-transport/shm",
+          .option      = "!shm",
+          .value       = "off",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .description = "Let clients on the same node as a brick talk to it "
+                         "over shared memory instead of tcp. Takes effect "
+                         "when the brick is restarted and the client "
+                         "remounts. Not used on volumes with auth.allow, "
+                         "auth.reject, auth.ssl-allow or SSL set."
+        },
 
         /* Performance xlators enable/disbable options */
         { .key         = "performance.write-behind",
@@ -997,6 +1161,17 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .description = "enable/disable readdir-ahead translator in the volume.",
           .flags       = OPT_FLAG_CLIENT_OPT | OPT_FLAG_XLATOR_OPT
         },
+        { .key         = "performance.parallel-readdir",
+          .voltype     = "performance/readdir-ahead",
+          .option      = "!parallel-readdir",
+          .value       = "off",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .description = "If this option is enabled, a readdir-ahead "
+                         "translator is loaded on top of each subvolume of "
+                         "distribute, so that directory entries are "
+                         "prefetched from all the subvolumes in parallel.",
+          .flags       = OPT_FLAG_CLIENT_OPT
+        },
 
         { .key         = "performance.io-cache",
           .voltype     = "performance/io-cache",
@@ -1024,6 +1199,16 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .flags       = OPT_FLAG_CLIENT_OPT | OPT_FLAG_XLATOR_OPT
 
         },
+        { .key         = "performance.nl-cache",
+          .voltype     = "performance/nl-cache",
+          .option      = "!perf",
+          .value       = "off",
+          .op_version  = GD_OP_VERSION_3_7_0,
+          .description = "enable/disable negative entry caching translator in "
+                         "the volume. Needs features.cache-invalidation.",
+          .validate_fn = validate_nl_cache,
+          .flags       = OPT_FLAG_CLIENT_OPT | OPT_FLAG_XLATOR_OPT
+        },
         { .key         = "performance.stat-prefetch",
           .voltype     = "performance/md-cache",
           .option      = "!perf",
@@ -1564,6 +1749,14 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .voltype     = "storage/posix",
           .op_version  = 1
         },
+        { .key         = "storage.io-uring",
+          .voltype     = "storage/posix",
+          .op_version  = GD_OP_VERSION_3_7_0
+        },
+        { .key         = "storage.io-uring-depth",
+          .voltype     = "storage/posix",
+          .op_version  = GD_OP_VERSION_3_7_0
+        },
         { .key         = "storage.batch-fsync-mode",
           .voltype     = "storage/posix",
           .op_version  = 3
@@ -1741,6 +1934,11 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .op_version    = GD_OP_VERSION_3_7_0,
           .validate_fn   = validate_disperse_heal_enable_disable
         },
+        { .key           = "disperse.cpu-extensions",
+          .voltype       = "cluster/disperse",
+          .option        = "cpu-extensions",
+          .op_version    = GD_OP_VERSION_3_7_0,
+        },
         { .key           = "cluster.quorum-reads",
           .voltype       = "cluster/replicate",
           .op_version    = GD_OP_VERSION_3_7_0,
@@ -1804,6 +2002,7 @@ struct volopt_map_entry glusterd_volopt_map[] = {
           .voltype     = "features/upcall",
           .value      = "off",
           .op_version  = GD_OP_VERSION_3_7_0,
+          .validate_fn = validate_nl_cache,
         },
         { .key         = "features.cache-invalidation-timeout",
           .voltype     = "features/upcall",
@@ -47,6 +47,8 @@
 #define GLUSTERD_SOCKET_LISTEN_BACKLOG  128
 #define GLUSTERD_QUORUM_TYPE_KEY        "cluster.server-quorum-type"
 #define GLUSTERD_QUORUM_RATIO_KEY       "cluster.server-quorum-ratio"
+#define GLUSTERD_EVENT_SHARDING_KEY     "server.event-sharding"
+#define GLUSTERD_EVENT_CPU_AFFINITY_KEY "server.event-cpu-affinity"
 #define GLUSTERD_GLOBAL_OPT_VERSION     "global-option-version"
 #define GLUSTERD_COMMON_PEM_PUB_FILE    "/geo-replication/common_secret.pem.pub"
 #define GEO_CONF_MAX_OPT_VALS           6
@@ -274,6 +276,8 @@ struct glusterd_rebalance_ {
         uint64_t                 rebalance_failures;
         uuid_t                   rebalance_id;
         double                   rebalance_time;
+        char                    *rebalance_workers; /* throughput of each
+                                                     * migration worker */
         glusterd_op_t            op;
         dict_t                  *dict; /* Dict to store misc information
                                         * like list of bricks being removed */
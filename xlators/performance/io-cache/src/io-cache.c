@@ -52,7 +52,7 @@ ioc_inode_reupdate (ioc_inode_t *ioc_inode)
         table = ioc_inode->table;
 
         list_add_tail (&ioc_inode->inode_lru,
-                       &table->inode_lru[ioc_inode->weight]);
+                       &ioc_inode->shard->inode_lru[ioc_inode->weight]);
 
         return ioc_inode;
 }
@@ -136,13 +136,9 @@ ioc_inode_flush (ioc_inode_t *ioc_inode)
         }
         ioc_inode_unlock (ioc_inode);
 
-        if (destroy_size) {
-                ioc_table_lock (ioc_inode->table);
-                {
-                        ioc_inode->table->cache_used -= destroy_size;
-                }
-                ioc_table_unlock (ioc_inode->table);
-        }
+        if (destroy_size)
+                __sync_fetch_and_sub (&ioc_inode->table->cache_used,
+                                      destroy_size);
 
         return;
 }
@@ -244,12 +240,7 @@ ioc_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                 ioc_inode_flush (ioc_inode);
         }
 
-        ioc_table_lock (ioc_inode->table);
-        {
-                list_move_tail (&ioc_inode->inode_lru,
-                                &table->inode_lru[ioc_inode->weight]);
-        }
-        ioc_table_unlock (ioc_inode->table);
+        ioc_inode_lru_touch (ioc_inode);
 
 out:
         if (frame->local != NULL) {
@@ -380,13 +371,9 @@ ioc_cache_validate_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                 local_stbuf = NULL;
         }
 
-        if (destroy_size) {
-                ioc_table_lock (ioc_inode->table);
-                {
-                        ioc_inode->table->cache_used -= destroy_size;
-                }
-                ioc_table_unlock (ioc_inode->table);
-        }
+        if (destroy_size)
+                __sync_fetch_and_sub (&ioc_inode->table->cache_used,
+                                      destroy_size);
 
         if (op_ret < 0)
                 local_stbuf = NULL;
@@ -565,12 +552,7 @@ ioc_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this, int32_t op_ret,
                         goto out;
                 }
 
-                ioc_table_lock (ioc_inode->table);
-                {
-                        list_move_tail (&ioc_inode->inode_lru,
-                                        &table->inode_lru[ioc_inode->weight]);
-                }
-                ioc_table_unlock (ioc_inode->table);
+                ioc_inode_lru_touch (ioc_inode);
 
                 ioc_inode_lock (ioc_inode);
                 {
@@ -914,11 +896,9 @@ ioc_need_prune (ioc_table_t *table)
 {
         int64_t cache_difference = 0;
 
-        ioc_table_lock (table);
-        {
-                cache_difference = table->cache_used - table->cache_size;
-        }
-        ioc_table_unlock (table);
+        cache_difference = __atomic_load_n (&table->cache_used,
+                                            __ATOMIC_RELAXED)
+                - table->cache_size;
 
         if (cache_difference > 0)
                 return 1;
@@ -954,8 +934,13 @@ ioc_dispatch_requests (call_frame_t *frame, ioc_inode_t *ioc_inode, fd_t *fd,
                                                 * if a page exists, do we need
                                                 * to validate it?
                                                 */
+        struct ioc_pri_stats *stats      = NULL;
+
         local = frame->local;
         table = ioc_inode->table;
+        /* priorities raised by a reconfigure count in the last entry */
+        stats = &table->stats[min (ioc_inode->weight,
+                                   (uint32_t)(table->stats_count - 1))];
 
         rounded_offset = floor (offset, table->page_size);
         rounded_end = roof (offset + size, table->page_size);
@@ -999,8 +984,18 @@ ioc_dispatch_requests (call_frame_t *frame, ioc_inode_t *ioc_inode, fd_t *fd,
                                         ioc_inode_unlock (ioc_inode);
                                         goto out;
                                 }
+                                __sync_fetch_and_add (&stats->misses, 1);
+                        } else {
+                                __sync_fetch_and_add (&stats->hits, 1);
+                                /* a sequential reader goes through a page
+                                 * only once, do not count it as reuse */
+                                if (local_offset < trav->served)
+                                        __ioc_page_promote (trav);
                         }
 
+                        trav->served = max (trav->served,
+                                            local_offset + trav_size);
+
                         __ioc_wait_on_page (trav, frame, local_offset,
                                             trav_size);
 
@@ -1105,7 +1100,6 @@ ioc_readv (call_frame_t *frame, xlator_t *this, fd_t *fd,
         uint64_t     tmp_ioc_inode = 0;
         ioc_inode_t *ioc_inode     = NULL;
         ioc_local_t *local         = NULL;
-        uint32_t     weight        = 0;
         ioc_table_t *table         = NULL;
         int32_t      op_errno      = -1;
 
@@ -1180,14 +1174,7 @@ ioc_readv (call_frame_t *frame, xlator_t *this, fd_t *fd,
                 "NEW REQ (%p) offset = %"PRId64" && size = %"GF_PRI_SIZET"",
                 frame, offset, size);
 
-        weight = ioc_inode->weight;
-
-        ioc_table_lock (ioc_inode->table);
-        {
-                list_move_tail (&ioc_inode->inode_lru,
-                                &ioc_inode->table->inode_lru[weight]);
-        }
-        ioc_table_unlock (ioc_inode->table);
+        ioc_inode_lru_touch (ioc_inode);
 
         ioc_dispatch_requests (frame, ioc_inode, fd, offset, size);
         return 0;
@@ -1717,6 +1704,8 @@ init (xlator_t *this)
         glusterfs_ctx_t *ctx               = NULL;
         data_t          *data              = 0;
         uint32_t         num_pages         = 0;
+        struct ioc_shard *shard            = NULL;
+        int32_t          i                 = 0;
 
         xl_options = this->options;
 
@@ -1782,15 +1771,27 @@ init (xlator_t *this)
                 goto out;
         }
 
-        table->inode_lru = GF_CALLOC (table->max_pri,
-                                      sizeof (struct list_head),
-                                      gf_ioc_mt_list_head);
-        if (table->inode_lru == NULL) {
-                goto out;
+        for (i = 0; i < IOC_TABLE_SHARDS; i++) {
+                shard = &table->shards[i];
+                shard->inode_lru = GF_CALLOC (table->max_pri,
+                                              sizeof (struct list_head),
+                                              gf_ioc_mt_list_head);
+                if (shard->inode_lru == NULL) {
+                        goto out;
+                }
+
+                for (index = 0; index < (table->max_pri); index++)
+                        INIT_LIST_HEAD (&shard->inode_lru[index]);
+
+                pthread_mutex_init (&shard->lock, NULL);
         }
 
-        for (index = 0; index < (table->max_pri); index++)
-                INIT_LIST_HEAD (&table->inode_lru[index]);
+        table->stats = GF_CALLOC (table->max_pri, sizeof (*table->stats),
+                                  gf_ioc_mt_ioc_pri_stats_t);
+        if (table->stats == NULL) {
+                goto out;
+        }
+        table->stats_count = table->max_pri;
 
         this->local_pool = mem_pool_new (ioc_local_t, 64);
         if (!this->local_pool) {
@@ -1822,7 +1823,9 @@ init (xlator_t *this)
 out:
         if (ret == -1) {
                 if (table != NULL) {
-                        GF_FREE (table->inode_lru);
+                        for (i = 0; i < IOC_TABLE_SHARDS; i++)
+                                GF_FREE (table->shards[i].inode_lru);
+                        GF_FREE (table->stats);
                         GF_FREE (table);
                 }
         }
@@ -2011,8 +2014,12 @@ ioc_priv_dump (xlator_t *this)
 {
         ioc_table_t *priv                            = NULL;
         char         key_prefix[GF_DUMP_MAX_BUF_LEN] = {0, };
+        char         key[GF_DUMP_MAX_BUF_LEN]        = {0, };
         int          ret                             = -1;
         gf_boolean_t add_section                     = _gf_false;
+        int          i                               = 0;
+        uint64_t     hits                            = 0;
+        uint64_t     misses                          = 0;
 
         if (!this || !this->private)
                 goto out;
@@ -2030,10 +2037,26 @@ ioc_priv_dump (xlator_t *this)
                 gf_proc_dump_write ("page_size", "%ld", priv->page_size);
                 gf_proc_dump_write ("cache_size", "%ld", priv->cache_size);
                 gf_proc_dump_write ("cache_used", "%ld", priv->cache_used);
+                gf_proc_dump_write ("hot_used", "%ld", priv->hot_used);
                 gf_proc_dump_write ("inode_count", "%u", priv->inode_count);
                 gf_proc_dump_write ("cache_timeout", "%u", priv->cache_timeout);
                 gf_proc_dump_write ("min-file-size", "%u", priv->min_file_size);
                 gf_proc_dump_write ("max-file-size", "%u", priv->max_file_size);
+
+                for (i = 0; i < priv->stats_count; i++) {
+                        hits = priv->stats[i].hits;
+                        misses = priv->stats[i].misses;
+
+                        snprintf (key, sizeof (key), "priority[%d].hits", i);
+                        gf_proc_dump_write (key, "%"PRIu64, hits);
+                        snprintf (key, sizeof (key), "priority[%d].misses", i);
+                        gf_proc_dump_write (key, "%"PRIu64, misses);
+                        snprintf (key, sizeof (key), "priority[%d].hit_ratio",
+                                  i);
+                        gf_proc_dump_write (key, "%.2f", (hits + misses)
+                                            ? (double)hits / (hits + misses)
+                                            : 0.0);
+                }
         }
         pthread_mutex_unlock (&priv->table_lock);
 out:
@@ -2062,6 +2085,7 @@ fini (xlator_t *this)
 {
         ioc_table_t         *table = NULL;
         struct ioc_priority *curr  = NULL, *tmp = NULL;
+        int                  i     = 0;
 
         table = this->private;
 
@@ -2085,11 +2109,17 @@ fini (xlator_t *this)
          * called soon after init()? Hence commenting the below asserts.
          */
         /*for (i = 0; i < table->max_pri; i++) {
-                GF_ASSERT (list_empty (&table->inode_lru[i]));
+                GF_ASSERT (list_empty (&table->shards[0].inode_lru[i]));
         }
 
         GF_ASSERT (list_empty (&table->inodes));
         */
+        for (i = 0; i < IOC_TABLE_SHARDS; i++) {
+                pthread_mutex_destroy (&table->shards[i].lock);
+                GF_FREE (table->shards[i].inode_lru);
+        }
+
+        GF_FREE (table->stats);
         pthread_mutex_destroy (&table->table_lock);
         GF_FREE (table);
 
@@ -33,6 +33,9 @@
 #define IOC_PAGE_SIZE    (1024 * 128)   /* 128KB */
 #define IOC_CACHE_SIZE   (32 * 1024 * 1024)
 #define IOC_PAGE_TABLE_BUCKET_COUNT 1
+#define IOC_TABLE_SHARDS 16
+/* share of the cache the pages read more than once may keep */
+#define IOC_HOT_PERCENT  75
 
 struct ioc_table;
 struct ioc_local;
@@ -118,6 +121,8 @@ struct ioc_page {
         pthread_mutex_t     page_lock;
         int32_t             op_errno;
         char                stale;
+        char                hot;      /* read again after it was filled */
+        off_t               served;   /* end of the data read from it */
 };
 
 struct ioc_cache {
@@ -143,6 +148,7 @@ struct ioc_inode {
                                             * io-cache translator
                                             */
         struct list_head       inode_lru;
+        struct ioc_shard      *shard;      /* holds inode_lru */
         struct ioc_waitq      *waitq;
         pthread_mutex_t        inode_lock;
         uint32_t               weight;      /*
@@ -152,15 +158,37 @@ struct ioc_inode {
         inode_t               *inode;
 };
 
+/*
+ * ioc_shard - the inodes are spread over IOC_TABLE_SHARDS shards, each with
+ *             its own lru lists (one per priority) and lock, so that reads
+ *             of different files do not serialize on the table lock.
+ */
+struct ioc_shard {
+        pthread_mutex_t   lock;
+        struct list_head *inode_lru;
+};
+
+struct ioc_pri_stats {
+        uint64_t hits;
+        uint64_t misses;
+};
+
 struct ioc_table {
         uint64_t         page_size;
         uint64_t         cache_size;
-        uint64_t         cache_used;
+        uint64_t         cache_used;  /* updated atomically */
+        uint64_t         hot_used;    /* part of cache_used in hot pages */
         uint64_t         min_file_size;
         uint64_t         max_file_size;
         struct list_head inodes; /* list of inodes cached */
         struct list_head active;
-        struct list_head *inode_lru;
+        struct ioc_shard shards[IOC_TABLE_SHARDS];
+        uint32_t         next_shard;
+        uint32_t         prune_shard;
+        int32_t          pruning;
+        struct ioc_pri_stats *stats; /* per priority */
+        int32_t          stats_count; /* entries in stats, max_pri at
+                                         init */
         struct list_head priority_list;
         int32_t          readv_count;
         pthread_mutex_t  table_lock;
@@ -254,6 +282,22 @@ ioc_frame_fill (ioc_page_t *page, call_frame_t *frame, off_t offset,
         } while (0)
 
 
+#define ioc_shard_lock(table, shard)                            \
+        do {                                                    \
+                gf_log (table->xl->name, GF_LOG_TRACE,          \
+                        "locked shard(%p)", shard);             \
+                pthread_mutex_lock (&shard->lock);              \
+        } while (0)
+
+
+#define ioc_shard_unlock(table, shard)                          \
+        do {                                                    \
+                gf_log (table->xl->name, GF_LOG_TRACE,          \
+                        "unlocked shard(%p)", shard);           \
+                pthread_mutex_unlock (&shard->lock);            \
+        } while (0)
+
+
 #define ioc_local_lock(local)                                           \
         do {                                                            \
                 gf_log (local->inode->table->xl->name, GF_LOG_TRACE,    \
@@ -307,6 +351,9 @@ ioc_inode_destroy (ioc_inode_t *ioc_inode);
 ioc_inode_t *
 ioc_inode_update (ioc_table_t *table, inode_t *inode, uint32_t weight);
 
+void
+ioc_inode_lru_touch (ioc_inode_t *ioc_inode);
+
 int64_t
 __ioc_page_destroy (ioc_page_t *page);
 
@@ -329,4 +376,10 @@ ioc_prune (ioc_table_t *table);
 int32_t
 ioc_need_prune (ioc_table_t *table);
 
+void
+__ioc_page_promote (ioc_page_t *page);
+
+void
+__ioc_page_demote (ioc_page_t *page);
+
 #endif /* __IO_CACHE_H */
@@ -188,16 +188,24 @@ ioc_inode_update (ioc_table_t *table, inode_t *inode, uint32_t weight)
         INIT_LIST_HEAD (&ioc_inode->cache.page_lru);
         pthread_mutex_init (&ioc_inode->inode_lock, NULL);
         ioc_inode->weight = weight;
+        ioc_inode->shard = &table->shards[__sync_fetch_and_add
+                                          (&table->next_shard, 1)
+                                          % IOC_TABLE_SHARDS];
 
         ioc_table_lock (table);
         {
                 table->inode_count++;
                 list_add (&ioc_inode->inode_list, &table->inodes);
-                list_add_tail (&ioc_inode->inode_lru,
-                               &table->inode_lru[weight]);
         }
         ioc_table_unlock (table);
 
+        ioc_shard_lock (table, ioc_inode->shard);
+        {
+                list_add_tail (&ioc_inode->inode_lru,
+                               &ioc_inode->shard->inode_lru[weight]);
+        }
+        ioc_shard_unlock (table, ioc_inode->shard);
+
         gf_log (table->xl->name, GF_LOG_TRACE,
                 "adding to inode_lru[%d]", weight);
 
@@ -206,6 +214,28 @@ out:
 }
 
 
+/*
+ * ioc_inode_lru_touch - move the inode to the most recently used end of the
+ *                       lru list of its priority.
+ *
+ * @ioc_inode: inode which was just used
+ */
+void
+ioc_inode_lru_touch (ioc_inode_t *ioc_inode)
+{
+        ioc_table_t *table = NULL;
+
+        table = ioc_inode->table;
+
+        ioc_shard_lock (table, ioc_inode->shard);
+        {
+                list_move_tail (&ioc_inode->inode_lru,
+                                &ioc_inode->shard->inode_lru[ioc_inode->weight]);
+        }
+        ioc_shard_unlock (table, ioc_inode->shard);
+}
+
+
 /*
  * ioc_inode_destroy - destroy an ioc_inode_t object.
  *
@@ -226,10 +256,15 @@ ioc_inode_destroy (ioc_inode_t *ioc_inode)
         {
                 table->inode_count--;
                 list_del (&ioc_inode->inode_list);
-                list_del (&ioc_inode->inode_lru);
         }
         ioc_table_unlock (table);
 
+        ioc_shard_lock (table, ioc_inode->shard);
+        {
+                list_del (&ioc_inode->inode_lru);
+        }
+        ioc_shard_unlock (table, ioc_inode->shard);
+
         ioc_inode_flush (ioc_inode);
         rbthash_table_destroy (ioc_inode->cache.page_table);
 
@@ -83,6 +83,40 @@ out:
 }
 
 
+/*
+ * __ioc_page_promote - make a page hot, once data it has already served is
+ *                      read again. cold pages are pruned before hot ones, so
+ *                      a file streamed through the cache once can not push
+ *                      out the pages which are read over and over.
+ *
+ * @page:
+ *
+ * assumes inode lock is held
+ */
+void
+__ioc_page_promote (ioc_page_t *page)
+{
+        if (page->hot || !page->ready || !page->iobref)
+                return;
+
+        page->hot = 1;
+        __sync_fetch_and_add (&page->inode->table->hot_used,
+                              iobref_size (page->iobref));
+}
+
+
+void
+__ioc_page_demote (ioc_page_t *page)
+{
+        if (!page->hot)
+                return;
+
+        page->hot = 0;
+        __sync_fetch_and_sub (&page->inode->table->hot_used,
+                              iobref_size (page->iobref));
+}
+
+
 /*
  * __ioc_page_destroy -
  *
@@ -107,6 +141,7 @@ __ioc_page_destroy (ioc_page_t *page)
                 rbthash_remove (page->inode->cache.page_table, &page->offset,
                                 sizeof (page->offset));
                 list_del (&page->page_lru);
+                __ioc_page_demote (page);
 
                 gf_log (page->inode->table->xl->name, GF_LOG_TRACE,
                         "destroying page = %p, offset = %"PRId64" "
@@ -153,26 +188,45 @@ out:
         return ret;
 }
 
+/*
+ * __ioc_inode_prune - prune the pages of an inode, least recently used
+ *                     first, till size_to_prune is reached.
+ *
+ * @cold_only: leave out the hot pages. the hot pages found while the hot
+ *             ones are over their share of the cache are made cold, so that
+ *             they age out if they are not read again.
+ *
+ * assumes inode lock is held
+ */
 int32_t
 __ioc_inode_prune (ioc_inode_t *curr, uint64_t *size_pruned,
-                   uint64_t size_to_prune, uint32_t index)
+                   uint64_t size_to_prune, uint32_t index, int32_t cold_only)
 {
-        ioc_page_t  *page  = NULL, *next = NULL;
-        int32_t      ret   = 0;
-        ioc_table_t *table = NULL;
+        ioc_page_t  *page      = NULL, *next = NULL;
+        int64_t      ret       = 0;
+        ioc_table_t *table     = NULL;
+        uint64_t     hot_limit = 0;
 
         if (curr == NULL) {
                 goto out;
         }
 
         table = curr->table;
+        hot_limit = table->cache_size / 100 * IOC_HOT_PERCENT;
 
         list_for_each_entry_safe (page, next, &curr->cache.page_lru, page_lru) {
+                if (cold_only && page->hot) {
+                        if (__atomic_load_n (&table->hot_used,
+                                             __ATOMIC_RELAXED) > hot_limit)
+                                __ioc_page_demote (page);
+                        continue;
+                }
+
                 *size_pruned += page->size;
                 ret = __ioc_page_destroy (page);
 
                 if (ret != -1)
-                        table->cache_used -= ret;
+                        __sync_fetch_and_sub (&table->cache_used, ret);
 
                 gf_log (table->xl->name, GF_LOG_TRACE,
                         "index = %d && table->cache_used = %"PRIu64" && table->"
@@ -196,46 +250,72 @@ out:
  *
  * @table: ioc_table_t of this translator
  *
+ * the inodes of the lowest priority go first. within a priority, the cold
+ * pages of all the shards are pruned before the hot ones. the shard pruning
+ * starts from changes on each call, so that no shard is always emptied
+ * first.
  */
 int32_t
 ioc_prune (ioc_table_t *table)
 {
-        ioc_inode_t *curr          = NULL, *next_ioc_inode = NULL;
-        int32_t      index         = 0;
-        uint64_t     size_to_prune = 0;
-        uint64_t     size_pruned   = 0;
+        ioc_inode_t      *curr          = NULL, *next_ioc_inode = NULL;
+        struct ioc_shard *shard         = NULL;
+        int32_t           index         = 0;
+        int32_t           cold_only     = 0;
+        int32_t           i             = 0;
+        uint32_t          start         = 0;
+        int64_t           size_to_prune = 0;
+        uint64_t          size_pruned   = 0;
 
         GF_VALIDATE_OR_GOTO ("io-cache", table, out);
 
-        ioc_table_lock (table);
-        {
-                size_to_prune = table->cache_used - table->cache_size;
-                /* take out the least recently used inode */
-                for (index=0; index < table->max_pri; index++) {
-                        list_for_each_entry_safe (curr, next_ioc_inode,
-                                                  &table->inode_lru[index],
-                                                  inode_lru) {
-                                /* prune page-by-page for this inode, till
-                                 * we reach the equilibrium */
-                                ioc_inode_lock (curr);
-                                {
-                                        __ioc_inode_prune (curr, &size_pruned,
-                                                           size_to_prune,
-                                                           index);
-                                }
-                                ioc_inode_unlock (curr);
+        /* one pruner at a time, the others go on with their reads */
+        if (__sync_val_compare_and_swap (&table->pruning, 0, 1) != 0)
+                goto out;
 
-                                if (size_pruned >= size_to_prune)
-                                        break;
-                        } /* list_for_each_entry_safe (curr...) */
+        size_to_prune = __atomic_load_n (&table->cache_used, __ATOMIC_RELAXED)
+                - table->cache_size;
+        if (size_to_prune <= 0)
+                goto unlock;
+
+        start = table->prune_shard++;
+
+        /* take out the least recently used inode */
+        for (index = 0; index < table->max_pri; index++) {
+                for (cold_only = 1; cold_only >= 0; cold_only--) {
+                        for (i = 0; i < IOC_TABLE_SHARDS; i++) {
+                                shard = &table->shards[(start + i)
+                                                       % IOC_TABLE_SHARDS];
+
+                                ioc_shard_lock (table, shard);
+                                list_for_each_entry_safe (curr, next_ioc_inode,
+                                                          &shard->inode_lru[index],
+                                                          inode_lru) {
+                                        /* prune page-by-page for this inode,
+                                         * till we reach the equilibrium */
+                                        ioc_inode_lock (curr);
+                                        {
+                                                __ioc_inode_prune (curr,
+                                                                   &size_pruned,
+                                                                   size_to_prune,
+                                                                   index,
+                                                                   cold_only);
+                                        }
+                                        ioc_inode_unlock (curr);
 
-                        if (size_pruned >= size_to_prune)
-                                break;
-                } /* for(index=0;...) */
+                                        if (size_pruned >= size_to_prune)
+                                                break;
+                                }
+                                ioc_shard_unlock (table, shard);
 
-        } /* ioc_inode_table locked region end */
-        ioc_table_unlock (table);
+                                if (size_pruned >= size_to_prune)
+                                        goto unlock;
+                        }
+                }
+        }
 
+unlock:
+        __atomic_store_n (&table->pruning, 0, __ATOMIC_RELEASE);
 out:
         return 0;
 }
@@ -476,6 +556,9 @@ ioc_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                                         table->page_size, ioc_inode);
                         } else {
                                 if (page->vector) {
+                                        __ioc_page_demote (page);
+                                        destroy_size += iobref_size
+                                                (page->iobref);
                                         iobref_unref (page->iobref);
                                         GF_FREE (page->vector);
                                         page->vector = NULL;
@@ -533,21 +616,11 @@ unlock:
 
         ioc_waitq_return (waitq);
 
-        if (iobref_page_size) {
-                ioc_table_lock (table);
-                {
-                        table->cache_used += iobref_page_size;
-                }
-                ioc_table_unlock (table);
-        }
+        if (iobref_page_size)
+                __sync_fetch_and_add (&table->cache_used, iobref_page_size);
 
-        if (destroy_size) {
-                ioc_table_lock (table);
-                {
-                        table->cache_used -= destroy_size;
-                }
-                ioc_table_unlock (table);
-        }
+        if (destroy_size)
+                __sync_fetch_and_sub (&table->cache_used, destroy_size);
 
         if (ioc_need_prune (ioc_inode->table)) {
                 ioc_prune (ioc_inode->table);
@@ -942,7 +1015,8 @@ __ioc_page_wakeup (ioc_page_t *page, int32_t op_errno)
 {
         ioc_waitq_t  *waitq = NULL, *trav = NULL;
         call_frame_t *frame = NULL;
-        int32_t       ret   = -1;
+        ioc_table_t  *table = NULL;
+        int64_t       ret   = -1;
 
         GF_VALIDATE_OR_GOTO ("io-cache", page, out);
 
@@ -964,7 +1038,10 @@ __ioc_page_wakeup (ioc_page_t *page, int32_t op_errno)
         }
 
         if (page->stale) {
-                __ioc_page_destroy (page);
+                table = page->inode->table;
+                ret = __ioc_page_destroy (page);
+                if (ret != -1)
+                        __sync_fetch_and_sub (&table->cache_used, ret);
         }
 
 out:
@@ -1016,7 +1093,7 @@ __ioc_page_error (ioc_page_t *page, int32_t op_ret, int32_t op_errno)
         ret = __ioc_page_destroy (page);
 
         if (ret != -1) {
-                table->cache_used -= ret;
+                __sync_fetch_and_sub (&table->cache_used, ret);
         }
 
 out:
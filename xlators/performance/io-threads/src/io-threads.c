@@ -52,112 +52,419 @@ struct volume_options options[];
                 }                                                              \
         } while (0)
 
+static iot_client_ctx_t *
+iot_client_ctx_init (iot_client_ctx_t *ctx, iot_queue_t *queue)
+{
+        int i = 0;
+
+        ctx->queue = queue;
+        for (i = 0; i < IOT_PRI_MAX; i++) {
+                INIT_LIST_HEAD (&ctx->clients[i]);
+                INIT_LIST_HEAD (&ctx->reqs[i]);
+        }
+
+        return ctx;
+}
+
+
+static iot_queue_t *
+iot_next_queue (iot_conf_t *conf)
+{
+        uint32_t n = __sync_fetch_and_add (&conf->next_queue, 1);
+
+        return &conf->queues[n % conf->queue_count];
+}
+
+
+/* Returns the per-client request lists of the client that issued 'frame',
+ * creating them on the client's first request. */
+static iot_client_ctx_t *
+iot_get_client_ctx (xlator_t *this, call_frame_t *frame)
+{
+        iot_conf_t       *conf = this->private;
+        client_t         *client = frame->root->client;
+        iot_client_ctx_t *ctx = NULL;
+        void             *tmp = NULL;
+
+        if (!client)
+                goto no_client;
+
+        if ((client_ctx_get (client, this, &tmp) == 0) && tmp)
+                return tmp;
+
+        pthread_mutex_lock (&conf->mutex);
+        {
+                if ((client_ctx_get (client, this, &tmp) == 0) && tmp) {
+                        ctx = tmp;
+                        goto unlock;
+                }
+
+                ctx = GF_CALLOC (1, sizeof (*ctx), gf_iot_mt_client_ctx_t);
+                if (!ctx)
+                        goto unlock;
+
+                iot_client_ctx_init (ctx, iot_next_queue (conf));
+                if (client_ctx_set (client, this, ctx) != 0) {
+                        GF_FREE (ctx);
+                        ctx = NULL;
+                }
+        }
+unlock:
+        pthread_mutex_unlock (&conf->mutex);
+
+        if (ctx)
+                return ctx;
+
+no_client:
+        return &iot_next_queue (conf)->no_client;
+}
+
+
+static int
+iot_wait_bucket (struct timeval *queued)
+{
+        struct timeval now = {0, };
+        struct timeval diff = {0, };
+        uint64_t       usecs = 0;
+        int            bucket = 0;
+
+        gettimeofday (&now, NULL);
+        timersub (&now, queued, &diff);
+        if (diff.tv_sec < 0)
+                return 0;
+
+        usecs = diff.tv_sec * 1000000ULL + diff.tv_usec;
+        while (usecs && (bucket < IOT_WAIT_BUCKETS - 1)) {
+                usecs >>= 1;
+                bucket++;
+        }
+
+        return bucket;
+}
+
+
+static call_stub_t *
+__iot_queue_pop (iot_queue_t *queue, int pri, gf_boolean_t stolen)
+{
+        iot_client_ctx_t *ctx = NULL;
+        call_stub_t      *stub = NULL;
+
+        if (list_empty (&queue->clients[pri]))
+                return NULL;
+
+        ctx = list_entry (queue->clients[pri].next, iot_client_ctx_t,
+                          clients[pri]);
+        stub = list_entry (ctx->reqs[pri].next, call_stub_t, list);
+        list_del_init (&stub->list);
+
+        /* next client's turn */
+        list_del_init (&ctx->clients[pri]);
+        if (!list_empty (&ctx->reqs[pri]))
+                list_add_tail (&ctx->clients[pri], &queue->clients[pri]);
+
+        queue->queue_size--;
+        queue->queue_sizes[pri]--;
+        queue->dequeued++;
+        if (stolen)
+                queue->stolen++;
+        queue->wait_hist[pri][iot_wait_bucket (&stub->queued)]++;
+
+        return stub;
+}
+
+
+static call_stub_t *
+iot_queue_pop (iot_queue_t *queue, int pri, gf_boolean_t stolen)
+{
+        call_stub_t *stub = NULL;
+
+        if (!queue->queue_sizes[pri])
+                return NULL;
+
+        pthread_mutex_lock (&queue->mutex);
+        {
+                stub = __iot_queue_pop (queue, pri, stolen);
+        }
+        pthread_mutex_unlock (&queue->mutex);
+
+        return stub;
+}
+
+
+/* Takes a request of priority 'pri' from the home queue or, failing that,
+ * from any other queue. The other queues are visited starting at a
+ * different one every time, so that no queue is favoured. */
+static call_stub_t *
+iot_queue_steal (iot_conf_t *conf, int home, uint32_t *rotor, int pri)
+{
+        call_stub_t *stub = NULL;
+        int          start = 0;
+        int          i = 0;
+
+        stub = iot_queue_pop (&conf->queues[home], pri, _gf_false);
+
+        start = (*rotor)++;
+        for (i = 0; (i < conf->queue_count) && !stub; i++) {
+                if ((start + i) % conf->queue_count == home)
+                        continue;
+                stub = iot_queue_pop (&conf->queues[(start + i) %
+                                                    conf->queue_count],
+                                      pri, _gf_true);
+        }
+
+        if (stub) {
+                __sync_fetch_and_sub (&conf->queue_sizes[pri], 1);
+                __sync_fetch_and_sub (&conf->queue_size, 1);
+        }
+
+        return stub;
+}
+
+
+/* Returns 0 if a least priority request may be handled now, otherwise
+ * fills 'sleep' with the soonest time it will be. Called with
+ * conf->throttle.lock held. */
+static int
+__iot_least_throttle (iot_conf_t *conf, struct timespec *sleep)
+{
+	struct timeval curtv = {0,}, difftv = {0,};
+
+	if (!conf->throttle.sample_time.tv_sec) {
+		/* initialize */
+		gettimeofday(&conf->throttle.sample_time, NULL);
+		return 0;
+	}
+
+	/*
+	 * Maintain a running count of least priority operations that are
+	 * handled over a particular time interval. The count is provided via
+	 * state dump and is used as a measure against least priority op
+	 * throttling.
+	 */
+	gettimeofday(&curtv, NULL);
+	timersub(&curtv, &conf->throttle.sample_time, &difftv);
+	if (difftv.tv_sec >= IOT_LEAST_THROTTLE_DELAY) {
+		conf->throttle.cached_rate = conf->throttle.sample_cnt;
+		conf->throttle.sample_cnt = 0;
+		conf->throttle.sample_time = curtv;
+	}
+
+	/*
+	 * If we're over the configured rate limit, provide an absolute time
+	 * to the caller that represents the soonest we're allowed to return
+	 * another least priority request.
+	 */
+	if (conf->throttle.rate_limit &&
+	    conf->throttle.sample_cnt >= conf->throttle.rate_limit) {
+		struct timeval delay;
+		delay.tv_sec = IOT_LEAST_THROTTLE_DELAY;
+		delay.tv_usec = 0;
+
+		timeradd(&conf->throttle.sample_time, &delay, &curtv);
+		TIMEVAL_TO_TIMESPEC(&curtv, sleep);
+
+		return -1;
+	}
+
+	return 0;
+}
+
+
 call_stub_t *
-__iot_dequeue (iot_conf_t *conf, int *pri, struct timespec *sleep)
+iot_dequeue (iot_conf_t *conf, int home, uint32_t *rotor, int *pri,
+             struct timespec *sleep)
 {
         call_stub_t  *stub = NULL;
         int           i = 0;
-	struct timeval curtv = {0,}, difftv = {0,};
 
         *pri = -1;
 	sleep->tv_sec = 0;
 	sleep->tv_nsec = 0;
         for (i = 0; i < IOT_PRI_MAX; i++) {
-                if (list_empty (&conf->reqs[i]) ||
-                   (conf->ac_iot_count[i] >= conf->ac_iot_limit[i]))
+                if (!conf->queue_sizes[i])
                         continue;
 
+                /* reserve a slot of this priority before taking a request */
+                if (__sync_add_and_fetch (&conf->ac_iot_count[i], 1) >
+                    conf->ac_iot_limit[i]) {
+                        __sync_fetch_and_sub (&conf->ac_iot_count[i], 1);
+                        continue;
+                }
+
 		if (i == IOT_PRI_LEAST) {
 			pthread_mutex_lock(&conf->throttle.lock);
-			if (!conf->throttle.sample_time.tv_sec) {
-				/* initialize */
-				gettimeofday(&conf->throttle.sample_time, NULL);
-			} else {
-				/*
-				 * Maintain a running count of least priority
-				 * operations that are handled over a particular
-				 * time interval. The count is provided via
-				 * state dump and is used as a measure against
-				 * least priority op throttling.
-				 */
-				gettimeofday(&curtv, NULL);
-				timersub(&curtv, &conf->throttle.sample_time,
-					 &difftv);
-				if (difftv.tv_sec >= IOT_LEAST_THROTTLE_DELAY) {
-					conf->throttle.cached_rate =
-						conf->throttle.sample_cnt;
-					conf->throttle.sample_cnt = 0;
-					conf->throttle.sample_time = curtv;
-				}
-
-				/*
-				 * If we're over the configured rate limit,
-				 * provide an absolute time to the caller that
-				 * represents the soonest we're allowed to
-				 * return another least priority request.
-				 */
-				if (conf->throttle.rate_limit &&
-				    conf->throttle.sample_cnt >=
-						conf->throttle.rate_limit) {
-					struct timeval delay;
-					delay.tv_sec = IOT_LEAST_THROTTLE_DELAY;
-					delay.tv_usec = 0;
-
-					timeradd(&conf->throttle.sample_time,
-						 &delay, &curtv);
-					TIMEVAL_TO_TIMESPEC(&curtv, sleep);
-
-					pthread_mutex_unlock(
-						&conf->throttle.lock);
-					break;
-				}
-			}
-			conf->throttle.sample_cnt++;
+			if (__iot_least_throttle (conf, sleep) == 0) {
+                                stub = iot_queue_steal (conf, home, rotor, i);
+                                if (stub)
+                                        conf->throttle.sample_cnt++;
+                        }
 			pthread_mutex_unlock(&conf->throttle.lock);
-		}
+		} else {
+                        stub = iot_queue_steal (conf, home, rotor, i);
+                }
 
-                stub = list_entry (conf->reqs[i].next, call_stub_t, list);
-                conf->ac_iot_count[i]++;
-                *pri = i;
-                break;
+                if (stub) {
+                        *pri = i;
+                        break;
+                }
+
+                __sync_fetch_and_sub (&conf->ac_iot_count[i], 1);
+                if (sleep->tv_sec || sleep->tv_nsec)
+                        break;
         }
 
-        if (!stub)
-                return NULL;
+        return stub;
+}
 
-        conf->queue_size--;
-        conf->queue_sizes[*pri]--;
-        list_del_init (&stub->list);
 
-        return stub;
+/* Whether a worker could get a request right now. */
+static gf_boolean_t
+iot_work_available (iot_conf_t *conf)
+{
+        int i = 0;
+
+        for (i = 0; i < IOT_PRI_MAX; i++) {
+                if (conf->queue_sizes[i] &&
+                    (conf->ac_iot_count[i] < conf->ac_iot_limit[i]))
+                        return _gf_true;
+        }
+
+        return _gf_false;
+}
+
+
+/* Wakes up a sleeping worker, preferably one of 'queue'. Workers announce
+ * themselves in sleep_count before checking for work, and the callers of
+ * this publish work before looking for sleepers, so no wakeup is lost. */
+static gf_boolean_t
+iot_queue_signal (iot_queue_t *queue)
+{
+        gf_boolean_t signaled = _gf_false;
+
+        if (!__sync_fetch_and_add (&queue->sleep_count, 0))
+                return _gf_false;
+
+        pthread_mutex_lock (&queue->mutex);
+        {
+                if (queue->sleep_count) {
+                        pthread_cond_signal (&queue->cond);
+                        signaled = _gf_true;
+                }
+        }
+        pthread_mutex_unlock (&queue->mutex);
+
+        return signaled;
+}
+
+
+static void
+iot_wakeup (iot_conf_t *conf, iot_queue_t *queue)
+{
+        int i = 0;
+
+        if (!__sync_fetch_and_add (&conf->sleep_count, 0))
+                return;
+
+        if (queue && iot_queue_signal (queue))
+                return;
+
+        for (i = 0; i < conf->queue_count; i++) {
+                if (iot_queue_signal (&conf->queues[i]))
+                        return;
+        }
 }
 
 
 void
-__iot_enqueue (iot_conf_t *conf, call_stub_t *stub, int pri)
+iot_enqueue (iot_conf_t *conf, iot_client_ctx_t *ctx, call_stub_t *stub,
+             int pri)
 {
+        iot_queue_t *queue = ctx->queue;
+
         if (pri < 0 || pri >= IOT_PRI_MAX)
                 pri = IOT_PRI_MAX-1;
 
-        list_add_tail (&stub->list, &conf->reqs[pri]);
+        gettimeofday (&stub->queued, NULL);
 
-        conf->queue_size++;
-        conf->queue_sizes[pri]++;
+        pthread_mutex_lock (&queue->mutex);
+        {
+                if (list_empty (&ctx->reqs[pri]))
+                        list_add_tail (&ctx->clients[pri],
+                                       &queue->clients[pri]);
+                list_add_tail (&stub->list, &ctx->reqs[pri]);
+
+                queue->queue_size++;
+                queue->queue_sizes[pri]++;
+        }
+        pthread_mutex_unlock (&queue->mutex);
+
+        __sync_fetch_and_add (&conf->queue_sizes[pri], 1);
+        __sync_fetch_and_add (&conf->queue_size, 1);
 
         return;
 }
 
 
+static void
+iot_release (iot_conf_t *conf, int pri)
+{
+        if (pri == -1)
+                return;
+
+        /* a request of this priority may have been waiting for the slot */
+        __sync_fetch_and_sub (&conf->ac_iot_count[pri], 1);
+        if (conf->queue_sizes[pri])
+                iot_wakeup (conf, NULL);
+}
+
+
+/* Sleeps on the home queue until there is work, the throttle delay in
+ * 'sleep' expires or the worker has been idle for too long. Returns
+ * ETIMEDOUT in the last case. */
+static int
+iot_worker_wait (iot_conf_t *conf, iot_queue_t *queue,
+                 struct timespec *sleep_till, struct timespec *sleep)
+{
+        int ret = 0;
+
+        pthread_mutex_lock (&queue->mutex);
+        {
+                __sync_fetch_and_add (&queue->sleep_count, 1);
+                __sync_fetch_and_add (&conf->sleep_count, 1);
+
+                if (sleep->tv_sec || sleep->tv_nsec)
+                        ret = pthread_cond_timedwait (&queue->cond,
+                                                      &queue->mutex, sleep);
+                else if (!iot_work_available (conf))
+                        ret = pthread_cond_timedwait (&queue->cond,
+                                                      &queue->mutex,
+                                                      sleep_till);
+
+                __sync_fetch_and_sub (&conf->sleep_count, 1);
+                __sync_fetch_and_sub (&queue->sleep_count, 1);
+        }
+        pthread_mutex_unlock (&queue->mutex);
+
+        /* throttling is not idling */
+        if (sleep->tv_sec || sleep->tv_nsec)
+                ret = 0;
+
+        return ret;
+}
+
+
 void *
 iot_worker (void *data)
 {
         iot_conf_t       *conf = NULL;
         xlator_t         *this = NULL;
         call_stub_t      *stub = NULL;
+        iot_queue_t      *queue = NULL;
         struct timespec   sleep_till = {0, };
         int               ret = 0;
         int               pri = -1;
-        char              timeout = 0;
+        int               home = 0;
+        uint32_t          rotor = 0;
         char              bye = 0;
 	struct timespec	  sleep = {0,};
 
@@ -165,83 +472,61 @@ iot_worker (void *data)
         this = conf->this;
         THIS = this;
 
+        home = __sync_fetch_and_add (&conf->next_queue, 1) %
+               conf->queue_count;
+        queue = &conf->queues[home];
+        rotor = home + 1;
+
         for (;;) {
                 sleep_till.tv_sec = time (NULL) + conf->idle_time;
 
+                stub = iot_dequeue (conf, home, &rotor, &pri, &sleep);
+                if (stub) {
+                        call_resume (stub);
+                        iot_release (conf, pri);
+                        continue;
+                }
+
+                ret = iot_worker_wait (conf, queue, &sleep_till, &sleep);
+                if (ret != ETIMEDOUT)
+                        continue;
+
                 pthread_mutex_lock (&conf->mutex);
                 {
-                        if (pri != -1) {
-                                conf->ac_iot_count[pri]--;
-                                pri = -1;
-                        }
-                        while (conf->queue_size == 0) {
-                                conf->sleep_count++;
-
-                                ret = pthread_cond_timedwait (&conf->cond,
-                                                              &conf->mutex,
-                                                              &sleep_till);
-                                conf->sleep_count--;
-
-                                if (ret == ETIMEDOUT) {
-                                        timeout = 1;
-                                        break;
-                                }
+                        if (conf->curr_count > IOT_MIN_THREADS) {
+                                conf->curr_count--;
+                                bye = 1;
+                                gf_log (conf->this->name, GF_LOG_DEBUG,
+                                        "timeout, terminated. conf->curr_count=%d",
+                                        conf->curr_count);
                         }
-
-                        if (timeout) {
-                                if (conf->curr_count > IOT_MIN_THREADS) {
-                                        conf->curr_count--;
-                                        bye = 1;
-                                        gf_log (conf->this->name, GF_LOG_DEBUG,
-                                                "timeout, terminated. conf->curr_count=%d",
-                                                conf->curr_count);
-                                } else {
-                                        timeout = 0;
-                                }
-                        }
-
-                        stub = __iot_dequeue (conf, &pri, &sleep);
-			if (!stub && (sleep.tv_sec || sleep.tv_nsec)) {
-				pthread_cond_timedwait(&conf->cond,
-						       &conf->mutex, &sleep);
-				pthread_mutex_unlock(&conf->mutex);
-				continue;
-			}
                 }
                 pthread_mutex_unlock (&conf->mutex);
 
-                if (stub) /* guard against spurious wakeups */
-                        call_resume (stub);
-
                 if (bye)
                         break;
         }
 
-        if (pri != -1) {
-                pthread_mutex_lock (&conf->mutex);
-                {
-                        conf->ac_iot_count[pri]--;
-                }
-                pthread_mutex_unlock (&conf->mutex);
-        }
         return NULL;
 }
 
 
 int
-do_iot_schedule (iot_conf_t *conf, call_stub_t *stub, int pri)
+do_iot_schedule (iot_conf_t *conf, call_frame_t *frame, call_stub_t *stub,
+                 int pri)
 {
-        int   ret = 0;
+        iot_client_ctx_t *ctx = NULL;
+        int               ret = 0;
 
-        pthread_mutex_lock (&conf->mutex);
-        {
-                __iot_enqueue (conf, stub, pri);
+        ctx = iot_get_client_ctx (conf->this, frame);
 
-                pthread_cond_signal (&conf->cond);
+        iot_enqueue (conf, ctx, stub, pri);
 
-                ret = __iot_workers_scale (conf);
-        }
-        pthread_mutex_unlock (&conf->mutex);
+        iot_wakeup (conf, ctx->queue);
+
+        /* only when no worker was idle */
+        if (!conf->sleep_count && (conf->curr_count < conf->max_count))
+                ret = iot_workers_scale (conf);
 
         return ret;
 }
@@ -333,6 +618,7 @@ iot_schedule (call_frame_t *frame, xlator_t *this, call_stub_t *stub)
 	case GF_FOP_FALLOCATE:
 	case GF_FOP_DISCARD:
         case GF_FOP_ZEROFILL:
+        case GF_FOP_SEEK:
                 pri = IOT_PRI_LO;
                 break;
 
@@ -348,7 +634,7 @@ iot_schedule (call_frame_t *frame, xlator_t *this, call_stub_t *stub)
 out:
         gf_log (this->name, GF_LOG_DEBUG, "%s scheduled as %s fop",
                 gf_fop_list[stub->fop], iot_get_pri_meaning (pri));
-        ret = do_iot_schedule (this->private, stub, pri);
+        ret = do_iot_schedule (this->private, frame, stub, pri);
         return ret;
 }
 
@@ -739,6 +1025,14 @@ iot_zerofill(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
         return 0;
 }
 
+int
+iot_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+          gf_seek_what_t what, dict_t *xdata)
+{
+        IOT_FOP (seek, frame, this, fd, offset, what, xdata);
+        return 0;
+}
+
 
 int
 __iot_workers_scale (iot_conf_t *conf)
@@ -850,7 +1144,16 @@ int
 iot_priv_dump (xlator_t *this)
 {
         iot_conf_t     *conf   =   NULL;
+        iot_queue_t    *queue  =   NULL;
         char           key_prefix[GF_DUMP_MAX_BUF_LEN];
+        char           key[GF_DUMP_MAX_BUF_LEN];
+        char           hist[512];
+        char          *name    =   NULL;
+        uint64_t       count   =   0;
+        size_t         len     =   0;
+        int            i       =   0;
+        int            j       =   0;
+        int            k       =   0;
 
         if (!this)
                 return 0;
@@ -882,6 +1185,46 @@ iot_priv_dump (xlator_t *this)
 			   conf->throttle.cached_rate);
 	gf_proc_dump_write("least rate limit", "%u", conf->throttle.rate_limit);
 
+        gf_proc_dump_write("queue_count", "%d", conf->queue_count);
+        for (i = 0; i < IOT_PRI_MAX; i++) {
+                name = iot_get_pri_meaning (i);
+                gf_proc_dump_write ("queue_depth", "%s: %d", name,
+                                    conf->queue_sizes[i]);
+                gf_proc_dump_write ("in_flight", "%s: %d", name,
+                                    conf->ac_iot_count[i]);
+
+                /* wait_usecs: "<1: n <2: n <4: n ..." */
+                memset (hist, 0, sizeof (hist));
+                for (j = 0; j < IOT_WAIT_BUCKETS; j++) {
+                        count = 0;
+                        for (k = 0; k < conf->queue_count; k++)
+                                count += conf->queues[k].wait_hist[i][j];
+                        if (!count)
+                                continue;
+                        if (j < IOT_WAIT_BUCKETS - 1)
+                                len += snprintf (hist + len, sizeof (hist) -
+                                                 len, "<%llu: %"PRIu64" ",
+                                                 1ULL << j, count);
+                        else
+                                len += snprintf (hist + len, sizeof (hist) -
+                                                 len, ">=%llu: %"PRIu64,
+                                                 1ULL << (j - 1), count);
+                        if (len >= sizeof (hist))
+                                break;
+                }
+                len = 0;
+                gf_proc_dump_write ("wait_usecs", "%s: %s", name, hist);
+        }
+
+        for (k = 0; k < conf->queue_count; k++) {
+                queue = &conf->queues[k];
+                snprintf (key, sizeof (key), "queue[%d]", k);
+                gf_proc_dump_write (key, "depth=%d, sleepers=%d, "
+                                    "dequeued=%"PRIu64", stolen=%"PRIu64,
+                                    queue->queue_size, queue->sleep_count,
+                                    queue->dequeued, queue->stolen);
+        }
+
         return 0;
 }
 
@@ -922,12 +1265,77 @@ out:
 }
 
 
+static int
+iot_queues_init (iot_conf_t *conf)
+{
+        iot_queue_t *queue = NULL;
+        int          i = 0;
+        int          j = 0;
+
+        conf->queues = GF_CALLOC (conf->queue_count, sizeof (*conf->queues),
+                                  gf_iot_mt_iot_queue_t);
+        if (!conf->queues)
+                return -1;
+
+        for (i = 0; i < conf->queue_count; i++) {
+                queue = &conf->queues[i];
+
+                pthread_mutex_init (&queue->mutex, NULL);
+                pthread_cond_init (&queue->cond, NULL);
+                for (j = 0; j < IOT_PRI_MAX; j++)
+                        INIT_LIST_HEAD (&queue->clients[j]);
+                iot_client_ctx_init (&queue->no_client, queue);
+        }
+
+        return 0;
+}
+
+
+int
+iot_client_destroy (xlator_t *this, client_t *client)
+{
+        iot_client_ctx_t *ctx = NULL;
+        iot_client_ctx_t *no_client = NULL;
+        iot_queue_t      *queue = NULL;
+        void             *tmp = NULL;
+        int               i = 0;
+
+        if (client_ctx_del (client, this, &tmp) || !tmp)
+                return 0;
+
+        ctx = tmp;
+        queue = ctx->queue;
+        no_client = &queue->no_client;
+
+        /* should not happen as requests keep a ref on the client, but do
+         * not lose them if it does */
+        pthread_mutex_lock (&queue->mutex);
+        {
+                for (i = 0; i < IOT_PRI_MAX; i++) {
+                        if (list_empty (&ctx->reqs[i]))
+                                continue;
+
+                        if (list_empty (&no_client->reqs[i]))
+                                list_add_tail (&no_client->clients[i],
+                                               &queue->clients[i]);
+                        list_splice_init (&ctx->reqs[i],
+                                          no_client->reqs[i].prev);
+                        list_del_init (&ctx->clients[i]);
+                }
+        }
+        pthread_mutex_unlock (&queue->mutex);
+
+        GF_FREE (ctx);
+
+        return 0;
+}
+
+
 int
 init (xlator_t *this)
 {
         iot_conf_t *conf = NULL;
         int         ret  = -1;
-        int         i    = 0;
 
 	if (!this->children || this->children->next) {
 		gf_log ("io-threads", GF_LOG_ERROR,
@@ -990,9 +1398,17 @@ init (xlator_t *this)
 
         conf->this = this;
 
-        for (i = 0; i < IOT_PRI_MAX; i++) {
-                INIT_LIST_HEAD (&conf->reqs[i]);
-        }
+        GF_OPTION_INIT ("worker-queues", conf->queue_count, int32, out);
+        if (conf->queue_count == 0)
+                conf->queue_count = sysconf (_SC_NPROCESSORS_ONLN);
+        if (conf->queue_count < 1)
+                conf->queue_count = 1;
+        if (conf->queue_count > IOT_MAX_QUEUES)
+                conf->queue_count = IOT_MAX_QUEUES;
+
+        ret = iot_queues_init (conf);
+        if (ret)
+                goto out;
 
 	ret = iot_workers_scale (conf);
 
@@ -1005,8 +1421,10 @@ init (xlator_t *this)
 	this->private = conf;
         ret = 0;
 out:
-        if (ret)
+        if (ret && conf) {
+                GF_FREE (conf->queues);
                 GF_FREE (conf);
+        }
 
 	return ret;
 }
@@ -1017,6 +1435,8 @@ fini (xlator_t *this)
 {
 	iot_conf_t *conf = this->private;
 
+        if (conf)
+                GF_FREE (conf->queues);
 	GF_FREE (conf);
 
 	this->private = NULL;
@@ -1072,9 +1492,12 @@ struct xlator_fops fops = {
 	.fallocate   = iot_fallocate,
 	.discard     = iot_discard,
         .zerofill    = iot_zerofill,
+        .seek        = iot_seek,
 };
 
-struct xlator_cbks cbks;
+struct xlator_cbks cbks = {
+        .client_destroy = iot_client_destroy,
+};
 
 struct volume_options options[] = {
 	{ .key  = {"thread-count"},
@@ -1132,6 +1555,16 @@ struct volume_options options[] = {
          .max   = 0x7fffffff,
          .default_value = "120",
         },
+        {.key   = {"worker-queues"},
+         .type  = GF_OPTION_TYPE_INT,
+         .min   = 0,
+         .max   = IOT_MAX_QUEUES,
+         .default_value = "0",
+         .description = "Number of request queues the worker threads are "
+                        "spread over. Idle workers steal requests from the "
+                        "other queues. 0 uses one queue per online CPU. "
+                        "Only read when the translator is initialized."
+        },
 	{.key	= {"least-rate-limit"},
 	 .type	= GF_OPTION_TYPE_INT,
 	 .min	= 0,
@@ -39,7 +39,11 @@ struct iot_conf;
 
 #define IOT_MIN_THREADS         1
 #define IOT_DEFAULT_THREADS     16
-#define IOT_MAX_THREADS         64
+#define IOT_MAX_THREADS         256
+#define IOT_MAX_QUEUES          64
+
+/* log2 buckets of the time requests spend queued, in microseconds */
+#define IOT_WAIT_BUCKETS        16
 
 
 #define IOT_THREAD_STACK_SIZE   ((size_t)(1024*1024))
@@ -62,9 +66,40 @@ struct iot_least_throttle {
 	pthread_mutex_t	lock;
 };
 
-struct iot_conf {
+struct iot_queue;
+
+/* Requests of one client, queued per priority. Clients with pending
+ * requests of a priority are served round-robin, so that a client flooding
+ * the brick only gets its share of the workers. */
+typedef struct iot_client_ctx {
+        struct iot_queue    *queue;
+        struct list_head     clients[IOT_PRI_MAX]; /* in queue->clients[] */
+        struct list_head     reqs[IOT_PRI_MAX];
+} iot_client_ctx_t;
+
+/* Every worker has a home queue which it serves first. Once it runs out of
+ * work it steals from the other queues, highest priority first, so the
+ * priority ordering holds across all of them. A client always queues on the
+ * same queue. */
+typedef struct iot_queue {
         pthread_mutex_t      mutex;
         pthread_cond_t       cond;
+        int32_t              sleep_count;
+
+        int32_t              queue_size;
+        int32_t              queue_sizes[IOT_PRI_MAX];
+        struct list_head     clients[IOT_PRI_MAX];
+        iot_client_ctx_t     no_client;   /* requests without a client_t */
+
+        uint64_t             dequeued;
+        uint64_t             stolen;      /* dequeued by foreign workers */
+        uint64_t             wait_hist[IOT_PRI_MAX][IOT_WAIT_BUCKETS];
+} iot_queue_t;
+
+struct iot_conf {
+        pthread_mutex_t      mutex;       /* thread accounting, client ctx
+                                             creation */
+        pthread_cond_t       cond;
 
         int32_t              max_count;   /* configured maximum */
         int32_t              curr_count;  /* actual number of threads running */
@@ -72,8 +107,12 @@ struct iot_conf {
 
         int32_t              idle_time;   /* in seconds */
 
-        struct list_head     reqs[IOT_PRI_MAX];
+        iot_queue_t         *queues;
+        int32_t              queue_count;
+        uint32_t             next_queue;  /* for workers and client-less
+                                             requests */
 
+        /* updated atomically, the queues have their own counts */
         int32_t              ac_iot_limit[IOT_PRI_MAX];
         int32_t              ac_iot_count[IOT_PRI_MAX];
         int                  queue_sizes[IOT_PRI_MAX];
@@ -0,0 +1,1050 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "nl-cache.h"
+#include "defaults.h"
+#include "statedump.h"
+#include "hashfn.h"
+
+/*
+ * Negative lookup cache.
+ *
+ * Lookups failing with ENOENT are remembered as negative entries of their
+ * parent directory, and further lookups of the same name are answered from
+ * here until the entry times out. Every fop that can make a name appear in
+ * a directory (create, mknod, mkdir, symlink, link and rename) drops it,
+ * and an upcall notification for a directory drops all of its entries.
+ *
+ * The entries of a directory are kept in a hash table, which grows with
+ * them, and directories only get one once an entry is cached in them.
+ *
+ * Each directory also carries a generation, bumped by every invalidation.
+ * A lookup notes it when it is wound, and its ENOENT is only cached if
+ * nothing was invalidated in the directory while it was in flight.
+ *
+ * Names created through other clients are only seen through upcalls, so
+ * without cache-invalidation nothing is cached and every fop is passed
+ * through.
+ */
+
+
+static struct nlc_ctx *
+nlc_inode_ctx_get (xlator_t *this, inode_t *inode)
+{
+        uint64_t value = 0;
+
+        if (inode_ctx_get (inode, this, &value) != 0)
+                return NULL;
+
+        return (struct nlc_ctx *)(long) value;
+}
+
+
+/* Returns the ctx of @inode. Without one, bumps the generation of its
+ * slot instead, so that lookups in flight do not create it. */
+static struct nlc_ctx *
+nlc_inode_ctx_get_or_inval (xlator_t *this, inode_t *inode)
+{
+        nlc_conf_t     *conf  = this->private;
+        struct nlc_ctx *ctx   = NULL;
+        uint64_t        value = 0;
+
+        LOCK (&inode->lock);
+        {
+                if (__inode_ctx_get (inode, this, &value) == 0)
+                        ctx = (struct nlc_ctx *)(long) value;
+                else
+                        __sync_fetch_and_add (&conf->gen[NLC_GEN_SLOT (inode)],
+                                              1);
+        }
+        UNLOCK (&inode->lock);
+
+        return ctx;
+}
+
+
+/* Creates the ctx of @inode for a lookup that found none when it was
+ * wound, unless the directory was invalidated since, as @gen tells. */
+static struct nlc_ctx *
+nlc_inode_ctx_prep (xlator_t *this, inode_t *inode, uint64_t gen)
+{
+        nlc_conf_t     *conf  = this->private;
+        struct nlc_ctx *ctx   = NULL;
+        uint64_t        value = 0;
+
+        LOCK (&inode->lock);
+        {
+                /* the slot only moves while the directory has no ctx */
+                if (conf->gen[NLC_GEN_SLOT (inode)] != gen)
+                        goto unlock;
+
+                if (__inode_ctx_get (inode, this, &value) == 0) {
+                        ctx = (struct nlc_ctx *)(long) value;
+                        goto unlock;
+                }
+
+                ctx = GF_CALLOC (1, sizeof (*ctx), gf_nlc_mt_nlc_ctx_t);
+                if (!ctx)
+                        goto unlock;
+
+                ctx->hash_size = NLC_HASH_MIN;
+                ctx->ne_hash = GF_CALLOC (ctx->hash_size,
+                                          sizeof (*ctx->ne_hash),
+                                          gf_nlc_mt_nlc_ctx_t);
+                if (!ctx->ne_hash)
+                        goto free;
+                for (value = 0; value < ctx->hash_size; value++)
+                        INIT_LIST_HEAD (&ctx->ne_hash[value]);
+                INIT_LIST_HEAD (&ctx->lru);
+                LOCK_INIT (&ctx->lock);
+
+                value = (uint64_t)(long) ctx;
+                if (__inode_ctx_set (inode, this, &value) == 0)
+                        goto unlock;
+
+                LOCK_DESTROY (&ctx->lock);
+free:
+                GF_FREE (ctx->ne_hash);
+                GF_FREE (ctx);
+                ctx = NULL;
+        }
+unlock:
+        UNLOCK (&inode->lock);
+
+        return ctx;
+}
+
+
+static void
+__nlc_ne_free (xlator_t *this, struct nlc_ctx *ctx, struct nlc_ne *ne)
+{
+        nlc_conf_t *conf = this->private;
+
+        list_del (&ne->hash);
+        ctx->ne_count--;
+        ctx->cache_size -= ne->size;
+        __sync_fetch_and_sub (&conf->current_cache_size, ne->size);
+
+        GF_FREE (ne);
+}
+
+
+static void
+__nlc_ctx_clear (xlator_t *this, struct nlc_ctx *ctx)
+{
+        struct nlc_ne *ne  = NULL;
+        struct nlc_ne *tmp = NULL;
+        uint32_t       i   = 0;
+
+        for (i = 0; ctx->ne_count && (i < ctx->hash_size); i++) {
+                list_for_each_entry_safe (ne, tmp, &ctx->ne_hash[i], hash)
+                        __nlc_ne_free (this, ctx, ne);
+        }
+
+        ctx->gen++;
+}
+
+
+static struct nlc_ne *
+__nlc_ne_find (struct nlc_ctx *ctx, const char *name, uint32_t hashval)
+{
+        struct nlc_ne *ne = NULL;
+
+        list_for_each_entry (ne, &ctx->ne_hash[hashval & (ctx->hash_size - 1)],
+                             hash) {
+                if ((ne->hashval == hashval) && (strcmp (ne->name, name) == 0))
+                        return ne;
+        }
+
+        return NULL;
+}
+
+
+/* Doubles the buckets of @ctx, it keeps the ones it has if that fails */
+static void
+__nlc_ctx_grow (struct nlc_ctx *ctx)
+{
+        struct list_head *ne_hash = NULL;
+        struct nlc_ne    *ne      = NULL;
+        struct nlc_ne    *tmp     = NULL;
+        uint32_t          size    = 0;
+        uint32_t          i       = 0;
+
+        size = ctx->hash_size * 2;
+        ne_hash = GF_CALLOC (size, sizeof (*ne_hash), gf_nlc_mt_nlc_ctx_t);
+        if (!ne_hash)
+                return;
+
+        for (i = 0; i < size; i++)
+                INIT_LIST_HEAD (&ne_hash[i]);
+
+        for (i = 0; i < ctx->hash_size; i++) {
+                list_for_each_entry_safe (ne, tmp, &ctx->ne_hash[i], hash)
+                        list_move (&ne->hash,
+                                   &ne_hash[ne->hashval & (size - 1)]);
+        }
+
+        GF_FREE (ctx->ne_hash);
+        ctx->ne_hash = ne_hash;
+        ctx->hash_size = size;
+}
+
+
+/* Directories are evicted as a whole, starting with the one whose last
+ * negative entry is the oldest. */
+static void
+nlc_lru_update (xlator_t *this, struct nlc_ctx *ctx)
+{
+        nlc_conf_t     *conf  = this->private;
+        struct nlc_ctx *evict = NULL;
+
+        LOCK (&conf->lock);
+        {
+                list_move_tail (&ctx->lru, &conf->lru);
+
+                while ((conf->current_cache_size > conf->cache_limit) &&
+                       !list_empty (&conf->lru)) {
+                        evict = list_entry (conf->lru.next, struct nlc_ctx,
+                                            lru);
+                        list_del_init (&evict->lru);
+
+                        LOCK (&evict->lock);
+                        {
+                                __nlc_ctx_clear (this, evict);
+                        }
+                        UNLOCK (&evict->lock);
+                }
+        }
+        UNLOCK (&conf->lock);
+}
+
+
+static gf_boolean_t
+nlc_ne_lookup (xlator_t *this, inode_t *parent, const char *name)
+{
+        nlc_conf_t     *conf    = this->private;
+        struct nlc_ctx *ctx     = NULL;
+        struct nlc_ne  *ne      = NULL;
+        gf_boolean_t    hit     = _gf_false;
+        uint32_t        hashval = 0;
+        time_t          now     = 0;
+
+        ctx = nlc_inode_ctx_get (this, parent);
+        if (!ctx)
+                return _gf_false;
+
+        hashval = SuperFastHash (name, strlen (name));
+        time (&now);
+
+        LOCK (&ctx->lock);
+        {
+                ne = __nlc_ne_find (ctx, name, hashval);
+                if (!ne)
+                        goto unlock;
+
+                if (now >= (ne->cache_time + conf->cache_timeout)) {
+                        __nlc_ne_free (this, ctx, ne);
+                        goto unlock;
+                }
+
+                hit = _gf_true;
+        }
+unlock:
+        UNLOCK (&ctx->lock);
+
+        return hit;
+}
+
+
+/* Caches @name as missing from the parent of @local, unless the parent
+ * was invalidated since @local was set up. */
+static void
+nlc_ne_add (xlator_t *this, nlc_local_t *local, inode_t *parent,
+            const char *name)
+{
+        nlc_conf_t     *conf    = this->private;
+        struct nlc_ctx *ctx     = NULL;
+        struct nlc_ne  *ne      = NULL;
+        gf_boolean_t    added   = _gf_false;
+        uint64_t        gen     = 0;
+        uint32_t        hashval = 0;
+        size_t          size    = 0;
+        time_t          now     = 0;
+
+        if (!conf->cache_timeout || !conf->cache_invalidation)
+                return;
+
+        if (local->had_ctx) {
+                ctx = nlc_inode_ctx_get (this, parent);
+                gen = local->gen;
+        } else {
+                /* a ctx created since has not been invalidated yet */
+                ctx = nlc_inode_ctx_prep (this, parent, local->gen);
+                gen = 0;
+        }
+        if (!ctx)
+                return;
+
+        size = sizeof (*ne) + strlen (name) + 1;
+        hashval = SuperFastHash (name, strlen (name));
+        time (&now);
+
+        LOCK (&ctx->lock);
+        {
+                if (ctx->gen != gen)
+                        goto unlock;
+
+                ne = __nlc_ne_find (ctx, name, hashval);
+                if (ne) {
+                        ne->cache_time = now;
+                        goto unlock;
+                }
+
+                ne = GF_CALLOC (1, size, gf_nlc_mt_nlc_ne_t);
+                if (!ne)
+                        goto unlock;
+
+                strcpy (ne->name, name);
+                ne->hashval = hashval;
+                ne->size = size;
+                ne->cache_time = now;
+
+                list_add (&ne->hash,
+                          &ctx->ne_hash[hashval & (ctx->hash_size - 1)]);
+                ctx->ne_count++;
+                ctx->cache_size += size;
+                __sync_fetch_and_add (&conf->current_cache_size, size);
+                added = _gf_true;
+
+                if ((ctx->ne_count > 2 * ctx->hash_size) &&
+                    (ctx->hash_size < NLC_HASH_MAX))
+                        __nlc_ctx_grow (ctx);
+        }
+unlock:
+        UNLOCK (&ctx->lock);
+
+        if (added)
+                nlc_lru_update (this, ctx);
+}
+
+
+static void
+nlc_ne_del (xlator_t *this, inode_t *parent, const char *name)
+{
+        struct nlc_ctx *ctx     = NULL;
+        struct nlc_ne  *ne      = NULL;
+        uint32_t        hashval = 0;
+
+        if (!parent || !name)
+                return;
+
+        ctx = nlc_inode_ctx_get_or_inval (this, parent);
+        if (!ctx)
+                return;
+
+        hashval = SuperFastHash (name, strlen (name));
+
+        LOCK (&ctx->lock);
+        {
+                ctx->gen++;
+
+                ne = __nlc_ne_find (ctx, name, hashval);
+                if (ne)
+                        __nlc_ne_free (this, ctx, ne);
+        }
+        UNLOCK (&ctx->lock);
+}
+
+
+static void
+nlc_dir_inval (xlator_t *this, inode_t *inode)
+{
+        nlc_conf_t     *conf = this->private;
+        struct nlc_ctx *ctx  = NULL;
+
+        ctx = nlc_inode_ctx_get_or_inval (this, inode);
+        if (ctx) {
+                LOCK (&ctx->lock);
+                {
+                        __nlc_ctx_clear (this, ctx);
+                }
+                UNLOCK (&ctx->lock);
+        }
+
+        __sync_fetch_and_add (&conf->nlc_invals, 1);
+}
+
+
+/* Upcalls may have been missed while a subvolume was away. */
+static void
+nlc_clear_all (xlator_t *this)
+{
+        nlc_conf_t     *conf = this->private;
+        struct nlc_ctx *ctx  = NULL;
+        int             i    = 0;
+
+        LOCK (&conf->lock);
+        {
+                list_for_each_entry (ctx, &conf->lru, lru) {
+                        LOCK (&ctx->lock);
+                        {
+                                __nlc_ctx_clear (this, ctx);
+                        }
+                        UNLOCK (&ctx->lock);
+                }
+        }
+        UNLOCK (&conf->lock);
+
+        for (i = 0; i < NLC_GEN_SLOTS; i++)
+                __sync_fetch_and_add (&conf->gen[i], 1);
+}
+
+
+static void
+nlc_upcall_inval (xlator_t *this, struct gf_upcall *upcall)
+{
+        nlc_conf_t *conf  = this->private;
+        inode_t    *inode = NULL;
+
+        if (!upcall || !conf->itable)
+                return;
+
+        inode = inode_find (conf->itable, (unsigned char *)upcall->gfid);
+        if (!inode)
+                return;
+
+        /* any change of a directory may have added names to it */
+        if (inode->ia_type == IA_IFDIR)
+                nlc_dir_inval (this, inode);
+
+        inode_unref (inode);
+}
+
+
+/* Notes the generation of the parent directory, its ENOENT or removal is
+ * only cached if nothing was invalidated in it meanwhile. Directories get
+ * a ctx only once they have an entry cached, until then invalidations
+ * bump the generation of the slot of conf->gen the directory maps to. */
+static nlc_local_t *
+nlc_local_init (call_frame_t *frame, xlator_t *this, loc_t *loc, loc_t *loc2)
+{
+        nlc_conf_t     *conf  = this->private;
+        nlc_local_t    *local = NULL;
+        struct nlc_ctx *ctx   = NULL;
+        uint64_t        value = 0;
+
+        local = GF_CALLOC (1, sizeof (*local), gf_nlc_mt_nlc_local_t);
+        if (!local)
+                return NULL;
+
+        loc_copy (&local->loc, loc);
+        if (loc2)
+                loc_copy (&local->loc2, loc2);
+
+        if (loc->parent) {
+                LOCK (&loc->parent->lock);
+                {
+                        if (__inode_ctx_get (loc->parent, this, &value) == 0)
+                                ctx = (struct nlc_ctx *)(long) value;
+                        else
+                                local->gen =
+                                        conf->gen[NLC_GEN_SLOT (loc->parent)];
+                }
+                UNLOCK (&loc->parent->lock);
+
+                if (ctx) {
+                        LOCK (&ctx->lock);
+                        {
+                                local->gen = ctx->gen;
+                                local->had_ctx = _gf_true;
+                        }
+                        UNLOCK (&ctx->lock);
+                }
+        }
+
+        frame->local = local;
+
+        return local;
+}
+
+
+void
+nlc_local_wipe (xlator_t *this, nlc_local_t *local)
+{
+        if (!local)
+                return;
+
+        loc_wipe (&local->loc);
+        loc_wipe (&local->loc2);
+
+        GF_FREE (local);
+}
+
+
+int
+nlc_lookup_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, inode_t *inode,
+                struct iatt *stbuf, dict_t *xdata, struct iatt *postparent)
+{
+        nlc_conf_t  *conf  = this->private;
+        nlc_local_t *local = NULL;
+
+        local = frame->local;
+        if (!local)
+                goto out;
+
+        if ((op_ret < 0) && (op_errno == ENOENT)) {
+                __sync_fetch_and_add (&conf->nlc_miss, 1);
+                nlc_ne_add (this, local, local->loc.parent, local->loc.name);
+        }
+
+out:
+        NLC_STACK_UNWIND (lookup, frame, op_ret, op_errno, inode, stbuf,
+                          xdata, postparent);
+        return 0;
+}
+
+
+int
+nlc_lookup (call_frame_t *frame, xlator_t *this, loc_t *loc, dict_t *xdata)
+{
+        nlc_conf_t  *conf       = this->private;
+        struct iatt  stbuf      = {0, };
+        struct iatt  postparent = {0, };
+
+        /* nameless lookups are meant to reach the bricks */
+        if (!loc->parent || !loc->name)
+                goto wind;
+
+        if (!conf->itable)
+                conf->itable = loc->parent->table;
+
+        if (nlc_ne_lookup (this, loc->parent, loc->name)) {
+                __sync_fetch_and_add (&conf->nlc_hit, 1);
+                NLC_STACK_UNWIND (lookup, frame, -1, ENOENT, NULL, &stbuf,
+                                  NULL, &postparent);
+                return 0;
+        }
+
+        nlc_local_init (frame, this, loc, NULL);
+
+wind:
+        STACK_WIND (frame, nlc_lookup_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->lookup, loc, xdata);
+        return 0;
+}
+
+
+int
+nlc_mknod_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, inode_t *inode,
+               struct iatt *buf, struct iatt *preparent,
+               struct iatt *postparent, dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (local)
+                nlc_ne_del (this, local->loc.parent, local->loc.name);
+
+        NLC_STACK_UNWIND (mknod, frame, op_ret, op_errno, inode, buf,
+                          preparent, postparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_mknod (call_frame_t *frame, xlator_t *this, loc_t *loc, mode_t mode,
+           dev_t rdev, mode_t umask, dict_t *xdata)
+{
+        nlc_ne_del (this, loc->parent, loc->name);
+        nlc_local_init (frame, this, loc, NULL);
+
+        STACK_WIND (frame, nlc_mknod_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->mknod, loc, mode, rdev, umask,
+                    xdata);
+        return 0;
+}
+
+
+int
+nlc_mkdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, inode_t *inode,
+               struct iatt *buf, struct iatt *preparent,
+               struct iatt *postparent, dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (local)
+                nlc_ne_del (this, local->loc.parent, local->loc.name);
+
+        NLC_STACK_UNWIND (mkdir, frame, op_ret, op_errno, inode, buf,
+                          preparent, postparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_mkdir (call_frame_t *frame, xlator_t *this, loc_t *loc, mode_t mode,
+           mode_t umask, dict_t *xdata)
+{
+        nlc_ne_del (this, loc->parent, loc->name);
+        nlc_local_init (frame, this, loc, NULL);
+
+        STACK_WIND (frame, nlc_mkdir_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->mkdir, loc, mode, umask, xdata);
+        return 0;
+}
+
+
+int
+nlc_symlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, inode_t *inode,
+                 struct iatt *buf, struct iatt *preparent,
+                 struct iatt *postparent, dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (local)
+                nlc_ne_del (this, local->loc.parent, local->loc.name);
+
+        NLC_STACK_UNWIND (symlink, frame, op_ret, op_errno, inode, buf,
+                          preparent, postparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_symlink (call_frame_t *frame, xlator_t *this, const char *linkpath,
+             loc_t *loc, mode_t umask, dict_t *xdata)
+{
+        nlc_ne_del (this, loc->parent, loc->name);
+        nlc_local_init (frame, this, loc, NULL);
+
+        STACK_WIND (frame, nlc_symlink_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->symlink, linkpath, loc, umask,
+                    xdata);
+        return 0;
+}
+
+
+int
+nlc_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, fd_t *fd, inode_t *inode,
+                struct iatt *buf, struct iatt *preparent,
+                struct iatt *postparent, dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (local)
+                nlc_ne_del (this, local->loc.parent, local->loc.name);
+
+        NLC_STACK_UNWIND (create, frame, op_ret, op_errno, fd, inode, buf,
+                          preparent, postparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_create (call_frame_t *frame, xlator_t *this, loc_t *loc, int32_t flags,
+            mode_t mode, mode_t umask, fd_t *fd, dict_t *xdata)
+{
+        nlc_ne_del (this, loc->parent, loc->name);
+        nlc_local_init (frame, this, loc, NULL);
+
+        STACK_WIND (frame, nlc_create_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->create, loc, flags, mode, umask,
+                    fd, xdata);
+        return 0;
+}
+
+
+int
+nlc_link_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+              int32_t op_ret, int32_t op_errno, inode_t *inode,
+              struct iatt *buf, struct iatt *preparent,
+              struct iatt *postparent, dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (local)
+                nlc_ne_del (this, local->loc2.parent, local->loc2.name);
+
+        NLC_STACK_UNWIND (link, frame, op_ret, op_errno, inode, buf,
+                          preparent, postparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_link (call_frame_t *frame, xlator_t *this, loc_t *oldloc, loc_t *newloc,
+          dict_t *xdata)
+{
+        nlc_ne_del (this, newloc->parent, newloc->name);
+        nlc_local_init (frame, this, oldloc, newloc);
+
+        STACK_WIND (frame, nlc_link_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->link, oldloc, newloc, xdata);
+        return 0;
+}
+
+
+int
+nlc_rename_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, struct iatt *buf,
+                struct iatt *preoldparent, struct iatt *postoldparent,
+                struct iatt *prenewparent, struct iatt *postnewparent,
+                dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (!local)
+                goto out;
+
+        /* the source name is gone now. Added before the target is
+         * dropped, as dropping it bumps the generation of the parent,
+         * which is the same one for a rename within a directory.
+         */
+        if ((op_ret == 0) && local->loc.parent && local->loc.name)
+                nlc_ne_add (this, local, local->loc.parent, local->loc.name);
+
+        nlc_ne_del (this, local->loc2.parent, local->loc2.name);
+
+out:
+        NLC_STACK_UNWIND (rename, frame, op_ret, op_errno, buf, preoldparent,
+                          postoldparent, prenewparent, postnewparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_rename (call_frame_t *frame, xlator_t *this, loc_t *oldloc,
+            loc_t *newloc, dict_t *xdata)
+{
+        nlc_ne_del (this, newloc->parent, newloc->name);
+        nlc_local_init (frame, this, oldloc, newloc);
+
+        STACK_WIND (frame, nlc_rename_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->rename, oldloc, newloc, xdata);
+        return 0;
+}
+
+
+int
+nlc_unlink_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                int32_t op_ret, int32_t op_errno, struct iatt *preparent,
+                struct iatt *postparent, dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (local && (op_ret == 0) && local->loc.parent && local->loc.name)
+                nlc_ne_add (this, local, local->loc.parent, local->loc.name);
+
+        NLC_STACK_UNWIND (unlink, frame, op_ret, op_errno, preparent,
+                          postparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_unlink (call_frame_t *frame, xlator_t *this, loc_t *loc, int xflag,
+            dict_t *xdata)
+{
+        nlc_local_init (frame, this, loc, NULL);
+
+        STACK_WIND (frame, nlc_unlink_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->unlink, loc, xflag, xdata);
+        return 0;
+}
+
+
+int
+nlc_rmdir_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+               int32_t op_ret, int32_t op_errno, struct iatt *preparent,
+               struct iatt *postparent, dict_t *xdata)
+{
+        nlc_local_t *local = frame->local;
+
+        if (local && (op_ret == 0) && local->loc.parent && local->loc.name)
+                nlc_ne_add (this, local, local->loc.parent, local->loc.name);
+
+        NLC_STACK_UNWIND (rmdir, frame, op_ret, op_errno, preparent,
+                          postparent, xdata);
+        return 0;
+}
+
+
+int
+nlc_rmdir (call_frame_t *frame, xlator_t *this, loc_t *loc, int flags,
+           dict_t *xdata)
+{
+        nlc_local_init (frame, this, loc, NULL);
+
+        STACK_WIND (frame, nlc_rmdir_cbk, FIRST_CHILD (this),
+                    FIRST_CHILD (this)->fops->rmdir, loc, flags, xdata);
+        return 0;
+}
+
+
+int
+nlc_forget (xlator_t *this, inode_t *inode)
+{
+        nlc_conf_t     *conf  = this->private;
+        struct nlc_ctx *ctx   = NULL;
+        uint64_t        value = 0;
+
+        if (inode_ctx_del (inode, this, &value) != 0)
+                return 0;
+
+        ctx = (struct nlc_ctx *)(long) value;
+
+        LOCK (&conf->lock);
+        {
+                list_del_init (&ctx->lru);
+        }
+        UNLOCK (&conf->lock);
+
+        LOCK (&ctx->lock);
+        {
+                __nlc_ctx_clear (this, ctx);
+        }
+        UNLOCK (&ctx->lock);
+
+        LOCK_DESTROY (&ctx->lock);
+        GF_FREE (ctx->ne_hash);
+        GF_FREE (ctx);
+
+        return 0;
+}
+
+
+int
+nlc_priv_dump (xlator_t *this)
+{
+        nlc_conf_t *conf                            = NULL;
+        char        key_prefix[GF_DUMP_MAX_BUF_LEN] = {0, };
+
+        conf = this->private;
+        if (!conf)
+                return 0;
+
+        gf_proc_dump_build_key (key_prefix, this->type, this->name);
+        gf_proc_dump_add_section (key_prefix);
+
+        gf_proc_dump_write ("cache_timeout", "%d", conf->cache_timeout);
+        gf_proc_dump_write ("cache_limit", "%"PRIu64, conf->cache_limit);
+        gf_proc_dump_write ("current_cache_size", "%"PRIu64,
+                            conf->current_cache_size);
+        gf_proc_dump_write ("nlc_hit", "%"PRIu64, conf->nlc_hit);
+        gf_proc_dump_write ("nlc_miss", "%"PRIu64, conf->nlc_miss);
+        gf_proc_dump_write ("nlc_invals", "%"PRIu64, conf->nlc_invals);
+
+        return 0;
+}
+
+
+int
+nlc_inode_ctx_dump (xlator_t *this, inode_t *inode)
+{
+        struct nlc_ctx *ctx                             = NULL;
+        char            key_prefix[GF_DUMP_MAX_BUF_LEN] = {0, };
+        int             ne_count                        = 0;
+        uint32_t        hash_size                       = 0;
+        uint64_t        cache_size                      = 0;
+
+        ctx = nlc_inode_ctx_get (this, inode);
+        if (!ctx)
+                return 0;
+
+        LOCK (&ctx->lock);
+        {
+                ne_count = ctx->ne_count;
+                hash_size = ctx->hash_size;
+                cache_size = ctx->cache_size;
+        }
+        UNLOCK (&ctx->lock);
+
+        gf_proc_dump_build_key (key_prefix, "xlator.performance.nl-cache",
+                                "nlc_inode");
+        gf_proc_dump_add_section (key_prefix);
+        gf_proc_dump_write ("negative_entries", "%d", ne_count);
+        gf_proc_dump_write ("hash_size", "%"PRIu32, hash_size);
+        gf_proc_dump_write ("cache_size", "%"PRIu64, cache_size);
+
+        return 0;
+}
+
+
+int
+notify (xlator_t *this, int event, void *data, ...)
+{
+        switch (event) {
+        case GF_EVENT_UPCALL:
+                nlc_upcall_inval (this, data);
+                break;
+        case GF_EVENT_CHILD_UP:
+        case GF_EVENT_CHILD_DOWN:
+        case GF_EVENT_CHILD_MODIFIED:
+                if (this->private)
+                        nlc_clear_all (this);
+                break;
+        default:
+                break;
+        }
+
+        return default_notify (this, event, data);
+}
+
+
+int
+reconfigure (xlator_t *this, dict_t *options)
+{
+        nlc_conf_t *conf = NULL;
+
+        conf = this->private;
+
+        GF_OPTION_RECONF ("nl-cache-timeout", conf->cache_timeout, options,
+                          int32, out);
+        GF_OPTION_RECONF ("nl-cache-limit", conf->cache_limit, options,
+                          size_uint64, out);
+        GF_OPTION_RECONF ("cache-invalidation", conf->cache_invalidation,
+                          options, bool, out);
+
+        if (!conf->cache_invalidation)
+                nlc_clear_all (this);
+out:
+        return 0;
+}
+
+
+int32_t
+mem_acct_init (xlator_t *this)
+{
+        int     ret = -1;
+
+        ret = xlator_mem_acct_init (this, gf_nlc_mt_end + 1);
+        return ret;
+}
+
+
+int
+init (xlator_t *this)
+{
+        nlc_conf_t *conf = NULL;
+        int         ret  = -1;
+
+        if (!this->children || this->children->next) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "FATAL: nl-cache not configured with exactly one "
+                        "child");
+                return -1;
+        }
+
+        conf = GF_CALLOC (1, sizeof (*conf), gf_nlc_mt_nlc_conf_t);
+        if (!conf) {
+                gf_log (this->name, GF_LOG_ERROR, "out of memory");
+                return -1;
+        }
+
+        INIT_LIST_HEAD (&conf->lru);
+        LOCK_INIT (&conf->lock);
+
+        GF_OPTION_INIT ("nl-cache-timeout", conf->cache_timeout, int32, out);
+        GF_OPTION_INIT ("nl-cache-limit", conf->cache_limit, size_uint64, out);
+        GF_OPTION_INIT ("cache-invalidation", conf->cache_invalidation, bool,
+                        out);
+
+        if (!conf->cache_invalidation)
+                gf_log (this->name, GF_LOG_WARNING, "cache-invalidation is "
+                        "off, negative entries are not cached");
+
+        this->private = conf;
+        ret = 0;
+out:
+        if (ret) {
+                LOCK_DESTROY (&conf->lock);
+                GF_FREE (conf);
+        }
+
+        return ret;
+}
+
+
+void
+fini (xlator_t *this)
+{
+        nlc_conf_t *conf = NULL;
+
+        conf = this->private;
+        if (!conf)
+                return;
+
+        this->private = NULL;
+
+        LOCK_DESTROY (&conf->lock);
+        GF_FREE (conf);
+}
+
+
+struct xlator_fops fops = {
+        .lookup      = nlc_lookup,
+        .mknod       = nlc_mknod,
+        .mkdir       = nlc_mkdir,
+        .symlink     = nlc_symlink,
+        .create      = nlc_create,
+        .link        = nlc_link,
+        .rename      = nlc_rename,
+        .unlink      = nlc_unlink,
+        .rmdir       = nlc_rmdir,
+};
+
+
+struct xlator_cbks cbks = {
+        .forget      = nlc_forget,
+};
+
+
+struct xlator_dumpops dumpops = {
+        .priv        = nlc_priv_dump,
+        .inodectx    = nlc_inode_ctx_dump,
+};
+
+
+struct volume_options options[] = {
+        { .key = {"nl-cache-timeout"},
+          .type = GF_OPTION_TYPE_INT,
+          .min = 0,
+          .max = 600,
+          .default_value = "60",
+          .description = "Time period after which a negative entry is "
+                         "dropped. 0 disables the cache.",
+        },
+        { .key = {"nl-cache-limit"},
+          .type = GF_OPTION_TYPE_SIZET,
+          .min = 0,
+          .max = 1 * GF_UNIT_GB,
+          .default_value = "1MB",
+          .description = "Maximum amount of memory held by negative "
+                         "entries. Directories are evicted least recently "
+                         "used first once it is exceeded.",
+        },
+        { .key = {"cache-invalidation"},
+          .type = GF_OPTION_TYPE_BOOL,
+          .default_value = "off",
+          .description = "Set when the bricks send cache invalidation "
+                         "upcalls (features.cache-invalidation). Without "
+                         "them nothing is cached.",
+        },
+        { .key = {NULL} },
+};
@@ -0,0 +1,99 @@
+/*
+  Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+  This file is part of GlusterFS.
+
+  This file is licensed to you under your choice of the GNU Lesser
+  General Public License, version 3 or any later version (LGPLv3 or
+  later), or the GNU General Public License, version 2 (GPLv2), in all
+  cases as published by the Free Software Foundation.
+*/
+
+#ifndef __NL_CACHE_H__
+#define __NL_CACHE_H__
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "glusterfs.h"
+#include "xlator.h"
+#include "locking.h"
+#include "list.h"
+#include "nl-cache-mem-types.h"
+
+/* Buckets of the negative entry hash of a directory. It starts small
+ * and doubles whenever it holds twice as many entries as buckets. */
+#define NLC_HASH_MIN      16
+#define NLC_HASH_MAX      (64 * 1024)
+
+/* Invalidation generations of the directories without a ctx, see
+ * nlc_local_init (). */
+#define NLC_GEN_SLOTS     64
+#define NLC_GEN_SLOT(inode) ((inode)->gfid[15] & (NLC_GEN_SLOTS - 1))
+
+/* A name known not to exist in its parent directory. */
+struct nlc_ne {
+        struct list_head  hash;         /* on a bucket of ctx->ne_hash */
+        uint32_t          hashval;
+        time_t            cache_time;
+        size_t            size;
+        char              name[];
+};
+
+/* Negative entries of a directory, kept in its inode ctx. Only
+ * directories which had entries cached get one. */
+struct nlc_ctx {
+        struct list_head *ne_hash;
+        uint32_t          hash_size;    /* a power of two */
+        struct list_head  lru;          /* on conf->lru once it had entries */
+        uint64_t          gen;          /* bumped on every invalidation */
+        uint64_t          cache_size;
+        int               ne_count;
+        gf_lock_t         lock;
+};
+
+struct nlc_conf {
+        int32_t           cache_timeout;
+        gf_boolean_t      cache_invalidation; /* upcalls reach the client,
+                                                 negative entries are only
+                                                 cached when they do */
+        uint64_t          cache_limit;
+        uint64_t          current_cache_size;
+        struct list_head  lru;          /* directories, least recently
+                                           added to first */
+        inode_table_t    *itable;
+        gf_lock_t         lock;
+        uint64_t          gen[NLC_GEN_SLOTS]; /* bumped on invalidations of
+                                                 directories without ctx */
+        uint64_t          nlc_hit;
+        uint64_t          nlc_miss;
+        uint64_t          nlc_invals;
+};
+typedef struct nlc_conf nlc_conf_t;
+
+struct nlc_local {
+        loc_t             loc;
+        loc_t             loc2;
+        uint64_t          gen;
+        gf_boolean_t      had_ctx;      /* gen is the one of the ctx of
+                                           loc.parent, not of its slot in
+                                           conf->gen */
+};
+typedef struct nlc_local nlc_local_t;
+
+#define NLC_STACK_UNWIND(fop, frame, params ...) do {           \
+                nlc_local_t *__local = NULL;                    \
+                xlator_t    *__xl    = NULL;                    \
+                if (frame) {                                    \
+                        __xl         = frame->this;             \
+                        __local      = frame->local;            \
+                        frame->local = NULL;                    \
+                }                                               \
+                STACK_UNWIND_STRICT (fop, frame, params);       \
+                nlc_local_wipe (__xl, __local);                 \
+        } while (0)
+
+void nlc_local_wipe (xlator_t *this, nlc_local_t *local);
+
+#endif /* __NL_CACHE_H__ */
@@ -749,6 +749,25 @@ err:
         return 0;
 }
 
+int
+ob_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+         gf_seek_what_t what, dict_t *xdata)
+{
+        call_stub_t *stub;
+
+        stub = fop_seek_stub (frame, default_seek_resume, fd, offset, what,
+                              xdata);
+        if (!stub)
+                goto err;
+
+        open_and_resume (this, fd, stub);
+
+        return 0;
+err:
+        STACK_UNWIND_STRICT (seek, frame, -1, ENOMEM, 0, NULL);
+        return 0;
+}
+
 
 int
 ob_unlink (call_frame_t *frame, xlator_t *this, loc_t *loc, int xflags,
@@ -980,6 +999,7 @@ struct xlator_fops fops = {
 	.fallocate   = ob_fallocate,
 	.discard     = ob_discard,
         .zerofill    = ob_zerofill,
+        .seek        = ob_seek,
 	.unlink      = ob_unlink,
 	.rename      = ob_rename,
 	.lk          = ob_lk,
@@ -130,6 +130,55 @@ ra_waitq_return (ra_waitq_t *waitq)
 }
 
 
+static ra_waitq_t *
+ra_waitq_splice (ra_waitq_t *waitq, ra_waitq_t *more)
+{
+        ra_waitq_t *tail = NULL;
+
+        if (!more)
+                return waitq;
+
+        for (tail = more; tail->next; tail = tail->next)
+                ;
+        tail->next = waitq;
+
+        return more;
+}
+
+
+/*
+ * ra_page_fill_range - fill a page with its part of a read which covered
+ *                      several pages. The part past the end of the read is
+ *                      left empty, as a read past EOF would.
+ */
+static int
+ra_page_fill_range (ra_page_t *page, struct iovec *vector, int32_t count,
+                    struct iobref *iobref, off_t start)
+{
+        size_t  length = 0;
+        off_t   end    = 0;
+        int32_t slices = 0;
+
+        length = iov_length (vector, count);
+        start = min (start, (off_t)length);
+        end = min (start + (off_t)page->file->page_size, (off_t)length);
+
+        slices = iov_subset (vector, count, start, end, NULL);
+
+        page->vector = GF_CALLOC (max (slices, 1), sizeof (struct iovec),
+                                  gf_ra_mt_iovec);
+        if (page->vector == NULL)
+                return -1;
+
+        page->count = iov_subset (vector, count, start, end, page->vector);
+        page->iobref = iobref_ref (iobref);
+        page->size = end - start;
+        page->ready = 1;
+
+        return 0;
+}
+
+
 int
 ra_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
               int32_t op_ret, int32_t op_errno, struct iovec *vector,
@@ -138,11 +187,15 @@ ra_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 {
         ra_local_t   *local          = NULL;
         off_t         pending_offset = 0;
+        size_t        pending_size   = 0;
+        off_t         page_offset    = 0;
         ra_file_t    *file           = NULL;
         ra_page_t    *page           = NULL;
         ra_waitq_t   *waitq          = NULL;
         fd_t         *fd             = NULL;
         uint64_t      tmp_file       = 0;
+        int32_t       page_ret       = 0;
+        int32_t       page_errno     = 0;
 
         GF_ASSERT (frame);
 
@@ -153,6 +206,7 @@ ra_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 
         file = (ra_file_t *)(long)tmp_file;
         pending_offset = local->pending_offset;
+        pending_size = local->pending_size;
 
         if (file == NULL) {
                 gf_log (this->name, GF_LOG_WARNING,
@@ -167,58 +221,68 @@ ra_fault_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
                 if (op_ret >= 0)
                         file->stbuf = *stbuf;
 
-                page = ra_page_get (file, pending_offset);
+                for (page_offset = pending_offset;
+                     page_offset < pending_offset + pending_size;
+                     page_offset += file->page_size) {
+                        page = ra_page_get (file, page_offset);
+
+                        if (!page) {
+                                gf_log (this->name, GF_LOG_TRACE,
+                                        "wasted copy: %"PRId64"[+%"PRId64"] "
+                                        "file=%p", page_offset,
+                                        file->page_size, file);
+                                continue;
+                        }
 
-                if (!page) {
-                        gf_log (this->name, GF_LOG_TRACE,
-                                "wasted copy: %"PRId64"[+%"PRId64"] file=%p",
-                                pending_offset, file->page_size, file);
-                        goto unlock;
-                }
+                        page_ret = op_ret;
+                        page_errno = op_errno;
+
+                        /*
+                         * "Dirty" means that the request was a pure
+                         * read-ahead; it's set for requests we issue
+                         * ourselves, and cleared when user requests are
+                         * issued or put on the waitq.  "Poisoned" means that
+                         * we got a write while a read was still in flight,
+                         * and we couldn't stop it so we marked it instead.
+                         * If it's both dirty and poisoned by the time we get
+                         * here, we cancel its effect so that a subsequent
+                         * user read doesn't get data that we know is stale
+                         * (because we made it stale ourselves).  We can't use
+                         * ESTALE because that has special significance.
+                         * ECANCELED has no such special meaning, and is close
+                         * to what we're trying to indicate.
+                         */
+                        if (page->dirty && page->poisoned) {
+                                page_ret = -1;
+                                page_errno = ECANCELED;
+                        }
 
-                /*
-                 * "Dirty" means that the request was a pure read-ahead; it's
-                 * set for requests we issue ourselves, and cleared when user
-                 * requests are issued or put on the waitq.  "Poisoned" means
-                 * that we got a write while a read was still in flight, and we
-                 * couldn't stop it so we marked it instead.  If it's both
-                 * dirty and poisoned by the time we get here, we cancel its
-                 * effect so that a subsequent user read doesn't get data that
-                 * we know is stale (because we made it stale ourselves).  We
-                 * can't use ESTALE because that has special significance.
-                 * ECANCELED has no such special meaning, and is close to what
-                 * we're trying to indicate.
-                 */
-                if (page->dirty && page->poisoned) {
-                        op_ret = -1;
-                        op_errno = ECANCELED;
-                }
+                        if (page_ret < 0) {
+                                waitq = ra_waitq_splice (waitq,
+                                                         ra_page_error (page,
+                                                                        page_ret,
+                                                                        page_errno));
+                                continue;
+                        }
 
-                if (op_ret < 0) {
-                        waitq = ra_page_error (page, op_ret, op_errno);
-                        goto unlock;
-                }
+                        if (page->vector) {
+                                iobref_unref (page->iobref);
+                                GF_FREE (page->vector);
+                                page->vector = NULL;
+                        }
 
-                if (page->vector) {
-                        iobref_unref (page->iobref);
-                        GF_FREE (page->vector);
-                }
+                        if (ra_page_fill_range (page, vector, count, iobref,
+                                                page_offset - pending_offset)) {
+                                waitq = ra_waitq_splice (waitq,
+                                                         ra_page_error (page,
+                                                                        -1,
+                                                                        ENOMEM));
+                                continue;
+                        }
 
-                page->vector = iov_dup (vector, count);
-                if (page->vector == NULL) {
-                        waitq = ra_page_error (page, -1, ENOMEM);
-                        goto unlock;
+                        waitq = ra_waitq_splice (waitq, ra_page_wakeup (page));
                 }
-
-                page->count = count;
-                page->iobref = iobref_ref (iobref);
-                page->ready = 1;
-
-                page->size = iov_length (vector, count);
-
-                waitq = ra_page_wakeup (page);
         }
-unlock:
         ra_file_unlock (file);
 
         ra_waitq_return (waitq);
@@ -234,14 +298,20 @@ out:
 }
 
 
+/*
+ * ra_page_fault - read @count pages starting at @offset, in one read from
+ *                 the child.
+ */
 void
-ra_page_fault (ra_file_t *file, call_frame_t *frame, off_t offset)
+ra_page_fault (ra_file_t *file, call_frame_t *frame, off_t offset,
+               uint32_t count)
 {
         call_frame_t *fault_frame = NULL;
         ra_local_t   *fault_local = NULL;
         ra_page_t    *page        = NULL;
         ra_waitq_t   *waitq       = NULL;
         int32_t       op_ret      = -1, op_errno = -1;
+        uint32_t      i           = 0;
 
         GF_VALIDATE_OR_GOTO ("read-ahead", frame, out);
         GF_VALIDATE_OR_GOTO (frame->this->name, file, out);
@@ -263,24 +333,29 @@ ra_page_fault (ra_file_t *file, call_frame_t *frame, off_t offset)
 
         fault_frame->local = fault_local;
         fault_local->pending_offset = offset;
-        fault_local->pending_size = file->page_size;
+        fault_local->pending_size = file->page_size * count;
 
         fault_local->fd = fd_ref (file->fd);
 
         STACK_WIND (fault_frame, ra_fault_cbk,
                     FIRST_CHILD (fault_frame->this),
                     FIRST_CHILD (fault_frame->this)->fops->readv,
-                    file->fd, file->page_size, offset, 0, NULL);
+                    file->fd, fault_local->pending_size, offset, 0, NULL);
 
         return;
 
 err:
         ra_file_lock (file);
         {
-                page = ra_page_get (file, offset);
-                if (page)
-                        waitq = ra_page_error (page, op_ret,
-                                               op_errno);
+                for (i = 0; i < count; i++) {
+                        page = ra_page_get (file,
+                                            offset + i * file->page_size);
+                        if (page)
+                                waitq = ra_waitq_splice (waitq,
+                                                         ra_page_error (page,
+                                                                        op_ret,
+                                                                        op_errno));
+                }
         }
         ra_file_unlock (file);
 
@@ -30,7 +30,7 @@
 #include <sys/time.h>
 
 static void
-read_ahead (call_frame_t *frame, ra_file_t *file);
+read_ahead (call_frame_t *frame, ra_file_t *file, ra_stream_t *stream);
 
 
 int
@@ -62,7 +62,6 @@ ra_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         if ((fd->flags & O_DIRECT) || ((fd->flags & O_ACCMODE) == O_WRONLY))
                 file->disabled = 1;
 
-        file->offset = (unsigned long long) 0;
         file->conf = conf;
         file->pages.next = &file->pages;
         file->pages.prev = &file->pages;
@@ -79,14 +78,9 @@ ra_open_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         ra_conf_unlock (conf);
 
         file->fd = fd;
-        file->page_count = conf->page_count;
         file->page_size = conf->page_size;
         pthread_mutex_init (&file->file_lock, NULL);
 
-        if (!file->disabled) {
-                file->page_count = 1;
-        }
-
         ret = fd_ctx_set (fd, this, (uint64_t)(long)file);
         if (ret == -1) {
                 gf_log (frame->this->name, GF_LOG_WARNING,
@@ -137,7 +131,6 @@ ra_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         if ((fd->flags & O_DIRECT) || ((fd->flags & O_ACCMODE) == O_WRONLY))
                 file->disabled = 1;
 
-        file->offset = (unsigned long long) 0;
         //file->size = fd->inode->buf.ia_size;
         file->conf = conf;
         file->pages.next = &file->pages;
@@ -155,7 +148,6 @@ ra_create_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
         ra_conf_unlock (conf);
 
         file->fd = fd;
-        file->page_count = conf->page_count;
         file->page_size = conf->page_size;
         pthread_mutex_init (&file->file_lock, NULL);
 
@@ -245,6 +237,130 @@ flush_region (call_frame_t *frame, ra_file_t *file, off_t offset, off_t size,
 }
 
 
+/* free the cache pages which are not in reach of any stream,
+   does not touch pages with frames waiting on it
+*/
+
+static void
+flush_unused (ra_file_t *file)
+{
+        ra_page_t   *trav   = NULL;
+        ra_page_t   *next   = NULL;
+        ra_stream_t *stream = NULL;
+        off_t        start  = 0;
+        off_t        end    = 0;
+        int          used   = 0;
+        int          i      = 0;
+
+        ra_file_lock (file);
+        {
+                trav = file->pages.next;
+                while (trav != &file->pages) {
+                        next = trav->next;
+
+                        used = 0;
+                        for (i = 0; i < RA_MAX_STREAMS && !used; i++) {
+                                stream = &file->streams[i];
+                                if (!stream->last_used)
+                                        continue;
+
+                                /* read_ahead() may fault up to two windows
+                                   ahead of the stream */
+                                start = floor (stream->offset,
+                                               file->page_size);
+                                end = start + 2 * file->page_size
+                                        * (stream->window + 1);
+                                used = (trav->offset >= start
+                                        && trav->offset < end);
+                        }
+
+                        if (!used) {
+                                if (!trav->waitq)
+                                        ra_page_purge (trav);
+                                else
+                                        trav->stale = 1;
+                        }
+
+                        trav = next;
+                }
+        }
+        ra_file_unlock (file);
+}
+
+
+/*
+ * ra_stream_get - find the stream a read at @offset continues, or take over
+ *                 the least useful one for a new stream.
+ *
+ * The read may start a little behind where the stream expects it, or
+ * inside its read-ahead, when its reader has several reads in flight.
+ *
+ * called with file lock held
+ */
+static ra_stream_t *
+ra_stream_get (ra_file_t *file, off_t offset, size_t size)
+{
+        ra_stream_t *stream = NULL;
+        ra_stream_t *victim = NULL;
+        int          i      = 0;
+
+        file->reads++;
+
+        for (i = 0; i < RA_MAX_STREAMS; i++) {
+                stream = &file->streams[i];
+                if (!stream->last_used)
+                        continue;
+
+                if ((offset + (off_t)file->page_size > stream->offset)
+                    && (offset <= stream->offset + (off_t)(file->page_size
+                                                           * stream->page_count)))
+                        break;
+        }
+
+        if (i < RA_MAX_STREAMS) {
+                gf_log (THIS->name, GF_LOG_TRACE,
+                        "expected offset (%"PRId64") when page_count=%d",
+                        offset, stream->page_count);
+
+                if (stream->expected < (file->page_size * stream->window)) {
+                        stream->expected += size;
+                        stream->page_count = min ((stream->expected
+                                                   / file->page_size),
+                                                  stream->window);
+                }
+                goto out;
+        }
+
+        /* Slots which never turned sequential (random reads) go before
+         * the sequential streams, the least recently used first. */
+        for (i = 0; i < RA_MAX_STREAMS; i++) {
+                stream = &file->streams[i];
+                if (!victim || !stream->last_used
+                    || (!stream->expected && victim->expected)
+                    || ((!stream->expected == !victim->expected)
+                        && (stream->last_used < victim->last_used)))
+                        victim = stream;
+
+                if (!victim->last_used)
+                        break;
+        }
+
+        gf_log (THIS->name, GF_LOG_TRACE,
+                "unexpected offset (%"PRId64"), new stream replacing "
+                "the one at %"PRId64, offset, victim->offset);
+
+        stream = victim;
+        memset (stream, 0, sizeof (*stream));
+        stream->window = file->conf->page_count;
+
+out:
+        stream->offset = max (stream->offset, (off_t)(offset + size));
+        stream->last_used = file->reads;
+
+        return stream;
+}
+
+
 int
 ra_release (xlator_t *this, fd_t *fd)
 {
@@ -266,27 +382,30 @@ out:
 
 
 void
-read_ahead (call_frame_t *frame, ra_file_t *file)
+read_ahead (call_frame_t *frame, ra_file_t *file, ra_stream_t *stream)
 {
-        off_t      ra_offset   = 0;
-        size_t     ra_size     = 0;
-        off_t      trav_offset = 0;
-        ra_page_t *trav        = NULL;
-        off_t      cap         = 0;
-        char       fault       = 0;
+        off_t      ra_offset    = 0;
+        size_t     ra_size      = 0;
+        off_t      trav_offset  = 0;
+        ra_page_t *trav         = NULL;
+        off_t      cap          = 0;
+        char       fault        = 0;
+        off_t      fault_offset = 0;
+        uint32_t   fault_count  = 0;
+        uint32_t   max_count    = 0;
 
         GF_VALIDATE_OR_GOTO ("read-ahead", frame, out);
         GF_VALIDATE_OR_GOTO (frame->this->name, file, out);
 
-        if (!file->page_count) {
+        if (!stream->page_count) {
                 goto out;
         }
 
-        ra_size   = file->page_size * file->page_count;
-        ra_offset = floor (file->offset, file->page_size);
-        cap       = file->size ? file->size : file->offset + ra_size;
+        ra_size   = file->page_size * stream->page_count;
+        ra_offset = floor (stream->offset, file->page_size);
+        cap       = file->size ? file->size : stream->offset + ra_size;
 
-        while (ra_offset < min (file->offset + ra_size, cap)) {
+        while (ra_offset < min (stream->offset + ra_size, cap)) {
 
                 ra_file_lock (file);
                 {
@@ -306,6 +425,7 @@ read_ahead (call_frame_t *frame, ra_file_t *file)
         }
 
         trav_offset = ra_offset;
+        max_count = max (RA_MAX_READ_SIZE / file->page_size, 1);
 
         cap  = file->size ? file->size : ra_offset + ra_size;
 
@@ -328,14 +448,27 @@ read_ahead (call_frame_t *frame, ra_file_t *file)
                         break;
                 }
 
+                /* neighbouring pages go in one read, the reads are
+                   not waited for and run in parallel */
+                if (fault_count && (!fault || fault_count == max_count)) {
+                        ra_page_fault (file, frame, fault_offset,
+                                       fault_count);
+                        fault_count = 0;
+                }
+
                 if (fault) {
                         gf_log (frame->this->name, GF_LOG_TRACE,
                                 "RA at offset=%"PRId64, trav_offset);
-                        ra_page_fault (file, frame, trav_offset);
+                        if (!fault_count)
+                                fault_offset = trav_offset;
+                        fault_count++;
                 }
                 trav_offset += file->page_size;
         }
 
+        if (fault_count)
+                ra_page_fault (file, frame, fault_offset, fault_count);
+
 out:
         return;
 }
@@ -353,8 +486,48 @@ ra_need_atime_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
 }
 
 
+/*
+ * ra_stream_adapt - size the window of a stream by how its reads found the
+ *                   pages it read ahead. Waiting on one means the read-ahead
+ *                   does not cover the latency of the reads: the window
+ *                   doubles. A whole window of pages found ready means it may
+ *                   be more than needed: it shrinks by one page.
+ *
+ * called with file lock held
+ */
 static void
-dispatch_requests (call_frame_t *frame, ra_file_t *file)
+ra_stream_adapt (ra_file_t *file, ra_stream_t *stream, int stalled)
+{
+        ra_conf_t *conf = NULL;
+
+        conf = file->conf;
+
+        if (stalled) {
+                stream->stalls++;
+                stream->streak = 0;
+
+                if (stream->page_count >= stream->window)
+                        stream->window = min (stream->window * 2,
+                                              max (conf->max_page_count,
+                                                   conf->page_count));
+                return;
+        }
+
+        stream->hits++;
+
+        if (++stream->streak < stream->window || stream->window <= 1)
+                return;
+
+        stream->streak = 0;
+        stream->window--;
+        stream->page_count = min (stream->page_count, stream->window);
+        stream->expected = min (stream->expected,
+                                file->page_size * stream->window);
+}
+
+
+static void
+dispatch_requests (call_frame_t *frame, ra_file_t *file, ra_stream_t *stream)
 {
         ra_local_t   *local             = NULL;
         ra_conf_t    *conf              = NULL;
@@ -365,6 +538,10 @@ dispatch_requests (call_frame_t *frame, ra_file_t *file)
         call_frame_t *ra_frame          = NULL;
         char          need_atime_update = 1;
         char          fault             = 0;
+        char          was_ahead         = 0;
+        off_t         fault_offset      = 0;
+        uint32_t      fault_count       = 0;
+        uint32_t      max_count         = 0;
 
         GF_VALIDATE_OR_GOTO ("read-ahead", frame, out);
         GF_VALIDATE_OR_GOTO (frame->this->name, file, out);
@@ -374,6 +551,7 @@ dispatch_requests (call_frame_t *frame, ra_file_t *file)
 
         rounded_offset = floor (local->offset, file->page_size);
         rounded_end    = roof (local->offset + local->size, file->page_size);
+        max_count      = max (RA_MAX_READ_SIZE / file->page_size, 1);
 
         trav_offset = rounded_offset;
 
@@ -393,6 +571,7 @@ dispatch_requests (call_frame_t *frame, ra_file_t *file)
                                 fault = 1;
                                 need_atime_update = 0;
                         }
+                        was_ahead = trav->dirty;
                         trav->dirty = 0;
 
                         if (trav->ready) {
@@ -407,24 +586,42 @@ dispatch_requests (call_frame_t *frame, ra_file_t *file)
                                 ra_wait_on_page (trav, frame);
                                 need_atime_update = 0;
                         }
+
+                        if (was_ahead)
+                                ra_stream_adapt (file, stream, !trav->ready);
                 }
         unlock:
                 ra_file_unlock (file);
 
+                if (fault_count && (!fault || fault_count == max_count)) {
+                        ra_page_fault (file, frame, fault_offset,
+                                       fault_count);
+                        fault_count = 0;
+                }
+
                 if (local->op_ret == -1) {
-                        goto out;
+                        break;
                 }
 
                 if (fault) {
                         gf_log (frame->this->name, GF_LOG_TRACE,
                                 "MISS at offset=%"PRId64".",
                                 trav_offset);
-                        ra_page_fault (file, frame, trav_offset);
+                        if (!fault_count)
+                                fault_offset = trav_offset;
+                        fault_count++;
                 }
 
                 trav_offset += file->page_size;
         }
 
+        if (fault_count)
+                ra_page_fault (file, frame, fault_offset, fault_count);
+
+        if (local->op_ret == -1) {
+                goto out;
+        }
+
         if (need_atime_update && conf->force_atime_update) {
                 /* TODO: use untimens() since readv() can confuse underlying
                    io-cache and others */
@@ -465,17 +662,14 @@ ra_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
 {
         ra_file_t   *file            = NULL;
         ra_local_t  *local           = NULL;
-        ra_conf_t   *conf            = NULL;
         int          op_errno        = EINVAL;
-        char         expected_offset = 1;
         uint64_t     tmp_file        = 0;
+        ra_stream_t *stream          = NULL;
 
         GF_ASSERT (frame);
         GF_VALIDATE_OR_GOTO (frame->this->name, this, unwind);
         GF_VALIDATE_OR_GOTO (frame->this->name, fd, unwind);
 
-        conf = this->private;
-
         gf_log (this->name, GF_LOG_TRACE,
                 "NEW REQ at offset=%"PRId64" for size=%"GF_PRI_SIZET"",
                 offset, size);
@@ -487,28 +681,11 @@ ra_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
                 goto disabled;
         }
 
-        if (file->offset != offset) {
-                gf_log (this->name, GF_LOG_TRACE,
-                        "unexpected offset (%"PRId64" != %"PRId64") resetting",
-                        file->offset, offset);
-
-                expected_offset = file->expected = file->page_count = 0;
-        } else {
-                gf_log (this->name, GF_LOG_TRACE,
-                        "expected offset (%"PRId64") when page_count=%d",
-                        offset, file->page_count);
-
-                if (file->expected < (file->page_size * conf->page_count)) {
-                        file->expected += size;
-                        file->page_count = min ((file->expected
-                                                 / file->page_size),
-                                                conf->page_count);
-                }
-        }
-
-        if (!expected_offset) {
-                flush_region (frame, file, 0, file->pages.prev->offset + 1, 0);
+        ra_file_lock (file);
+        {
+                stream = ra_stream_get (file, offset, size);
         }
+        ra_file_unlock (file);
 
         local = mem_get0 (this->local_pool);
         if (!local) {
@@ -528,16 +705,14 @@ ra_readv (call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
 
         frame->local = local;
 
-        dispatch_requests (frame, file);
+        dispatch_requests (frame, file, stream);
 
-        flush_region (frame, file, 0, floor (offset, file->page_size), 0);
+        flush_unused (file);
 
-        read_ahead (frame, file);
+        read_ahead (frame, file, stream);
 
         ra_frame_return (frame);
 
-        file->offset = offset + size;
-
         return 0;
 
 unwind:
@@ -665,6 +840,7 @@ ra_writev (call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
         ra_file_t *file    = NULL;
         uint64_t  tmp_file = 0;
         int32_t   op_errno = EINVAL;
+        int       i        = 0;
 
         GF_ASSERT (frame);
         GF_VALIDATE_OR_GOTO (frame->this->name, this, unwind);
@@ -676,7 +852,14 @@ ra_writev (call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
                 flush_region (frame, file, 0, file->pages.prev->offset+1, 1);
                 frame->local = file;
                 /* reset the read-ahead counters too */
-                file->expected = file->page_count = 0;
+                ra_file_lock (file);
+                {
+                        for (i = 0; i < RA_MAX_STREAMS; i++) {
+                                file->streams[i].expected = 0;
+                                file->streams[i].page_count = 0;
+                        }
+                }
+                ra_file_unlock (file);
         }
 
         STACK_WIND (frame, ra_writev_cbk,
@@ -803,7 +986,8 @@ ra_fdctx_dump (xlator_t *this, fd_t *fd)
 {
 	ra_file_t    *file     = NULL;
         ra_page_t    *page     = NULL;
-        int32_t       ret      = 0, i = 0;
+        ra_stream_t  *stream   = NULL;
+        int32_t       ret      = 0, i = 0, j = 0;
         uint64_t      tmp_file = 0;
         char         *path     = NULL;
         char          key[GF_DUMP_MAX_BUF_LEN]        = {0, };
@@ -840,10 +1024,22 @@ ra_fdctx_dump (xlator_t *this, fd_t *fd)
 
         gf_proc_dump_write ("page-size", "%"PRId64, file->page_size);
 
-        gf_proc_dump_write ("page-count", "%u", file->page_count);
-
-        gf_proc_dump_write ("next-expected-offset-for-sequential-reads",
-                            "%"PRId64, file->offset);
+        for (j = 0; j < RA_MAX_STREAMS; j++) {
+                stream = &file->streams[j];
+                if (!stream->last_used)
+                        continue;
+
+                sprintf (key, "stream[%d].next-expected-offset", j);
+                gf_proc_dump_write (key, "%"PRId64, stream->offset);
+                sprintf (key, "stream[%d].page-count", j);
+                gf_proc_dump_write (key, "%u", stream->page_count);
+                sprintf (key, "stream[%d].window", j);
+                gf_proc_dump_write (key, "%u", stream->window);
+                sprintf (key, "stream[%d].hits", j);
+                gf_proc_dump_write (key, "%"PRIu64, stream->hits);
+                sprintf (key, "stream[%d].stalls", j);
+                gf_proc_dump_write (key, "%"PRIu64, stream->stalls);
+        }
 
         for (page = file->pages.next; page != &file->pages;
              page = page->next) {
@@ -1073,6 +1269,8 @@ ra_priv_dump (xlator_t *this)
         {
                 gf_proc_dump_write ("page_size", "%d", conf->page_size);
                 gf_proc_dump_write ("page_count", "%d", conf->page_count);
+                gf_proc_dump_write ("max_page_count", "%d",
+                                    conf->max_page_count);
                 gf_proc_dump_write ("force_atime_update", "%d",
                                     conf->force_atime_update);
         }
@@ -1124,6 +1322,9 @@ reconfigure (xlator_t *this, dict_t *options)
 
         GF_OPTION_RECONF ("page-count", conf->page_count, options, uint32, out);
 
+        GF_OPTION_RECONF ("max-page-count", conf->max_page_count, options,
+                          uint32, out);
+
         GF_OPTION_RECONF ("page-size", conf->page_size, options, size_uint64,
                           out);
 
@@ -1163,6 +1364,8 @@ init (xlator_t *this)
 
         GF_OPTION_INIT ("page-count", conf->page_count, uint32, out);
 
+        GF_OPTION_INIT ("max-page-count", conf->max_page_count, uint32, out);
+
         GF_OPTION_INIT ("force-atime-update", conf->force_atime_update, bool, out);
 
         conf->files.next = &conf->files;
@@ -1257,6 +1460,15 @@ struct volume_options options[] = {
           .default_value = "4",
           .description = "Number of pages that will be pre-fetched"
         },
+        { .key  = {"max-page-count"},
+          .type = GF_OPTION_TYPE_INT,
+          .min  = 1,
+          .max  = 256,
+          .default_value = "16",
+          .description = "Number of pages a sequential reader's pre-fetch "
+                         "may grow to, when its reads keep waiting for the "
+                         "pre-fetched pages"
+        },
 	{ .key = {"page-size"},
 	  .type = GF_OPTION_TYPE_SIZET,
 	  .min = 4096,
@@ -24,6 +24,10 @@
 #include "common-utils.h"
 #include "read-ahead-mem-types.h"
 
+#define RA_MAX_STREAMS   4
+/* faults of neighbouring pages are sent as one read of up to this size */
+#define RA_MAX_READ_SIZE (1 * GF_UNIT_MB)
+
 struct ra_conf;
 struct ra_local;
 struct ra_page;
@@ -80,27 +84,43 @@ struct ra_page {
 };
 
 
+/*
+ * ra_stream - a sequential reader of an fd. Several of them can read one fd
+ *             at different offsets, each with its own read-ahead.
+ */
+struct ra_stream {
+        off_t              offset;     /* next offset expected */
+        size_t             expected;
+        uint32_t           page_count; /* pages read ahead of offset */
+        uint32_t           window;     /* how far page_count may grow */
+        uint32_t           streak;     /* pages found ready in a row */
+        uint64_t           last_used;
+        uint64_t           hits;
+        uint64_t           stalls;
+};
+
+
 struct ra_file {
         struct ra_file    *next;
         struct ra_file    *prev;
         struct ra_conf    *conf;
         fd_t              *fd;
         int                disabled;
-        size_t             expected;
         struct ra_page     pages;
-        off_t              offset;
         size_t             size;
         int32_t            refcount;
         pthread_mutex_t    file_lock;
         struct iatt        stbuf;
         uint64_t           page_size;
-        uint32_t           page_count;
+        struct ra_stream   streams[RA_MAX_STREAMS];
+        uint64_t           reads;
 };
 
 
 struct ra_conf {
         uint64_t          page_size;
         uint32_t          page_count;
+        uint32_t          max_page_count;
         void             *cache_block;
         struct ra_file    files;
         gf_boolean_t      force_atime_update;
@@ -114,6 +134,7 @@ typedef struct ra_page ra_page_t;
 typedef struct ra_file ra_file_t;
 typedef struct ra_waitq ra_waitq_t;
 typedef struct ra_fill ra_fill_t;
+typedef struct ra_stream ra_stream_t;
 
 ra_page_t *
 ra_page_get (ra_file_t *file,
@@ -126,7 +147,8 @@ ra_page_create (ra_file_t *file,
 void
 ra_page_fault (ra_file_t *file,
                call_frame_t *frame,
-               off_t offset);
+               off_t offset,
+               uint32_t count);
 void
 ra_wait_on_page (ra_page_t *page,
                  call_frame_t *frame);
@@ -204,6 +204,16 @@ rda_readdirp(call_frame_t *frame, xlator_t *this, fd_t *fd, size_t size,
 		fill = 1;
 	}
 
+	/*
+	 * No preload was started by opendir, e.g. it failed on this subvolume
+	 * of a parallel readdir. Start one now rather than waiting on it.
+	 */
+	if (!off && (ctx->state & RDA_FD_NEW)) {
+		if (!ctx->xattrs && xdata)
+			ctx->xattrs = dict_ref(xdata);
+		fill = 1;
+	}
+
 	/*
 	 * If a readdir occurs at an unexpected offset or we already have a
 	 * request pending, admit defeat and just get out of the way.
@@ -384,7 +394,7 @@ rda_fill_fd(call_frame_t *frame, xlator_t *this, fd_t *fd)
 
 	STACK_WIND(nframe, rda_fill_fd_cbk, FIRST_CHILD(this),
 		   FIRST_CHILD(this)->fops->readdirp, fd, priv->rda_req_size,
-		   offset, NULL);
+		   offset, ctx->xattrs);
 
 	return 0;
 
@@ -395,12 +405,28 @@ err:
 	return -1;
 }
 
+/*
+ * The xattrs requested by opendir are requested by the preload as well. When
+ * readdir-ahead sits below DHT (parallel readdir), this is how the linkto
+ * xattr DHT filters entries on gets loaded.
+ */
 static int32_t
 rda_opendir_cbk(call_frame_t *frame, void *cookie, xlator_t *this,
 		    int32_t op_ret, int32_t op_errno, fd_t *fd, dict_t *xdata)
 {
-	if (!op_ret)
+	dict_t *xattrs = cookie;
+	struct rda_fd_ctx *ctx;
+
+	if (!op_ret) {
+		ctx = get_rda_fd_ctx(fd, this);
+		if (ctx && xattrs && !ctx->xattrs)
+			ctx->xattrs = dict_ref(xattrs);
+
 		rda_fill_fd(frame, this, fd);
+	}
+
+	if (xattrs)
+		dict_unref(xattrs);
 
 	STACK_UNWIND_STRICT(opendir, frame, op_ret, op_errno, fd, xdata);
 	return 0;
@@ -410,8 +436,9 @@ static int32_t
 rda_opendir(call_frame_t *frame, xlator_t *this, loc_t *loc, fd_t *fd,
 		dict_t *xdata)
 {
-	STACK_WIND(frame, rda_opendir_cbk, FIRST_CHILD(this),
-		   FIRST_CHILD(this)->fops->opendir, loc, fd, xdata);
+	STACK_WIND_COOKIE(frame, rda_opendir_cbk,
+			  xdata ? dict_ref(xdata) : NULL, FIRST_CHILD(this),
+			  FIRST_CHILD(this)->fops->opendir, loc, fd, xdata);
 	return 0;
 }
 
@@ -433,6 +460,9 @@ rda_releasedir(xlator_t *this, fd_t *fd)
 	if (ctx->fill_frame)
 		STACK_DESTROY(ctx->fill_frame->root);
 
+	if (ctx->xattrs)
+		dict_unref(ctx->xattrs);
+
 	if (ctx->stub)
 		gf_log(this->name, GF_LOG_ERROR,
 			"released a directory with a pending stub");
@@ -29,6 +29,7 @@ struct rda_fd_ctx {
 	call_frame_t *fill_frame;
 	call_stub_t *stub;
 	int op_errno;
+	dict_t *xattrs;		/* xattrs requested along with the preload */
 };
 
 struct rda_local {
@@ -1283,6 +1283,8 @@ wb_writev (call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
         int           ret           = -1;
         int32_t       op_errno      = EINVAL;
 	int           o_direct      = O_DIRECT;
+	struct iovec  copy          = {0, };
+	struct iobref *copy_iobref  = NULL;
 
 	conf = this->private;
 
@@ -1305,6 +1307,19 @@ wb_writev (call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
 	if (flags & (O_SYNC|O_DSYNC|o_direct))
 		wb_disabled = 1;
 
+	/* buffers owned by the application (gfapi zero-copy writes) can be
+	   reused as soon as the write is unwound, keep a private copy */
+	if (!wb_disabled && iobref && iobref_has_external (iobref)) {
+		if (iobuf_copy_iovec (this->ctx->iobuf_pool, vector, count,
+				      &copy, &copy_iobref)) {
+			op_errno = ENOMEM;
+			goto unwind;
+		}
+		vector = &copy;
+		count = 1;
+		iobref = copy_iobref;
+	}
+
 	if (wb_disabled)
 		stub = fop_writev_stub (frame, wb_writev_helper, fd, vector,
 					count, offset, flags, iobref, xdata);
@@ -1328,6 +1343,9 @@ wb_writev (call_frame_t *frame, xlator_t *this, fd_t *fd, struct iovec *vector,
 
         wb_process_queue (wb_inode);
 
+	if (copy_iobref)
+		iobref_unref (copy_iobref);
+
         return 0;
 
 unwind:
@@ -1336,6 +1354,9 @@ unwind:
         if (stub)
                 call_stub_destroy (stub);
 
+	if (copy_iobref)
+		iobref_unref (copy_iobref);
+
         return 0;
 }
 
@@ -179,12 +179,15 @@ client_set_lk_version_cbk (struct rpc_req *req, struct iovec *iov,
         }
 
         ret = xdr_to_generic (*iov, &rsp, (xdrproc_t)xdr_gf_set_lk_ver_rsp);
-        if (ret < 0)
+        if (ret < 0) {
                 gf_log (fr->this->name, GF_LOG_WARNING,
                         "xdr decoding failed");
-        else
+        } else {
                 gf_log (fr->this->name, GF_LOG_INFO,
                         "Server lk version = %d", rsp.lk_ver);
+                /* the stripes now bind with the lk-version the brick has */
+                client_stripes_start (fr->this);
+        }
 
         ret = 0;
 out:
@@ -1057,6 +1060,65 @@ out:
         return 0;
 }
 
+static int
+client_stripe_setvolume_cbk (struct rpc_req *req, struct iovec *iov,
+                             int count, void *myframe)
+{
+        call_frame_t         *frame         = NULL;
+        clnt_conf_t          *conf          = NULL;
+        clnt_stripe_t        *stripe        = NULL;
+        xlator_t             *this          = NULL;
+        gf_setvolume_rsp      rsp           = {0,};
+        int                   ret           = -1;
+
+        frame  = myframe;
+        this   = frame->this;
+        conf   = this->private;
+        stripe = frame->cookie;
+
+        if (-1 == req->rpc_status) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "received RPC status error");
+                goto out;
+        }
+
+        ret = xdr_to_generic (*iov, &rsp, (xdrproc_t)xdr_gf_setvolume_rsp);
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_ERROR, "XDR decoding failed");
+                goto out;
+        }
+
+        ret = rsp.op_ret;
+        if (-1 == ret) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "SETVOLUME on %s failed (%s)",
+                        stripe->rpc->conn.name,
+                        strerror (gf_error_to_errno (rsp.op_errno)));
+                goto out;
+        }
+
+        /* the main connection went down meanwhile */
+        if (!conf->attached) {
+                ret = -1;
+                goto out;
+        }
+
+        rpc_clnt_set_connected (&stripe->rpc->conn);
+        stripe->attached = 1;
+
+        gf_log (this->name, GF_LOG_INFO, "Connected %s to the brick",
+                stripe->rpc->conn.name);
+out:
+        if (ret < 0)
+                rpc_clnt_disconnect (stripe->rpc);
+
+        free (rsp.dict.dict_val);
+
+        STACK_DESTROY (frame->root);
+
+        return 0;
+}
+
 int
 client_setvolume_cbk (struct rpc_req *req, struct iovec *iov, int count, void *myframe)
 {
@@ -1163,6 +1225,10 @@ client_setvolume_cbk (struct rpc_req *req, struct iovec *iov, int count, void *m
 
         gf_log (this->name, GF_LOG_DEBUG, "clnt-lk-version = %d, "
                 "server-lk-version = %d", client_get_lk_ver (conf), lk_ver);
+
+        /* bricks without the procedure reply PROC_UNAVAIL to it */
+        conf->compound_fops = dict_get_str_boolean (reply, "compound-fops",
+                                                    _gf_false) > 0;
         /* TODO: currently setpeer path is broken */
         /*
         if (process_uuid && req->conn &&
@@ -1198,6 +1264,10 @@ client_setvolume_cbk (struct rpc_req *req, struct iovec *iov, int count, void *m
         conf->connecting = 0;
         conf->connected = 1;
 
+        /* A stripe sending its SETVOLUME with another lk-version than the
+           brick has would have it clean up the fds and locks of the client.
+           When they differ, the stripes wait for the fds to be reopened and
+           for SET_LK_VER. */
         if (lk_ver != client_get_lk_ver (conf)) {
                 gf_log (this->name, GF_LOG_INFO, "Server and Client "
                         "lk-version numbers are not same, reopening the fds");
@@ -1210,6 +1280,7 @@ client_setvolume_cbk (struct rpc_req *req, struct iovec *iov, int count, void *m
                 gf_log (this->name, GF_LOG_INFO, "Server and Client "
                         "lk-version numbers are same, no need to "
                         "reopen the fds");
+                client_stripes_start (this);
                 client_notify_parents_child_up (frame->this);
         }
 
@@ -1259,10 +1330,20 @@ client_setvolume (xlator_t *this, struct rpc_clnt *rpc)
         clnt_conf_t      *conf            = NULL;
         dict_t           *options         = NULL;
         char             counter_str[32]  = {0};
+        clnt_stripe_t   *stripe           = NULL;
+        fop_cbk_fn_t     cbk              = client_setvolume_cbk;
 
         options = this->options;
         conf    = this->private;
 
+        /* A stripe sends the options the main connection last sent, so it
+           binds to the same client on the brick */
+        stripe = client_stripe_get (conf, rpc);
+        if (stripe) {
+                cbk = client_stripe_setvolume_cbk;
+                goto serialize;
+        }
+
         if (conf->fops) {
                 ret = dict_set_int32 (options, "fops-version",
                                       conf->fops->prognum);
@@ -1346,6 +1427,7 @@ client_setvolume (xlator_t *this, struct rpc_clnt *rpc)
                         client_get_lk_ver (conf));
         }
 
+serialize:
         ret = dict_serialized_length (options);
         if (ret < 0) {
                 gf_log (this->name, GF_LOG_ERROR,
@@ -1366,11 +1448,12 @@ client_setvolume (xlator_t *this, struct rpc_clnt *rpc)
         fr  = create_frame (this, this->ctx->pool);
         if (!fr)
                 goto fail;
+        fr->cookie = stripe;
 
-        ret = client_submit_request (this, &req, fr, conf->handshake,
-                                     GF_HNDSK_SETVOLUME, client_setvolume_cbk,
-                                     NULL, NULL, 0, NULL, 0, NULL,
-                                     (xdrproc_t)xdr_gf_setvolume_req);
+        ret = client_submit_request_on (this, rpc, &req, fr, conf->handshake,
+                                        GF_HNDSK_SETVOLUME, cbk, NULL, NULL, 0,
+                                        NULL, 0, NULL,
+                                        (xdrproc_t)xdr_gf_setvolume_req);
 
 fail:
         GF_FREE (req.dict.dict_val);
@@ -1494,6 +1577,7 @@ client_query_portmap_cbk (struct rpc_req *req, struct iovec *iov, int count, voi
         conf->disconnect_err_logged = 0;
         config.remote_port = rsp.port;
         rpc_clnt_reconfig (conf->rpc, &config);
+        conf->brick_port = rsp.port;
 
         conf->skip_notify = 1;
 	conf->quick_reconnect = 1;
@@ -18,6 +18,7 @@
 #include "glusterfs3-xdr.h"
 #include "glusterfs3.h"
 #include "compat-errno.h"
+#include "compound-fop-utils.h"
 
 int32_t client3_getspec (call_frame_t *frame, xlator_t *this, void *data);
 rpc_clnt_prog_t clnt3_3_fop_prog;
@@ -85,9 +86,10 @@ client_submit_vec_request (xlator_t  *this, void *req, call_frame_t  *frame,
         }
 
         /* Send the msg */
-        ret = rpc_clnt_submit (conf->rpc, prog, procnum, cbkfn, &iov, count,
-                               payload, payloadcnt, new_iobref, frame, NULL, 0,
-                               NULL, 0, NULL);
+        ret = client_rpc_submit (this, client_pick_rpc (conf, prog, procnum),
+                                 frame, prog, procnum, cbkfn, &iov, count,
+                                 payload, payloadcnt, new_iobref, NULL, 0,
+                                 NULL, 0, NULL);
         if (ret < 0) {
                 gf_log (this->name, GF_LOG_DEBUG, "rpc_clnt_submit failed");
         }
@@ -157,9 +159,9 @@ client3_3_symlink_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -228,9 +230,9 @@ client3_3_mknod_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -294,9 +296,9 @@ client3_3_mkdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -436,9 +438,9 @@ client3_3_open_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 }
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -494,9 +496,9 @@ client3_3_stat_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.stat, &iatt);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -548,9 +550,9 @@ client3_3_readlink_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.buf, &iatt);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -610,9 +612,9 @@ client3_3_unlink_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -670,9 +672,9 @@ client3_3_rmdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -727,9 +729,9 @@ client3_3_truncate_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -782,9 +784,9 @@ client3_3_statfs_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_statfs_to_statfs (&rsp.statfs, &statfs);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -841,9 +843,9 @@ client3_3_writev_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -902,9 +904,9 @@ client3_3_flush_cbk (struct rpc_req *req, struct iovec *iov, int count,
                         lkowner_utoa (&local->owner), ret);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -960,9 +962,9 @@ client3_3_fsync_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1010,9 +1012,9 @@ client3_3_setxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         op_errno = gf_error_to_errno (rsp.op_errno);
@@ -1067,15 +1069,15 @@ client3_3_getxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
 
         op_errno = gf_error_to_errno (rsp.op_errno);
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->this, dict,
+                                                    (rsp.dict.dict_val),
+                                                    (rsp.dict.dict_len),
+                                                    rsp.op_ret, op_errno, out);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1140,14 +1142,14 @@ client3_3_fgetxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
 
         op_errno = gf_error_to_errno (rsp.op_errno);
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->this, dict,
+                                                    (rsp.dict.dict_val),
+                                                    (rsp.dict.dict_len),
+                                                    rsp.op_ret, op_errno, out);
         }
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1204,9 +1206,9 @@ client3_3_removexattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1259,9 +1261,9 @@ client3_3_fremovexattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1307,9 +1309,9 @@ client3_3_fsyncdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1355,9 +1357,9 @@ client3_3_access_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1411,9 +1413,9 @@ client3_3_ftruncate_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.poststat, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1465,9 +1467,9 @@ client3_3_fstat_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.stat, &stat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1514,9 +1516,9 @@ client3_3_inodelk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1565,9 +1567,9 @@ client3_3_finodelk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1618,9 +1620,9 @@ client3_3_entrylk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1669,9 +1671,9 @@ client3_3_fentrylk_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if ((rsp.op_ret == -1) &&
@@ -1725,15 +1727,15 @@ client3_3_xattrop_cbk (struct rpc_req *req, struct iovec *iov, int count,
 
         op_errno = rsp.op_errno;
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->this, dict,
+                                                    (rsp.dict.dict_val),
+                                                    (rsp.dict.dict_len),
+                                                    rsp.op_ret, op_errno, out);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1792,16 +1794,16 @@ client3_3_fxattrop_cbk (struct rpc_req *req, struct iovec *iov, int count,
         }
         op_errno = rsp.op_errno;
         if (-1 != rsp.op_ret) {
-                GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, dict,
-                                              (rsp.dict.dict_val),
-                                              (rsp.dict.dict_len), rsp.op_ret,
-                                              op_errno, out);
+                GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->this, dict,
+                                                    (rsp.dict.dict_val),
+                                                    (rsp.dict.dict_len),
+                                                    rsp.op_ret, op_errno, out);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, xdata,
-                                      (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), rsp.op_ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->this, xdata,
+                                            (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), rsp.op_ret,
+                                            op_errno, out);
 out:
 
         if (rsp.op_ret == -1) {
@@ -1856,9 +1858,9 @@ client3_3_fsetxattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         op_errno = gf_error_to_errno (rsp.op_errno);
@@ -1914,9 +1916,9 @@ client3_3_fsetattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -1970,9 +1972,9 @@ client3_3_fallocate_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2025,9 +2027,9 @@ client3_3_discard_cbk(struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2080,9 +2082,9 @@ client3_3_zerofill_cbk(struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2129,9 +2131,9 @@ client3_3_ipc_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2151,6 +2153,197 @@ out:
         return 0;
 }
 
+int
+client3_3_seek_cbk (struct rpc_req *req, struct iovec *iov, int count,
+                    void *myframe)
+{
+        call_frame_t    *frame         = NULL;
+        gfs3_seek_rsp    rsp           = {0,};
+        int              ret           = 0;
+        xlator_t        *this          = NULL;
+        dict_t          *xdata         = NULL;
+
+        this = THIS;
+
+        frame = myframe;
+
+        if (-1 == req->rpc_status) {
+                rsp.op_ret   = -1;
+                rsp.op_errno = ENOTCONN;
+                goto out;
+        }
+        ret = xdr_to_generic(*iov, &rsp, (xdrproc_t) xdr_gfs3_seek_rsp);
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_ERROR, "XDR decoding failed");
+                rsp.op_ret   = -1;
+                rsp.op_errno = EINVAL;
+                goto out;
+        }
+
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
+
+out:
+        /* ENXIO only tells that there is no data past the offset */
+        if ((rsp.op_ret == -1) &&
+            (gf_error_to_errno (rsp.op_errno) != ENXIO)) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "remote operation failed: %s",
+                        strerror (gf_error_to_errno (rsp.op_errno)));
+        }
+        CLIENT_STACK_UNWIND (seek, frame,
+                             rsp.op_ret, gf_error_to_errno (rsp.op_errno),
+                             rsp.offset, xdata);
+
+        free (rsp.xdata.xdata_val);
+
+        if (xdata)
+                dict_unref (xdata);
+
+        return 0;
+}
+
+static int
+client_compound_rsp_fill (xlator_t *this, compound_args_t *args,
+                          gfs3_compound_rsp *rsp)
+{
+        compound_rsp       *entry    = NULL;
+        compound_rsp_t     *c_rsp    = NULL;
+        gfs3_write_rsp     *write    = NULL;
+        gfs3_fxattrop_rsp  *fxattrop = NULL;
+        int                 ret      = 0;
+        int                 op_errno = 0;
+        int                 i        = 0;
+
+        /* the bricks stop at the first fop that fails, a successful
+         * reply carries all of them */
+        if ((rsp->compound_rsp_array.compound_rsp_array_len > args->count) ||
+            ((rsp->op_ret >= 0) &&
+             (rsp->compound_rsp_array.compound_rsp_array_len != args->count)))
+                return EINVAL;
+
+        for (i = 0; i < rsp->compound_rsp_array.compound_rsp_array_len; i++) {
+                entry = &rsp->compound_rsp_array.compound_rsp_array_val[i];
+                c_rsp = &args->rsp[i];
+                args->done = i + 1;
+
+                switch (entry->fop_enum) {
+                case GFS3_COMPOUND_WRITE:
+                        if (args->req[i].fop != GF_FOP_WRITE)
+                                return EINVAL;
+
+                        write = &entry->compound_rsp_u.compound_write_rsp;
+                        c_rsp->op_ret = write->op_ret;
+                        c_rsp->op_errno = gf_error_to_errno (write->op_errno);
+                        if (-1 != write->op_ret) {
+                                gf_stat_to_iatt (&write->prestat,
+                                                 &c_rsp->prestat);
+                                gf_stat_to_iatt (&write->poststat,
+                                                 &c_rsp->poststat);
+                        }
+
+                        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, c_rsp->xdata,
+                                                            (write->xdata.xdata_val),
+                                                            (write->xdata.xdata_len),
+                                                            ret, op_errno, out);
+                        break;
+                case GFS3_COMPOUND_FXATTROP:
+                        if (args->req[i].fop != GF_FOP_FXATTROP)
+                                return EINVAL;
+
+                        fxattrop = &entry->compound_rsp_u.compound_fxattrop_rsp;
+                        c_rsp->op_ret = fxattrop->op_ret;
+                        c_rsp->op_errno =
+                                gf_error_to_errno (fxattrop->op_errno);
+                        if (-1 != fxattrop->op_ret) {
+                                GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this,
+                                                c_rsp->xattr,
+                                                (fxattrop->dict.dict_val),
+                                                (fxattrop->dict.dict_len),
+                                                ret, op_errno, out);
+                        }
+
+                        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, c_rsp->xdata,
+                                                (fxattrop->xdata.xdata_val),
+                                                (fxattrop->xdata.xdata_len),
+                                                ret, op_errno, out);
+                        break;
+                default:
+                        return EINVAL;
+                }
+        }
+out:
+        return op_errno;
+}
+
+int
+client3_3_compound_cbk (struct rpc_req *req, struct iovec *iov, int count,
+                        void *myframe)
+{
+        call_frame_t      *frame    = NULL;
+        clnt_local_t      *local    = NULL;
+        compound_args_t   *args     = NULL;
+        gfs3_compound_rsp  rsp      = {0,};
+        xlator_t          *this     = NULL;
+        dict_t            *xdata    = NULL;
+        int                ret      = 0;
+        int                op_errno = 0;
+
+        this = THIS;
+
+        frame = myframe;
+        local = frame->local;
+        args = local->compound_args;
+        args->done = 0;
+
+        if (-1 == req->rpc_status) {
+                rsp.op_ret   = -1;
+                op_errno = ENOTCONN;
+                goto out;
+        }
+
+        ret = xdr_to_generic (*iov, &rsp, (xdrproc_t)xdr_gfs3_compound_rsp);
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_ERROR, "XDR decoding failed");
+                rsp.op_ret   = -1;
+                op_errno = EINVAL;
+                goto out;
+        }
+        op_errno = gf_error_to_errno (rsp.op_errno);
+
+        ret = client_compound_rsp_fill (this, args, &rsp);
+        if (ret) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "malformed compound reply");
+                rsp.op_ret = -1;
+                op_errno = ret;
+                goto out;
+        }
+
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            op_errno, out);
+
+out:
+        if (rsp.op_ret == -1) {
+                gf_log (this->name, GF_LOG_WARNING,
+                        "remote operation failed: %s", strerror (op_errno));
+                compound_args_cancel (args, op_errno);
+        } else if (local->attempt_reopen) {
+                client_attempt_reopen (local->fd, this);
+        }
+        CLIENT_STACK_UNWIND (compound, frame, rsp.op_ret, op_errno, args,
+                             xdata);
+
+        xdr_free ((xdrproc_t)xdr_gfs3_compound_rsp, (char *)&rsp);
+
+        if (xdata)
+                dict_unref (xdata);
+
+        return 0;
+}
+
 int
 client3_3_setattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                        void *myframe)
@@ -2187,9 +2380,9 @@ client3_3_setattr_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.statpost, &poststat);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2260,9 +2453,9 @@ client3_3_create_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 }
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2314,9 +2507,9 @@ client3_3_rchecksum_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2392,9 +2585,9 @@ client3_3_lk_cbk (struct rpc_req *req, struct iovec *iov, int count,
         }
         */
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if ((rsp.op_ret == -1) &&
@@ -2453,10 +2646,10 @@ client3_3_readdir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 unserialize_rsp_dirent (this, &rsp, &entries);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, xdata,
-                                      (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), rsp.op_ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->this, xdata,
+                                            (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), rsp.op_ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2519,9 +2712,9 @@ client3_3_readdirp_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 unserialize_rsp_direntp (this, local->fd, &rsp, &entries);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2589,9 +2782,9 @@ client3_3_rename_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postnewparent, &postnewparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2655,9 +2848,9 @@ client3_3_link_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 gf_stat_to_iatt (&rsp.postparent, &postparent);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2725,9 +2918,9 @@ client3_3_opendir_cbk (struct rpc_req *req, struct iovec *iov, int count,
                 }
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 out:
         if (rsp.op_ret == -1) {
@@ -2793,9 +2986,10 @@ client3_3_lookup_cbk (struct rpc_req *req, struct iovec *iov, int count,
         rsp.op_ret = -1;
         gf_stat_to_iatt (&rsp.stat, &stbuf);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), rsp.op_ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->this, xdata,
+                                            (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), rsp.op_ret,
+                                            op_errno, out);
 
         if ((!gf_uuid_is_null (inode->gfid))
             && (gf_uuid_compare (stbuf.ia_gfid, inode->gfid) != 0)) {
@@ -2882,9 +3076,9 @@ client3_3_readv_cbk (struct rpc_req *req, struct iovec *iov, int count,
                         vector[0].iov_base = req->rsp[1].iov_base;
                 rspcount = 1;
         }
-        GF_PROTOCOL_DICT_UNSERIALIZE (this, xdata, (rsp.xdata.xdata_val),
-                                      (rsp.xdata.xdata_len), ret,
-                                      rsp.op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (this, xdata, (rsp.xdata.xdata_val),
+                                            (rsp.xdata.xdata_len), ret,
+                                            rsp.op_errno, out);
 
 #ifdef GF_TESTING_IO_XDATA
         dict_dump_to_log (xdata);
@@ -4104,6 +4298,7 @@ client3_3_readv (call_frame_t *frame, xlator_t *this,
         struct iovec    rsp_vec    = {0, };
         struct iobuf   *rsp_iobuf  = NULL;
         struct iobref  *rsp_iobref = NULL;
+        struct iobuf_read_dest *dest = NULL;
 
         if (!frame || !this || !data)
                 goto unwind;
@@ -4127,6 +4322,19 @@ client3_3_readv (call_frame_t *frame, xlator_t *this,
 
         memcpy (req.gfid, args->fd->inode->gfid, 16);
 
+        /* let the transport read the payload straight into the caller's
+           buffer, if one came down with the request. The key holds a
+           pointer into this process and is never sent to the brick. */
+        if (args->xdata &&
+            !dict_get_ptr (args->xdata, GF_READ_DEST_KEY, (void **)&dest)) {
+                dict_del (args->xdata, GF_READ_DEST_KEY);
+                if (!iobuf_read_dest_claim (dest, args->offset, args->size)) {
+                        rsp_vec = dest->vector;
+                        local->iobref = iobref_ref (dest->iobref);
+                        goto submit;
+                }
+        }
+
         rsp_iobuf = iobuf_get2 (this->ctx->iobuf_pool, args->size);
         if (rsp_iobuf == NULL) {
                 op_errno = ENOMEM;
@@ -4159,6 +4367,7 @@ client3_3_readv (call_frame_t *frame, xlator_t *this,
         local->iobref = rsp_iobref;
         rsp_iobref = NULL;
 
+submit:
         GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
                                     req.xdata.xdata_len, op_errno, unwind);
 
@@ -6147,6 +6356,214 @@ unwind:
         return 0;
 }
 
+int32_t
+client3_3_seek (call_frame_t *frame, xlator_t *this, void *data)
+{
+        clnt_args_t       *args        = NULL;
+        int64_t            remote_fd   = -1;
+        clnt_conf_t       *conf        = NULL;
+        gfs3_seek_req      req         = {{0},};
+        int                op_errno    = ESTALE;
+        int                ret         = 0;
+
+        GF_ASSERT (frame);
+
+        if (!this || !data)
+                goto unwind;
+
+        args = data;
+        conf = this->private;
+
+        CLIENT_GET_REMOTE_FD (this, args->fd, DEFAULT_REMOTE_FD,
+                              remote_fd, op_errno, unwind);
+
+        req.fd = remote_fd;
+        req.offset = args->offset;
+        req.what = args->what;
+        memcpy(req.gfid, args->fd->inode->gfid, 16);
+
+        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
+                                    req.xdata.xdata_len, op_errno, unwind);
+
+        ret = client_submit_request(this, &req, frame, conf->fops,
+                                    GFS3_OP_SEEK, client3_3_seek_cbk,
+                                    NULL, NULL, 0, NULL, 0, NULL,
+                                    (xdrproc_t) xdr_gfs3_seek_req);
+        if (ret)
+                gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
+
+        GF_FREE (req.xdata.xdata_val);
+
+        return 0;
+unwind:
+        CLIENT_STACK_UNWIND(seek, frame, -1, op_errno, 0, NULL);
+        GF_FREE (req.xdata.xdata_val);
+
+        return 0;
+}
+
+static void
+client_compound_req_cleanup (gfs3_compound_req *req)
+{
+        compound_req *entry = NULL;
+        int           i     = 0;
+
+        if (!req->compound_req_array.compound_req_array_val)
+                return;
+
+        for (i = 0; i < req->compound_req_array.compound_req_array_len; i++) {
+                entry = &req->compound_req_array.compound_req_array_val[i];
+
+                switch (entry->fop_enum) {
+                case GFS3_COMPOUND_WRITE:
+                        GF_FREE (entry->compound_req_u.compound_write_req.xdata.xdata_val);
+                        break;
+                case GFS3_COMPOUND_FXATTROP:
+                        GF_FREE (entry->compound_req_u.compound_fxattrop_req.dict.dict_val);
+                        GF_FREE (entry->compound_req_u.compound_fxattrop_req.xdata.xdata_val);
+                        break;
+                }
+        }
+
+        GF_FREE (req->compound_req_array.compound_req_array_val);
+}
+
+/* All the fops of a compound are on one fd. The data of its write goes as
+ * the payload of the request. */
+int32_t
+client3_3_compound (call_frame_t *frame, xlator_t *this, void *data)
+{
+        clnt_args_t        *args       = NULL;
+        compound_args_t    *c_args     = NULL;
+        compound_req_t     *c_req      = NULL;
+        compound_req       *entry      = NULL;
+        gfs3_write_req     *write      = NULL;
+        gfs3_fxattrop_req  *fxattrop   = NULL;
+        clnt_conf_t        *conf       = NULL;
+        clnt_local_t       *local      = NULL;
+        gfs3_compound_req   req        = {{0,},};
+        struct iovec       *payload    = NULL;
+        int                 payloadcnt = 0;
+        struct iobref      *iobref     = NULL;
+        int64_t             remote_fd  = -1;
+        fd_t               *fd         = NULL;
+        int                 op_errno   = ESTALE;
+        int                 ret        = 0;
+        int                 i          = 0;
+
+        GF_ASSERT (frame);
+
+        if (!this || !data)
+                goto unwind;
+
+        args = data;
+        conf = this->private;
+        c_args = args->compound_args;
+        c_args->done = 0;
+        fd = c_args->req[0].fd;
+
+        CLIENT_GET_REMOTE_FD (this, fd, FALLBACK_TO_ANON_FD,
+                              remote_fd, op_errno, unwind);
+        ret = client_fd_fop_prepare_local (frame, fd, remote_fd);
+        if (ret) {
+                op_errno = -ret;
+                goto unwind;
+        }
+
+        local = frame->local;
+        local->compound_args = c_args;
+
+        req.compound_req_array.compound_req_array_val =
+                GF_CALLOC (c_args->count, sizeof (compound_req),
+                           gf_client_mt_compound_req_t);
+        if (!req.compound_req_array.compound_req_array_val) {
+                op_errno = ENOMEM;
+                goto unwind;
+        }
+        req.compound_req_array.compound_req_array_len = c_args->count;
+
+        for (i = 0; i < c_args->count; i++) {
+                c_req = &c_args->req[i];
+                entry = &req.compound_req_array.compound_req_array_val[i];
+
+                if (c_req->fd != fd) {
+                        op_errno = EINVAL;
+                        goto unwind;
+                }
+
+                switch (c_req->fop) {
+                case GF_FOP_WRITE:
+                        if (payload) {
+                                op_errno = EINVAL;
+                                goto unwind;
+                        }
+
+                        entry->fop_enum = GFS3_COMPOUND_WRITE;
+                        write = &entry->compound_req_u.compound_write_req;
+                        write->fd = remote_fd;
+                        write->offset = c_req->offset;
+                        write->size = iov_length (c_req->vector,
+                                                  c_req->count);
+                        write->flag = c_req->flags;
+                        memcpy (write->gfid, fd->inode->gfid, 16);
+
+                        GF_PROTOCOL_DICT_SERIALIZE (this, c_req->xdata,
+                                                    (&write->xdata.xdata_val),
+                                                    write->xdata.xdata_len,
+                                                    op_errno, unwind);
+
+                        payload = c_req->vector;
+                        payloadcnt = c_req->count;
+                        iobref = c_req->iobref;
+                        break;
+                case GF_FOP_FXATTROP:
+                        entry->fop_enum = GFS3_COMPOUND_FXATTROP;
+                        fxattrop = &entry->compound_req_u.compound_fxattrop_req;
+                        fxattrop->fd = remote_fd;
+                        fxattrop->flags = c_req->optype;
+                        memcpy (fxattrop->gfid, fd->inode->gfid, 16);
+
+                        GF_PROTOCOL_DICT_SERIALIZE (this, c_req->xattr,
+                                                    (&fxattrop->dict.dict_val),
+                                                    fxattrop->dict.dict_len,
+                                                    op_errno, unwind);
+
+                        GF_PROTOCOL_DICT_SERIALIZE (this, c_req->xdata,
+                                                    (&fxattrop->xdata.xdata_val),
+                                                    fxattrop->xdata.xdata_len,
+                                                    op_errno, unwind);
+                        break;
+                default:
+                        op_errno = ENOTSUP;
+                        goto unwind;
+                }
+        }
+
+        GF_PROTOCOL_DICT_SERIALIZE (this, args->xdata, (&req.xdata.xdata_val),
+                                    req.xdata.xdata_len, op_errno, unwind);
+
+        ret = client_submit_vec_request (this, &req, frame, conf->fops,
+                                         GFS3_OP_COMPOUND,
+                                         client3_3_compound_cbk,
+                                         payload, payloadcnt, iobref,
+                                         (xdrproc_t)xdr_gfs3_compound_req);
+        if (ret)
+                gf_log (this->name, GF_LOG_WARNING, "failed to send the fop");
+
+        client_compound_req_cleanup (&req);
+        GF_FREE (req.xdata.xdata_val);
+
+        return 0;
+unwind:
+        if (c_args)
+                compound_args_cancel (c_args, op_errno);
+        CLIENT_STACK_UNWIND (compound, frame, -1, op_errno, c_args, NULL);
+        client_compound_req_cleanup (&req);
+        GF_FREE (req.xdata.xdata_val);
+
+        return 0;
+}
+
 /* Table Specific to FOPS */
 
 
@@ -6200,6 +6617,8 @@ rpc_clnt_procedure_t clnt3_3_fop_actors[GF_FOP_MAXVALUE] = {
         [GF_FOP_GETSPEC]      = { "GETSPEC",      client3_getspec },
         [GF_FOP_FREMOVEXATTR] = { "FREMOVEXATTR", client3_3_fremovexattr },
         [GF_FOP_IPC]          = { "IPC",          client3_3_ipc },
+        [GF_FOP_SEEK]         = { "SEEK",         client3_3_seek },
+        [GF_FOP_COMPOUND]     = { "COMPOUND",     client3_3_compound },
 };
 
 /* Used From RPC-CLNT library to log proper name of procedure based on number */
@@ -6252,6 +6671,8 @@ char *clnt3_3_fop_names[GFS3_OP_MAXVALUE] = {
 	[GFS3_OP_DISCARD]     = "DISCARD",
         [GFS3_OP_ZEROFILL]    = "ZEROFILL",
         [GFS3_OP_IPC]         = "IPC",
+        [GFS3_OP_SEEK]        = "SEEK",
+        [GFS3_OP_COMPOUND]    = "COMPOUND",
 
 };
 
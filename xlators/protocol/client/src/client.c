@@ -20,6 +20,7 @@
 #include "glusterfs.h"
 #include "statedump.h"
 #include "compat-errno.h"
+#include "compound-fop-utils.h"
 #include "event.h"
 
 #include "xdr-rpc.h"
@@ -48,6 +49,7 @@ client_fini_complete (xlator_t *this)
         this->private = NULL;
 
         pthread_mutex_destroy (&conf->lock);
+        GF_FREE (conf->stripes);
         GF_FREE (conf);
 
 out:
@@ -212,6 +214,54 @@ out:
         return ret;
 }
 
+/* Everything goes over the main connection but readv, writev and compound
+ * fops, which are spread round-robin over it and the attached stripes. */
+struct rpc_clnt *
+client_pick_rpc (clnt_conf_t *conf, rpc_clnt_prog_t *prog, int procnum)
+{
+        clnt_stripe_t *stripe = NULL;
+        uint32_t       slot   = 0;
+
+        if (conf->transport_count < 2 || prog != conf->fops)
+                return conf->rpc;
+
+        switch (procnum) {
+        case GFS3_OP_READ:
+        case GFS3_OP_WRITE:
+        case GFS3_OP_COMPOUND:
+                break;
+        default:
+                return conf->rpc;
+        }
+
+        slot = __sync_fetch_and_add (&conf->next_stripe, 1) %
+                conf->transport_count;
+        if (slot == 0)
+                return conf->rpc;
+
+        stripe = &conf->stripes[slot - 1];
+        if (!stripe->attached)
+                return conf->rpc;
+
+        return stripe->rpc;
+}
+
+clnt_stripe_t *
+client_stripe_get (clnt_conf_t *conf, struct rpc_clnt *rpc)
+{
+        int i = 0;
+
+        if (!conf->stripes)
+                return NULL;
+
+        for (i = 0; i < conf->transport_count - 1; i++) {
+                if (conf->stripes[i].rpc == rpc)
+                        return &conf->stripes[i];
+        }
+
+        return NULL;
+}
+
 int
 client_submit_request (xlator_t *this, void *req, call_frame_t *frame,
                        rpc_clnt_prog_t *prog, int procnum, fop_cbk_fn_t cbkfn,
@@ -219,6 +269,126 @@ client_submit_request (xlator_t *this, void *req, call_frame_t *frame,
                        int rsphdr_count, struct iovec *rsp_payload,
                        int rsp_payload_count, struct iobref *rsp_iobref,
                        xdrproc_t xdrproc)
+{
+        return client_submit_request_on (this, NULL, req, frame, prog,
+                                         procnum, cbkfn, iobref, rsphdr,
+                                         rsphdr_count, rsp_payload,
+                                         rsp_payload_count, rsp_iobref,
+                                         xdrproc);
+}
+
+static void
+client_stripe_retry_free (clnt_stripe_retry_t *retry)
+{
+        if (retry->iobref)
+                iobref_unref (retry->iobref);
+        if (retry->rsp_iobref)
+                iobref_unref (retry->rsp_iobref);
+
+        GF_FREE (retry);
+}
+
+static int
+client_stripe_retry_cbk (struct rpc_req *req, struct iovec *iov, int count,
+                         void *myframe)
+{
+        call_frame_t        *frame = NULL;
+        clnt_conf_t         *conf  = NULL;
+        clnt_local_t        *local = NULL;
+        clnt_stripe_retry_t *retry = NULL;
+        fop_cbk_fn_t         cbkfn = NULL;
+
+        frame = myframe;
+        conf  = frame->this->private;
+        local = frame->local;
+        retry = local->stripe_retry;
+        local->stripe_retry = NULL;
+        cbkfn = retry->cbkfn;
+
+        if ((req->rpc_status == -1) && conf->connected) {
+                gf_log (frame->this->name, GF_LOG_DEBUG, "stripe went down, "
+                        "sending the request over the main connection");
+                rpc_clnt_submit (conf->rpc, retry->prog, retry->procnum, cbkfn,
+                                 &retry->hdr, 1, retry->payload,
+                                 retry->payloadcnt, retry->iobref, frame, NULL,
+                                 0, retry->rsp_payload,
+                                 retry->rsp_payload_count, retry->rsp_iobref);
+                client_stripe_retry_free (retry);
+                return 0;
+        }
+
+        client_stripe_retry_free (retry);
+
+        return cbkfn (req, iov, count, frame);
+}
+
+/* rpc_clnt_submit (), but reads and writes sent over a stripe are sent again
+ * over the main connection if the stripe fails them. */
+int
+client_rpc_submit (xlator_t *this, struct rpc_clnt *rpc, call_frame_t *frame,
+                   rpc_clnt_prog_t *prog, int procnum, fop_cbk_fn_t cbkfn,
+                   struct iovec *hdr, int hdrcount, struct iovec *payload,
+                   int payloadcnt, struct iobref *iobref, struct iovec *rsphdr,
+                   int rsphdr_count, struct iovec *rsp_payload,
+                   int rsp_payload_count, struct iobref *rsp_iobref)
+{
+        clnt_conf_t         *conf  = NULL;
+        clnt_local_t        *local = NULL;
+        clnt_stripe_retry_t *retry = NULL;
+
+        conf  = this->private;
+        local = frame->local;
+
+        if ((rpc == conf->rpc) || !local || local->stripe_retry ||
+            (hdrcount != 1) || rsphdr_count ||
+            ((procnum != GFS3_OP_READ) && (procnum != GFS3_OP_WRITE)))
+                goto submit;
+
+        retry = GF_CALLOC (1, sizeof (*retry) + (payloadcnt +
+                                                 rsp_payload_count) *
+                           sizeof (struct iovec),
+                           gf_client_mt_clnt_stripe_retry_t);
+        if (!retry)
+                goto submit;
+
+        retry->prog = prog;
+        retry->procnum = procnum;
+        retry->cbkfn = cbkfn;
+        retry->hdr = *hdr;
+        retry->payload = (struct iovec *)(retry + 1);
+        retry->payloadcnt = payloadcnt;
+        if (payloadcnt)
+                memcpy (retry->payload, payload,
+                        payloadcnt * sizeof (struct iovec));
+        retry->rsp_payload = retry->payload + payloadcnt;
+        retry->rsp_payload_count = rsp_payload_count;
+        if (rsp_payload_count)
+                memcpy (retry->rsp_payload, rsp_payload,
+                        rsp_payload_count * sizeof (struct iovec));
+        if (iobref)
+                retry->iobref = iobref_ref (iobref);
+        if (rsp_iobref)
+                retry->rsp_iobref = iobref_ref (rsp_iobref);
+
+        local->stripe_retry = retry;
+        cbkfn = client_stripe_retry_cbk;
+submit:
+        return rpc_clnt_submit (rpc, prog, procnum, cbkfn, hdr, hdrcount,
+                                payload, payloadcnt, iobref, frame, rsphdr,
+                                rsphdr_count, rsp_payload, rsp_payload_count,
+                                rsp_iobref);
+}
+
+/* Sends the request over @rpc, or over the connection client_pick_rpc ()
+ * chooses when @rpc is NULL. */
+int
+client_submit_request_on (xlator_t *this, struct rpc_clnt *rpc, void *req,
+                          call_frame_t *frame, rpc_clnt_prog_t *prog,
+                          int procnum, fop_cbk_fn_t cbkfn,
+                          struct iobref *iobref, struct iovec *rsphdr,
+                          int rsphdr_count, struct iovec *rsp_payload,
+                          int rsp_payload_count, struct iobref *rsp_iobref,
+                          xdrproc_t xdrproc)
 {
         int             ret        = -1;
         clnt_conf_t    *conf       = NULL;
@@ -308,10 +478,14 @@ client_submit_request (xlator_t *this, void *req, call_frame_t *frame,
                 }
         }
 
+        if (!rpc)
+                rpc = client_pick_rpc (conf, prog, procnum);
+
         /* Send the msg */
-        ret = rpc_clnt_submit (conf->rpc, prog, procnum, cbkfn, &iov, count,
-                               NULL, 0, new_iobref, frame, rsphdr, rsphdr_count,
-                               rsp_payload, rsp_payload_count, rsp_iobref);
+        ret = client_rpc_submit (this, rpc, frame, prog, procnum, cbkfn, &iov,
+                                 count, NULL, 0, new_iobref, rsphdr,
+                                 rsphdr_count, rsp_payload, rsp_payload_count,
+                                 rsp_iobref);
 
         if (ret < 0) {
                 gf_log (this->name, GF_LOG_DEBUG, "rpc_clnt_submit failed");
@@ -1952,6 +2126,74 @@ out:
 }
 
 
+int32_t
+client_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+             gf_seek_what_t what, dict_t *xdata)
+{
+        int          ret              = -1;
+        clnt_conf_t *conf             = NULL;
+        rpc_clnt_procedure_t *proc    = NULL;
+        clnt_args_t  args             = {0,};
+
+        conf = this->private;
+        if (!conf || !conf->fops)
+                goto out;
+
+        args.fd = fd;
+        args.offset = offset;
+        args.what = what;
+        args.xdata = xdata;
+
+        proc = &conf->fops->proctable[GF_FOP_SEEK];
+
+        if (proc->fn)
+                ret = proc->fn (frame, this, &args);
+out:
+        if (ret)
+                STACK_UNWIND_STRICT (seek, frame, -1, ENOTCONN, 0, NULL);
+
+        return 0;
+}
+
+
+int32_t
+client_compound (call_frame_t *frame, xlator_t *this, compound_args_t *args,
+                 dict_t *xdata)
+{
+        int          ret              = -1;
+        clnt_conf_t *conf             = NULL;
+        rpc_clnt_procedure_t *proc    = NULL;
+        clnt_args_t  c_args           = {0,};
+
+        conf = this->private;
+        if (!conf || !conf->fops)
+                goto out;
+
+        /* older bricks get the fops one by one */
+        if (!conf->compound_fops)
+                return default_compound (frame, this, args, xdata);
+
+        __sync_fetch_and_add (&conf->compound_sent, 1);
+
+        c_args.compound_args = args;
+        c_args.xdata = xdata;
+
+        proc = &conf->fops->proctable[GF_FOP_COMPOUND];
+
+        if (proc->fn)
+                ret = proc->fn (frame, this, &c_args);
+out:
+        if (ret) {
+                args->done = 0;
+                compound_args_cancel (args, ENOTCONN);
+                STACK_UNWIND_STRICT (compound, frame, -1, ENOTCONN, args,
+                                     NULL);
+        }
+
+        return 0;
+}
+
+
 int32_t
 client_getspec (call_frame_t *frame, xlator_t *this, const char *key,
                 int32_t flags)
@@ -2004,6 +2246,99 @@ client_mark_fd_bad (xlator_t *this)
 }
 
 
+/* Called once the main connection is attached and the brick has the
+ * lk-version of the client: the stripes can now bind to the same client
+ * on the brick. */
+void
+client_stripes_start (xlator_t *this)
+{
+        clnt_conf_t            *conf   = NULL;
+        struct rpc_clnt_config  config = {0, };
+        int                     i      = 0;
+
+        conf = this->private;
+        /* SET_LK_VER may be answered after a disconnect */
+        if (!conf->connected)
+                return;
+        conf->attached = 1;
+
+        config.remote_port = conf->brick_port;
+        for (i = 0; i < conf->transport_count - 1; i++) {
+                rpc_clnt_reconfig (conf->stripes[i].rpc, &config);
+                rpc_clnt_start (conf->stripes[i].rpc);
+        }
+}
+
+static void
+client_stripes_stop (xlator_t *this)
+{
+        clnt_conf_t *conf = NULL;
+        int          i    = 0;
+
+        conf = this->private;
+        conf->attached = 0;
+
+        for (i = 0; i < conf->transport_count - 1; i++) {
+                conf->stripes[i].attached = 0;
+                rpc_clnt_disconnect (conf->stripes[i].rpc);
+        }
+}
+
+static int
+client_stripe_rpc_notify (struct rpc_clnt *rpc, void *mydata,
+                          rpc_clnt_event_t event, void *data)
+{
+        xlator_t               *this   = NULL;
+        clnt_conf_t            *conf   = NULL;
+        clnt_stripe_t          *stripe = NULL;
+        struct rpc_clnt_config  config = {0, };
+
+        this = mydata;
+        if (!this || !this->private)
+                goto out;
+
+        conf = this->private;
+        stripe = client_stripe_get (conf, rpc);
+        if (!stripe)
+                goto out;
+
+        switch (event) {
+        case RPC_CLNT_CONNECT:
+                /* the main connection restarts us once it is attached */
+                if (!conf->attached) {
+                        rpc_clnt_disconnect (rpc);
+                        break;
+                }
+
+                client_setvolume (this, rpc);
+                break;
+
+        case RPC_CLNT_DISCONNECT:
+                if (stripe->attached)
+                        gf_log (this->name, GF_LOG_INFO,
+                                "disconnected %s", rpc->conn.name);
+                stripe->attached = 0;
+
+                if (!conf->attached) {
+                        /* breaks the reconnect chain */
+                        rpc_clnt_disconnect (rpc);
+                        break;
+                }
+
+                /* the port only lasts for one connect */
+                config.remote_port = conf->brick_port;
+                rpc_clnt_reconfig (rpc, &config);
+                break;
+
+        default:
+                break;
+        }
+
+out:
+        return 0;
+}
+
+
 int
 client_rpc_notify (struct rpc_clnt *rpc, void *mydata, rpc_clnt_event_t event,
                    void *data)
@@ -2069,6 +2404,8 @@ client_rpc_notify (struct rpc_clnt *rpc, void *mydata, rpc_clnt_event_t event,
                 break;
         }
         case RPC_CLNT_DISCONNECT:
+                client_stripes_stop (this);
+
                 if (!conf->lk_heal)
                         client_mark_fd_bad (this);
                 else
@@ -2141,6 +2478,7 @@ int
 notify (xlator_t *this, int32_t event, void *data, ...)
 {
         clnt_conf_t     *conf  = NULL;
+        int              i     = 0;
 
         conf = this->private;
         if (!conf)
@@ -2169,6 +2507,8 @@ notify (xlator_t *this, int32_t event, void *data, ...)
                 pthread_mutex_unlock (&conf->lock);
 
                 rpc_clnt_disable (conf->rpc);
+                for (i = 0; i < conf->transport_count - 1; i++)
+                        rpc_clnt_disable (conf->stripes[i].rpc);
                 break;
 
         default:
@@ -2242,6 +2582,8 @@ build_client_config (xlator_t *this, clnt_conf_t *conf)
 
         GF_OPTION_INIT ("send-gids", conf->send_gids, bool, out);
 
+        GF_OPTION_INIT ("transport-count", conf->transport_count, int32, out);
+
         conf->client_id = glusterfs_leaf_position(this);
 
         ret = client_check_remote_host (this, this->options);
@@ -2273,6 +2615,76 @@ mem_acct_init (xlator_t *this)
         return ret;
 }
 
+static int
+client_init_stripes (xlator_t *this)
+{
+        clnt_conf_t     *conf     = NULL;
+        struct rpc_clnt *rpc      = NULL;
+        char             name[64] = {0, };
+        int              ret      = -1;
+        int              i        = 0;
+
+        conf = this->private;
+
+        if (!conf->stripes) {
+                conf->stripes = GF_CALLOC (conf->transport_count - 1,
+                                           sizeof (*conf->stripes),
+                                           gf_client_mt_clnt_stripe_t);
+                if (!conf->stripes)
+                        goto out;
+        }
+
+        for (i = 0; i < conf->transport_count - 1; i++) {
+                snprintf (name, sizeof (name), "%s.%d", this->name, i + 1);
+
+                rpc = rpc_clnt_new (this->options, this->ctx, name, 0);
+                if (!rpc) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "failed to initialize RPC %s", name);
+                        goto out;
+                }
+                conf->stripes[i].rpc = rpc;
+
+                ret = rpc_clnt_register_notify (rpc, client_stripe_rpc_notify,
+                                                this);
+                if (ret)
+                        goto out;
+
+                /* upcalls come over whichever connection the brick finds
+                   first */
+                ret = rpcclnt_cbk_program_register (rpc, &gluster_cbk_prog,
+                                                    this);
+                if (ret)
+                        goto out;
+        }
+
+        ret = 0;
+out:
+        return ret;
+}
+
+static void
+client_destroy_stripes (xlator_t *this)
+{
+        clnt_conf_t *conf = NULL;
+        int          i    = 0;
+
+        conf = this->private;
+        if (!conf->stripes)
+                return;
+
+        for (i = 0; i < conf->transport_count - 1; i++) {
+                if (!conf->stripes[i].rpc)
+                        continue;
+
+                conf->stripes[i].attached = 0;
+                rpc_clnt_disable (conf->stripes[i].rpc);
+                rpc_clnt_connection_cleanup (&conf->stripes[i].rpc->conn);
+                rpc_clnt_unref (conf->stripes[i].rpc);
+                conf->stripes[i].rpc = NULL;
+        }
+}
+
 int
 client_destroy_rpc (xlator_t *this)
 {
@@ -2284,6 +2696,8 @@ client_destroy_rpc (xlator_t *this)
                 goto out;
 
         if (conf->rpc) {
+                client_destroy_stripes (this);
+
                 /* cleanup the saved-frames before last unref */
                 rpc_clnt_connection_cleanup (&conf->rpc->conn);
 
@@ -2302,6 +2716,60 @@ out:
         return ret;
 }
 
+/* Volfiles are the same on every node, so whether the brick is local can
+ * only be known here: glusterd gives us the path of the brick's shm socket
+ * and we use it if a brick listens on it on this node. A brick that was
+ * killed leaves its socket behind, so only connecting to it tells. */
+static int
+client_select_shm (xlator_t *this)
+{
+        clnt_conf_t        *conf  = NULL;
+        char               *path  = NULL;
+        struct sockaddr_un  addr  = {0, };
+        int                 sock  = -1;
+        int                 ret   = 0;
+
+        conf = this->private;
+
+        ret = dict_get_str (this->options, "transport.shm.connect-path",
+                            &path);
+        if (ret || !path)
+                return 0;
+
+        if (strlen (path) >= sizeof (addr.sun_path))
+                return 0;
+
+        addr.sun_family = AF_UNIX;
+        strcpy (addr.sun_path, path);
+
+        sock = socket (AF_UNIX, SOCK_STREAM, 0);
+        if (sock == -1)
+                return 0;
+
+        ret = connect (sock, (struct sockaddr *)&addr, sizeof (addr));
+        close (sock);
+        if (ret) {
+                if (errno != ENOENT)
+                        gf_log (this->name, GF_LOG_INFO, "not using shm "
+                                "transport over %s (%s)", path,
+                                strerror (errno));
+                return 0;
+        }
+
+        ret = dict_set_str (this->options, "transport-type", "shm");
+        if (ret)
+                return ret;
+
+        conf->shm = _gf_true;
+        /* one ring pair already carries more than a tcp connection */
+        conf->transport_count = 1;
+
+        gf_log (this->name, GF_LOG_INFO, "brick is local, using shm "
+                "transport over %s", path);
+
+        return 0;
+}
+
 int
 client_init_rpc (xlator_t *this)
 {
@@ -2317,6 +2785,14 @@ client_init_rpc (xlator_t *this)
                 goto out;
         }
 
+        ret = client_select_shm (this);
+        if (ret) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "failed to select the shm transport");
+                goto out;
+        }
+
+        ret = -1;
         conf->rpc = rpc_clnt_new (this->options, this->ctx, this->name, 0);
         if (!conf->rpc) {
                 gf_log (this->name, GF_LOG_ERROR, "failed to initialize RPC");
@@ -2340,6 +2816,15 @@ client_init_rpc (xlator_t *this)
                 goto out;
         }
 
+        if (conf->transport_count > 1) {
+                ret = client_init_stripes (this);
+                if (ret) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "failed to initialize the extra transports");
+                        goto out;
+                }
+        }
+
         ret = 0;
 
         gf_log (this->name, GF_LOG_DEBUG, "client init successful");
@@ -2563,6 +3048,7 @@ fini (xlator_t *this)
                 return;
 
         conf->destroy = 1;
+        client_destroy_stripes (this);
         if (conf->rpc) {
                 /* cleanup the saved-frames before last unref */
                 rpc_clnt_connection_cleanup (&conf->rpc->conn);
@@ -2673,6 +3159,32 @@ client_priv_dump (xlator_t *this)
                                     conn->pingcnt);
                 gf_proc_dump_write("msgs_sent", "%"PRIu64,
                                     conn->msgcnt);
+                gf_proc_dump_write("total_msgs_written", "%"PRIu64,
+                                   conn->trans->total_msgs_write);
+                gf_proc_dump_write("write_calls_per_msg", "%.2f",
+                                   conn->trans->total_msgs_write
+                                   ? (double)conn->trans->total_write_calls
+                                     / conn->trans->total_msgs_write
+                                   : 0.0);
+        }
+
+        gf_proc_dump_write ("compound_fops", "%d", conf->compound_fops);
+        gf_proc_dump_write ("compound_sent", "%"PRIu64, conf->compound_sent);
+        gf_proc_dump_write ("shm", "%d", conf->shm);
+        gf_proc_dump_write ("transport_count", "%d", conf->transport_count);
+        for (i = 0; conf->stripes && i < conf->transport_count - 1; i++) {
+                if (!conf->stripes[i].rpc ||
+                    !conf->stripes[i].rpc->conn.trans)
+                        continue;
+                conn = &conf->stripes[i].rpc->conn;
+                sprintf (key, "stripe.%d.attached", i + 1);
+                gf_proc_dump_write (key, "%d", conf->stripes[i].attached);
+                sprintf (key, "stripe.%d.total_bytes_read", i + 1);
+                gf_proc_dump_write (key, "%"PRIu64,
+                                    conn->trans->total_bytes_read);
+                sprintf (key, "stripe.%d.total_bytes_written", i + 1);
+                gf_proc_dump_write (key, "%"PRIu64,
+                                    conn->trans->total_bytes_write);
         }
         pthread_mutex_unlock(&conf->lock);
 
@@ -2750,6 +3262,8 @@ struct xlator_fops fops = {
         .zerofill    = client_zerofill,
         .getspec     = client_getspec,
         .ipc         = client_ipc,
+        .seek        = client_seek,
+        .compound    = client_compound,
 };
 
 
@@ -2768,7 +3282,7 @@ struct volume_options options[] = {
         },
         { .key   = {"transport-type"},
           .value = {"tcp", "socket", "ib-verbs", "unix", "ib-sdp",
-                    "tcp/client", "ib-verbs/client", "rdma"},
+                    "tcp/client", "ib-verbs/client", "rdma", "shm"},
           .type  = GF_OPTION_TYPE_STR
         },
         { .key   = {"remote-host"},
@@ -2836,6 +3350,23 @@ struct volume_options options[] = {
           .type  = GF_OPTION_TYPE_BOOL,
           .default_value = "on",
         },
+        { .key   = {"transport.shm.connect-path"},
+          .type  = GF_OPTION_TYPE_PATH,
+          .description = "Socket of the brick's shm transport. If it exists "
+                         "on this node the client talks to the brick over "
+                         "shared memory instead of tcp."
+        },
+        { .key   = {"transport-count"},
+          .type  = GF_OPTION_TYPE_INT,
+          .min   = 1,
+          .max   = CLIENT_MAX_TRANSPORTS,
+          .default_value = "1",
+          .description = "Number of connections to the brick. Reads and "
+                         "writes are spread over all of them, everything else "
+                         "goes over the first one. Only useful with at least "
+                         "as many event-threads. Takes effect on the next "
+                         "mount."
+        },
         { .key   = {"event-threads"},
           .type  = GF_OPTION_TYPE_INT,
           .min   = 1,
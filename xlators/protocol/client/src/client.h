@@ -28,6 +28,7 @@
 #define CLIENT_DUMP_LOCKS     "trusted.glusterfs.clientlk-dump"
 #define GF_MAX_SOCKET_WINDOW_SIZE  (1 * GF_UNIT_MB)
 #define GF_MIN_SOCKET_WINDOW_SIZE  (0)
+#define CLIENT_MAX_TRANSPORTS      16
 
 typedef enum {
         GF_LK_HEAL_IN_PROGRESS,
@@ -66,6 +67,14 @@ typedef enum {
         } while (0)
 
 
+/* An extra connection to the brick (option transport-count). It binds to
+ * the same client on the brick as the main connection, so fds and locks
+ * opened over one are valid over all of them. */
+typedef struct clnt_stripe {
+        struct rpc_clnt       *rpc;
+        int                    attached; /* SETVOLUME done on it */
+} clnt_stripe_t;
+
 struct clnt_options {
         char *remote_subvolume;
         int   ping_timeout;
@@ -132,6 +141,18 @@ typedef struct clnt_conf {
 
         gf_boolean_t           destroy; /* if enabled implies fini was called
                                          * on @this xlator instance */
+
+        int32_t                transport_count;
+        clnt_stripe_t         *stripes; /* transport_count - 1 of them, only
+                                           used while the main connection is
+                                           attached */
+        uint32_t               next_stripe;
+        int                    attached; /* SETVOLUME done on conf->rpc */
+        gf_boolean_t           shm; /* brick is on this node, talking to it
+                                       over the shm transport */
+        int                    brick_port; /* from the portmap query */
+        gf_boolean_t           compound_fops; /* brick has GFS3_OP_COMPOUND */
+        uint64_t               compound_sent;
 } clnt_conf_t;
 
 typedef struct _client_fd_ctx {
@@ -163,6 +184,21 @@ typedef struct _client_posix_lock {
         struct list_head   list;          /* reference used to add to the fdctx list of locks */
 } client_posix_lock_t;
 
+/* What a read or write sent over a stripe needs to be sent again over the
+ * main connection, should the stripe go down before it is answered. */
+typedef struct clnt_stripe_retry {
+        rpc_clnt_prog_t     *prog;
+        int                  procnum;
+        fop_cbk_fn_t         cbkfn;
+        struct iovec         hdr;
+        struct iovec        *payload;
+        int                  payloadcnt;
+        struct iobref       *iobref;
+        struct iovec        *rsp_payload;
+        int                  rsp_payload_count;
+        struct iobref       *rsp_iobref;
+} clnt_stripe_retry_t;
+
 typedef struct client_local {
         loc_t                loc;
         loc_t                loc2;
@@ -178,6 +214,8 @@ typedef struct client_local {
         pthread_mutex_t      mutex;
         char                *name;
         gf_boolean_t         attempt_reopen;
+        compound_args_t     *compound_args;
+        clnt_stripe_retry_t *stripe_retry;
 } clnt_local_t;
 
 typedef struct client_args {
@@ -206,6 +244,8 @@ typedef struct client_args {
         entrylk_cmd         cmd_entrylk;
         entrylk_type        type;
         gf_xattrop_flags_t  optype;
+        gf_seek_what_t      what;
+        compound_args_t    *compound_args;
         int32_t             valid;
         int32_t             len;
 
@@ -221,6 +261,13 @@ void this_fd_set_ctx (fd_t *file, xlator_t *this, loc_t *loc,
                       clnt_fd_ctx_t *ctx);
 
 int client_local_wipe (clnt_local_t *local);
+int client_submit_request_on (xlator_t *this, struct rpc_clnt *rpc,
+                              void *req, call_frame_t *frame,
+                              rpc_clnt_prog_t *prog, int procnum,
+                              fop_cbk_fn_t cbk, struct iobref *iobref,
+                              struct iovec *rsphdr, int rsphdr_count,
+                              struct iovec *rsp_payload, int rsp_count,
+                              struct iobref *rsp_iobref, xdrproc_t xdrproc);
 int client_submit_request (xlator_t *this, void *req,
                            call_frame_t *frame, rpc_clnt_prog_t *prog,
                            int procnum, fop_cbk_fn_t cbk,
@@ -269,4 +316,19 @@ gf_boolean_t
 __is_fd_reopen_in_progress (clnt_fd_ctx_t *fdctx);
 int
 client_notify_dispatch (xlator_t *this, int32_t event, void *data, ...);
+struct rpc_clnt *
+client_pick_rpc (clnt_conf_t *conf, rpc_clnt_prog_t *prog, int procnum);
+clnt_stripe_t *
+client_stripe_get (clnt_conf_t *conf, struct rpc_clnt *rpc);
+int
+client_rpc_submit (xlator_t *this, struct rpc_clnt *rpc, call_frame_t *frame,
+                   rpc_clnt_prog_t *prog, int procnum, fop_cbk_fn_t cbkfn,
+                   struct iovec *hdr, int hdrcount, struct iovec *payload,
+                   int payloadcnt, struct iobref *iobref, struct iovec *rsphdr,
+                   int rsphdr_count, struct iovec *rsp_payload,
+                   int rsp_payload_count, struct iobref *rsp_iobref);
+void
+client_stripes_start (xlator_t *this);
+int
+client_setvolume (xlator_t *this, struct rpc_clnt *rpc);
 #endif /* !_CLIENT_H */
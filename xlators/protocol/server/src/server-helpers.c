@@ -16,6 +16,7 @@
 #include "server.h"
 #include "server-helpers.h"
 #include "gidcache.h"
+#include "compound-fop-utils.h"
 
 #include <fnmatch.h>
 #include <pwd.h>
@@ -218,6 +219,11 @@ free_state (server_state_t *state)
                 state->xdata = NULL;
         }
 
+        if (state->compound) {
+                compound_args_destroy (state->compound);
+                state->compound = NULL;
+        }
+
         GF_FREE ((void *)state->volume);
 
         GF_FREE ((void *)state->name);
@@ -22,6 +22,7 @@
 #include "glusterfs3-xdr.h"
 #include "glusterfs3.h"
 #include "compat-errno.h"
+#include "compound-fop-utils.h"
 
 #include "xdr-nfs3.h"
 
@@ -2063,6 +2064,180 @@ out:
 }
 
 
+int
+server_seek_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                 int32_t op_ret, int32_t op_errno, off_t offset,
+                 dict_t *xdata)
+{
+        gfs3_seek_rsp      rsp    = {0,};
+        server_state_t    *state  = NULL;
+        rpcsvc_request_t  *req    = NULL;
+
+        req = frame->local;
+        state  = CALL_STATE (frame);
+
+        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, (&rsp.xdata.xdata_val),
+                                    rsp.xdata.xdata_len, op_errno, out);
+
+        if (op_ret) {
+                gf_log (this->name,
+                        (op_errno == ENXIO) ? GF_LOG_DEBUG : GF_LOG_INFO,
+                        "%"PRId64": SEEK%"PRId64" (%s) ==> (%s)",
+                        frame->root->unique, state->resolve.fd_no,
+                        uuid_utoa (state->resolve.gfid),
+                        strerror (op_errno));
+                goto out;
+        }
+
+        rsp.offset = offset;
+
+out:
+        rsp.op_ret    = op_ret;
+        rsp.op_errno  = gf_errno_to_error (op_errno);
+
+        server_submit_reply(frame, req, &rsp, NULL, 0, NULL,
+                            (xdrproc_t) xdr_gfs3_seek_rsp);
+
+        GF_FREE (rsp.xdata.xdata_val);
+
+        return 0;
+}
+
+
+static void
+server_compound_rsp_cleanup (gfs3_compound_rsp *rsp)
+{
+        compound_rsp *entry = NULL;
+        int           i     = 0;
+
+        if (!rsp->compound_rsp_array.compound_rsp_array_val)
+                return;
+
+        for (i = 0; i < rsp->compound_rsp_array.compound_rsp_array_len; i++) {
+                entry = &rsp->compound_rsp_array.compound_rsp_array_val[i];
+
+                switch (entry->fop_enum) {
+                case GFS3_COMPOUND_WRITE:
+                        GF_FREE (entry->compound_rsp_u.compound_write_rsp.xdata.xdata_val);
+                        break;
+                case GFS3_COMPOUND_FXATTROP:
+                        GF_FREE (entry->compound_rsp_u.compound_fxattrop_rsp.dict.dict_val);
+                        GF_FREE (entry->compound_rsp_u.compound_fxattrop_rsp.xdata.xdata_val);
+                        break;
+                }
+        }
+
+        GF_FREE (rsp->compound_rsp_array.compound_rsp_array_val);
+        rsp->compound_rsp_array.compound_rsp_array_val = NULL;
+        rsp->compound_rsp_array.compound_rsp_array_len = 0;
+}
+
+
+/* One reply goes back for every fop that was run. */
+int
+server_compound_cbk (call_frame_t *frame, void *cookie, xlator_t *this,
+                     int32_t op_ret, int32_t op_errno, compound_args_t *args,
+                     dict_t *xdata)
+{
+        gfs3_compound_rsp   rsp      = {0,};
+        compound_rsp       *entry    = NULL;
+        compound_rsp_t     *c_rsp    = NULL;
+        gfs3_write_rsp     *write    = NULL;
+        gfs3_fxattrop_rsp  *fxattrop = NULL;
+        server_state_t     *state    = NULL;
+        rpcsvc_request_t   *req      = NULL;
+        int                 i        = 0;
+
+        req = frame->local;
+        state = CALL_STATE (frame);
+
+        GF_PROTOCOL_DICT_SERIALIZE (this, xdata, &rsp.xdata.xdata_val,
+                                    rsp.xdata.xdata_len, op_errno, out);
+
+        if (op_ret < 0) {
+                gf_log (this->name, GF_LOG_INFO,
+                        "%"PRId64": COMPOUND %"PRId64" (%s) ==> (%s)",
+                        frame->root->unique, state->resolve.fd_no,
+                        uuid_utoa (state->resolve.gfid),
+                        strerror (op_errno));
+        }
+
+        if (!args || !args->done)
+                goto out;
+
+        rsp.compound_rsp_array.compound_rsp_array_val =
+                GF_CALLOC (args->done, sizeof (compound_rsp),
+                           gf_server_mt_compound_rsp_t);
+        if (!rsp.compound_rsp_array.compound_rsp_array_val) {
+                op_ret = -1;
+                op_errno = ENOMEM;
+                goto out;
+        }
+        rsp.compound_rsp_array.compound_rsp_array_len = args->done;
+
+        for (i = 0; i < args->done; i++) {
+                entry = &rsp.compound_rsp_array.compound_rsp_array_val[i];
+                c_rsp = &args->rsp[i];
+
+                switch (args->req[i].fop) {
+                case GF_FOP_WRITE:
+                        entry->fop_enum = GFS3_COMPOUND_WRITE;
+                        write = &entry->compound_rsp_u.compound_write_rsp;
+                        write->op_ret = c_rsp->op_ret;
+                        write->op_errno = gf_errno_to_error (c_rsp->op_errno);
+                        if (c_rsp->op_ret >= 0) {
+                                gf_stat_from_iatt (&write->prestat,
+                                                   &c_rsp->prestat);
+                                gf_stat_from_iatt (&write->poststat,
+                                                   &c_rsp->poststat);
+                        }
+
+                        GF_PROTOCOL_DICT_SERIALIZE (this, c_rsp->xdata,
+                                                    &write->xdata.xdata_val,
+                                                    write->xdata.xdata_len,
+                                                    op_errno, fail);
+                        break;
+                case GF_FOP_FXATTROP:
+                        entry->fop_enum = GFS3_COMPOUND_FXATTROP;
+                        fxattrop = &entry->compound_rsp_u.compound_fxattrop_rsp;
+                        fxattrop->op_ret = c_rsp->op_ret;
+                        fxattrop->op_errno =
+                                gf_errno_to_error (c_rsp->op_errno);
+
+                        GF_PROTOCOL_DICT_SERIALIZE (this, c_rsp->xattr,
+                                                    &fxattrop->dict.dict_val,
+                                                    fxattrop->dict.dict_len,
+                                                    op_errno, fail);
+
+                        GF_PROTOCOL_DICT_SERIALIZE (this, c_rsp->xdata,
+                                                    &fxattrop->xdata.xdata_val,
+                                                    fxattrop->xdata.xdata_len,
+                                                    op_errno, fail);
+                        break;
+                default:
+                        op_errno = EINVAL;
+                        goto fail;
+                }
+        }
+
+        goto out;
+fail:
+        server_compound_rsp_cleanup (&rsp);
+        op_ret = -1;
+out:
+        rsp.op_ret    = op_ret;
+        rsp.op_errno  = gf_errno_to_error (op_errno);
+
+        server_submit_reply (frame, req, &rsp, NULL, 0, NULL,
+                             (xdrproc_t) xdr_gfs3_compound_rsp);
+
+        server_compound_rsp_cleanup (&rsp);
+        GF_FREE (rsp.xdata.xdata_val);
+
+        return 0;
+}
+
+
 /* Resume function section */
 
 int
@@ -3110,6 +3285,56 @@ err:
         return 0;
 }
 
+int
+server_seek_resume (call_frame_t *frame, xlator_t *bound_xl)
+{
+        server_state_t *state = NULL;
+
+        state = CALL_STATE (frame);
+
+        if (state->resolve.op_ret != 0)
+                goto err;
+
+        STACK_WIND (frame, server_seek_cbk,
+                    bound_xl, bound_xl->fops->seek,
+                    state->fd, state->offset, state->what, state->xdata);
+        return 0;
+err:
+        server_seek_cbk (frame, NULL, frame->this, state->resolve.op_ret,
+                         state->resolve.op_errno, 0, NULL);
+
+        return 0;
+}
+
+/* The fops of the compound go one by one through the graph of the brick,
+ * so every xlator of it sees them as plain fops. */
+int
+server_compound_resume (call_frame_t *frame, xlator_t *bound_xl)
+{
+        server_state_t *state = NULL;
+        int             i     = 0;
+
+        state = CALL_STATE (frame);
+
+        if (state->resolve.op_ret != 0)
+                goto err;
+
+        for (i = 0; i < state->compound->count; i++)
+                state->compound->req[i].fd = fd_ref (state->fd);
+
+        STACK_WIND (frame, server_compound_cbk,
+                    bound_xl, bound_xl->fops->compound,
+                    state->compound, state->xdata);
+        return 0;
+err:
+        state->compound->done = 0;
+        compound_args_cancel (state->compound, state->resolve.op_errno);
+        server_compound_cbk (frame, NULL, frame->this, state->resolve.op_ret,
+                             state->resolve.op_errno, state->compound, NULL);
+
+        return 0;
+}
+
 
 
 /* Fop section */
@@ -3152,11 +3377,10 @@ server3_3_stat (rpcsvc_request_t *req)
         state->resolve.type  = RESOLVE_MUST;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
 
         ret = 0;
@@ -3213,11 +3437,10 @@ server3_3_setattr (rpcsvc_request_t *req)
         gf_stat_to_iatt (&args.stbuf, &state->stbuf);
         state->valid = args.valid;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_setattr_resume);
@@ -3272,11 +3495,10 @@ server3_3_fsetattr (rpcsvc_request_t *req)
         gf_stat_to_iatt (&args.stbuf, &state->stbuf);
         state->valid = args.valid;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsetattr_resume);
@@ -3333,11 +3555,10 @@ server3_3_fallocate(rpcsvc_request_t *req)
         state->size = args.size;
         memcpy(state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fallocate_resume);
@@ -3394,11 +3615,10 @@ server3_3_discard(rpcsvc_request_t *req)
         state->size = args.size;
         memcpy(state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_discard_resume);
@@ -3455,10 +3675,11 @@ server3_3_zerofill(rpcsvc_request_t *req)
         state->size = args.size;
         memcpy(state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl, state->xdata,
-                                      (args.xdata.xdata_val),
-                                      (args.xdata.xdata_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata,
+                                            (args.xdata.xdata_val),
+                                            (args.xdata.xdata_len), ret,
+                                            op_errno, out);
 
         ret = 0;
         resolve_and_resume (frame, server_zerofill_resume);
@@ -3508,10 +3729,10 @@ server3_3_ipc (rpcsvc_request_t *req)
                 goto out;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (bound_xl, xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len,
-                                      ret, op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (bound_xl, xdata,
+                                            args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         STACK_WIND (frame, server_ipc_cbk, bound_xl, bound_xl->fops->ipc,
@@ -3529,6 +3750,234 @@ out:
         return ret;
 }
 
+int
+server3_3_seek (rpcsvc_request_t *req)
+{
+        server_state_t       *state      = NULL;
+        call_frame_t         *frame      = NULL;
+        gfs3_seek_req         args       = {{0},};
+        int                   ret        = -1;
+        int                   op_errno   = 0;
+
+        if (!req)
+                return ret;
+
+        ret = xdr_to_generic (req->msg[0], &args,
+                              (xdrproc_t)xdr_gfs3_seek_req);
+        if (ret < 0) {
+                /*failed to decode msg*/;
+                req->rpc_err = GARBAGE_ARGS;
+                goto out;
+        }
+
+        frame = get_frame_from_request (req);
+        if (!frame) {
+                /* something wrong, mostly insufficient memory*/
+                req->rpc_err = GARBAGE_ARGS; /* TODO */
+                goto out;
+        }
+        frame->root->op = GF_FOP_SEEK;
+
+        state = CALL_STATE (frame);
+        if (!frame->root->client->bound_xl) {
+                /* auth failure, request on subvolume without setvolume */
+                req->rpc_err = GARBAGE_ARGS;
+                goto out;
+        }
+
+        state->resolve.type   = RESOLVE_MUST;
+        state->resolve.fd_no  = args.fd;
+
+        state->offset = args.offset;
+        state->what = args.what;
+        memcpy(state->resolve.gfid, args.gfid, 16);
+
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata,
+                                            (args.xdata.xdata_val),
+                                            (args.xdata.xdata_len), ret,
+                                            op_errno, out);
+
+        ret = 0;
+        resolve_and_resume (frame, server_seek_resume);
+
+out:
+        free (args.xdata.xdata_val);
+
+        if (op_errno)
+                req->rpc_err = GARBAGE_ARGS;
+
+        return ret;
+}
+
+/* Every fop of the compound must be on the fd of the first one. */
+static int
+server_compound_fill (rpcsvc_request_t *req, call_frame_t *frame,
+                      gfs3_compound_req *args, ssize_t len)
+{
+        server_state_t     *state    = NULL;
+        xlator_t           *bound_xl = NULL;
+        compound_req       *entry    = NULL;
+        compound_req_t     *c_req    = NULL;
+        gfs3_write_req     *write    = NULL;
+        gfs3_fxattrop_req  *fxattrop = NULL;
+        int64_t             fd_no    = -1;
+        char               *gfid     = NULL;
+        int                 writes   = 0;
+        int                 ret      = 0;
+        int                 op_errno = 0;
+        int                 i        = 0;
+        int                 j        = 0;
+
+        state = CALL_STATE (frame);
+        bound_xl = frame->root->client->bound_xl;
+
+        state->compound =
+                compound_args_new (args->compound_req_array.compound_req_array_len);
+        if (!state->compound)
+                return -1;
+
+        for (i = 0; i < state->compound->count; i++) {
+                entry = &args->compound_req_array.compound_req_array_val[i];
+                c_req = &state->compound->req[i];
+
+                switch (entry->fop_enum) {
+                case GFS3_COMPOUND_WRITE:
+                        if (writes++)
+                                return -1;
+
+                        write = &entry->compound_req_u.compound_write_req;
+                        fd_no = write->fd;
+                        gfid = write->gfid;
+
+                        c_req->fop = GF_FOP_WRITE;
+                        c_req->offset = write->offset;
+                        c_req->flags = write->flag;
+                        c_req->iobref = iobref_ref (req->iobref);
+
+                        /* the data follows the request */
+                        if (len < req->msg[0].iov_len) {
+                                state->payload_vector[0].iov_base
+                                        = (req->msg[0].iov_base + len);
+                                state->payload_vector[0].iov_len
+                                        = req->msg[0].iov_len - len;
+                                state->payload_count = 1;
+                        }
+                        for (j = 1; j < req->count; j++) {
+                                state->payload_vector[state->payload_count++]
+                                        = req->msg[j];
+                        }
+
+                        if (state->payload_count) {
+                                c_req->vector = iov_dup (state->payload_vector,
+                                                         state->payload_count);
+                                if (!c_req->vector)
+                                        return -1;
+                                c_req->count = state->payload_count;
+                        }
+
+                        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (bound_xl,
+                                                c_req->xdata,
+                                                (write->xdata.xdata_val),
+                                                (write->xdata.xdata_len),
+                                                ret, op_errno, out);
+                        break;
+                case GFS3_COMPOUND_FXATTROP:
+                        fxattrop = &entry->compound_req_u.compound_fxattrop_req;
+                        fd_no = fxattrop->fd;
+                        gfid = fxattrop->gfid;
+
+                        c_req->fop = GF_FOP_FXATTROP;
+                        c_req->optype = fxattrop->flags;
+
+                        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (bound_xl,
+                                                c_req->xattr,
+                                                (fxattrop->dict.dict_val),
+                                                (fxattrop->dict.dict_len),
+                                                ret, op_errno, out);
+
+                        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (bound_xl,
+                                                c_req->xdata,
+                                                (fxattrop->xdata.xdata_val),
+                                                (fxattrop->xdata.xdata_len),
+                                                ret, op_errno, out);
+                        break;
+                default:
+                        return -1;
+                }
+
+                if (i == 0) {
+                        state->resolve.fd_no = fd_no;
+                        memcpy (state->resolve.gfid, gfid, 16);
+                } else if ((fd_no != state->resolve.fd_no) ||
+                           memcmp (state->resolve.gfid, gfid, 16)) {
+                        return -1;
+                }
+        }
+out:
+        return op_errno ? -1 : 0;
+}
+
+int
+server3_3_compound (rpcsvc_request_t *req)
+{
+        server_state_t      *state    = NULL;
+        call_frame_t        *frame    = NULL;
+        gfs3_compound_req    args     = {{0,},};
+        ssize_t              len      = 0;
+        int                  ret      = -1;
+        int                  op_errno = 0;
+
+        if (!req)
+                return ret;
+
+        len = xdr_to_generic (req->msg[0], &args,
+                              (xdrproc_t)xdr_gfs3_compound_req);
+        if ((len < 0) || !args.compound_req_array.compound_req_array_len) {
+                //failed to decode msg;
+                SERVER_REQ_SET_ERROR (req, ret);
+                goto out;
+        }
+
+        frame = get_frame_from_request (req);
+        if (!frame) {
+                // something wrong, mostly insufficient memory
+                SERVER_REQ_SET_ERROR (req, ret);
+                goto out;
+        }
+        frame->root->op = GF_FOP_COMPOUND;
+
+        state = CALL_STATE (frame);
+        if (!frame->root->client->bound_xl) {
+                /* auth failure, request on subvolume without setvolume */
+                SERVER_REQ_SET_ERROR (req, ret);
+                goto out;
+        }
+
+        state->resolve.type = RESOLVE_MUST;
+
+        if (server_compound_fill (req, frame, &args, len)) {
+                SERVER_REQ_SET_ERROR (req, ret);
+                goto out;
+        }
+
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata,
+                                            (args.xdata.xdata_val),
+                                            (args.xdata.xdata_len), ret,
+                                            op_errno, out);
+
+        ret = 0;
+        resolve_and_resume (frame, server_compound_resume);
+out:
+        xdr_free ((xdrproc_t)xdr_gfs3_compound_req, (char *)&args);
+
+        if (op_errno)
+                SERVER_REQ_SET_ERROR (req, ret);
+
+        return ret;
+}
+
 int
 server3_3_readlink (rpcsvc_request_t *req)
 {
@@ -3569,11 +4018,10 @@ server3_3_readlink (rpcsvc_request_t *req)
 
         state->size  = args.size;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_readlink_resume);
@@ -3639,11 +4087,10 @@ server3_3_create (rpcsvc_request_t *req)
         }
 
         /* TODO: can do alloca for xdata field instead of stdalloc */
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_create_resume);
@@ -3698,11 +4145,10 @@ server3_3_open (rpcsvc_request_t *req)
 
         state->flags = gf_flags_to_flags (args.flags);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_open_resume);
@@ -3758,11 +4204,10 @@ server3_3_readv (rpcsvc_request_t *req)
 
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_readv_resume);
@@ -3839,11 +4284,10 @@ server3_3_writev (rpcsvc_request_t *req)
                 state->size += state->payload_vector[i].iov_len;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
 #ifdef GF_TESTING_IO_XDATA
         dict_dump_to_log (state->xdata);
@@ -4042,11 +4486,10 @@ server3_3_fsync (rpcsvc_request_t *req)
         state->flags         = args.data;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsync_resume);
@@ -4100,11 +4543,10 @@ server3_3_flush (rpcsvc_request_t *req)
         state->resolve.fd_no = args.fd;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_flush_resume);
@@ -4159,11 +4601,10 @@ server3_3_ftruncate (rpcsvc_request_t *req)
         state->offset         = args.offset;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_ftruncate_resume);
@@ -4216,11 +4657,10 @@ server3_3_fstat (rpcsvc_request_t *req)
         state->resolve.fd_no   = args.fd;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fstat_resume);
@@ -4273,11 +4713,10 @@ server3_3_truncate (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->offset        = args.offset;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_truncate_resume);
@@ -4335,11 +4774,10 @@ server3_3_unlink (rpcsvc_request_t *req)
 
         state->flags = args.xflags;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_unlink_resume);
@@ -4406,11 +4844,10 @@ server3_3_setxattr (rpcsvc_request_t *req)
         /* There can be some commands hidden in key, check and proceed */
         gf_server_check_setxattr_cmd (frame, dict);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_setxattr_resume);
@@ -4482,11 +4919,10 @@ server3_3_fsetxattr (rpcsvc_request_t *req)
 
         state->dict = dict;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsetxattr_resume);
@@ -4558,11 +4994,10 @@ server3_3_fxattrop (rpcsvc_request_t *req)
 
         state->dict = dict;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fxattrop_resume);
@@ -4634,11 +5069,10 @@ server3_3_xattrop (rpcsvc_request_t *req)
 
         state->dict = dict;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_xattrop_resume);
@@ -4705,11 +5139,10 @@ server3_3_getxattr (rpcsvc_request_t *req)
                 gf_server_check_getxattr_cmd (frame, state->name);
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_getxattr_resume);
@@ -4766,11 +5199,10 @@ server3_3_fgetxattr (rpcsvc_request_t *req)
         if (args.namelen)
                 state->name = gf_strdup (args.name);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fgetxattr_resume);
@@ -4826,11 +5258,10 @@ server3_3_removexattr (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->name           = gf_strdup (args.name);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_removexattr_resume);
@@ -4885,11 +5316,10 @@ server3_3_fremovexattr (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->name           = gf_strdup (args.name);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fremovexattr_resume);
@@ -4943,11 +5373,10 @@ server3_3_opendir (rpcsvc_request_t *req)
         state->resolve.type   = RESOLVE_MUST;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_opendir_resume);
@@ -5014,11 +5443,10 @@ server3_3_readdirp (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
 
         /* here, dict itself works as xdata */
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->dict,
-                                      (args.dict.dict_val),
-                                      (args.dict.dict_len), ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->dict, (args.dict.dict_val),
+                                            (args.dict.dict_len), ret, op_errno,
+                                            out);
 
 
         ret = 0;
@@ -5084,11 +5512,10 @@ server3_3_readdir (rpcsvc_request_t *req)
         state->offset = args.offset;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_readdir_resume);
@@ -5141,11 +5568,10 @@ server3_3_fsyncdir (rpcsvc_request_t *req)
         state->flags = args.data;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fsyncdir_resume);
@@ -5205,11 +5631,10 @@ server3_3_mknod (rpcsvc_request_t *req)
         state->dev   = args.dev;
         state->umask = args.umask;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_mknod_resume);
@@ -5271,11 +5696,10 @@ server3_3_mkdir (rpcsvc_request_t *req)
         state->umask = args.umask;
 
         /* TODO: can do alloca for xdata field instead of stdalloc */
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_mkdir_resume);
@@ -5333,11 +5757,10 @@ server3_3_rmdir (rpcsvc_request_t *req)
 
         state->flags = args.xflags;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_rmdir_resume);
@@ -5423,11 +5846,10 @@ server3_3_inodelk (rpcsvc_request_t *req)
                 break;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_inodelk_resume);
@@ -5512,11 +5934,10 @@ server3_3_finodelk (rpcsvc_request_t *req)
                 break;
         }
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_finodelk_resume);
@@ -5580,11 +6001,10 @@ server3_3_entrylk (rpcsvc_request_t *req)
         state->cmd            = args.cmd;
         state->type           = args.type;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_entrylk_resume);
@@ -5645,11 +6065,10 @@ server3_3_fentrylk (rpcsvc_request_t *req)
                 state->name = gf_strdup (args.name);
         state->volume = gf_strdup (args.volume);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_fentrylk_resume);
@@ -5701,11 +6120,10 @@ server3_3_access (rpcsvc_request_t *req)
         memcpy (state->resolve.gfid, args.gfid, 16);
         state->mask          = args.mask;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_access_resume);
@@ -5764,11 +6182,10 @@ server3_3_symlink (rpcsvc_request_t *req)
         state->name           = gf_strdup (args.linkname);
         state->umask          = args.umask;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_symlink_resume);
@@ -5828,11 +6245,10 @@ server3_3_link (rpcsvc_request_t *req)
         state->resolve2.bname  = gf_strdup (args.newbname);
         memcpy (state->resolve2.pargfid, args.newgfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_link_resume);
@@ -5892,11 +6308,10 @@ server3_3_rename (rpcsvc_request_t *req)
         state->resolve2.bname = gf_strdup (args.newbname);
         memcpy (state->resolve2.pargfid, args.newgfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_rename_resume);
@@ -5995,11 +6410,10 @@ server3_3_lk (rpcsvc_request_t *req)
         }
 
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_lk_resume);
@@ -6055,11 +6469,10 @@ server3_3_rchecksum (rpcsvc_request_t *req)
         state->offset        = args.offset;
         state->size          = args.len;
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_rchecksum_resume);
@@ -6193,11 +6606,10 @@ server3_3_statfs (rpcsvc_request_t *req)
         state->resolve.type   = RESOLVE_MUST;
         memcpy (state->resolve.gfid, args.gfid, 16);
 
-        GF_PROTOCOL_DICT_UNSERIALIZE (frame->root->client->bound_xl,
-                                      state->xdata,
-                                      args.xdata.xdata_val,
-                                      args.xdata.xdata_len, ret,
-                                      op_errno, out);
+        GF_PROTOCOL_DICT_UNSERIALIZE_STEAL (frame->root->client->bound_xl,
+                                            state->xdata, args.xdata.xdata_val,
+                                            args.xdata.xdata_len, ret, op_errno,
+                                            out);
 
         ret = 0;
         resolve_and_resume (frame, server_statfs_resume);
@@ -6260,6 +6672,8 @@ rpcsvc_actor_t glusterfs3_3_fop_actors[GLUSTER_FOP_PROCCNT] = {
         [GFS3_OP_DISCARD]      = {"DISCARD",      GFS3_OP_DISCARD,      server3_3_discard,      NULL, 0, DRC_NA},
         [GFS3_OP_ZEROFILL]    =  {"ZEROFILL",     GFS3_OP_ZEROFILL,     server3_3_zerofill,     NULL, 0, DRC_NA},
         [GFS3_OP_IPC]         =  {"IPC",          GFS3_OP_IPC,          server3_3_ipc,          NULL, 0, DRC_NA},
+        [GFS3_OP_SEEK]        =  {"SEEK",         GFS3_OP_SEEK,         server3_3_seek,         NULL, 0, DRC_NA},
+        [GFS3_OP_COMPOUND]    =  {"COMPOUND",     GFS3_OP_COMPOUND,     server3_3_compound,     NULL, 0, DRC_NA},
 };
 
 
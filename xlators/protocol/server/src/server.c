@@ -291,6 +291,8 @@ server_priv (xlator_t *this)
         char              key[GF_DUMP_MAX_BUF_LEN] = {0,};
         uint64_t          total_read = 0;
         uint64_t          total_write = 0;
+        uint64_t          total_msgs = 0;
+        uint64_t          total_calls = 0;
         int32_t           ret  = -1;
 
         GF_VALIDATE_OR_GOTO ("server", this, out);
@@ -309,6 +311,8 @@ server_priv (xlator_t *this)
                 list_for_each_entry (xprt, &conf->xprt_list, list) {
                         total_read  += xprt->total_bytes_read;
                         total_write += xprt->total_bytes_write;
+                        total_msgs  += xprt->total_msgs_write;
+                        total_calls += xprt->total_write_calls;
                 }
         }
         pthread_mutex_unlock (&conf->mutex);
@@ -319,6 +323,13 @@ server_priv (xlator_t *this)
         gf_proc_dump_build_key(key, "server", "total-bytes-write");
         gf_proc_dump_write(key, "%"PRIu64, total_write);
 
+        gf_proc_dump_build_key(key, "server", "total-msgs-write");
+        gf_proc_dump_write(key, "%"PRIu64, total_msgs);
+
+        gf_proc_dump_build_key(key, "server", "write-calls-per-msg");
+        gf_proc_dump_write(key, "%.2f", total_msgs
+                           ? (double)total_calls / total_msgs : 0.0);
+
         ret = 0;
 out:
         if (ret)
@@ -540,6 +551,14 @@ server_rpc_notify (rpcsvc_t *rpc, void *xl, rpcsvc_event_t event,
                         gf_client_unref (client);
                         break;
                 }
+
+                /* the client's other transports still use its fds and
+                   locks, the last one to go starts the grace timer */
+                if (gf_client_put_shared (client)) {
+                        trans->xl_private = NULL;
+                        break;
+                }
+
                 trans->xl_private = NULL;
                 server_connection_cleanup (this, client, INTERNAL_LOCKS);
 
@@ -1192,7 +1211,12 @@ struct volume_options options[] = {
                     "rdma*([ \t]),*([ \t])socket",
                     "rdma*([ \t]),*([ \t])tcp",
                     "tcp*([ \t]),*([ \t])rdma",
-                    "socket*([ \t]),*([ \t])rdma"},
+                    "socket*([ \t]),*([ \t])rdma",
+                    "shm",
+                    "tcp*([ \t]),*([ \t])shm",
+                    "socket*([ \t]),*([ \t])shm",
+                    "rdma*([ \t]),*([ \t])shm",
+                    "tcp*([ \t]),*([ \t])rdma*([ \t]),*([ \t])shm"},
           .type  = GF_OPTION_TYPE_STR
         },
         { .key   = {"volume-filename.*"},
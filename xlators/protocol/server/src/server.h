@@ -148,6 +148,8 @@ struct _server_state {
 
         dict_t           *xdata;
         mode_t            umask;
+        gf_seek_what_t    what;
+        compound_args_t  *compound;
 };
 
 
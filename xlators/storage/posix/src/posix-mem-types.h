@@ -21,6 +21,8 @@ enum gf_posix_mem_types_ {
         gf_posix_mt_posix_dev_t,
         gf_posix_mt_trash_path,
 	gf_posix_mt_paiocb,
+	gf_posix_mt_uring,
+	gf_posix_mt_uring_req,
         gf_posix_mt_end
 };
 #endif
@@ -0,0 +1,1579 @@
+/*
+   Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+   This file is part of GlusterFS.
+
+   This file is licensed to you under your choice of the GNU Lesser
+   General Public License, version 3 or any later version (LGPLv3 or
+   later), or the GNU General Public License, version 2 (GPLv2), in all
+   cases as published by the Free Software Foundation.
+*/
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "xlator.h"
+#include "glusterfs.h"
+#include "statedump.h"
+#include "posix.h"
+#include "posix-aio.h"
+#include "posix-uring.h"
+
+#ifdef HAVE_IO_URING
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/sysmacros.h>
+
+/* One io_uring per posix instance.
+ *
+ * Any io-thread queues the sqes of its fop under ring->lock and wakes the
+ * submitter thread if it sleeps. The submitter enters everything pending
+ * with one io_uring_enter(), so the fops queued while it was in the kernel
+ * go in together with the next call. The kernel cancels the requests of a
+ * thread that exits, and io-threads do exit when idle, which is why they
+ * never enter sqes themselves. Another thread reaps the completions and
+ * unwinds.
+ *
+ * The stats that go with a fop are linked to it (statx before and after,
+ * fsync after an O_SYNC write) with hard links: they run in order, and a
+ * failed one does not cancel the rest. Any statx that did not work is
+ * redone with posix_fdstat().
+ *
+ * Every sqe carries the personality of the brick, registered at setup, so
+ * it does not matter which thread enters it into the kernel.
+ */
+
+struct posix_uring_req;
+
+struct posix_uring_slot {
+        struct posix_uring_req  *req;
+        int                      res;
+};
+
+struct posix_uring_req {
+        call_frame_t            *frame;
+        xlator_t                *this;
+        fd_t                    *fd;
+        int                      _fd;
+        glusterfs_fop_t          op;
+        int                      nr;
+        int                      done;
+        struct posix_uring_slot  slots[POSIX_URING_MAX_SQES];
+        int                      opslot;
+        int                      syncslot;
+        int                      preslot;
+        int                      postslot;
+        struct statx             prestx;
+        struct statx             poststx;
+        off_t                    offset;
+        size_t                   size;
+        struct iovec             iov;
+        struct iovec            *vector;
+        struct iobuf            *iobuf;
+        struct iobref           *iobref;
+        dict_t                  *xdata;
+};
+
+
+static int
+posix_uring_setup (unsigned entries, struct io_uring_params *params)
+{
+        return syscall (__NR_io_uring_setup, entries, params);
+}
+
+static int
+posix_uring_enter (int fd, unsigned to_submit, unsigned min_complete,
+                   unsigned flags)
+{
+        return syscall (__NR_io_uring_enter, fd, to_submit, min_complete,
+                        flags, NULL, 0);
+}
+
+static int
+posix_uring_register (int fd, unsigned opcode, void *arg, unsigned nr_args)
+{
+        return syscall (__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+
+static void
+posix_uring_probe (xlator_t *this, struct posix_uring *ring)
+{
+        struct io_uring_probe *probe = NULL;
+        int                    nr    = 256;
+        int                    ret   = -1;
+
+        probe = GF_CALLOC (1, sizeof (*probe) +
+                           nr * sizeof (struct io_uring_probe_op),
+                           gf_posix_mt_char);
+        if (!probe)
+                return;
+
+        ret = posix_uring_register (ring->fd, IORING_REGISTER_PROBE, probe,
+                                    nr);
+        if (ret == 0) {
+                if (probe->last_op >= IORING_OP_STATX)
+                        ring->has_statx = !!(probe->ops[IORING_OP_STATX].flags
+                                             & IO_URING_OP_SUPPORTED);
+                if (probe->last_op >= IORING_OP_FALLOCATE)
+                        ring->has_fallocate =
+                                !!(probe->ops[IORING_OP_FALLOCATE].flags
+                                   & IO_URING_OP_SUPPORTED);
+        }
+
+        GF_FREE (probe);
+
+        /* fallocate is charged to the caller, so it needs the personality
+           to run with the brick's credentials whoever submits it */
+        ret = posix_uring_register (ring->fd, IORING_REGISTER_PERSONALITY,
+                                    NULL, 0);
+        if (ret > 0)
+                ring->personality = ret;
+        else
+                ring->has_fallocate = _gf_false;
+
+#ifdef IORING_RSRC_REGISTER_SPARSE
+        {
+                struct io_uring_rsrc_register reg = {0, };
+
+                reg.nr = POSIX_URING_MAX_BUFS;
+                reg.flags = IORING_RSRC_REGISTER_SPARSE;
+                ret = posix_uring_register (ring->fd,
+                                            IORING_REGISTER_BUFFERS2, &reg,
+                                            sizeof (reg));
+                if (ret == 0)
+                        ring->has_fixed = _gf_true;
+        }
+#endif
+
+        gf_log (this->name, GF_LOG_INFO, "io_uring: statx %s, fallocate %s, "
+                "fixed buffers %s", ring->has_statx ? "yes" : "no",
+                ring->has_fallocate ? "yes" : "no",
+                ring->has_fixed ? "yes" : "no");
+}
+
+
+static void
+posix_uring_destroy (struct posix_uring *ring)
+{
+        if (ring->sqes && ring->sqes != MAP_FAILED)
+                munmap (ring->sqes, ring->sqes_size);
+        if (ring->cq_ring && ring->cq_ring != MAP_FAILED &&
+            ring->cq_ring != ring->sq_ring)
+                munmap (ring->cq_ring, ring->cq_ring_size);
+        if (ring->sq_ring && ring->sq_ring != MAP_FAILED)
+                munmap (ring->sq_ring, ring->sq_ring_size);
+        if (ring->fd >= 0)
+                close (ring->fd);
+
+        GF_FREE (ring->unsent);
+        pthread_mutex_destroy (&ring->lock);
+        pthread_cond_destroy (&ring->cond);
+        pthread_mutex_destroy (&ring->buf_lock);
+        GF_FREE (ring);
+}
+
+
+static struct posix_uring *
+posix_uring_new (xlator_t *this, unsigned depth)
+{
+        struct posix_uring     *ring   = NULL;
+        struct io_uring_params  params = {0, };
+        char                   *sq     = NULL;
+        char                   *cq     = NULL;
+
+        ring = GF_CALLOC (1, sizeof (*ring), gf_posix_mt_uring);
+        if (!ring)
+                return NULL;
+
+        ring->fd = -1;
+        pthread_mutex_init (&ring->lock, NULL);
+        pthread_cond_init (&ring->cond, NULL);
+        pthread_mutex_init (&ring->buf_lock, NULL);
+
+        params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL;
+        params.cq_entries = depth * 2;
+        ring->fd = posix_uring_setup (depth, &params);
+        if (ring->fd < 0 && errno == EINVAL) {
+                /* older kernel, take the default sizes */
+                memset (&params, 0, sizeof (params));
+                ring->fd = posix_uring_setup (depth, &params);
+        }
+        if (ring->fd < 0)
+                goto err;
+
+        ring->sq_ring_size = params.sq_off.array +
+                             params.sq_entries * sizeof (unsigned);
+        ring->cq_ring_size = params.cq_off.cqes +
+                             params.cq_entries * sizeof (struct io_uring_cqe);
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+                if (ring->cq_ring_size > ring->sq_ring_size)
+                        ring->sq_ring_size = ring->cq_ring_size;
+                ring->cq_ring_size = ring->sq_ring_size;
+        }
+
+        ring->sq_ring = mmap (NULL, ring->sq_ring_size,
+                              PROT_READ|PROT_WRITE, MAP_SHARED|MAP_POPULATE,
+                              ring->fd, IORING_OFF_SQ_RING);
+        if (ring->sq_ring == MAP_FAILED)
+                goto err;
+
+        if (params.features & IORING_FEAT_SINGLE_MMAP) {
+                ring->cq_ring = ring->sq_ring;
+        } else {
+                ring->cq_ring = mmap (NULL, ring->cq_ring_size,
+                                      PROT_READ|PROT_WRITE,
+                                      MAP_SHARED|MAP_POPULATE, ring->fd,
+                                      IORING_OFF_CQ_RING);
+                if (ring->cq_ring == MAP_FAILED)
+                        goto err;
+        }
+
+        ring->sqes_size = params.sq_entries * sizeof (struct io_uring_sqe);
+        ring->sqes = mmap (NULL, ring->sqes_size, PROT_READ|PROT_WRITE,
+                           MAP_SHARED|MAP_POPULATE, ring->fd,
+                           IORING_OFF_SQES);
+        if (ring->sqes == MAP_FAILED)
+                goto err;
+
+        sq = ring->sq_ring;
+        ring->sq_head  = (unsigned *)(sq + params.sq_off.head);
+        ring->sq_tail  = (unsigned *)(sq + params.sq_off.tail);
+        ring->sq_mask  = (unsigned *)(sq + params.sq_off.ring_mask);
+        ring->sq_array = (unsigned *)(sq + params.sq_off.array);
+        ring->sq_entries = params.sq_entries;
+
+        cq = ring->cq_ring;
+        ring->cq_head  = (unsigned *)(cq + params.cq_off.head);
+        ring->cq_tail  = (unsigned *)(cq + params.cq_off.tail);
+        ring->cq_mask  = (unsigned *)(cq + params.cq_off.ring_mask);
+        ring->cqes     = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+        ring->cq_entries = params.cq_entries;
+
+        ring->unsent = GF_CALLOC (ring->sq_entries, sizeof (*ring->unsent),
+                                  gf_posix_mt_uring);
+        if (!ring->unsent)
+                goto err;
+
+        posix_uring_probe (this, ring);
+
+        return ring;
+err:
+        posix_uring_destroy (ring);
+        return NULL;
+}
+
+
+/* iobuf arena hooks, called under the iobuf pool mutex */
+
+static void
+posix_uring_arena_added (void *data, struct iobuf_arena *iobuf_arena)
+{
+#ifdef IORING_RSRC_REGISTER_SPARSE
+        struct posix_uring           *ring = data;
+        struct io_uring_rsrc_update2  upd  = {0, };
+        struct iovec                  iov  = {0, };
+        int                           i    = 0;
+        int                           ret  = -1;
+
+        if (!iobuf_arena->mem_base || iobuf_arena->mem_base == MAP_FAILED)
+                return;
+
+        pthread_mutex_lock (&ring->buf_lock);
+        {
+                for (i = 0; i < POSIX_URING_MAX_BUFS; i++)
+                        if (!ring->bufs[i].base)
+                                break;
+                if (i == POSIX_URING_MAX_BUFS)
+                        goto unlock;
+
+                iov.iov_base = iobuf_arena->mem_base;
+                iov.iov_len = iobuf_arena->arena_size;
+                upd.offset = i;
+                upd.data = (unsigned long) &iov;
+                upd.nr = 1;
+                ret = posix_uring_register (ring->fd,
+                                            IORING_REGISTER_BUFFERS_UPDATE,
+                                            &upd, sizeof (upd));
+                if (ret < 0) {
+                        gf_log (THIS->name, GF_LOG_DEBUG, "registering "
+                                "iobuf arena %p failed: %s",
+                                iobuf_arena->mem_base, strerror (errno));
+                        goto unlock;
+                }
+
+                ring->bufs[i].base = iov.iov_base;
+                ring->bufs[i].len = iov.iov_len;
+        }
+unlock:
+        pthread_mutex_unlock (&ring->buf_lock);
+#endif
+}
+
+
+static void
+posix_uring_arena_removed (void *data, struct iobuf_arena *iobuf_arena)
+{
+#ifdef IORING_RSRC_REGISTER_SPARSE
+        struct posix_uring           *ring = data;
+        struct io_uring_rsrc_update2  upd  = {0, };
+        struct iovec                  iov  = {0, };
+        int                           i    = 0;
+
+        pthread_mutex_lock (&ring->buf_lock);
+        {
+                for (i = 0; i < POSIX_URING_MAX_BUFS; i++)
+                        if (ring->bufs[i].base == iobuf_arena->mem_base)
+                                break;
+                if (i == POSIX_URING_MAX_BUFS)
+                        goto unlock;
+
+                /* the kernel keeps the pages of the I/O already in flight,
+                   an empty iovec just frees the slot */
+                upd.offset = i;
+                upd.data = (unsigned long) &iov;
+                upd.nr = 1;
+                posix_uring_register (ring->fd,
+                                      IORING_REGISTER_BUFFERS_UPDATE, &upd,
+                                      sizeof (upd));
+
+                ring->bufs[i].base = NULL;
+                ring->bufs[i].len = 0;
+        }
+unlock:
+        pthread_mutex_unlock (&ring->buf_lock);
+#endif
+}
+
+
+/* Index of the registered arena that holds [@ptr, @ptr + @len), or -1 */
+static int
+posix_uring_buf_index (struct posix_uring *ring, void *ptr, size_t len)
+{
+        char *base = NULL;
+        int   idx  = -1;
+        int   i    = 0;
+
+        if (!ring->has_fixed)
+                return -1;
+
+        pthread_mutex_lock (&ring->buf_lock);
+        {
+                for (i = 0; i < POSIX_URING_MAX_BUFS; i++) {
+                        base = ring->bufs[i].base;
+                        if (base && (char *)ptr >= base &&
+                            (char *)ptr + len <= base + ring->bufs[i].len) {
+                                idx = i;
+                                break;
+                        }
+                }
+        }
+        pthread_mutex_unlock (&ring->buf_lock);
+
+        return idx;
+}
+
+
+/* Queues the @nr sqes of one fop, -1 if the ring has no room for them */
+static int
+posix_uring_queue (struct posix_uring *ring, struct io_uring_sqe *sqe,
+                   int nr, gf_boolean_t fixed)
+{
+        unsigned head = 0;
+        unsigned tail = 0;
+        unsigned idx  = 0;
+        int      ret  = -1;
+        int      i    = 0;
+
+        pthread_mutex_lock (&ring->lock);
+        {
+                head = __atomic_load_n (ring->sq_head, __ATOMIC_ACQUIRE);
+                tail = *ring->sq_tail;
+
+                if (tail - head + nr > ring->sq_entries ||
+                    ring->inflight + ring->pending + nr > ring->cq_entries) {
+                        ring->fallbacks++;
+                        goto unlock;
+                }
+
+                for (i = 0; i < nr; i++) {
+                        idx = (tail + i) & *ring->sq_mask;
+                        sqe[i].personality = ring->personality;
+                        ring->sqes[idx] = sqe[i];
+                        ring->sq_array[idx] = idx;
+                }
+                __atomic_store_n (ring->sq_tail, tail + nr, __ATOMIC_RELEASE);
+
+                if (!ring->pending)
+                        pthread_cond_signal (&ring->cond);
+                ring->pending += nr;
+                if (fixed)
+                        ring->fixed_ios++;
+
+                ret = 0;
+        }
+unlock:
+        pthread_mutex_unlock (&ring->lock);
+
+        return ret;
+}
+
+
+static struct posix_uring_req *
+posix_uring_req_new (call_frame_t *frame, xlator_t *this, fd_t *fd, int _fd,
+                     glusterfs_fop_t op)
+{
+        struct posix_uring_req *req = NULL;
+        int                     i   = 0;
+
+        req = GF_CALLOC (1, sizeof (*req), gf_posix_mt_uring_req);
+        if (!req)
+                return NULL;
+
+        req->frame = frame;
+        req->this = this;
+        req->fd = fd_ref (fd);
+        req->_fd = _fd;
+        req->op = op;
+        req->opslot = req->syncslot = req->preslot = req->postslot = -1;
+        for (i = 0; i < POSIX_URING_MAX_SQES; i++)
+                req->slots[i].req = req;
+
+        return req;
+}
+
+
+static void
+posix_uring_req_destroy (struct posix_uring_req *req)
+{
+        if (req->iobuf)
+                iobuf_unref (req->iobuf);
+        if (req->iobref)
+                iobref_unref (req->iobref);
+        if (req->xdata)
+                dict_unref (req->xdata);
+        GF_FREE (req->vector);
+        if (req->fd)
+                fd_unref (req->fd);
+        GF_FREE (req);
+}
+
+
+/* Next sqe of @req's chain, hard linked to the previous one */
+static struct io_uring_sqe *
+posix_uring_prep (struct posix_uring_req *req, struct io_uring_sqe *sqe,
+                  int opcode)
+{
+        struct io_uring_sqe *cur = NULL;
+
+        if (req->nr)
+                sqe[req->nr - 1].flags |= IOSQE_IO_HARDLINK;
+
+        cur = &sqe[req->nr];
+        memset (cur, 0, sizeof (*cur));
+        cur->opcode = opcode;
+        cur->fd = req->_fd;
+        cur->user_data = (unsigned long) &req->slots[req->nr];
+        req->nr++;
+
+        return cur;
+}
+
+
+static void
+posix_uring_prep_statx (struct posix_uring_req *req, struct io_uring_sqe *sqe,
+                        struct statx *stx, int *slot)
+{
+        struct io_uring_sqe *cur = NULL;
+
+        *slot = req->nr;
+        cur = posix_uring_prep (req, sqe, IORING_OP_STATX);
+        cur->addr = (unsigned long) "";
+        cur->len = STATX_BASIC_STATS;
+        cur->addr2 = (unsigned long) stx;
+        cur->statx_flags = AT_EMPTY_PATH | AT_STATX_SYNC_AS_STAT;
+}
+
+
+static void
+posix_uring_iatt_from_statx (struct posix_uring_req *req, struct statx *stx,
+                             struct iatt *iatt)
+{
+        struct stat stbuf = {0, };
+
+        stbuf.st_dev = makedev (stx->stx_dev_major, stx->stx_dev_minor);
+        stbuf.st_ino = stx->stx_ino;
+        stbuf.st_mode = stx->stx_mode;
+        stbuf.st_nlink = stx->stx_nlink;
+        stbuf.st_uid = stx->stx_uid;
+        stbuf.st_gid = stx->stx_gid;
+        stbuf.st_rdev = makedev (stx->stx_rdev_major, stx->stx_rdev_minor);
+        stbuf.st_size = stx->stx_size;
+        stbuf.st_blksize = stx->stx_blksize;
+        stbuf.st_blocks = stx->stx_blocks;
+        stbuf.st_atim.tv_sec = stx->stx_atime.tv_sec;
+        stbuf.st_atim.tv_nsec = stx->stx_atime.tv_nsec;
+        stbuf.st_mtim.tv_sec = stx->stx_mtime.tv_sec;
+        stbuf.st_mtim.tv_nsec = stx->stx_mtime.tv_nsec;
+        stbuf.st_ctim.tv_sec = stx->stx_ctime.tv_sec;
+        stbuf.st_ctim.tv_nsec = stx->stx_ctime.tv_nsec;
+
+        /* same as posix_fdstat(), without the gfid handle link */
+        if (stbuf.st_nlink && !S_ISDIR (stbuf.st_mode))
+                stbuf.st_nlink--;
+
+        iatt_from_stat (iatt, &stbuf);
+
+        if (!gf_uuid_is_null (req->fd->inode->gfid))
+                gf_uuid_copy (iatt->ia_gfid, req->fd->inode->gfid);
+        else
+                posix_fill_gfid_fd (req->this, req->_fd, iatt);
+
+        posix_fill_ino_from_gfid (req->this, iatt);
+}
+
+
+/* The iatt of a linked statx, or of a new fstat when it did not work */
+static int
+posix_uring_stat (struct posix_uring_req *req, int slot, struct statx *stx,
+                  struct iatt *iatt)
+{
+        if (slot >= 0 && req->slots[slot].res == 0) {
+                posix_uring_iatt_from_statx (req, stx, iatt);
+                return 0;
+        }
+
+        return posix_fdstat (req->this, req->_fd, iatt);
+}
+
+
+/* O_DIRECT that the libaio engine left on the fd. Buffered I/O is
+   asynchronous with io_uring, so only an O_DIRECT open keeps it. */
+static void
+posix_uring_fd_reset_odirect (fd_t *fd, struct posix_fd *pfd)
+{
+        int flags = 0;
+
+        if (!pfd->odirect)
+                return;
+
+        LOCK (&fd->lock);
+        {
+                if (pfd->odirect && !((fd->flags|pfd->flags) & O_DIRECT)) {
+                        flags = fcntl (pfd->fd, F_GETFL);
+                        if (fcntl (pfd->fd, F_SETFL, flags & ~O_DIRECT) == 0)
+                                pfd->odirect = 0;
+                }
+        }
+        UNLOCK (&fd->lock);
+}
+
+
+static gf_boolean_t
+posix_uring_iov_aligned (struct iovec *vector, int count, off_t offset)
+{
+        int i = 0;
+
+        if (offset & 0xfff)
+                return _gf_false;
+
+        for (i = 0; i < count; i++)
+                if (((unsigned long) vector[i].iov_base |
+                     vector[i].iov_len) & 0xfff)
+                        return _gf_false;
+
+        return _gf_true;
+}
+
+
+static void
+posix_uring_readv_complete (struct posix_uring_req *req)
+{
+        xlator_t             *this     = req->this;
+        struct posix_private *priv     = this->private;
+        struct iatt           postbuf  = {0, };
+        struct iovec          iov      = {0, };
+        struct iobref        *iobref   = NULL;
+        int                   op_ret   = -1;
+        int                   op_errno = 0;
+        int                   res      = 0;
+
+        res = req->slots[req->opslot].res;
+        if (res < 0) {
+                op_errno = -res;
+                gf_log (this->name, GF_LOG_ERROR,
+                        "readv(io_uring) failed fd=%d,size=%lu,offset=%llu "
+                        "(%s)", req->_fd, (unsigned long) req->size,
+                        (unsigned long long) req->offset, strerror (op_errno));
+                goto out;
+        }
+
+        if (posix_uring_stat (req, req->postslot, &req->poststx,
+                              &postbuf) != 0) {
+                op_errno = errno;
+                gf_log (this->name, GF_LOG_ERROR,
+                        "fstat failed on fd=%d: %s", req->_fd,
+                        strerror (op_errno));
+                goto out;
+        }
+
+        iobref = iobref_new ();
+        if (!iobref) {
+                op_errno = ENOMEM;
+                goto out;
+        }
+        iobref_add (iobref, req->iobuf);
+
+        op_ret = res;
+        iov.iov_base = iobuf_ptr (req->iobuf);
+        iov.iov_len = op_ret;
+
+        /* Hack to notify higher layers of EOF. */
+        if (!postbuf.ia_size || (req->offset + iov.iov_len) >= postbuf.ia_size)
+                op_errno = ENOENT;
+
+        LOCK (&priv->lock);
+        {
+                priv->read_value += op_ret;
+        }
+        UNLOCK (&priv->lock);
+
+out:
+        STACK_UNWIND_STRICT (readv, req->frame, op_ret, op_errno, &iov, 1,
+                             &postbuf, iobref, NULL);
+        if (iobref)
+                iobref_unref (iobref);
+}
+
+
+static void
+posix_uring_writev_complete (struct posix_uring_req *req)
+{
+        xlator_t             *this      = req->this;
+        struct posix_private *priv      = this->private;
+        struct iatt           prebuf    = {0, };
+        struct iatt           postbuf   = {0, };
+        dict_t               *rsp_xdata = NULL;
+        int                   op_ret    = -1;
+        int                   op_errno  = 0;
+        int                   res       = 0;
+
+        res = req->slots[req->opslot].res;
+        if (res < 0) {
+                op_errno = -res;
+                gf_log (this->name, GF_LOG_ERROR,
+                        "writev(io_uring) failed fd=%d,offset=%llu (%s)",
+                        req->_fd, (unsigned long long) req->offset,
+                        strerror (op_errno));
+                goto out;
+        }
+
+        if (req->syncslot >= 0 && req->slots[req->syncslot].res < 0) {
+                op_errno = -req->slots[req->syncslot].res;
+                gf_log (this->name, GF_LOG_ERROR,
+                        "fsync() in writev on fd %d failed: %s", req->_fd,
+                        strerror (op_errno));
+                goto out;
+        }
+
+        /* a failed pre-op statx can only be redone after the write */
+        if (posix_uring_stat (req, req->preslot, &req->prestx,
+                              &prebuf) != 0 ||
+            posix_uring_stat (req, req->postslot, &req->poststx,
+                              &postbuf) != 0) {
+                op_errno = errno;
+                gf_log (this->name, GF_LOG_ERROR,
+                        "fstat failed on fd=%d: %s", req->_fd,
+                        strerror (op_errno));
+                goto out;
+        }
+
+        op_ret = res;
+        rsp_xdata = _fill_writev_xdata (req->fd, req->xdata, this, 0);
+
+        LOCK (&priv->lock);
+        {
+                priv->write_value += op_ret;
+        }
+        UNLOCK (&priv->lock);
+
+out:
+        STACK_UNWIND_STRICT (writev, req->frame, op_ret, op_errno, &prebuf,
+                             &postbuf, rsp_xdata);
+        if (rsp_xdata)
+                dict_unref (rsp_xdata);
+}
+
+
+static void
+posix_uring_fsync_complete (struct posix_uring_req *req)
+{
+        struct iatt preop    = {0, };
+        struct iatt postop   = {0, };
+        int         op_ret   = -1;
+        int         op_errno = 0;
+        int         res      = 0;
+
+        res = req->slots[req->opslot].res;
+        if (res < 0) {
+                op_errno = -res;
+                gf_log (req->this->name, GF_LOG_ERROR,
+                        "fsync on fd=%p failed: %s", req->fd,
+                        strerror (op_errno));
+                goto out;
+        }
+
+        if (posix_uring_stat (req, req->preslot, &req->prestx, &preop) != 0 ||
+            posix_uring_stat (req, req->postslot, &req->poststx,
+                              &postop) != 0) {
+                op_errno = errno;
+                gf_log (req->this->name, GF_LOG_WARNING,
+                        "fstat failed on fd=%p: %s", req->fd,
+                        strerror (op_errno));
+                goto out;
+        }
+
+        op_ret = 0;
+out:
+        STACK_UNWIND_STRICT (fsync, req->frame, op_ret, op_errno, &preop,
+                             &postop, NULL);
+}
+
+
+static void
+posix_uring_fallocate_complete (struct posix_uring_req *req)
+{
+        struct iatt statpre  = {0, };
+        struct iatt statpost = {0, };
+        int         op_errno = 0;
+        int         res      = 0;
+
+        res = req->slots[req->opslot].res;
+        if (res < 0) {
+                op_errno = -res;
+                goto err;
+        }
+
+        if (posix_uring_stat (req, req->preslot, &req->prestx,
+                              &statpre) != 0 ||
+            posix_uring_stat (req, req->postslot, &req->poststx,
+                              &statpost) != 0) {
+                op_errno = errno;
+                gf_log (req->this->name, GF_LOG_ERROR,
+                        "fallocate (fstat) failed on fd=%p: %s", req->fd,
+                        strerror (op_errno));
+                goto err;
+        }
+
+        if (req->op == GF_FOP_DISCARD)
+                STACK_UNWIND_STRICT (discard, req->frame, 0, 0, &statpre,
+                                     &statpost, NULL);
+        else
+                STACK_UNWIND_STRICT (fallocate, req->frame, 0, 0, &statpre,
+                                     &statpost, NULL);
+        return;
+err:
+        if (req->op == GF_FOP_DISCARD)
+                STACK_UNWIND_STRICT (discard, req->frame, -1, op_errno, NULL,
+                                     NULL, NULL);
+        else
+                STACK_UNWIND_STRICT (fallocate, req->frame, -1, op_errno,
+                                     NULL, NULL, NULL);
+}
+
+
+static void
+posix_uring_complete (struct posix_uring_req *req)
+{
+        switch (req->op) {
+        case GF_FOP_READ:
+                posix_uring_readv_complete (req);
+                break;
+        case GF_FOP_WRITE:
+                posix_uring_writev_complete (req);
+                break;
+        case GF_FOP_FSYNC:
+                posix_uring_fsync_complete (req);
+                break;
+        case GF_FOP_FALLOCATE:
+        case GF_FOP_DISCARD:
+                posix_uring_fallocate_complete (req);
+                break;
+        default:
+                gf_log (req->this->name, GF_LOG_ERROR,
+                        "unknown op %d found in io_uring request", req->op);
+                break;
+        }
+
+        posix_uring_req_destroy (req);
+}
+
+
+/* Accounts for the sqe of @slot, and completes its request if that was
+   the last one outstanding. */
+static void
+posix_uring_slot_done (struct posix_uring_slot *slot)
+{
+        struct posix_uring_req *req = slot->req;
+        int                     nr  = req->nr;
+
+        /* the sqes of a request may end on both the submitter and the
+           completion thread */
+        if (__sync_add_and_fetch (&req->done, 1) == nr)
+                posix_uring_complete (req);
+}
+
+
+/* The kernel refused the queued sqes for good. They are taken back out of
+   the ring and their fops fail with @op_errno. */
+static void
+posix_uring_fail_unsent (struct posix_uring *ring, int op_errno)
+{
+        struct posix_uring_slot *slot = NULL;
+        unsigned                 head = 0;
+        unsigned                 tail = 0;
+        unsigned                 nr   = 0;
+        unsigned                 i    = 0;
+
+        pthread_mutex_lock (&ring->lock);
+        {
+                /* without SQPOLL the kernel only takes sqes in an enter,
+                   and only this thread enters */
+                head = __atomic_load_n (ring->sq_head, __ATOMIC_ACQUIRE);
+                tail = *ring->sq_tail;
+                for (nr = 0; head != tail; head++, nr++) {
+                        slot = (void *)(unsigned long)
+                               ring->sqes[head & *ring->sq_mask].user_data;
+                        slot->res = -op_errno;
+                        ring->unsent[nr] = slot;
+                }
+                __atomic_store_n (ring->sq_tail, tail - nr, __ATOMIC_RELEASE);
+                ring->pending = 0;
+        }
+        pthread_mutex_unlock (&ring->lock);
+
+        for (i = 0; i < nr; i++)
+                posix_uring_slot_done (ring->unsent[i]);
+}
+
+
+static void *
+posix_uring_submitter (void *data)
+{
+        xlator_t             *this    = NULL;
+        struct posix_private *priv    = NULL;
+        struct posix_uring   *ring    = NULL;
+        struct timespec       wait    = {0, };
+        unsigned              n       = 0;
+        unsigned              backoff = 0;
+        int                   ret     = 0;
+
+        this = data;
+        THIS = this;
+        priv = this->private;
+        ring = priv->uring;
+
+        pthread_mutex_lock (&ring->lock);
+        for (;;) {
+                while (!ring->pending || ring->blocked)
+                        pthread_cond_wait (&ring->cond, &ring->lock);
+
+                n = ring->pending;
+                pthread_mutex_unlock (&ring->lock);
+                ret = posix_uring_enter (ring->fd, n, 0, 0);
+                if (ret < 0)
+                        ret = -errno;
+                pthread_mutex_lock (&ring->lock);
+
+                if (ret > 0) {
+                        ring->pending -= ret;
+                        ring->inflight += ret;
+                        ring->enter_calls++;
+                        ring->sqes_entered += ret;
+                        backoff = 0;
+                        continue;
+                }
+                if (ret == -EINTR)
+                        continue;
+
+                if (ret == 0 || ret == -EAGAIN || ret == -EBUSY) {
+                        /* out of resources for now. The completion thread
+                           wakes us once it reaped something, without
+                           anything in flight we try again after a while */
+                        if (ring->inflight) {
+                                ring->blocked = 1;
+                                continue;
+                        }
+                        backoff = backoff ? min (backoff * 2,
+                                                 POSIX_URING_MAX_BACKOFF) : 1;
+                        clock_gettime (CLOCK_REALTIME, &wait);
+                        wait.tv_nsec += backoff * 1000000;
+                        wait.tv_sec += wait.tv_nsec / 1000000000;
+                        wait.tv_nsec %= 1000000000;
+                        pthread_cond_timedwait (&ring->cond, &ring->lock,
+                                                &wait);
+                        continue;
+                }
+
+                gf_log (this->name, GF_LOG_ERROR, "io_uring_enter() failed: "
+                        "%s, failing %u queued requests", strerror (-ret), n);
+                pthread_mutex_unlock (&ring->lock);
+                posix_uring_fail_unsent (ring, -ret);
+                pthread_mutex_lock (&ring->lock);
+        }
+        pthread_mutex_unlock (&ring->lock);
+
+        return NULL;
+}
+
+
+static void *
+posix_uring_thread (void *data)
+{
+        xlator_t                *this = NULL;
+        struct posix_private    *priv = NULL;
+        struct posix_uring      *ring = NULL;
+        struct posix_uring_slot *slots[POSIX_URING_MAX_REAP];
+        struct io_uring_cqe     *cqe  = NULL;
+        unsigned                 head = 0;
+        unsigned                 tail = 0;
+        gf_boolean_t             stop = _gf_false;
+        int                      nr   = 0;
+        int                      ret  = 0;
+        int                      i    = 0;
+
+        this = data;
+        THIS = this;
+        priv = this->private;
+        ring = priv->uring;
+
+        while (!stop) {
+                ret = posix_uring_enter (ring->fd, 0, 1,
+                                         IORING_ENTER_GETEVENTS);
+                if (ret < 0 && errno != EINTR && errno != EAGAIN &&
+                    errno != EBUSY) {
+                        gf_log (this->name, GF_LOG_ERROR,
+                                "io_uring_enter() failed: %s",
+                                strerror (errno));
+                        break;
+                }
+
+                for (;;) {
+                        head = *ring->cq_head;
+                        tail = __atomic_load_n (ring->cq_tail,
+                                                __ATOMIC_ACQUIRE);
+                        if (head == tail)
+                                break;
+                        for (nr = 0; head != tail && nr < POSIX_URING_MAX_REAP;
+                             head++) {
+                                cqe = &ring->cqes[head & *ring->cq_mask];
+                                /* the nop of posix_uring_thread_stop () */
+                                if (!cqe->user_data) {
+                                        stop = _gf_true;
+                                        continue;
+                                }
+                                slots[nr] = (void *)(unsigned long)
+                                            cqe->user_data;
+                                slots[nr]->res = cqe->res;
+                                nr++;
+                        }
+                        __atomic_store_n (ring->cq_head, head,
+                                          __ATOMIC_RELEASE);
+
+                        pthread_mutex_lock (&ring->lock);
+                        {
+                                ring->inflight -= nr;
+                                if (ring->blocked) {
+                                        ring->blocked = 0;
+                                        pthread_cond_signal (&ring->cond);
+                                }
+                        }
+                        pthread_mutex_unlock (&ring->lock);
+
+                        for (i = 0; i < nr; i++)
+                                posix_uring_slot_done (slots[i]);
+                }
+        }
+
+        return NULL;
+}
+
+
+int
+posix_uring_readv (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                   size_t size, off_t offset, uint32_t flags, dict_t *xdata)
+{
+        struct posix_private   *priv     = NULL;
+        struct posix_uring     *ring     = NULL;
+        struct posix_fd        *pfd      = NULL;
+        struct posix_uring_req *req      = NULL;
+        struct iobuf           *iobuf    = NULL;
+        struct io_uring_sqe     sqe[POSIX_URING_MAX_SQES];
+        struct io_uring_sqe    *cur      = NULL;
+        int32_t                 op_errno = EINVAL;
+        int                     idx      = -1;
+        int                     ret      = -1;
+
+        VALIDATE_OR_GOTO (frame, err);
+        VALIDATE_OR_GOTO (this, err);
+        VALIDATE_OR_GOTO (fd, err);
+
+        priv = this->private;
+        ring = priv->uring;
+
+        ret = posix_fd_ctx_get (fd, this, &pfd);
+        if (ret < 0) {
+                op_errno = -ret;
+                gf_log (this->name, GF_LOG_WARNING,
+                        "pfd is NULL from fd=%p", fd);
+                goto err;
+        }
+
+        if (!size) {
+                op_errno = EINVAL;
+                gf_log (this->name, GF_LOG_WARNING, "size=%"GF_PRI_SIZET, size);
+                goto err;
+        }
+
+        posix_uring_fd_reset_odirect (fd, pfd);
+
+        iobuf = iobuf_get2 (this->ctx->iobuf_pool, size);
+        if (!iobuf) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        req = posix_uring_req_new (frame, this, fd, pfd->fd, GF_FOP_READ);
+        if (!req) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+        req->iobuf = iobuf;
+        req->offset = offset;
+        req->size = size;
+        req->iov.iov_base = iobuf_ptr (iobuf);
+        req->iov.iov_len = size;
+
+        idx = posix_uring_buf_index (ring, req->iov.iov_base, size);
+
+        req->opslot = req->nr;
+        if (idx >= 0) {
+                cur = posix_uring_prep (req, sqe, IORING_OP_READ_FIXED);
+                cur->addr = (unsigned long) req->iov.iov_base;
+                cur->len = size;
+                cur->buf_index = idx;
+        } else {
+                cur = posix_uring_prep (req, sqe, IORING_OP_READV);
+                cur->addr = (unsigned long) &req->iov;
+                cur->len = 1;
+        }
+        cur->off = offset;
+
+        if (ring->has_statx)
+                posix_uring_prep_statx (req, sqe, &req->poststx,
+                                        &req->postslot);
+
+        ret = posix_uring_queue (ring, sqe, req->nr, (idx >= 0));
+        if (ret) {
+                posix_uring_req_destroy (req);
+                return posix_readv (frame, this, fd, size, offset, flags,
+                                    xdata);
+        }
+
+        return 0;
+err:
+        STACK_UNWIND_STRICT (readv, frame, -1, op_errno, 0, 0, 0, 0, 0);
+        if (iobuf)
+                iobuf_unref (iobuf);
+
+        return 0;
+}
+
+
+int
+posix_uring_writev (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                    struct iovec *iov, int count, off_t offset, uint32_t flags,
+                    struct iobref *iobref, dict_t *xdata)
+{
+        struct posix_private   *priv     = NULL;
+        struct posix_uring     *ring     = NULL;
+        struct posix_fd        *pfd      = NULL;
+        struct posix_uring_req *req      = NULL;
+        struct io_uring_sqe     sqe[POSIX_URING_MAX_SQES];
+        struct io_uring_sqe    *cur      = NULL;
+        int32_t                 op_errno = EINVAL;
+        int                     idx      = -1;
+        int                     ret      = -1;
+
+        VALIDATE_OR_GOTO (frame, err);
+        VALIDATE_OR_GOTO (this, err);
+        VALIDATE_OR_GOTO (fd, err);
+        VALIDATE_OR_GOTO (iov, err);
+
+        priv = this->private;
+        ring = priv->uring;
+
+        ret = posix_fd_ctx_get (fd, this, &pfd);
+        if (ret < 0) {
+                op_errno = -ret;
+                gf_log (this->name, GF_LOG_WARNING,
+                        "pfd is NULL from fd=%p", fd);
+                goto err;
+        }
+
+        /* the append check needs the pre-op stat and the write under the
+           inode lock, and O_DIRECT needs aligned buffers */
+        if ((xdata && dict_get (xdata, GLUSTERFS_WRITE_IS_APPEND)) ||
+            ((pfd->flags & O_DIRECT) &&
+             !posix_uring_iov_aligned (iov, count, offset)))
+                goto sync;
+
+        posix_uring_fd_reset_odirect (fd, pfd);
+
+        req = posix_uring_req_new (frame, this, fd, pfd->fd, GF_FOP_WRITE);
+        if (!req) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+        req->offset = offset;
+        req->size = iov_length (iov, count);
+        if (iobref)
+                req->iobref = iobref_ref (iobref);
+        if (xdata)
+                req->xdata = dict_ref (xdata);
+
+        /* whoever enters the sqes reads the iovecs, maybe after we
+           returned */
+        if (count == 1) {
+                req->iov = iov[0];
+                idx = posix_uring_buf_index (ring, iov[0].iov_base,
+                                             iov[0].iov_len);
+        } else {
+                req->vector = GF_CALLOC (count, sizeof (*iov),
+                                         gf_posix_mt_uring_req);
+                if (!req->vector) {
+                        posix_uring_req_destroy (req);
+                        goto sync;
+                }
+                memcpy (req->vector, iov, count * sizeof (*iov));
+        }
+
+        if (ring->has_statx)
+                posix_uring_prep_statx (req, sqe, &req->prestx,
+                                        &req->preslot);
+
+        req->opslot = req->nr;
+        if (idx >= 0) {
+                cur = posix_uring_prep (req, sqe, IORING_OP_WRITE_FIXED);
+                cur->addr = (unsigned long) iov[0].iov_base;
+                cur->len = iov[0].iov_len;
+                cur->buf_index = idx;
+        } else {
+                cur = posix_uring_prep (req, sqe, IORING_OP_WRITEV);
+                cur->addr = (unsigned long) (req->vector ? req->vector
+                                                         : &req->iov);
+                cur->len = count;
+        }
+        cur->off = offset;
+
+        if (flags & (O_SYNC|O_DSYNC)) {
+                req->syncslot = req->nr;
+                posix_uring_prep (req, sqe, IORING_OP_FSYNC);
+        }
+
+        if (ring->has_statx)
+                posix_uring_prep_statx (req, sqe, &req->poststx,
+                                        &req->postslot);
+
+        ret = posix_uring_queue (ring, sqe, req->nr, (idx >= 0));
+        if (ret) {
+                posix_uring_req_destroy (req);
+                goto sync;
+        }
+
+        return 0;
+sync:
+        return posix_writev (frame, this, fd, iov, count, offset, flags,
+                             iobref, xdata);
+err:
+        STACK_UNWIND_STRICT (writev, frame, -1, op_errno, 0, 0, 0);
+        return 0;
+}
+
+
+int32_t
+posix_uring_fsync (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                   int32_t datasync, dict_t *xdata)
+{
+        struct posix_private   *priv     = NULL;
+        struct posix_uring     *ring     = NULL;
+        struct posix_fd        *pfd      = NULL;
+        struct posix_uring_req *req      = NULL;
+        struct io_uring_sqe     sqe[POSIX_URING_MAX_SQES];
+        struct io_uring_sqe    *cur      = NULL;
+        int32_t                 op_errno = EINVAL;
+        int                     ret      = -1;
+
+        VALIDATE_OR_GOTO (frame, err);
+        VALIDATE_OR_GOTO (this, err);
+        VALIDATE_OR_GOTO (fd, err);
+
+        priv = this->private;
+        ring = priv->uring;
+
+        if (priv->batch_fsync_mode && xdata && dict_get (xdata, "batch-fsync")) {
+                posix_batch_fsync (frame, this, fd, datasync, xdata);
+                return 0;
+        }
+
+        ret = posix_fd_ctx_get (fd, this, &pfd);
+        if (ret < 0) {
+                op_errno = -ret;
+                gf_log (this->name, GF_LOG_WARNING,
+                        "pfd not found in fd's ctx");
+                goto err;
+        }
+
+        req = posix_uring_req_new (frame, this, fd, pfd->fd, GF_FOP_FSYNC);
+        if (!req) {
+                op_errno = ENOMEM;
+                goto err;
+        }
+
+        if (ring->has_statx)
+                posix_uring_prep_statx (req, sqe, &req->prestx,
+                                        &req->preslot);
+
+        req->opslot = req->nr;
+        cur = posix_uring_prep (req, sqe, IORING_OP_FSYNC);
+        if (datasync)
+                cur->fsync_flags = IORING_FSYNC_DATASYNC;
+
+        if (ring->has_statx)
+                posix_uring_prep_statx (req, sqe, &req->poststx,
+                                        &req->postslot);
+
+        ret = posix_uring_queue (ring, sqe, req->nr, _gf_false);
+        if (ret) {
+                posix_uring_req_destroy (req);
+                return posix_fsync (frame, this, fd, datasync, xdata);
+        }
+
+        return 0;
+err:
+        STACK_UNWIND_STRICT (fsync, frame, -1, op_errno, NULL, NULL, NULL);
+        return 0;
+}
+
+
+static int32_t
+posix_uring_do_fallocate (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                          glusterfs_fop_t op, int32_t mode, off_t offset,
+                          size_t len)
+{
+        struct posix_private   *priv     = NULL;
+        struct posix_uring     *ring     = NULL;
+        struct posix_fd        *pfd      = NULL;
+        struct posix_uring_req *req      = NULL;
+        struct io_uring_sqe     sqe[POSIX_URING_MAX_SQES];
+        struct io_uring_sqe    *cur      = NULL;
+        int                     ret      = -1;
+
+        priv = this->private;
+        ring = priv->uring;
+
+        ret = posix_fd_ctx_get (fd, this, &pfd);
+        if (ret < 0) {
+                gf_log (this->name, GF_LOG_DEBUG,
+                        "pfd is NULL from fd=%p", fd);
+                return ret;
+        }
+
+        req = posix_uring_req_new (frame, this, fd, pfd->fd, op);
+        if (!req)
+                return -ENOMEM;
+
+        if (ring->has_statx)
+                posix_uring_prep_statx (req, sqe, &req->prestx,
+                                        &req->preslot);
+
+        req->opslot = req->nr;
+        cur = posix_uring_prep (req, sqe, IORING_OP_FALLOCATE);
+        cur->off = offset;
+        cur->addr = len;
+        cur->len = mode;
+
+        if (ring->has_statx)
+                posix_uring_prep_statx (req, sqe, &req->poststx,
+                                        &req->postslot);
+
+        ret = posix_uring_queue (ring, sqe, req->nr, _gf_false);
+        if (ret) {
+                posix_uring_req_destroy (req);
+                return 1;
+        }
+
+        return 0;
+}
+
+
+int32_t
+posix_uring_fallocate (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                       int32_t keep_size, off_t offset, size_t len,
+                       dict_t *xdata)
+{
+        int32_t ret = 0;
+
+        ret = posix_uring_do_fallocate (frame, this, fd, GF_FOP_FALLOCATE,
+                                        keep_size ? FALLOC_FL_KEEP_SIZE : 0,
+                                        offset, len);
+        if (ret > 0)
+                return _posix_fallocate (frame, this, fd, keep_size, offset,
+                                         len, xdata);
+        if (ret < 0)
+                STACK_UNWIND_STRICT (fallocate, frame, -1, -ret, NULL, NULL,
+                                     NULL);
+        return 0;
+}
+
+
+int32_t
+posix_uring_discard (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                     off_t offset, size_t len, dict_t *xdata)
+{
+        int32_t ret = 0;
+
+        ret = posix_uring_do_fallocate (frame, this, fd, GF_FOP_DISCARD,
+                                        FALLOC_FL_KEEP_SIZE |
+                                        FALLOC_FL_PUNCH_HOLE, offset, len);
+        if (ret > 0)
+                return posix_discard (frame, this, fd, offset, len, xdata);
+        if (ret < 0)
+                STACK_UNWIND_STRICT (discard, frame, -1, -ret, NULL, NULL,
+                                     NULL);
+        return 0;
+}
+
+
+/* Ends the completion thread with a nop it takes for the end, for a ring
+   that cannot be put to use after all */
+static int
+posix_uring_thread_stop (struct posix_uring *ring)
+{
+        struct io_uring_sqe sqe = {0, };
+
+        sqe.opcode = IORING_OP_NOP;
+        sqe.user_data = 0;
+
+        if (posix_uring_queue (ring, &sqe, 1, _gf_false) != 0 ||
+            posix_uring_enter (ring->fd, 1, 0, 0) != 1)
+                return -1;
+
+        pthread_join (ring->thread, NULL);
+        return 0;
+}
+
+
+static int
+posix_uring_init (xlator_t *this)
+{
+        struct posix_private *priv = NULL;
+        struct posix_uring   *ring = NULL;
+        int                   ret  = 0;
+
+        priv = this->private;
+
+        ring = posix_uring_new (this, priv->uring_depth);
+        if (!ring) {
+                if (errno == ENOSYS || errno == EPERM) {
+                        gf_log (this->name, GF_LOG_WARNING,
+                                "io_uring not available at run-time (%s)."
+                                " Continuing with synchronous IO",
+                                strerror (errno));
+                        return 0;
+                }
+                gf_log (this->name, GF_LOG_WARNING,
+                        "io_uring_setup() failed: %s", strerror (errno));
+                return -1;
+        }
+
+        priv->uring = ring;
+
+        ret = gf_thread_create (&ring->thread, NULL, posix_uring_thread,
+                                this);
+        if (ret != 0) {
+                priv->uring = NULL;
+                posix_uring_destroy (ring);
+                return -1;
+        }
+
+        ret = gf_thread_create (&ring->submitter, NULL,
+                                posix_uring_submitter, this);
+        if (ret != 0) {
+                gf_log (this->name, GF_LOG_ERROR,
+                        "io_uring submitter thread creation failed");
+                /* if the completion thread cannot be stopped it keeps
+                   the ring, unused */
+                if (posix_uring_thread_stop (ring) == 0) {
+                        priv->uring = NULL;
+                        posix_uring_destroy (ring);
+                }
+                return -1;
+        }
+
+        if (ring->has_fixed &&
+            iobuf_pool_set_arena_hooks (this->ctx->iobuf_pool, ring,
+                                        posix_uring_arena_added,
+                                        posix_uring_arena_removed) != 0) {
+                gf_log (this->name, GF_LOG_INFO, "iobuf arenas are "
+                        "registered by another instance, not using fixed "
+                        "buffers");
+                ring->has_fixed = _gf_false;
+        }
+
+        return 0;
+}
+
+
+int
+posix_uring_on (xlator_t *this)
+{
+        struct posix_private *priv = NULL;
+        struct posix_uring   *ring = NULL;
+        int                   ret  = 0;
+
+        priv = this->private;
+
+        if (!priv->uring_init_done) {
+                ret = posix_uring_init (this);
+                if (ret == 0 && priv->uring)
+                        priv->uring_capable = _gf_true;
+                else
+                        priv->uring_capable = _gf_false;
+                priv->uring_init_done = _gf_true;
+        }
+
+        if (priv->uring_capable) {
+                ring = priv->uring;
+                this->fops->readv  = posix_uring_readv;
+                this->fops->writev = posix_uring_writev;
+                this->fops->fsync  = posix_uring_fsync;
+                if (ring->has_fallocate) {
+                        this->fops->fallocate = posix_uring_fallocate;
+                        this->fops->discard   = posix_uring_discard;
+                }
+        }
+
+        return ret;
+}
+
+int
+posix_uring_off (xlator_t *this)
+{
+        struct posix_private *priv = NULL;
+
+        priv = this->private;
+
+        this->fops->readv     = posix_readv;
+        this->fops->writev    = posix_writev;
+        this->fops->fsync     = posix_fsync;
+        this->fops->fallocate = _posix_fallocate;
+        this->fops->discard   = posix_discard;
+
+        /* readv and writev go back to libaio if it is on */
+        if (priv->aio_configured)
+                posix_aio_on (this);
+
+        return 0;
+}
+
+
+void
+posix_uring_fini (xlator_t *this)
+{
+        struct posix_private *priv = NULL;
+
+        priv = this->private;
+
+        if (priv->uring)
+                iobuf_pool_clear_arena_hooks (this->ctx->iobuf_pool,
+                                              priv->uring);
+}
+
+
+void
+posix_uring_priv_dump (xlator_t *this)
+{
+        struct posix_private *priv = NULL;
+        struct posix_uring   *ring = NULL;
+        int                   bufs = 0;
+        int                   i    = 0;
+
+        priv = this->private;
+        ring = priv->uring;
+        if (!ring)
+                return;
+
+        pthread_mutex_lock (&ring->buf_lock);
+        {
+                for (i = 0; i < POSIX_URING_MAX_BUFS; i++)
+                        if (ring->bufs[i].base)
+                                bufs++;
+        }
+        pthread_mutex_unlock (&ring->buf_lock);
+
+        pthread_mutex_lock (&ring->lock);
+        {
+                gf_proc_dump_write ("io_uring.depth", "%u",
+                                    ring->sq_entries);
+                gf_proc_dump_write ("io_uring.inflight", "%u",
+                                    ring->inflight);
+                gf_proc_dump_write ("io_uring.enter_calls", "%"PRIu64,
+                                    ring->enter_calls);
+                gf_proc_dump_write ("io_uring.sqes", "%"PRIu64,
+                                    ring->sqes_entered);
+                gf_proc_dump_write ("io_uring.sqes_per_enter", "%.2f",
+                                    ring->enter_calls
+                                    ? (double)ring->sqes_entered
+                                      / ring->enter_calls
+                                    : 0.0);
+                gf_proc_dump_write ("io_uring.fixed_ios", "%"PRIu64,
+                                    ring->fixed_ios);
+                gf_proc_dump_write ("io_uring.fallbacks", "%"PRIu64,
+                                    ring->fallbacks);
+        }
+        pthread_mutex_unlock (&ring->lock);
+
+        gf_proc_dump_write ("io_uring.fixed_buffers", "%d", bufs);
+}
+
+
+#else
+
+
+int
+posix_uring_on (xlator_t *this)
+{
+        gf_log (this->name, GF_LOG_INFO,
+                "io_uring not available at build-time."
+                " Continuing with synchronous IO");
+        return 0;
+}
+
+int
+posix_uring_off (xlator_t *this)
+{
+        return 0;
+}
+
+void
+posix_uring_fini (xlator_t *this)
+{
+}
+
+void
+posix_uring_priv_dump (xlator_t *this)
+{
+}
+#endif
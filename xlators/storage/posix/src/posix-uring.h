@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2015 Red Hat, Inc. <http://www.redhat.com>
+   This file is part of GlusterFS.
+
+   This file is licensed to you under your choice of the GNU Lesser
+   General Public License, version 3 or any later version (LGPLv3 or
+   later), or the GNU General Public License, version 2 (GPLv2), in all
+   cases as published by the Free Software Foundation.
+*/
+#ifndef _POSIX_URING_H
+#define _POSIX_URING_H
+
+#ifndef _CONFIG_H
+#define _CONFIG_H
+#include "config.h"
+#endif
+
+#include "xlator.h"
+#include "glusterfs.h"
+
+/* Submission queue entries by default. The completion queue is twice as
+   big, and never more than that many entries are in the kernel. */
+#define POSIX_URING_DEFAULT_DEPTH 256
+#define POSIX_URING_MIN_DEPTH     16
+#define POSIX_URING_MAX_DEPTH     4096
+
+/* A fop is at most a pre-op statx, the op, an fsync and a post-op statx,
+   linked so that the kernel runs them in that order. */
+#define POSIX_URING_MAX_SQES 4
+
+/* Slots for iobuf arenas registered as fixed buffers */
+#define POSIX_URING_MAX_BUFS 256
+
+/* Completions reaped per pass of the completion thread */
+#define POSIX_URING_MAX_REAP 64
+
+/* Longest wait, in milliseconds, before the submitter retries an enter
+   the kernel had no resources for while nothing was in flight */
+#define POSIX_URING_MAX_BACKOFF 64
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+
+struct posix_uring_buf {
+        void   *base;
+        size_t  len;
+};
+
+struct posix_uring_slot;
+
+struct posix_uring {
+        int                      fd;
+
+        /* submission side, any io-thread queues, one thread enters */
+        pthread_mutex_t          lock;
+        pthread_cond_t           cond;
+        unsigned                *sq_head;
+        unsigned                *sq_tail;
+        unsigned                *sq_mask;
+        unsigned                *sq_array;
+        unsigned                 sq_entries;
+        struct io_uring_sqe     *sqes;
+        unsigned                 pending;    /* queued, not yet entered */
+        int                      blocked;    /* until something is reaped */
+        unsigned                 inflight;   /* entered, not yet reaped */
+        pthread_t                submitter;
+        struct posix_uring_slot **unsent;    /* taken back after a failed
+                                                enter, submitter only */
+
+        /* completion side, only the completion thread */
+        unsigned                *cq_head;
+        unsigned                *cq_tail;
+        unsigned                *cq_mask;
+        unsigned                 cq_entries;
+        struct io_uring_cqe     *cqes;
+        pthread_t                thread;
+
+        void                    *sq_ring;
+        size_t                   sq_ring_size;
+        void                    *cq_ring;
+        size_t                   cq_ring_size;
+        size_t                   sqes_size;
+
+        int                      personality;
+        gf_boolean_t             has_statx;
+        gf_boolean_t             has_fallocate;
+        gf_boolean_t             has_fixed;
+
+        /* iobuf arenas the kernel has pinned, by buffer index */
+        pthread_mutex_t          buf_lock;
+        struct posix_uring_buf   bufs[POSIX_URING_MAX_BUFS];
+
+        uint64_t                 enter_calls;
+        uint64_t                 sqes_entered;
+        uint64_t                 fixed_ios;
+        uint64_t                 fallbacks;
+};
+#endif
+
+int posix_uring_on (xlator_t *this);
+int posix_uring_off (xlator_t *this);
+void posix_uring_fini (xlator_t *this);
+void posix_uring_priv_dump (xlator_t *this);
+
+int32_t posix_fsync (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                     int32_t datasync, dict_t *xdata);
+
+int32_t _posix_fallocate (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                          int32_t keep_size, off_t offset, size_t len,
+                          dict_t *xdata);
+
+int32_t posix_discard (call_frame_t *frame, xlator_t *this, fd_t *fd,
+                       off_t offset, size_t len, dict_t *xdata);
+
+#endif /* !_POSIX_URING_H */
@@ -815,7 +815,7 @@ out:
         return ret;
 }
 
-static int32_t
+int32_t
 _posix_fallocate(call_frame_t *frame, xlator_t *this, fd_t *fd, int32_t keep_size,
 		off_t offset, size_t len, dict_t *xdata)
 {
@@ -842,7 +842,7 @@ err:
 	return 0;
 }
 
-static int32_t
+int32_t
 posix_discard(call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
 	      size_t len, dict_t *xdata)
 {
@@ -891,6 +891,70 @@ err:
 
 }
 
+static int32_t
+posix_seek (call_frame_t *frame, xlator_t *this, fd_t *fd, off_t offset,
+            gf_seek_what_t what, dict_t *xdata)
+{
+#if defined(SEEK_DATA) && defined(SEEK_HOLE)
+        struct posix_fd *pfd       = NULL;
+        off_t            ret       = -1;
+        int              err       = EINVAL;
+        int              whence    = 0;
+
+        DECLARE_OLD_FS_ID_VAR;
+
+        SET_FS_ID (frame->root->uid, frame->root->gid);
+
+        VALIDATE_OR_GOTO (frame, out);
+        VALIDATE_OR_GOTO (this, out);
+        VALIDATE_OR_GOTO (fd, out);
+
+        switch (what) {
+        case GF_SEEK_DATA:
+                whence = SEEK_DATA;
+                break;
+        case GF_SEEK_HOLE:
+                whence = SEEK_HOLE;
+                break;
+        default:
+                err = ENOTSUP;
+                gf_log (this->name, GF_LOG_ERROR,
+                        "invalid seek what %d", what);
+                goto out;
+        }
+
+        if (posix_fd_ctx_get (fd, this, &pfd) < 0) {
+                gf_log (this->name, GF_LOG_DEBUG,
+                        "pfd is NULL from fd=%p", fd);
+                err = EBADF;
+                goto out;
+        }
+
+        ret = lseek (pfd->fd, offset, whence);
+        if (ret == -1) {
+                err = errno;
+                /* ENXIO is returned when there is no data past offset */
+                gf_log (this->name,
+                        (err == ENXIO) ? GF_LOG_DEBUG : GF_LOG_ERROR,
+                        "seek failed on fd %d offset %" PRId64 " %s",
+                        pfd->fd, offset, strerror (err));
+                goto out;
+        }
+        err = 0;
+
+out:
+        SET_TO_OLD_FS_ID ();
+
+        if (ret == -1)
+                STACK_UNWIND_STRICT (seek, frame, -1, err, 0, NULL);
+        else
+                STACK_UNWIND_STRICT (seek, frame, 0, 0, ret, NULL);
+#else
+        STACK_UNWIND_STRICT (seek, frame, -1, ENOTSUP, 0, NULL);
+#endif
+        return 0;
+}
+
 static int32_t
 posix_ipc (call_frame_t *frame, xlator_t *this, int32_t op, dict_t *xdata)
 {
@@ -5499,6 +5563,8 @@ posix_priv (xlator_t *this)
         gf_proc_dump_write("max_write","%d", priv->write_value);
         gf_proc_dump_write("nr_files","%ld", priv->nr_files);
 
+        posix_uring_priv_dump (this);
+
         return 0;
 }
 
@@ -5743,6 +5809,14 @@ reconfigure (xlator_t *this, dict_t *options)
 	else
 		posix_aio_off (this);
 
+	GF_OPTION_RECONF ("io-uring", priv->uring_configured,
+			  options, bool, out);
+
+	if (priv->uring_configured)
+		posix_uring_on (this);
+	else
+		posix_uring_off (this);
+
         GF_OPTION_RECONF ("update-link-count-parent", priv->update_pgfid_nlinks,
                           options, bool, out);
 
@@ -6177,6 +6251,20 @@ init (xlator_t *this)
 		}
 	}
 
+	GF_OPTION_INIT ("io-uring-depth", _private->uring_depth, uint32, out);
+	GF_OPTION_INIT ("io-uring", _private->uring_configured, bool, out);
+
+	if (_private->uring_configured) {
+		op_ret = posix_uring_on (this);
+
+		if (op_ret == -1) {
+			gf_log (this->name, GF_LOG_ERROR,
+				"Posix io_uring init failed");
+			ret = -1;
+			goto out;
+		}
+	}
+
         GF_OPTION_INIT ("node-uuid-pathinfo",
                         _private->node_uuid_pathinfo, bool, out);
         if (_private->node_uuid_pathinfo &&
@@ -6245,6 +6333,7 @@ fini (xlator_t *this)
         struct posix_private *priv = this->private;
         if (!priv)
                 return;
+        posix_uring_fini (this);
         this->private = NULL;
         /*unlock brick dir*/
         if (priv->mount_lock)
@@ -6304,6 +6393,7 @@ struct xlator_fops fops = {
 	.discard     = posix_discard,
         .zerofill    = posix_zerofill,
         .ipc         = posix_ipc,
+        .seek        = posix_seek,
 };
 
 struct xlator_cbks cbks = {
@@ -6337,6 +6427,23 @@ struct volume_options options[] = {
 	  .default_value = "off",
           .description = "Support for native Linux AIO"
 	},
+	{
+	  .key  = {"io-uring"},
+	  .type = GF_OPTION_TYPE_BOOL,
+	  .default_value = "off",
+          .description = "Submit reads, writes, fsyncs and fallocates "
+                         "through an io_uring, together with the fstat of "
+                         "the file before and after them"
+	},
+        {
+          .key = {"io-uring-depth"},
+          .type = GF_OPTION_TYPE_INT,
+          .min = POSIX_URING_MIN_DEPTH,
+          .max = POSIX_URING_MAX_DEPTH,
+          .default_value = "256",
+          .description = "Number of submission queue entries of the "
+                         "io_uring. Takes effect when the brick restarts."
+        },
         {
           .key = {"brick-uid"},
           .type = GF_OPTION_TYPE_INT,
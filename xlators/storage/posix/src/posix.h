@@ -50,6 +50,8 @@
 #include "posix-aio.h"
 #endif
 
+#include "posix-uring.h"
+
 #define VECTOR_SIZE 64 * 1024 /* vector size 64KB*/
 #define MAX_NO_VECT 1024
 
@@ -138,6 +140,14 @@ struct posix_private {
         pthread_t       aiothread;
 #endif
 
+	gf_boolean_t    uring_configured;
+	gf_boolean_t    uring_init_done;
+	gf_boolean_t    uring_capable;
+        uint32_t        uring_depth;
+#ifdef HAVE_IO_URING
+        struct posix_uring *uring;
+#endif
+
         /* node-uuid in pathinfo xattr */
         gf_boolean_t  node_uuid_pathinfo;
 
@@ -220,6 +230,7 @@ int posix_entry_create_xattr_set (xlator_t *this, const char *path,
 
 int posix_fd_ctx_get (fd_t *fd, xlator_t *this, struct posix_fd **pfd);
 void posix_fill_ino_from_gfid (xlator_t *this, struct iatt *buf);
+int posix_fill_gfid_fd (xlator_t *this, int fd, struct iatt *iatt);
 
 gf_boolean_t posix_special_xattr (char **pattern, char *key);
 
@@ -249,4 +260,11 @@ posix_get_objectsignature (char *, dict_t *);
 int32_t
 posix_fdget_objectsignature (int, dict_t *);
 
+dict_t *
+_fill_writev_xdata (fd_t *fd, dict_t *xdata, xlator_t *this, int is_append);
+
+int
+posix_batch_fsync (call_frame_t *frame, xlator_t *this,
+                   fd_t *fd, int datasync, dict_t *xdata);
+
 #endif /* _POSIX_H */